@@ -19,6 +19,8 @@
 
 #include <lib/support/StringSplitter.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <tracing/binary/binary_tracing.h>
+#include <tracing/histogram/histogram_backend.h>
 #include <tracing/json/json_tracing.h>
 #include <tracing/registry.h>
 
@@ -27,8 +29,13 @@
 #include <tracing/perfetto/simple_initialize.h> // nogncheck
 #endif
 
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+
 #include <memory>
 #include <string>
+#include <thread>
 
 namespace chip {
 namespace CommandLineApp {
@@ -47,6 +54,66 @@ bool StartsWith(CharSpan argument, const char * prefix)
     return argument.data_equal(CharSpan(prefix, prefix_len));
 }
 
+// Histogram snapshots are logged on SIGUSR1. The signal handler only writes to a pipe, as
+// logging is not async-signal-safe; a thread reading the pipe does the logging.
+constexpr char kDumpSnapshots = 'd';
+constexpr char kStopDumping   = 'q';
+
+int gSnapshotPipe[2] = { -1, -1 };
+std::thread gSnapshotThread;
+
+void OnSnapshotSignal(int)
+{
+    const int savedErrno = errno;
+    (void) !write(gSnapshotPipe[1], &kDumpSnapshots, 1);
+    errno = savedErrno;
+}
+
+void StartSnapshotDumpOnSignal(chip::Tracing::Histogram::HistogramBackend & backend)
+{
+    VerifyOrReturn(gSnapshotPipe[0] < 0);
+
+    if (pipe(gSnapshotPipe) != 0)
+    {
+        ChipLogError(AppServer, "Failed to create histogram snapshot pipe: %s", strerror(errno));
+        return;
+    }
+
+    gSnapshotThread = std::thread([&backend]() {
+        char command;
+        while (true)
+        {
+            ssize_t result = read(gSnapshotPipe[0], &command, 1);
+            if (result < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (result != 1 || command == kStopDumping)
+            {
+                break;
+            }
+            backend.LogSnapshots();
+        }
+    });
+
+    signal(SIGUSR1, OnSnapshotSignal);
+    ChipLogProgress(AppServer, "Latency histograms are logged on SIGUSR1 (kill -USR1 %d)", static_cast<int>(getpid()));
+}
+
+void StopSnapshotDumpOnSignal()
+{
+    VerifyOrReturn(gSnapshotPipe[0] >= 0);
+
+    signal(SIGUSR1, SIG_DFL);
+    (void) !write(gSnapshotPipe[1], &kStopDumping, 1);
+    gSnapshotThread.join();
+
+    close(gSnapshotPipe[0]);
+    close(gSnapshotPipe[1]);
+    gSnapshotPipe[0] = -1;
+    gSnapshotPipe[1] = -1;
+}
+
 } // namespace
 
 void TracingSetup::EnableTracingFor(const char * cliArg)
@@ -74,6 +141,23 @@ void TracingSetup::EnableTracingFor(const char * cliArg)
             }
             chip::Tracing::Register(mJsonBackend);
         }
+        else if (StartsWith(value, "binary:"))
+        {
+            std::string fileName(value.data() + 7, value.size() - 7);
+
+            CHIP_ERROR err = mBinaryBackend.OpenFile(fileName.c_str());
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(AppServer, "Failed to open binary trace output: %" CHIP_ERROR_FORMAT, err.Format());
+                continue;
+            }
+            chip::Tracing::Register(mBinaryBackend);
+        }
+        else if (value.data_equal(CharSpan::fromCharString("histogram")))
+        {
+            chip::Tracing::Register(mHistogramBackend);
+            StartSnapshotDumpOnSignal(mHistogramBackend);
+        }
 #if ENABLE_PERFETTO_TRACING
         else if (value.data_equal(CharSpan::fromCharString("perfetto")))
         {
@@ -113,6 +197,14 @@ void TracingSetup::StopTracing()
 #endif
 
     chip::Tracing::Unregister(mJsonBackend);
+    chip::Tracing::Unregister(mBinaryBackend);
+
+    if (mHistogramBackend.IsInList())
+    {
+        StopSnapshotDumpOnSignal();
+        mHistogramBackend.LogSnapshots();
+        chip::Tracing::Unregister(mHistogramBackend);
+    }
 }
 
 } // namespace CommandLineApp
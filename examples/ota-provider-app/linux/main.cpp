@@ -23,6 +23,7 @@
 #include <app/util/util.h>
 #include <json/json.h>
 #include <ota-provider-common/BdxOtaSender.h>
+#include <ota-provider-common/MappedBdxOtaSender.h>
 #include <ota-provider-common/OTAProviderExample.h>
 
 #include "AppMain.h"
@@ -44,9 +45,11 @@ using namespace chip::app::Clusters::OtaSoftwareUpdateProvider;
 constexpr chip::EndpointId kOtaProviderEndpoint = 0;
 
 constexpr uint16_t kOptionUpdateAction              = 'a';
+constexpr uint16_t kOptionMaxBlockSize              = 'b';
 constexpr uint16_t kOptionUserConsentNeeded         = 'c';
 constexpr uint16_t kOptionFilepath                  = 'f';
 constexpr uint16_t kOptionImageUri                  = 'i';
+constexpr uint16_t kOptionMaxTransfers              = 'm';
 constexpr uint16_t kOptionOtaImageList              = 'o';
 constexpr uint16_t kOptionDelayedApplyActionTimeSec = 'p';
 constexpr uint16_t kOptionQueryImageStatus          = 'q';
@@ -57,6 +60,7 @@ constexpr uint16_t kOptionIgnoreApplyUpdate         = 'y';
 constexpr uint16_t kOptionPollInterval              = 'P';
 
 OTAProviderExample gOtaProvider;
+MappedBdxOtaSender gMappedBdxOtaSender;
 chip::ota::DefaultOTAProviderUserConsent gUserConsentProvider;
 
 // Global variables used for passing the CLI arguments to the OTAProviderExample object
@@ -72,6 +76,8 @@ static bool gUserConsentNeeded                       = false;
 static uint32_t gIgnoreQueryImageCount               = 0;
 static uint32_t gIgnoreApplyUpdateCount              = 0;
 static uint32_t gPollInterval                        = 0;
+static uint32_t gMaxTransfers                        = 0;
+static uint16_t gMaxBlockSize                        = 0;
 
 // Parses the JSON filepath and extracts DeviceSoftwareVersionModel parameters
 static bool ParseJsonFileAndPopulateCandidates(const char * filepath,
@@ -245,6 +251,16 @@ bool HandleOptions(const char * aProgram, OptionSet * aOptions, int aIdentifier,
     case kOptionPollInterval:
         gPollInterval = static_cast<uint32_t>(strtoul(aValue, NULL, 0));
         break;
+    case kOptionMaxTransfers:
+        gMaxTransfers = static_cast<uint32_t>(strtoul(aValue, NULL, 0));
+        break;
+    case kOptionMaxBlockSize:
+        if (!chip::ArgParser::ParseInt(aValue, gMaxBlockSize) || gMaxBlockSize == 0)
+        {
+            PrintArgError("%s: ERROR: Invalid maxBlockSize parameter:  %s\n", aProgram, aValue);
+            retval = false;
+        }
+        break;
 
     default:
         PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
@@ -268,6 +284,8 @@ OptionDef cmdLineOptionsDef[] = {
     { "ignoreQueryImage", chip::ArgParser::kArgumentRequired, kOptionIgnoreQueryImage },
     { "ignoreApplyUpdate", chip::ArgParser::kArgumentRequired, kOptionIgnoreApplyUpdate },
     { "pollInterval", chip::ArgParser::kArgumentRequired, kOptionPollInterval },
+    { "maxTransfers", chip::ArgParser::kArgumentRequired, kOptionMaxTransfers },
+    { "maxBlockSize", chip::ArgParser::kArgumentRequired, kOptionMaxBlockSize },
     {},
 };
 
@@ -308,7 +326,13 @@ OptionSet cmdLineOptions = { HandleOptions, cmdLineOptionsDef, "PROGRAM OPTIONS"
                              "  -y, --ignoreApplyUpdate <ignore count>\n"
                              "        The number of times to ignore the ApplyUpdateRequest Command and not send a response.\n"
                              "  -P, --pollInterval <time in milliseconds>\n"
-                             "        Poll interval for the BDX transfer \n" };
+                             "        Poll interval for the BDX transfer \n"
+                             "  -m, --maxTransfers <count>\n"
+                             "        Serve the OTA image to up to <count> requestors at once, from a memory mapping\n"
+                             "        of the file. By default, only one BDX transfer can be in progress at a time.\n"
+                             "  -b, --maxBlockSize <bytes>\n"
+                             "        With --maxTransfers, the largest BDX block size to offer to requestors connected\n"
+                             "        over TCP. Requestors connected over MRP are offered at most 1024 bytes.\n" };
 
 OptionSet * allOptions[] = { &cmdLineOptions, nullptr };
 
@@ -316,14 +340,36 @@ void ApplicationInit()
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    BdxOtaSender * bdxOtaSender = gOtaProvider.GetBdxOtaSender();
-    VerifyOrReturn(bdxOtaSender != nullptr);
-    err = chip::Server::GetInstance().GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(chip::Protocols::BDX::Id,
-                                                                                                        bdxOtaSender);
-    if (err != CHIP_NO_ERROR)
+    if (gMaxTransfers != 0)
+    {
+        gMappedBdxOtaSender.SetMaxTransfers(gMaxTransfers);
+        if (gMaxBlockSize != 0)
+        {
+            gMappedBdxOtaSender.SetMaxBlockSize(gMaxBlockSize);
+        }
+        if (gPollInterval != 0)
+        {
+            gMappedBdxOtaSender.SetPollInterval(chip::System::Clock::Milliseconds32(gPollInterval));
+        }
+        err = gMappedBdxOtaSender.Init(&chip::DeviceLayer::SystemLayer(), &chip::Server::GetInstance().GetExchangeManager());
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(SoftwareUpdate, "MappedBdxOtaSender init failed: %s", chip::ErrorStr(err));
+            return;
+        }
+        gOtaProvider.SetMappedBdxOtaSender(&gMappedBdxOtaSender);
+    }
+    else
     {
-        ChipLogDetail(SoftwareUpdate, "RegisterUnsolicitedMessageHandler failed: %s", chip::ErrorStr(err));
-        return;
+        BdxOtaSender * bdxOtaSender = gOtaProvider.GetBdxOtaSender();
+        VerifyOrReturn(bdxOtaSender != nullptr);
+        err = chip::Server::GetInstance().GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(
+            chip::Protocols::BDX::Id, bdxOtaSender);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(SoftwareUpdate, "RegisterUnsolicitedMessageHandler failed: %s", chip::ErrorStr(err));
+            return;
+        }
     }
 
     ChipLogDetail(SoftwareUpdate, "Using OTA file: %s", gOtaFilepath ? gOtaFilepath : "(none)");
@@ -380,7 +426,10 @@ void ApplicationInit()
     chip::app::Clusters::OTAProvider::SetDelegate(kOtaProviderEndpoint, &gOtaProvider);
 }
 
-void ApplicationShutdown() {}
+void ApplicationShutdown()
+{
+    gMappedBdxOtaSender.Shutdown();
+}
 
 int main(int argc, char * argv[])
 {
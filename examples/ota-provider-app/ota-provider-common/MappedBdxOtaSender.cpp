@@ -0,0 +1,392 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/MappedBdxOtaSender.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/Flags.h>
+#include <protocols/bdx/BdxMessages.h>
+
+#include <algorithm>
+
+using chip::CharSpan;
+using chip::bdx::MessageType;
+using chip::bdx::StatusCode;
+using chip::bdx::TransferControlFlags;
+using chip::bdx::TransferRole;
+using chip::bdx::TransferSession;
+
+namespace {
+constexpr chip::System::Clock::Timeout kBdxTimeout = chip::System::Clock::Seconds16(5 * 60); // OTA Spec mandates >= 5 minutes
+} // namespace
+
+CHIP_ERROR MappedBdxOtaTransfer::OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                                   chip::System::PacketBufferHandle && payload)
+{
+    VerifyOrReturnError(ec != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    if (payloadHeader.HasMessageType(MessageType::ReceiveInit))
+    {
+        chip::BitFlags<TransferControlFlags> flags(TransferControlFlags::kReceiverDrive); // OTA must use receiver drive
+        ReturnErrorOnFailure(PrepareForTransfer(mSender.mSystemLayer, TransferRole::kSender, flags,
+                                                mSender.GetMaxBlockSize(ec->GetSessionHandle()), kBdxTimeout,
+                                                mSender.mPollInterval));
+    }
+
+    CHIP_ERROR err = TransferFacilitator::OnMessageReceived(ec, payloadHeader, std::move(payload));
+
+    // Answer right away instead of on the next poll, so that a download is not limited to one block per poll interval.
+    PollUntilIdle();
+    return err;
+}
+
+void MappedBdxOtaTransfer::PollUntilIdle()
+{
+    // TransferSession hands out one event per poll, and handling a message usually queues the reply as the next one.
+    do
+    {
+        VerifyOrReturn(mSystemLayer != nullptr);
+        mHadOutput = false;
+        PollForOutput();
+    } while (mHadOutput);
+}
+
+void MappedBdxOtaTransfer::HandleTransferSessionOutput(TransferSession::OutputEvent & event)
+{
+    mHadOutput = (event.EventType != TransferSession::OutputEventType::kNone);
+    VerifyOrReturn(mHadOutput);
+
+    ChipLogDetail(BDX, "OutputEvent type: %s", event.ToString(event.EventType));
+
+    switch (event.EventType)
+    {
+    case TransferSession::OutputEventType::kMsgToSend:
+        SendMessage(event);
+        break;
+    case TransferSession::OutputEventType::kInitReceived:
+        AcceptTransfer();
+        break;
+    case TransferSession::OutputEventType::kQueryReceived:
+        SendBlock(0);
+        break;
+    case TransferSession::OutputEventType::kQueryWithSkipReceived:
+        SendBlock(event.bytesToSkip.BytesToSkip);
+        break;
+    case TransferSession::OutputEventType::kAckReceived:
+        break;
+    case TransferSession::OutputEventType::kAckEOFReceived:
+        ChipLogDetail(BDX, "Transfer completed, got AckEOF");
+        Reset();
+        break;
+    case TransferSession::OutputEventType::kStatusReceived:
+        ChipLogError(BDX, "Got StatusReport %x", static_cast<uint16_t>(event.statusData.statusCode));
+        Reset();
+        break;
+    case TransferSession::OutputEventType::kInternalError:
+        ChipLogError(BDX, "InternalError");
+        Reset();
+        break;
+    case TransferSession::OutputEventType::kTransferTimeout:
+        ChipLogError(BDX, "Transfer timed out");
+        Reset();
+        break;
+    case TransferSession::OutputEventType::kAcceptReceived:
+    case TransferSession::OutputEventType::kBlockReceived:
+    default:
+        // TransferSession should prevent this case from happening.
+        ChipLogError(BDX, "Unsupported event type");
+    }
+}
+
+void MappedBdxOtaTransfer::SendMessage(TransferSession::OutputEvent & event)
+{
+    VerifyOrReturn(mExchangeCtx != nullptr);
+
+    // All messages sent from the Sender expect a response, except for a StatusReport which would indicate an error and the
+    // end of the transfer.
+    const bool isStatusReport = event.msgTypeData.HasMessageType(chip::Protocols::SecureChannel::MsgType::StatusReport);
+    const auto sendFlags      = chip::bdx::GetTransferMessageSendFlags(*mExchangeCtx, event.msgTypeData, !isStatusReport);
+
+    CHIP_ERROR err = mExchangeCtx->SendMessage(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType,
+                                               std::move(event.MsgData), sendFlags);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "SendMessage failed: %" CHIP_ERROR_FORMAT, err.Format());
+        Reset();
+    }
+    else if (isStatusReport)
+    {
+        // After sending the StatusReport, the exchange gets closed.
+        mExchangeCtx = nullptr;
+        Reset();
+    }
+}
+
+void MappedBdxOtaTransfer::AcceptTransfer()
+{
+    uint16_t fdl       = 0;
+    const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
+    const CharSpan fileDesignator(chip::Uint8::to_const_char(fd), fdl);
+
+    mImage = mSender.RetainImage(fileDesignator);
+    if (mImage == nullptr)
+    {
+        ChipLogError(BDX, "Unknown file designator: %.*s", static_cast<int>(fileDesignator.size()), fileDesignator.data());
+        mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+        return;
+    }
+
+    const uint64_t imageSize = mImage->Data().size();
+    const uint64_t offset    = mTransfer.GetStartOffset();
+    if (offset > imageSize)
+    {
+        mTransfer.AbortTransfer(StatusCode::kLengthTooShort);
+        return;
+    }
+
+    // The image size is known, so always tell the requestor how much data to expect.
+    uint64_t length = mTransfer.GetTransferLength();
+    if ((length == 0) || (length > imageSize - offset))
+    {
+        length = imageSize - offset;
+    }
+
+    // TransferSession has already settled on the smaller of the block size the requestor asked for and ours.
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kReceiverDrive;
+    acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
+    acceptData.StartOffset  = offset;
+    acceptData.Length       = length;
+
+    CHIP_ERROR err = mTransfer.AcceptTransfer(acceptData);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format());
+        mTransfer.AbortTransfer(StatusCode::kUnknown);
+        return;
+    }
+
+    mNextOffset = offset;
+    mEndOffset  = offset + length;
+    ChipLogProgress(BDX, "Sending %u bytes of %.*s in blocks of %u bytes", static_cast<unsigned>(length),
+                    static_cast<int>(fileDesignator.size()), fileDesignator.data(), acceptData.MaxBlockSize);
+}
+
+void MappedBdxOtaTransfer::SendBlock(uint64_t bytesToSkip)
+{
+    VerifyOrReturn(mImage != nullptr, mTransfer.AbortTransfer(StatusCode::kUnexpectedMessage));
+
+    mNextOffset += std::min(bytesToSkip, mEndOffset - mNextOffset);
+
+    // The block is encoded straight from the mapping into the outgoing message.
+    const size_t length = static_cast<size_t>(std::min<uint64_t>(mTransfer.GetTransferBlockSize(), mEndOffset - mNextOffset));
+    TransferSession::BlockData blockData;
+    blockData.Data   = mImage->Data().data() + mNextOffset;
+    blockData.Length = length;
+    blockData.IsEof  = (mNextOffset + length == mEndOffset);
+
+    CHIP_ERROR err = mTransfer.PrepareBlock(blockData);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
+        mTransfer.AbortTransfer(StatusCode::kUnknown);
+        return;
+    }
+    mNextOffset += length;
+}
+
+void MappedBdxOtaTransfer::Reset()
+{
+    ResetTransfer();
+
+    if (mExchangeCtx != nullptr)
+    {
+        mIsExchangeClosing = true;
+        mExchangeCtx->Close();
+        mIsExchangeClosing = false;
+        mExchangeCtx       = nullptr;
+    }
+
+    if (mImage != nullptr)
+    {
+        mImage->Release();
+        mImage = nullptr;
+    }
+}
+
+void MappedBdxOtaTransfer::OnExchangeClosing(chip::Messaging::ExchangeContext * ec)
+{
+    // TransferFacilitator may still be using this object, so it is only released once the current event is handled.
+    mIsClosed = true;
+    mSender.ScheduleReleaseClosedTransfers();
+
+    // If the exchange is being closed by someone else (e.g. because a StatusReport was received), make sure nothing uses
+    // it anymore.
+    VerifyOrReturn(!mIsExchangeClosing);
+    mExchangeCtx = nullptr;
+    Reset();
+}
+
+CHIP_ERROR MappedBdxOtaSender::Init(chip::System::Layer * systemLayer, chip::Messaging::ExchangeManager * exchangeMgr)
+{
+    VerifyOrReturnError(systemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(exchangeMgr != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mExchangeMgr == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    ReturnErrorOnFailure(exchangeMgr->RegisterUnsolicitedMessageHandlerForType(MessageType::ReceiveInit, this));
+    mSystemLayer = systemLayer;
+    mExchangeMgr = exchangeMgr;
+    return CHIP_NO_ERROR;
+}
+
+void MappedBdxOtaSender::Shutdown()
+{
+    VerifyOrReturn(mExchangeMgr != nullptr);
+
+    LogErrorOnFailure(mExchangeMgr->UnregisterUnsolicitedMessageHandlerForType(MessageType::ReceiveInit));
+
+    mSystemLayer->CancelTimer(ReleaseClosedTransfers, this);
+    mTransfers.ForEachActiveObject([](MappedBdxOtaTransfer * transfer) {
+        transfer->AbortTransfer();
+        return chip::Loop::Continue;
+    });
+    mTransfers.ReleaseAll();
+
+    for (auto & published : mImages)
+    {
+        published.image->Release();
+    }
+    mImages.clear();
+
+    mSystemLayer = nullptr;
+    mExchangeMgr = nullptr;
+}
+
+CHIP_ERROR MappedBdxOtaSender::PublishImage(CharSpan fileDesignator, const char * path)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Several designators may refer to the same file: they share its mapping, unless the file was replaced since.
+    MappedOtaImage * image = nullptr;
+    for (auto & published : mImages)
+    {
+        if (published.path == path && published.image->IsCurrent(path))
+        {
+            image = published.image;
+            break;
+        }
+    }
+
+    auto existing = std::find_if(mImages.begin(), mImages.end(), [&](const PublishedImage & published) {
+        return CharSpan(published.fileDesignator.data(), published.fileDesignator.size()).data_equal(fileDesignator);
+    });
+    if ((existing != mImages.end()) && (existing->image == image))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    if (image == nullptr)
+    {
+        ReturnErrorOnFailure(MappedOtaImage::Open(path, image));
+    }
+    else
+    {
+        image->Retain();
+    }
+
+    // Transfers that are already sending the previous image keep their own reference to it.
+    if (existing != mImages.end())
+    {
+        existing->image->Release();
+        existing->path  = path;
+        existing->image = image;
+    }
+    else
+    {
+        mImages.push_back({ std::string(fileDesignator.data(), fileDesignator.size()), path, image });
+    }
+    return CHIP_NO_ERROR;
+}
+
+MappedOtaImage * MappedBdxOtaSender::RetainImage(CharSpan fileDesignator)
+{
+    for (auto & published : mImages)
+    {
+        if (!CharSpan(published.fileDesignator.data(), published.fileDesignator.size()).data_equal(fileDesignator))
+        {
+            continue;
+        }
+
+        // If the file was replaced since it was published, map the new one. Should that fail (e.g. the file was
+        // removed), the old mapping is still valid and keeps being served.
+        if (!published.image->IsCurrent(published.path.c_str()))
+        {
+            const std::string path = published.path;
+            LogErrorOnFailure(PublishImage(fileDesignator, path.c_str()));
+        }
+        return published.image->Retain();
+    }
+    return nullptr;
+}
+
+uint16_t MappedBdxOtaSender::GetMaxBlockSize(const chip::SessionHandle & session) const
+{
+    return session->AllowsLargePayload() ? mMaxBlockSize : std::min(mMaxBlockSize, kDefaultMaxBlockSize);
+}
+
+CHIP_ERROR MappedBdxOtaSender::OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                                            chip::Messaging::ExchangeDelegate *& newDelegate)
+{
+    if (!HasCapacity())
+    {
+        ChipLogError(BDX, "Already serving %u transfers, rejecting a new one", static_cast<unsigned>(mTransfers.Allocated()));
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    MappedBdxOtaTransfer * transfer = mTransfers.CreateObject(*this);
+    VerifyOrReturnError(transfer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    newDelegate = transfer;
+    return CHIP_NO_ERROR;
+}
+
+void MappedBdxOtaSender::OnExchangeCreationFailed(chip::Messaging::ExchangeDelegate * delegate)
+{
+    mTransfers.ReleaseObject(static_cast<MappedBdxOtaTransfer *>(delegate));
+}
+
+void MappedBdxOtaSender::ScheduleReleaseClosedTransfers()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+    // Restarting the timer rather than scheduling work coalesces the releases, and lets Shutdown() cancel them.
+    LogErrorOnFailure(mSystemLayer->StartTimer(chip::System::Clock::kZero, ReleaseClosedTransfers, this));
+}
+
+void MappedBdxOtaSender::ReleaseClosedTransfers(chip::System::Layer * systemLayer, void * appState)
+{
+    auto * sender = static_cast<MappedBdxOtaSender *>(appState);
+    sender->mTransfers.ForEachActiveObject([sender](MappedBdxOtaTransfer * transfer) {
+        if (transfer->IsClosed())
+        {
+            sender->mTransfers.ReleaseObject(transfer);
+        }
+        return chip::Loop::Continue;
+    });
+}
@@ -0,0 +1,144 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Pool.h>
+#include <lib/support/Span.h>
+#include <messaging/ExchangeDelegate.h>
+#include <messaging/ExchangeMgr.h>
+#include <ota-provider-common/MappedOtaImage.h>
+#include <protocols/bdx/BdxTransferSession.h>
+#include <protocols/bdx/TransferFacilitator.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <transport/Session.h>
+
+#include <string>
+#include <vector>
+
+class MappedBdxOtaSender;
+
+/**
+ * One download of a MappedOtaImage, on its own exchange. Created by MappedBdxOtaSender for every ReceiveInit it gets.
+ */
+class MappedBdxOtaTransfer : public chip::bdx::Responder
+{
+public:
+    MappedBdxOtaTransfer(MappedBdxOtaSender & sender) : mSender(sender) {}
+    ~MappedBdxOtaTransfer() override { Reset(); }
+
+    void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
+
+    void OnExchangeClosing(chip::Messaging::ExchangeContext * ec) override;
+
+    /// Ends the transfer without notifying the requestor.
+    void AbortTransfer() { Reset(); }
+
+    bool IsClosed() const { return mIsClosed; }
+
+protected:
+    CHIP_ERROR OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                 chip::System::PacketBufferHandle && payload) override;
+
+private:
+    void SendMessage(chip::bdx::TransferSession::OutputEvent & event);
+    void AcceptTransfer();
+    void SendBlock(uint64_t bytesToSkip);
+    void Reset();
+    void PollUntilIdle();
+
+    MappedBdxOtaSender & mSender;
+
+    // The image being sent, and the range of it still to send.
+    MappedOtaImage * mImage = nullptr;
+    uint64_t mNextOffset    = 0;
+    uint64_t mEndOffset     = 0;
+
+    bool mHadOutput         = false;
+    bool mIsExchangeClosing = false;
+    bool mIsClosed          = false;
+};
+
+/**
+ * Serves OTA images to any number of requestors at once.
+ *
+ * Unlike BdxOtaSender, which handles a single transfer and reads every block from the image file, this creates a
+ * MappedBdxOtaTransfer for every incoming ReceiveInit, each with the block size negotiated with its requestor, and serves
+ * the blocks of all of them from a single memory mapping of each published image.
+ */
+class MappedBdxOtaSender : public chip::Messaging::UnsolicitedMessageHandler
+{
+public:
+    /// The block size the provider has always offered, which fits in an MRP message.
+    static constexpr uint16_t kDefaultMaxBlockSize = 1024;
+    /// Also the most transfers there can be when object pools are not heap-allocated.
+    static constexpr size_t kDefaultMaxTransfers = 16;
+
+    ~MappedBdxOtaSender() { Shutdown(); }
+
+    CHIP_ERROR Init(chip::System::Layer * systemLayer, chip::Messaging::ExchangeManager * exchangeMgr);
+    void Shutdown();
+
+    /**
+     * Serves the image at `path` to requestors that ask for `fileDesignator`. The image is mapped the first time it is
+     * published; publishing it again (e.g. on every QueryImage) reuses the mapping, unless the file has changed since.
+     * Images must be replaced by rename, see MappedOtaImage.
+     */
+    CHIP_ERROR PublishImage(chip::CharSpan fileDesignator, const char * path);
+
+    /// Largest block size offered to requestors whose session can carry large payloads (i.e. TCP). Over MRP, blocks
+    /// never exceed kDefaultMaxBlockSize.
+    void SetMaxBlockSize(uint16_t maxBlockSize) { mMaxBlockSize = maxBlockSize; }
+    void SetMaxTransfers(size_t maxTransfers) { mMaxTransfers = maxTransfers; }
+    void SetPollInterval(chip::System::Clock::Timeout pollInterval) { mPollInterval = pollInterval; }
+
+    bool HasCapacity() const { return mTransfers.Allocated() < mMaxTransfers; }
+    size_t GetActiveTransferCount() const { return mTransfers.Allocated(); }
+
+private:
+    friend class MappedBdxOtaTransfer;
+
+    struct PublishedImage
+    {
+        std::string fileDesignator;
+        std::string path;
+        MappedOtaImage * image;
+    };
+
+    CHIP_ERROR OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                            chip::Messaging::ExchangeDelegate *& newDelegate) override;
+    void OnExchangeCreationFailed(chip::Messaging::ExchangeDelegate * delegate) override;
+
+    /// Returns a new reference to the image published as `fileDesignator`, or nullptr if there is none.
+    MappedOtaImage * RetainImage(chip::CharSpan fileDesignator);
+    uint16_t GetMaxBlockSize(const chip::SessionHandle & session) const;
+
+    /// Transfers cannot be released from within their own callbacks, so closed ones are released from here.
+    void ScheduleReleaseClosedTransfers();
+    static void ReleaseClosedTransfers(chip::System::Layer * systemLayer, void * appState);
+
+    chip::System::Layer * mSystemLayer              = nullptr;
+    chip::Messaging::ExchangeManager * mExchangeMgr = nullptr;
+    uint16_t mMaxBlockSize                          = kDefaultMaxBlockSize;
+    size_t mMaxTransfers                            = kDefaultMaxTransfers;
+    chip::System::Clock::Timeout mPollInterval      = chip::System::Clock::Milliseconds32(50);
+    std::vector<PublishedImage> mImages;
+    chip::ObjectPool<MappedBdxOtaTransfer, kDefaultMaxTransfers> mTransfers;
+};
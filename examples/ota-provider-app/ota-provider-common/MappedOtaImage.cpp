@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/MappedOtaImage.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+CHIP_ERROR MappedOtaImage::Open(const char * path, MappedOtaImage *& image)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        ChipLogError(BDX, "Cannot open OTA image %s: %" CHIP_ERROR_FORMAT, path, err.Format());
+        return err;
+    }
+
+    struct stat info;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    void * data    = MAP_FAILED;
+    if (fstat(fd, &info) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    else if (info.st_size <= 0)
+    {
+        // mmap() cannot map an empty file, and an empty file is not an OTA image anyway.
+        err = CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+    }
+    else
+    {
+        // A private mapping: the image is never written through it, and nothing else needs to see its pages.
+        data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            err = CHIP_ERROR_POSIX(errno);
+        }
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "Cannot map OTA image %s: %" CHIP_ERROR_FORMAT, path, err.Format());
+        return err;
+    }
+
+    // Transfers read the image front to back, so ask for aggressive read-ahead.
+    madvise(data, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+
+    image = chip::Platform::New<MappedOtaImage>(static_cast<const uint8_t *>(data), static_cast<size_t>(info.st_size), info);
+    if (image == nullptr)
+    {
+        munmap(data, static_cast<size_t>(info.st_size));
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    ChipLogProgress(BDX, "Mapped OTA image %s (%u bytes)", path, static_cast<unsigned>(info.st_size));
+    return CHIP_NO_ERROR;
+}
+
+bool MappedOtaImage::IsCurrent(const char * path) const
+{
+    struct stat info;
+    VerifyOrReturnValue(stat(path, &info) == 0, false);
+
+    return info.st_dev == mFileInfo.st_dev && info.st_ino == mFileInfo.st_ino && info.st_size == mFileInfo.st_size &&
+        info.st_mtim.tv_sec == mFileInfo.st_mtim.tv_sec && info.st_mtim.tv_nsec == mFileInfo.st_mtim.tv_nsec;
+}
+
+MappedOtaImage::~MappedOtaImage()
+{
+    munmap(const_cast<uint8_t *>(mData), mSize);
+}
@@ -0,0 +1,61 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/ReferenceCounted.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <sys/stat.h>
+
+/**
+ * A read-only memory mapping of an OTA image file.
+ *
+ * An image is mapped once and shared, through reference counting, by every transfer that serves it. Blocks are sent
+ * straight out of the mapping, so concurrent downloads of the same image are served from the page cache instead of
+ * each transfer reading the file.
+ *
+ * Images must be replaced by renaming a new file over the old one: transfers in progress then keep reading the old
+ * file, and IsCurrent() tells that new transfers need a new mapping. Rewriting or truncating the file in place while
+ * it is mapped is not supported: transfers in progress may read the new bytes, or crash with SIGBUS on a truncation.
+ */
+class MappedOtaImage : public chip::ReferenceCounted<MappedOtaImage>
+{
+public:
+    /**
+     * Maps the file at `path`. On success, `image` holds the only reference to the new mapping.
+     */
+    static CHIP_ERROR Open(const char * path, MappedOtaImage *& image);
+
+    MappedOtaImage(const uint8_t * data, size_t size, const struct stat & info) : mData(data), mSize(size), mFileInfo(info) {}
+    ~MappedOtaImage();
+
+    chip::ByteSpan Data() const { return chip::ByteSpan(mData, mSize); }
+
+    /**
+     * Returns whether the file at `path` is still the one that was mapped, with the same size and modification time.
+     */
+    bool IsCurrent(const char * path) const;
+
+private:
+    const uint8_t * mData;
+    size_t mSize;
+    struct stat mFileInfo;
+};
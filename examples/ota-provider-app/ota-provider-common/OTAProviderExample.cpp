@@ -227,6 +227,15 @@ bool OTAProviderExample::ParseOTAHeader(OTAImageHeaderParser & parser, const cha
     return true;
 }
 
+CHIP_ERROR OTAProviderExample::PublishMappedImage()
+{
+    // Requestors ask for the file designator of the ImageURI, which need not be the path of the image.
+    NodeId nodeId;
+    CharSpan fileDesignator;
+    ReturnErrorOnFailure(chip::bdx::ParseURI(CharSpan::fromCharString(mImageUri), nodeId, fileDesignator));
+    return mMappedBdxOtaSender->PublishImage(fileDesignator, mOTAFilePath);
+}
+
 void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj, const app::ConcreteCommandPath & commandPath,
                                                 const QueryImage::DecodableType & commandData)
 {
@@ -236,6 +245,7 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
     bool requestorCanConsent             = commandData.requestorCanConsent.ValueOr(false);
     uint8_t updateToken[kUpdateTokenLen] = { 0 };
     char strBuf[kUpdateTokenStrLen]      = { 0 };
+    bool atCapacity                      = false;
 
     // Set fields specific for an available status response
     if (mQueryImageStatus == OTAQueryStatus::kUpdateAvailable)
@@ -270,8 +280,22 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
         // Initialize the transfer session in prepartion for a BDX transfer
         BitFlags<TransferControlFlags> bdxFlags;
         bdxFlags.Set(TransferControlFlags::kReceiverDrive);
-        if (mBdxOtaSender.InitializeTransfer(commandObj->GetSubjectDescriptor().fabricIndex,
-                                             commandObj->GetSubjectDescriptor().subject) == CHIP_NO_ERROR)
+        bool transferReady = false;
+        if (mMappedBdxOtaSender != nullptr)
+        {
+            // Every requestor gets a transfer of its own, so this is only busy once the sender is at capacity.
+            CHIP_ERROR error = PublishMappedImage();
+            if (error != CHIP_NO_ERROR)
+            {
+                ChipLogError(SoftwareUpdate, "Cannot publish OTA image: %" CHIP_ERROR_FORMAT, error.Format());
+                commandObj->AddStatus(commandPath, Status::Failure);
+                return;
+            }
+            transferReady = mMappedBdxOtaSender->HasCapacity();
+            atCapacity    = !transferReady;
+        }
+        else if (mBdxOtaSender.InitializeTransfer(commandObj->GetSubjectDescriptor().fabricIndex,
+                                                  commandObj->GetSubjectDescriptor().subject) == CHIP_NO_ERROR)
         {
             CHIP_ERROR error =
                 mBdxOtaSender.PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
@@ -282,27 +306,33 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
                 commandObj->AddStatus(commandPath, Status::Failure);
                 return;
             }
-
-            response.imageURI.Emplace(chip::CharSpan::fromCharString(mImageUri));
-            response.softwareVersion.Emplace(mSoftwareVersion);
-            response.softwareVersionString.Emplace(chip::CharSpan::fromCharString(mSoftwareVersionString));
-            response.updateToken.Emplace(chip::ByteSpan(updateToken));
+            transferReady = true;
         }
         else
         {
             // Another BDX transfer in progress
             mQueryImageStatus = OTAQueryStatus::kBusy;
         }
+
+        if (transferReady)
+        {
+            response.imageURI.Emplace(chip::CharSpan::fromCharString(mImageUri));
+            response.softwareVersion.Emplace(mSoftwareVersion);
+            response.softwareVersionString.Emplace(chip::CharSpan::fromCharString(mSoftwareVersionString));
+            response.updateToken.Emplace(chip::ByteSpan(updateToken));
+        }
     }
 
+    const OTAQueryStatus queryImageStatus = atCapacity ? OTAQueryStatus::kBusy : mQueryImageStatus;
+
     // Delay action time is only applicable when the provider is busy
-    if (mQueryImageStatus == OTAQueryStatus::kBusy)
+    if (queryImageStatus == OTAQueryStatus::kBusy)
     {
         response.delayedActionTime.Emplace(mDelayedQueryActionTimeSec);
     }
 
     // Set remaining fields common to all status types
-    response.status = mQueryImageStatus;
+    response.status = queryImageStatus;
     if (mUserConsentNeeded && requestorCanConsent)
     {
         response.userConsentNeeded.Emplace(true);
@@ -24,6 +24,7 @@
 #include <app/clusters/ota-provider/ota-provider-delegate.h>
 #include <lib/core/OTAImageHeader.h>
 #include <ota-provider-common/BdxOtaSender.h>
+#include <ota-provider-common/MappedBdxOtaSender.h>
 #include <vector>
 
 /**
@@ -70,6 +71,8 @@ public:
     void SetOTAFilePath(const char * path);
     void SetImageUri(const char * imageUri);
     BdxOtaSender * GetBdxOtaSender() { return &mBdxOtaSender; }
+    /// Serve images through `sender`, to many requestors at once, instead of through the single-transfer BdxOtaSender.
+    void SetMappedBdxOtaSender(MappedBdxOtaSender * sender) { mMappedBdxOtaSender = sender; }
 
     void SetOTACandidates(std::vector<OTAProviderExample::DeviceSoftwareVersionModel> candidates);
     void SetIgnoreQueryImageCount(uint32_t count) { mIgnoreQueryImageCount = count; }
@@ -101,6 +104,11 @@ private:
 
     bool ParseOTAHeader(chip::OTAImageHeaderParser & parser, const char * otaFilePath, chip::OTAImageHeader & header);
 
+    /**
+     * Makes the image to send available to mMappedBdxOtaSender, under the file designator of the ImageURI.
+     */
+    CHIP_ERROR PublishMappedImage();
+
     /**
      * Called to send the response for a QueryImage command. If an error is encountered, an error status will be sent.
      */
@@ -109,6 +117,7 @@ private:
                            const chip::app::Clusters::OtaSoftwareUpdateProvider::Commands::QueryImage::DecodableType & commandData);
 
     BdxOtaSender mBdxOtaSender;
+    MappedBdxOtaSender * mMappedBdxOtaSender = nullptr;
     std::vector<DeviceSoftwareVersionModel> mCandidates;
     char mOTAFilePath[kFilepathBufLen]; // null-terminated
     char mImageUri[kUriMaxLen];
@@ -68,6 +68,9 @@
 
 #if ENABLE_TRACING
 #include <TracingCommandLineArgument.h> // nogncheck
+#if defined(ENABLE_CHIP_SHELL)
+#include <tracing/histogram/histogram_shell_commands.h> // nogncheck
+#endif
 #endif
 
 #if CHIP_DEVICE_CONFIG_ENABLE_SOFTWARE_DIAGNOSTIC_TRIGGER
@@ -571,9 +574,21 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     }
 #endif // CHIP_CONFIG_TERMS_AND_CONDITIONS_REQUIRED
 
+#if ENABLE_TRACING
+    chip::CommandLineApp::TracingSetup tracing_setup;
+
+    for (const auto & trace_destination : LinuxDeviceOptions::GetInstance().traceTo)
+    {
+        tracing_setup.EnableTracingFor(trace_destination.c_str());
+    }
+#endif
+
 #if defined(ENABLE_CHIP_SHELL)
     Engine::Root().Init();
     Shell::RegisterCommissioneeCommands();
+#if ENABLE_TRACING
+    Tracing::Histogram::RegisterShellCommands(tracing_setup.GetHistogramBackend());
+#endif
     std::thread shellThread([]() {
         sigset_t set;
         sigemptyset(&set);
@@ -595,15 +610,6 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     initParams.userDirectedCommissioningPort = LinuxDeviceOptions::GetInstance().unsecuredCommissionerPort;
 #endif // CHIP_DEVICE_CONFIG_ENABLE_BOTH_COMMISSIONER_AND_COMMISSIONEE
 
-#if ENABLE_TRACING
-    chip::CommandLineApp::TracingSetup tracing_setup;
-
-    for (const auto & trace_destination : LinuxDeviceOptions::GetInstance().traceTo)
-    {
-        tracing_setup.EnableTracingFor(trace_destination.c_str());
-    }
-#endif
-
     initParams.interfaceId = LinuxDeviceOptions::GetInstance().interfaceId;
 
     if (LinuxDeviceOptions::GetInstance().mCSRResponseOptions.csrExistingKeyPair)
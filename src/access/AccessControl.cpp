@@ -24,6 +24,10 @@
 #include "AccessControl.h"
 
 #include <lib/core/Global.h>
+#include <lib/support/TypeTraits.h>
+
+#include <algorithm>
+#include <tuple>
 
 namespace chip {
 namespace Access {
@@ -70,6 +74,21 @@ bool CheckRequestPrivilegeAgainstEntryPrivilege(Privilege requestPrivilege, Priv
     return false;
 }
 
+// Bits of the request privileges that are granted by an entry privilege
+uint8_t GetGrantedPrivileges(Privilege entryPrivilege)
+{
+    uint8_t granted = 0;
+    for (auto privilege :
+         { Privilege::kView, Privilege::kProxyView, Privilege::kOperate, Privilege::kManage, Privilege::kAdminister })
+    {
+        if (CheckRequestPrivilegeAgainstEntryPrivilege(privilege, entryPrivilege))
+        {
+            granted = static_cast<uint8_t>(granted | to_underlying(privilege));
+        }
+    }
+    return granted;
+}
+
 constexpr bool IsValidCaseNodeId(NodeId aNodeId)
 {
     if (IsOperationalNodeId(aNodeId))
@@ -209,6 +228,8 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+        mCompiledIndex.Reset();
+        AddEntryListener(mCompiledIndex);
     }
 
     return retval;
@@ -220,6 +241,8 @@ void AccessControl::Finish()
     ChipLogProgress(DataManagement, "AccessControl: finishing");
     mDelegate->Finish();
     mDelegate = nullptr;
+    RemoveEntryListener(mCompiledIndex);
+    mCompiledIndex.Reset();
 }
 
 CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t * index,
@@ -400,6 +423,31 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         return CHIP_NO_ERROR;
     }
 
+    bool allowed = false;
+    if (!mCompiledIndex.Check(*this, subjectDescriptor, requestPath, requestPrivilege, allowed))
+    {
+        ReturnErrorOnFailure(CheckEntries(subjectDescriptor, requestPath, requestPrivilege, allowed));
+    }
+
+    if (allowed)
+    {
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+        ChipLogProgress(DataManagement, "AccessControl: allowed");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+
+        return CHIP_NO_ERROR;
+    }
+
+    // No entry was found which passed all checks: access is denied.
+    ChipLogProgress(DataManagement, "AccessControl: denied");
+    return CHIP_ERROR_ACCESS_DENIED;
+}
+
+CHIP_ERROR AccessControl::CheckEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                       Privilege requestPrivilege, bool & allowed)
+{
+    allowed = false;
+
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -501,17 +549,324 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
             }
         }
         // Entry passed all checks: access is allowed.
+        allowed = true;
+        return CHIP_NO_ERROR;
+    }
 
-#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
-        ChipLogProgress(DataManagement, "AccessControl: allowed");
-#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+    return CHIP_NO_ERROR;
+}
 
-        return CHIP_NO_ERROR;
+void AccessControl::CompiledIndex::Reset()
+{
+    mGrants.Free();
+    mGrantCount = 0;
+    mState      = State::kStale;
+    InvalidateDeviceTypeCache();
+}
+
+void AccessControl::CompiledIndex::InvalidateDeviceTypeCache()
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DEVICE_TYPE_CACHE_SIZE > 0
+    for (auto & cached : mDeviceTypeCache)
+    {
+        cached = DeviceTypeCacheEntry();
     }
+#endif
+}
 
-    // No entry was found which passed all checks: access is denied.
-    ChipLogProgress(DataManagement, "AccessControl: denied");
-    return CHIP_ERROR_ACCESS_DENIED;
+bool AccessControl::CompiledIndex::Check(AccessControl & accessControl, const SubjectDescriptor & subjectDescriptor,
+                                         const RequestPath & requestPath, Privilege requestPrivilege, bool & allowed)
+{
+    if (mState == State::kStale)
+    {
+        CHIP_ERROR err = Compile(accessControl);
+        if (err == CHIP_NO_ERROR)
+        {
+            mState = State::kReady;
+        }
+        else
+        {
+            ChipLogError(DataManagement, "AccessControl: failed to compile entries: %" CHIP_ERROR_FORMAT, err.Format());
+            mGrants.Free();
+            mGrantCount = 0;
+            // Malformed entries won't compile until they change, other failures (e.g. out of memory) may be transient.
+            mState = (err == CHIP_ERROR_INCORRECT_STATE) ? State::kUnavailable : State::kStale;
+        }
+    }
+    VerifyOrReturnValue(mState == State::kReady, false);
+
+    const uint8_t privilege = to_underlying(requestPrivilege);
+
+    Grant key;
+    key.fabricIndex = subjectDescriptor.fabricIndex;
+    key.authMode    = subjectDescriptor.authMode;
+
+    // Entries without subjects
+    key.subjectType = SubjectType::kAny;
+    key.subject     = 0;
+    allowed         = IsGranted(accessControl, key, 0, requestPath, privilege);
+
+    // Entries with the subject's node or group ID
+    key.subjectType = SubjectType::kNode;
+    key.subject     = subjectDescriptor.subject;
+    allowed         = allowed || IsGranted(accessControl, key, 0, requestPath, privilege);
+
+    // Entries with one of the subject's CASE Authenticated Tags, at the same or a lower version
+    if (subjectDescriptor.authMode == AuthMode::kCase)
+    {
+        key.subjectType = SubjectType::kCASEAuthTag;
+        for (auto cat : subjectDescriptor.cats.values)
+        {
+            if (!allowed && cat != kUndefinedCAT)
+            {
+                key.subject = GetCASEAuthTagIdentifier(cat);
+                allowed     = IsGranted(accessControl, key, GetCASEAuthTagVersion(cat), requestPath, privilege);
+            }
+        }
+    }
+
+    return true;
+}
+
+CHIP_ERROR AccessControl::CompiledIndex::Compile(const AccessControl & accessControl)
+{
+    mGrants.Free();
+    mGrantCount = 0;
+
+    // The first pass counts the grants, so the table can be allocated at once, the second one fills it.
+    size_t capacity = 0;
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        if (pass == 1)
+        {
+            capacity = mGrantCount;
+            VerifyOrReturnError(capacity == 0 || mGrants.Calloc(capacity), CHIP_ERROR_NO_MEMORY);
+            mGrantCount = 0;
+        }
+
+        EntryIterator iterator;
+        ReturnErrorOnFailure(accessControl.Entries(iterator));
+
+        Entry entry;
+        CHIP_ERROR err;
+        while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(AddGrants(entry, mGrants.Get(), capacity, mGrantCount));
+        }
+        VerifyOrReturnError(err == CHIP_ERROR_SENTINEL, err);
+    }
+
+    auto compare = [](const Grant & a, const Grant & b) {
+        return std::tie(a.fabricIndex, a.authMode, a.subjectType, a.subject, a.targetType, a.endpoint, a.cluster, a.deviceType,
+                        a.catVersion) < std::tie(b.fabricIndex, b.authMode, b.subjectType, b.subject, b.targetType, b.endpoint,
+                                                 b.cluster, b.deviceType, b.catVersion);
+    };
+    Grant * grants = mGrants.Get();
+    std::sort(grants, grants + mGrantCount, compare);
+
+    // Merge the privileges of grants to the same subject over the same target
+    size_t merged = 0;
+    for (size_t i = 0; i < mGrantCount; ++i)
+    {
+        if (merged > 0 && !compare(grants[merged - 1], grants[i]))
+        {
+            grants[merged - 1].privileges = static_cast<uint8_t>(grants[merged - 1].privileges | grants[i].privileges);
+            continue;
+        }
+        grants[merged++] = grants[i];
+    }
+    mGrantCount = merged;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AccessControl::CompiledIndex::AddGrants(const Entry & entry, Grant * grants, size_t capacity, size_t & count)
+{
+    Grant grant;
+    Privilege privilege = Privilege::kView;
+    ReturnErrorOnFailure(entry.GetFabricIndex(grant.fabricIndex));
+    ReturnErrorOnFailure(entry.GetAuthMode(grant.authMode));
+    ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+    // Operational PASE not supported for v1.0.
+    VerifyOrReturnError(grant.authMode == AuthMode::kCase || grant.authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+    grant.privileges = GetGrantedPrivileges(privilege);
+
+    size_t subjectCount = 0;
+    size_t targetCount  = 0;
+    ReturnErrorOnFailure(entry.GetSubjectCount(subjectCount));
+    ReturnErrorOnFailure(entry.GetTargetCount(targetCount));
+
+    // An entry without subjects (or targets) grants its privilege to any subject (or over any target).
+    for (size_t i = 0; i < std::max<size_t>(subjectCount, 1); ++i)
+    {
+        if (subjectCount > 0)
+        {
+            NodeId subject = kUndefinedNodeId;
+            ReturnErrorOnFailure(entry.GetSubject(i, subject));
+            if (IsOperationalNodeId(subject))
+            {
+                VerifyOrReturnError(grant.authMode == AuthMode::kCase, CHIP_ERROR_INCORRECT_STATE);
+                grant.subjectType = SubjectType::kNode;
+                grant.subject     = subject;
+                grant.catVersion  = 0;
+            }
+            else if (IsCASEAuthTag(subject))
+            {
+                VerifyOrReturnError(grant.authMode == AuthMode::kCase, CHIP_ERROR_INCORRECT_STATE);
+                CASEAuthTag cat = CASEAuthTagFromNodeId(subject);
+                if (GetCASEAuthTagVersion(cat) == 0)
+                {
+                    // Never matches any subject
+                    continue;
+                }
+                grant.subjectType = SubjectType::kCASEAuthTag;
+                grant.subject     = GetCASEAuthTagIdentifier(cat);
+                grant.catVersion  = GetCASEAuthTagVersion(cat);
+            }
+            else if (IsGroupId(subject))
+            {
+                VerifyOrReturnError(grant.authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+                grant.subjectType = SubjectType::kNode;
+                grant.subject     = subject;
+                grant.catVersion  = 0;
+            }
+            else
+            {
+                // Operational PASE not supported for v1.0.
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+        }
+
+        for (size_t j = 0; j < std::max<size_t>(targetCount, 1); ++j)
+        {
+            grant.targetType = TargetType::kAny;
+            grant.endpoint   = 0;
+            grant.cluster    = 0;
+            grant.deviceType = 0;
+            if (targetCount > 0)
+            {
+                Entry::Target target;
+                ReturnErrorOnFailure(entry.GetTarget(j, target));
+                switch (target.flags & (Entry::Target::kCluster | Entry::Target::kEndpoint | Entry::Target::kDeviceType))
+                {
+                case 0:
+                    break;
+                case Entry::Target::kCluster:
+                    grant.targetType = TargetType::kCluster;
+                    grant.cluster    = target.cluster;
+                    break;
+                case Entry::Target::kEndpoint:
+                    grant.targetType = TargetType::kEndpoint;
+                    grant.endpoint   = target.endpoint;
+                    break;
+                case Entry::Target::kCluster | Entry::Target::kEndpoint:
+                    grant.targetType = TargetType::kEndpointCluster;
+                    grant.endpoint   = target.endpoint;
+                    grant.cluster    = target.cluster;
+                    break;
+                case Entry::Target::kDeviceType:
+                    grant.targetType = TargetType::kDeviceType;
+                    grant.deviceType = target.deviceType;
+                    break;
+                case Entry::Target::kCluster | Entry::Target::kDeviceType:
+                    grant.targetType = TargetType::kDeviceTypeCluster;
+                    grant.cluster    = target.cluster;
+                    grant.deviceType = target.deviceType;
+                    break;
+                default:
+                    // Endpoint and device type are mutually exclusive.
+                    return CHIP_ERROR_INCORRECT_STATE;
+                }
+            }
+
+            if (grants != nullptr)
+            {
+                VerifyOrReturnError(count < capacity, CHIP_ERROR_INCORRECT_STATE);
+                grants[count] = grant;
+            }
+            ++count;
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool AccessControl::CompiledIndex::IsGranted(AccessControl & accessControl, Grant key, uint16_t catVersion,
+                                             const RequestPath & requestPath, uint8_t requestPrivilege)
+{
+    // Grants are sorted by their key, then by device type and CASE Authenticated Tag version.
+    auto compare = [](const Grant & a, const Grant & b) {
+        return std::tie(a.fabricIndex, a.authMode, a.subjectType, a.subject, a.targetType, a.endpoint, a.cluster) <
+            std::tie(b.fabricIndex, b.authMode, b.subjectType, b.subject, b.targetType, b.endpoint, b.cluster);
+    };
+
+    const struct
+    {
+        TargetType type;
+        EndpointId endpoint;
+        ClusterId cluster;
+    } targets[] = {
+        { TargetType::kAny, 0, 0 },
+        { TargetType::kCluster, 0, requestPath.cluster },
+        { TargetType::kEndpoint, requestPath.endpoint, 0 },
+        { TargetType::kEndpointCluster, requestPath.endpoint, requestPath.cluster },
+        { TargetType::kDeviceType, 0, 0 },
+        { TargetType::kDeviceTypeCluster, 0, requestPath.cluster },
+    };
+
+    const Grant * grants = mGrants.Get();
+    for (const auto & target : targets)
+    {
+        key.targetType = target.type;
+        key.endpoint   = target.endpoint;
+        key.cluster    = target.cluster;
+
+        auto range = std::equal_range(grants, grants + mGrantCount, key, compare);
+        for (const Grant * grant = range.first; grant != range.second; ++grant)
+        {
+            if ((grant->privileges & requestPrivilege) == 0 || grant->catVersion > catVersion)
+            {
+                continue;
+            }
+            if ((target.type == TargetType::kDeviceType || target.type == TargetType::kDeviceTypeCluster) &&
+                !IsDeviceTypeOnEndpoint(*accessControl.mDeviceTypeResolver, grant->deviceType, requestPath.endpoint))
+            {
+                continue;
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool AccessControl::CompiledIndex::IsDeviceTypeOnEndpoint(DeviceTypeResolver & resolver, DeviceTypeId deviceType,
+                                                          EndpointId endpoint)
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DEVICE_TYPE_CACHE_SIZE > 0
+    // Resolutions from another source (e.g. a replaced data model provider) no longer apply
+    const void * source = resolver.GetDeviceTypeSource();
+    if (source != mDeviceTypeCacheSource)
+    {
+        InvalidateDeviceTypeCache();
+        mDeviceTypeCacheSource = source;
+    }
+
+    // kInvalidEndpointId marks unused cache entries
+    if (endpoint != kInvalidEndpointId)
+    {
+        const size_t slot = (static_cast<size_t>(deviceType) * 31u + endpoint) % CHIP_CONFIG_ACCESS_CONTROL_DEVICE_TYPE_CACHE_SIZE;
+        auto & cached     = mDeviceTypeCache[slot];
+        if (cached.endpoint != endpoint || cached.deviceType != deviceType)
+        {
+            cached.deviceType = deviceType;
+            cached.endpoint   = endpoint;
+            cached.onEndpoint = resolver.IsDeviceTypeOnEndpoint(deviceType, endpoint);
+        }
+        return cached.onEndpoint;
+    }
+#endif
+    return resolver.IsDeviceTypeOnEndpoint(deviceType, endpoint);
 }
 
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
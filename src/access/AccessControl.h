@@ -31,6 +31,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/Global.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
 
 // Dump function for use during development only (0 for disabled, non-zero for enabled).
 #define CHIP_ACCESS_CONTROL_DUMP_ENABLED 0
@@ -50,6 +51,13 @@ public:
         virtual ~DeviceTypeResolver() = default;
 
         virtual bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) = 0;
+
+        /**
+         * Identifies where the device types come from, e.g. the data model provider in use.
+         *
+         * Device type resolutions remembered by access control are dropped whenever this changes.
+         */
+        virtual const void * GetDeviceTypeSource() { return this; }
     };
 
     /**
@@ -503,6 +511,7 @@ public:
     {
         VerifyOrReturnError(IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        mCompiledIndex.MarkStale();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -553,6 +562,7 @@ public:
     {
         VerifyOrReturnError(IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        mCompiledIndex.MarkStale();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -574,6 +584,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        mCompiledIndex.MarkStale();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -662,11 +673,119 @@ public:
      */
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+    /**
+     * Forget the device type resolutions remembered when checking entries with device type targets.
+     *
+     * When CHIP_CONFIG_ACCESS_CONTROL_DEVICE_TYPE_CACHE_SIZE is not 0, this must be called whenever
+     * the device types on endpoints change, e.g. when endpoints are added, removed, enabled or
+     * disabled. Replacing the source of device types (see DeviceTypeResolver::GetDeviceTypeSource)
+     * does not need it.
+     */
+    void InvalidateDeviceTypeCache() { mCompiledIndex.InvalidateDeviceTypeCache(); }
+
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
     CHIP_ERROR Dump(const Entry & entry);
 #endif
 
 private:
+    friend class TestAccessControl;
+
+    /**
+     * Entries of all fabrics compiled into a table of grants, sorted by fabric, auth mode, subject
+     * and target, so that a check takes a few binary searches instead of a walk over every subject
+     * and target of every entry of the fabric.
+     *
+     * The table is compiled on the first check following a change to the entries. If the entries
+     * can't be compiled (e.g. malformed entries loaded from storage), checks are done against the
+     * entries until they change again.
+     */
+    class CompiledIndex : public EntryListener
+    {
+    public:
+        void Reset();
+
+        // Entries have changed without notification, compile them again on the next check
+        void MarkStale() { mState = State::kStale; }
+
+        void InvalidateDeviceTypeCache();
+
+        /**
+         * Check access against the compiled entries, compiling them first if needed.
+         *
+         * @return false if the entries could not be compiled, in which case `allowed` is not set.
+         */
+        bool Check(AccessControl & accessControl, const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                   Privilege requestPrivilege, bool & allowed);
+
+        void OnEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
+                            ChangeType changeType) override
+        {
+            MarkStale();
+        }
+
+    private:
+        enum class State : uint8_t
+        {
+            kStale,
+            kReady,
+            kUnavailable
+        };
+
+        enum class SubjectType : uint8_t
+        {
+            kAny,     // entry without subjects
+            kNode,    // operational node ID or group ID
+            kCASEAuthTag,
+        };
+
+        enum class TargetType : uint8_t
+        {
+            kAny, // entry without targets
+            kCluster,
+            kEndpoint,
+            kEndpointCluster,
+            kDeviceType,
+            kDeviceTypeCluster,
+        };
+
+        // Grant of privileges to one subject of an entry over one of its targets
+        struct Grant
+        {
+            FabricIndex fabricIndex = kUndefinedFabricIndex;
+            AuthMode authMode       = AuthMode::kNone;
+            SubjectType subjectType = SubjectType::kAny;
+            TargetType targetType   = TargetType::kAny;
+            NodeId subject          = 0; // node or group ID, or identifier of CASE Authenticated Tag
+            EndpointId endpoint     = 0;
+            ClusterId cluster       = 0;
+            DeviceTypeId deviceType = 0;
+            uint16_t catVersion     = 0;
+            uint8_t privileges      = 0; // bits of the request privileges granted
+        };
+
+        struct DeviceTypeCacheEntry
+        {
+            DeviceTypeId deviceType = 0;
+            EndpointId endpoint     = kInvalidEndpointId;
+            bool onEndpoint         = false;
+        };
+
+        CHIP_ERROR Compile(const AccessControl & accessControl);
+        static CHIP_ERROR AddGrants(const Entry & entry, Grant * grants, size_t capacity, size_t & count);
+        bool IsGranted(AccessControl & accessControl, Grant key, uint16_t catVersion, const RequestPath & requestPath,
+                       uint8_t requestPrivilege);
+        bool IsDeviceTypeOnEndpoint(DeviceTypeResolver & resolver, DeviceTypeId deviceType, EndpointId endpoint);
+
+        Platform::ScopedMemoryBuffer<Grant> mGrants;
+        size_t mGrantCount = 0;
+        State mState       = State::kStale;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DEVICE_TYPE_CACHE_SIZE > 0
+        DeviceTypeCacheEntry mDeviceTypeCache[CHIP_CONFIG_ACCESS_CONTROL_DEVICE_TYPE_CACHE_SIZE];
+        const void * mDeviceTypeCacheSource = nullptr; // resolver source the cached resolutions came from
+#endif
+    };
+
     bool IsInitialized() const { return (mDelegate != nullptr); }
 
     bool IsValid(const Entry & entry);
@@ -680,6 +799,14 @@ private:
      */
     CHIP_ERROR CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+    /**
+     * Check the entries of the subject's fabric one by one, without the compiled index.
+     *
+     * @param [out] allowed Whether an entry grants the access.
+     */
+    CHIP_ERROR CheckEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege, bool & allowed);
+
     /**
      * Check CommissioningARL or ARL (as appropriate) for whether access (by a
      * subject descriptor, to a request path, requiring a privilege) should
@@ -694,6 +821,8 @@ private:
 
     EntryListener * mEntryListener = nullptr;
 
+    CompiledIndex mCompiledIndex;
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     AccessRestrictionProvider * mAccessRestrictionProvider;
 #endif
@@ -45,6 +45,8 @@ public:
         return false;
     }
 
+    const void * GetDeviceTypeSource() override { return mModelGetter(); }
+
 private:
     ModelGetter mModelGetter;
 };
@@ -23,6 +23,9 @@
 
 #include <lib/core/CHIPCore.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+#include <vector>
 
 namespace chip {
 namespace Access {
@@ -419,12 +422,139 @@ constexpr DeviceTypeId invalidDeviceTypes[] = {
 };
 // clang-format on
 
+// For testing, resolves at most one device type, on one endpoint
 class DeviceTypeResolver : public AccessControl::DeviceTypeResolver
 {
 public:
-    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override
+    {
+        ++mResolveCount;
+        return deviceType == mDeviceType && endpoint == mEndpoint;
+    }
+
+    const void * GetDeviceTypeSource() override { return mSource; }
+
+    void Reset(DeviceTypeId deviceType = 0, EndpointId endpoint = kInvalidEndpointId)
+    {
+        mDeviceType   = deviceType;
+        mEndpoint     = endpoint;
+        mResolveCount = 0;
+    }
+
+    DeviceTypeId mDeviceType = 0;
+    EndpointId mEndpoint     = kInvalidEndpointId;
+    size_t mResolveCount     = 0;
+    const void * mSource     = this;
 } testDeviceTypeResolver;
 
+// For testing, keeps an access control list of any size in memory
+class LargeAccessControlDelegate : public AccessControl::Delegate
+{
+public:
+    struct EntryStorage
+    {
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        Privilege privilege;
+        std::vector<NodeId> subjects;
+        std::vector<Target> targets;
+    };
+
+    std::vector<EntryStorage> mEntries;
+
+    CHIP_ERROR Entries(EntryIterator & iterator, const FabricIndex * fabricIndex) const override
+    {
+        mIteratorDelegate.mEntries     = &mEntries;
+        mIteratorDelegate.mFabricIndex = (fabricIndex != nullptr) ? *fabricIndex : kUndefinedFabricIndex;
+        mIteratorDelegate.mIndex       = 0;
+        iterator.SetDelegate(mIteratorDelegate);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                     Privilege requestPrivilege) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    class EntryDelegate : public Entry::Delegate
+    {
+    public:
+        CHIP_ERROR GetAuthMode(AuthMode & authMode) const override
+        {
+            authMode = mStorage->authMode;
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetFabricIndex(FabricIndex & fabricIndex) const override
+        {
+            fabricIndex = mStorage->fabricIndex;
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetPrivilege(Privilege & privilege) const override
+        {
+            privilege = mStorage->privilege;
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetSubjectCount(size_t & count) const override
+        {
+            count = mStorage->subjects.size();
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetSubject(size_t index, NodeId & subject) const override
+        {
+            VerifyOrReturnError(index < mStorage->subjects.size(), CHIP_ERROR_SENTINEL);
+            subject = mStorage->subjects[index];
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetTargetCount(size_t & count) const override
+        {
+            count = mStorage->targets.size();
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetTarget(size_t index, Target & target) const override
+        {
+            VerifyOrReturnError(index < mStorage->targets.size(), CHIP_ERROR_SENTINEL);
+            target = mStorage->targets[index];
+            return CHIP_NO_ERROR;
+        }
+
+        const EntryStorage * mStorage = nullptr;
+    };
+
+    class IteratorDelegate : public EntryIterator::Delegate
+    {
+    public:
+        CHIP_ERROR Next(Entry & entry) override
+        {
+            while (mIndex < mEntries->size())
+            {
+                const EntryStorage & storage = (*mEntries)[mIndex++];
+                if (mFabricIndex == kUndefinedFabricIndex || storage.fabricIndex == mFabricIndex)
+                {
+                    mEntryDelegate.mStorage = &storage;
+                    entry.SetDelegate(mEntryDelegate);
+                    return CHIP_NO_ERROR;
+                }
+            }
+            return CHIP_ERROR_SENTINEL;
+        }
+
+        const std::vector<EntryStorage> * mEntries = nullptr;
+        FabricIndex mFabricIndex                   = kUndefinedFabricIndex;
+        size_t mIndex                              = 0;
+        EntryDelegate mEntryDelegate;
+    };
+
+    mutable IteratorDelegate mIteratorDelegate;
+};
+
 // For testing, supports one subject and target, allows any value (valid or invalid)
 class TestEntryDelegate : public Entry::Delegate
 {
@@ -1084,6 +1214,7 @@ public: // protected
     void SetUp() override { ASSERT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR); }
     static void SetUpTestSuite()
     {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
         AccessControl::Delegate * delegate = Examples::GetAccessControlDelegate();
         SetAccessControl(accessControl);
         VerifyOrDie(GetAccessControl().Init(delegate, testDeviceTypeResolver) == CHIP_NO_ERROR);
@@ -1092,6 +1223,26 @@ public: // protected
     {
         GetAccessControl().Finish();
         ResetAccessControlToDefault();
+        chip::Platform::MemoryShutdown();
+    }
+
+    // Check against the entries one by one, as done without the compiled index
+    static CHIP_ERROR CheckEntries(AccessControl & ac, const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                   Privilege privilege)
+    {
+        bool allowed = false;
+        ReturnErrorOnFailure(ac.CheckEntries(subjectDescriptor, requestPath, privilege, allowed));
+        return allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+    }
+
+    // Check against the compiled index only
+    static CHIP_ERROR CheckCompiledIndex(AccessControl & ac, const SubjectDescriptor & subjectDescriptor,
+                                         const RequestPath & requestPath, Privilege privilege)
+    {
+        bool allowed = false;
+        VerifyOrReturnError(ac.mCompiledIndex.Check(ac, subjectDescriptor, requestPath, privilege, allowed),
+                            CHIP_ERROR_INCORRECT_STATE);
+        return allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
     }
 };
 
@@ -1760,6 +1911,187 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+TEST_F(TestAccessControl, TestCheckCompiledIndex)
+{
+    LoadAccessControl(accessControl, entryData1, entryData1Count);
+
+    constexpr NodeId kSubjects[] = { kOperationalNodeId0, kOperationalNodeId1, kOperationalNodeId3, kOperationalNodeId4,
+                                     kOperationalNodeId5, kGroup2,             kGroup4 };
+    constexpr CATValues kCats[]  = { { { kUndefinedCAT, kUndefinedCAT, kUndefinedCAT } },
+                                     { { kCASEAuthTag0, kUndefinedCAT, kUndefinedCAT } },
+                                     { { kCASEAuthTag1, kCASEAuthTag2, kUndefinedCAT } },
+                                     { { kCASEAuthTag0, kCASEAuthTag3, kUndefinedCAT } },
+                                     { { kCASEAuthTag4, kUndefinedCAT, kUndefinedCAT } } };
+    constexpr ClusterId kClusters[] = { kOnOffCluster, kLevelControlCluster, kAccessControlCluster, kColorControlCluster };
+
+    // The compiled index must make the same decisions as the entries
+    for (auto fabricIndex : fabricIndexes)
+    {
+        for (auto authMode : authModes)
+        {
+            for (auto subject : kSubjects)
+            {
+                for (const auto & cats : kCats)
+                {
+                    SubjectDescriptor subjectDescriptor = { .fabricIndex = fabricIndex, .authMode = authMode, .subject = subject };
+                    subjectDescriptor.cats              = cats;
+                    for (auto cluster : kClusters)
+                    {
+                        for (EndpointId endpoint = 0; endpoint < 4; ++endpoint)
+                        {
+                            RequestPath requestPath = { .cluster = cluster, .endpoint = endpoint };
+                            for (auto privilege : privileges)
+                            {
+                                EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, privilege),
+                                          CheckEntries(accessControl, subjectDescriptor, requestPath, privilege));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(TestAccessControl, TestCheckCompiledIndexFollowsChanges)
+{
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    const RequestPath requestPath             = { .cluster = kOnOffCluster, .endpoint = 1 };
+
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    EntryData entryData = { .fabricIndex = 1,
+                            .privilege   = Privilege::kView,
+                            .authMode    = AuthMode::kCase,
+                            .subjects    = { kOperationalNodeId1 },
+                            .targets     = { { .flags = Target::kCluster, .cluster = kOnOffCluster } } };
+    EXPECT_EQ(LoadAccessControl(accessControl, &entryData, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kView), CHIP_NO_ERROR);
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    {
+        Entry entry;
+        entryData.privilege = Privilege::kOperate;
+        EXPECT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadEntry(entry, entryData), CHIP_NO_ERROR);
+        EXPECT_EQ(accessControl.UpdateEntry(0, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+
+    EXPECT_EQ(accessControl.DeleteEntry(0), CHIP_NO_ERROR);
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+}
+
+TEST_F(TestAccessControl, TestCheckDeviceTypeTargets)
+{
+    constexpr DeviceTypeId kDeviceType = 0x0000'0100;
+
+    const EntryData entryData = { .fabricIndex = 1,
+                                  .privilege   = Privilege::kOperate,
+                                  .authMode    = AuthMode::kCase,
+                                  .targets     = { { .flags = Target::kDeviceType, .deviceType = kDeviceType },
+                                                   { .flags      = Target::kCluster | Target::kDeviceType,
+                                                     .cluster    = kLevelControlCluster,
+                                                     .deviceType = kDeviceType + 1 } } };
+    EXPECT_EQ(LoadAccessControl(accessControl, &entryData, 1), CHIP_NO_ERROR);
+
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    RequestPath requestPath                   = { .cluster = kOnOffCluster, .endpoint = 2 };
+
+    testDeviceTypeResolver.Reset(kDeviceType, 2);
+    accessControl.InvalidateDeviceTypeCache();
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+    requestPath.endpoint = 1;
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DEVICE_TYPE_CACHE_SIZE > 0
+    // Resolutions are remembered until invalidated
+    size_t resolveCount = testDeviceTypeResolver.mResolveCount;
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(testDeviceTypeResolver.mResolveCount, resolveCount);
+
+    // A new source of device types (e.g. a replaced data model provider) is resolved again
+    int otherSource;
+    testDeviceTypeResolver.mSource = &otherSource;
+    testDeviceTypeResolver.Reset(kDeviceType, 1);
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+    EXPECT_EQ(testDeviceTypeResolver.mResolveCount, 1u);
+    testDeviceTypeResolver.mSource = &testDeviceTypeResolver;
+    testDeviceTypeResolver.Reset(kDeviceType, 2);
+#endif
+
+    testDeviceTypeResolver.Reset(kDeviceType + 1, 1);
+    accessControl.InvalidateDeviceTypeCache();
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+    requestPath.cluster = kLevelControlCluster;
+    EXPECT_EQ(CheckCompiledIndex(accessControl, subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+    EXPECT_EQ(CheckEntries(accessControl, subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+
+    testDeviceTypeResolver.Reset();
+    accessControl.InvalidateDeviceTypeCache();
+}
+
+TEST_F(TestAccessControl, TestCheckCompiledIndexLargeAccessControlList)
+{
+    constexpr size_t kEntryCount     = 256;
+    constexpr EndpointId kEndpoints  = 16;
+    constexpr ClusterId kClusters    = 8;
+    constexpr DeviceTypeId kBaseType = 0x0000'0100;
+
+    // Each entry grants a few nodes access to a few clusters on a few endpoints, like on a bridge
+    LargeAccessControlDelegate delegate;
+    for (size_t i = 0; i < kEntryCount; ++i)
+    {
+        LargeAccessControlDelegate::EntryStorage storage = { .fabricIndex = 1,
+                                                             .authMode    = AuthMode::kCase,
+                                                             .privilege   = Privilege::kOperate };
+        for (NodeId j = 0; j < 4; ++j)
+        {
+            storage.subjects.push_back(kOperationalNodeId1 + i * 4 + j);
+        }
+        for (uint16_t j = 0; j < 3; ++j)
+        {
+            storage.targets.push_back({ .flags    = Target::kCluster | Target::kEndpoint,
+                                        .cluster  = static_cast<ClusterId>((i + j) % kClusters),
+                                        .endpoint = static_cast<EndpointId>((i + j) % kEndpoints) });
+        }
+        if (i % 16 == 0)
+        {
+            storage.targets.push_back({ .flags = Target::kDeviceType, .deviceType = kBaseType + i });
+        }
+        delegate.mEntries.push_back(std::move(storage));
+    }
+
+    AccessControl ac;
+    testDeviceTypeResolver.Reset(kBaseType, 3);
+    ASSERT_EQ(ac.Init(&delegate, testDeviceTypeResolver), CHIP_NO_ERROR);
+
+    // A wildcard read by the subject of the last entry, and by an unknown subject
+    const NodeId kSubjects[] = { kOperationalNodeId1 + kEntryCount * 4 - 1, kOperationalNodeId0 };
+    for (auto subject : kSubjects)
+    {
+        const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = subject };
+
+        size_t allowedCount = 0;
+        for (EndpointId endpoint = 0; endpoint < kEndpoints; ++endpoint)
+        {
+            for (ClusterId cluster = 0; cluster < kClusters; ++cluster)
+            {
+                const RequestPath requestPath = { .cluster = cluster, .endpoint = endpoint };
+                CHIP_ERROR result             = CheckEntries(ac, subjectDescriptor, requestPath, Privilege::kView);
+                EXPECT_EQ(CheckCompiledIndex(ac, subjectDescriptor, requestPath, Privilege::kView), result);
+                allowedCount += (result == CHIP_NO_ERROR) ? 1 : 0;
+            }
+        }
+
+        // Only the last entry's three targets match its subject
+        EXPECT_EQ(allowedCount, (subject == kOperationalNodeId0) ? 0u : 3u);
+    }
+
+    ac.Finish();
+    testDeviceTypeResolver.Reset();
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
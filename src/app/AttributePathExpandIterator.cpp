@@ -31,9 +31,46 @@ namespace chip {
 namespace app {
 
 AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position) :
-    mDataModelProvider(dataModel), mPosition(position)
+    mDataModelProvider(dataModel), mPosition(position), mSnapshot(dataModel->RetainMetadataSnapshot())
 {}
 
+AttributePathExpandIterator::~AttributePathExpandIterator()
+{
+    if (mSnapshot != nullptr)
+    {
+        mSnapshot->Release();
+    }
+}
+
+void AttributePathExpandIterator::LoadEndpoints()
+{
+    if (mSnapshot != nullptr)
+    {
+        mSnapshotEndpoints = mSnapshot->Endpoints();
+        return;
+    }
+    mEndpoints = mDataModelProvider->EndpointsIgnoreError();
+}
+
+void AttributePathExpandIterator::LoadClusters()
+{
+    if (mSnapshot != nullptr)
+    {
+        mSnapshotClusters = mSnapshot->ServerClusters(mPosition.mOutputPath.mEndpointId);
+        return;
+    }
+    mClusters = mDataModelProvider->ServerClustersIgnoreError(mPosition.mOutputPath.mEndpointId);
+}
+
+void AttributePathExpandIterator::LoadAttributes()
+{
+    mAttributesFromSnapshot = (mSnapshot != nullptr) && mSnapshot->Attributes(mPosition.mOutputPath, mSnapshotAttributes);
+    if (!mAttributesFromSnapshot)
+    {
+        mAttributes = mDataModelProvider->AttributesIgnoreError(mPosition.mOutputPath);
+    }
+}
+
 bool AttributePathExpandIterator::AdvanceOutputPath()
 {
     /// Output path invariants
@@ -121,6 +158,19 @@ bool AttributePathExpandIterator::IsValidAttributeId(AttributeId attributeId)
         break;
     }
 
+    Span<const AttributeId> attributes;
+    if ((mSnapshot != nullptr) && mSnapshot->Attributes(mPosition.mOutputPath, attributes))
+    {
+        for (AttributeId id : attributes)
+        {
+            if (id == attributeId)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     DataModel::AttributeFinder finder(mDataModelProvider);
 
     const ConcreteAttributePath attributePath(mPosition.mOutputPath.mEndpointId, mPosition.mOutputPath.mClusterId, attributeId);
@@ -140,14 +190,13 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttributeId()
     if (mAttributeIndex == kInvalidIndex)
     {
         // start a new iteration of attributes on the current cluster path.
-        mAttributes = mDataModelProvider->AttributesIgnoreError(mPosition.mOutputPath);
+        LoadAttributes();
 
         if (mPosition.mOutputPath.mAttributeId != kInvalidAttributeId)
         {
             // Position on the correct attribute if we have a start point
             mAttributeIndex = 0;
-            while ((mAttributeIndex < mAttributes.size()) &&
-                   (mAttributes[mAttributeIndex].attributeId != mPosition.mOutputPath.mAttributeId))
+            while ((mAttributeIndex < AttributeCount()) && (AttributeAt(mAttributeIndex) != mPosition.mOutputPath.mAttributeId))
             {
                 mAttributeIndex++;
             }
@@ -200,9 +249,9 @@ std::optional<AttributeId> AttributePathExpandIterator::NextAttributeId()
         return std::nullopt;
     }
 
-    if (mAttributeIndex < mAttributes.size())
+    if (mAttributeIndex < AttributeCount())
     {
-        return mAttributes[mAttributeIndex].attributeId;
+        return AttributeAt(mAttributeIndex);
     }
 
     // Finished the data model, start with global attributes
@@ -223,13 +272,13 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
     if (mClusterIndex == kInvalidIndex)
     {
         // start a new iteration on the current endpoint
-        mClusters = mDataModelProvider->ServerClustersIgnoreError(mPosition.mOutputPath.mEndpointId);
+        LoadClusters();
 
         if (mPosition.mOutputPath.mClusterId != kInvalidClusterId)
         {
             // Position on the correct cluster if we have a start point
             mClusterIndex = 0;
-            while ((mClusterIndex < mClusters.size()) && (mClusters[mClusterIndex].clusterId != mPosition.mOutputPath.mClusterId))
+            while ((mClusterIndex < ClusterCount()) && (ClusterAt(mClusterIndex) != mPosition.mOutputPath.mClusterId))
             {
                 mClusterIndex++;
             }
@@ -250,9 +299,9 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
                 const ClusterId clusterId = mPosition.mAttributePath->mValue.mClusterId;
 
                 bool found = false;
-                for (auto & entry : mClusters)
+                for (size_t i = 0; i < ClusterCount(); i++)
                 {
-                    if (entry.clusterId == clusterId)
+                    if (ClusterAt(i) == clusterId)
                     {
                         found = true;
                         break;
@@ -275,9 +324,9 @@ std::optional<ClusterId> AttributePathExpandIterator::NextClusterId()
     }
 
     VerifyOrReturnValue(mPosition.mAttributePath->mValue.HasWildcardClusterId(), std::nullopt);
-    VerifyOrReturnValue(mClusterIndex < mClusters.size(), std::nullopt);
+    VerifyOrReturnValue(mClusterIndex < ClusterCount(), std::nullopt);
 
-    return mClusters[mClusterIndex].clusterId;
+    return ClusterAt(mClusterIndex);
 }
 
 std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
@@ -285,13 +334,13 @@ std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
     if (mEndpointIndex == kInvalidIndex)
     {
         // index is missing, have to start a new iteration
-        mEndpoints = mDataModelProvider->EndpointsIgnoreError();
+        LoadEndpoints();
 
         if (mPosition.mOutputPath.mEndpointId != kInvalidEndpointId)
         {
             // Position on the correct endpoint if we have a start point
             mEndpointIndex = 0;
-            while ((mEndpointIndex < mEndpoints.size()) && (mEndpoints[mEndpointIndex].id != mPosition.mOutputPath.mEndpointId))
+            while ((mEndpointIndex < EndpointCount()) && (EndpointAt(mEndpointIndex) != mPosition.mOutputPath.mEndpointId))
             {
                 mEndpointIndex++;
             }
@@ -314,9 +363,9 @@ std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
     }
 
     VerifyOrReturnValue(mPosition.mAttributePath->mValue.HasWildcardEndpointId(), std::nullopt);
-    VerifyOrReturnValue(mEndpointIndex < mEndpoints.size(), std::nullopt);
+    VerifyOrReturnValue(mEndpointIndex < EndpointCount(), std::nullopt);
 
-    return mEndpoints[mEndpointIndex].id;
+    return EndpointAt(mEndpointIndex);
 }
 
 } // namespace app
@@ -102,6 +102,7 @@ public:
     };
 
     AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position);
+    ~AttributePathExpandIterator();
 
     // This class may not be copied. A new one should be created when needed and they
     // should not overlap.
@@ -121,14 +122,40 @@ private:
     DataModel::Provider * mDataModelProvider;
     Position & mPosition;
 
-    DataModel::ReadOnlyBuffer<DataModel::EndpointEntry> mEndpoints; // all endpoints
+    // The structure of the data model as of when this iterator was created, if the provider keeps
+    // snapshots. When set, endpoint and cluster lists (and attribute lists, for the clusters the
+    // snapshot caches) come from the snapshot instead of the provider.
+    DataModel::MetadataSnapshot * mSnapshot;
+
+    DataModel::ReadOnlyBuffer<DataModel::EndpointEntry> mEndpoints; // all endpoints (without a snapshot)
+    Span<const EndpointId> mSnapshotEndpoints;                      // all endpoints (with a snapshot)
     size_t mEndpointIndex = kInvalidIndex;
 
     DataModel::ReadOnlyBuffer<DataModel::ServerClusterEntry> mClusters; // all clusters ON THE CURRENT endpoint
+    Span<const ClusterId> mSnapshotClusters;
     size_t mClusterIndex = kInvalidIndex;
 
     DataModel::ReadOnlyBuffer<DataModel::AttributeEntry> mAttributes; // all attributes ON THE CURRENT cluster
-    size_t mAttributeIndex = kInvalidIndex;
+    Span<const AttributeId> mSnapshotAttributes;
+    bool mAttributesFromSnapshot = false;
+    size_t mAttributeIndex       = kInvalidIndex;
+
+    size_t EndpointCount() const { return mSnapshot != nullptr ? mSnapshotEndpoints.size() : mEndpoints.size(); }
+    EndpointId EndpointAt(size_t index) const { return mSnapshot != nullptr ? mSnapshotEndpoints[index] : mEndpoints[index].id; }
+
+    size_t ClusterCount() const { return mSnapshot != nullptr ? mSnapshotClusters.size() : mClusters.size(); }
+    ClusterId ClusterAt(size_t index) const { return mSnapshot != nullptr ? mSnapshotClusters[index] : mClusters[index].clusterId; }
+
+    size_t AttributeCount() const { return mAttributesFromSnapshot ? mSnapshotAttributes.size() : mAttributes.size(); }
+    AttributeId AttributeAt(size_t index) const
+    {
+        return mAttributesFromSnapshot ? mSnapshotAttributes[index] : mAttributes[index].attributeId;
+    }
+
+    /// Fetch the endpoint/cluster/attribute lists for the current mOutputPath.
+    void LoadEndpoints();
+    void LoadClusters();
+    void LoadAttributes();
 
     /// Move to the next endpoint/cluster/attribute triplet that is valid given
     /// the current mOutputPath and mpAttributePath.
@@ -29,6 +29,63 @@
 namespace chip {
 namespace app {
 
+namespace {
+
+// The anonymous array start and end of container elements that wrap streamed list items.
+constexpr uint8_t kListStart[] = { to_underlying(TLV::TLVElementType::Array) };
+constexpr uint8_t kListEnd[]   = { to_underlying(TLV::TLVElementType::EndOfContainer) };
+
+} // namespace
+
+uint32_t BufferedReadCallback::BufferedListBackingStore::GetTotalLength() const
+{
+    size_t totalLength = sizeof(kListStart) + sizeof(kListEnd);
+    for (const auto & packetBuffer : mBufferedList)
+    {
+        totalLength += packetBuffer->DataLength();
+    }
+    return static_cast<uint32_t>(totalLength);
+}
+
+CHIP_ERROR BufferedReadCallback::BufferedListBackingStore::OnInit(TLV::TLVReader & reader, const uint8_t *& bufStart,
+                                                                  uint32_t & bufLen)
+{
+    bufStart = kListStart;
+    bufLen   = sizeof(kListStart);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BufferedReadCallback::BufferedListBackingStore::GetNextBuffer(TLV::TLVReader & reader, const uint8_t *& bufStart,
+                                                                         uint32_t & bufLen)
+{
+    //
+    // The reader has consumed everything up to the end of one of our segments, so the amount it has read
+    // identifies the segment that comes next.
+    //
+    size_t offset = sizeof(kListStart);
+    for (const auto & packetBuffer : mBufferedList)
+    {
+        if (offset == reader.GetLengthRead())
+        {
+            bufStart = packetBuffer->Start();
+            bufLen   = static_cast<uint32_t>(packetBuffer->DataLength());
+            return CHIP_NO_ERROR;
+        }
+        offset += packetBuffer->DataLength();
+    }
+
+    if (offset == reader.GetLengthRead())
+    {
+        bufStart = kListEnd;
+        bufLen   = sizeof(kListEnd);
+        return CHIP_NO_ERROR;
+    }
+
+    bufStart = nullptr;
+    bufLen   = 0;
+    return CHIP_NO_ERROR;
+}
+
 void BufferedReadCallback::OnReportBegin()
 {
     mCallback.OnReportBegin();
@@ -103,6 +160,11 @@ CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aR
 
 CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
 {
+    if (mListBufferingMode == ListBufferingMode::kStream)
+    {
+        return PackListItem(reader);
+    }
+
     System::PacketBufferTLVWriter writer;
     System::PacketBufferHandle handle;
 
@@ -135,6 +197,42 @@ CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR BufferedReadCallback::PackListItem(TLV::TLVReader & reader)
+{
+    //
+    // Try the last buffer first; if the item does not fit there, retry once in a fresh MTU-sized buffer,
+    // which is always big enough for an item that was received over the wire.
+    //
+    for (bool newBuffer = mBufferedList.empty();; newBuffer = true)
+    {
+        if (newBuffer)
+        {
+            System::PacketBufferHandle handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+            VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
+            mBufferedList.push_back(std::move(handle));
+        }
+
+        System::PacketBufferHandle & tail = mBufferedList.back();
+        TLV::TLVReader itemReader;
+        TLV::TLVWriter writer;
+
+        // CopyElement advances the reader it is given, so leave ours untouched in case we need to retry.
+        itemReader.Init(reader);
+        writer.Init(tail->Start() + tail->DataLength(), tail->AvailableDataLength());
+
+        CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), itemReader);
+        if (err == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(writer.Finalize());
+            tail->SetDataLength(tail->DataLength() + writer.GetLengthWritten());
+            reader.Init(itemReader);
+            return CHIP_NO_ERROR;
+        }
+
+        VerifyOrReturnError(!newBuffer && (err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL), err);
+    }
+}
+
 CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData)
 {
 
@@ -202,9 +300,6 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     }
 
     StatusIB statusIB;
-    TLV::ScopedBufferTLVReader reader;
-
-    ReturnErrorOnFailure(GenerateListTLV(reader));
 
     //
     // Update the list operation to now reflect the delivery of the entire list
@@ -212,12 +307,33 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     //
     mBufferedPath.mListOp = ConcreteDataAttributePath::ListOperation::ReplaceAll;
 
-    //
-    // Advance the reader forward to the list itself
-    //
-    ReturnErrorOnFailure(reader.Next());
+    if (mListBufferingMode == ListBufferingMode::kStream)
+    {
+        BufferedListBackingStore backingStore(mBufferedList);
+        TLV::TLVReader reader;
+
+        ReturnErrorOnFailure(reader.Init(backingStore, backingStore.GetTotalLength()));
 
-    mCallback.OnAttributeData(mBufferedPath, &reader, statusIB);
+        //
+        // Advance the reader forward to the list itself
+        //
+        ReturnErrorOnFailure(reader.Next());
+
+        mCallback.OnAttributeData(mBufferedPath, &reader, statusIB);
+    }
+    else
+    {
+        TLV::ScopedBufferTLVReader reader;
+
+        ReturnErrorOnFailure(GenerateListTLV(reader));
+
+        //
+        // Advance the reader forward to the list itself
+        //
+        ReturnErrorOnFailure(reader.Next());
+
+        mCallback.OnAttributeData(mBufferedPath, &reader, statusIB);
+    }
 
     //
     // Clear out our buffered contents to free up allocated buffers, and reset the buffered path.
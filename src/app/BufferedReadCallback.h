@@ -36,13 +36,60 @@ namespace app {
  * upon completion of delivery of all chunks. This is then delivered to a compliant ReadClient::Callback
  * without any awareness on their part that chunking happened.
  *
+ * In the default kReassemble mode, the buffered list elements are copied into a single contiguous buffer
+ * before delivery. In kStream mode, the list elements are packed into as few packet buffers as possible
+ * and the callback is handed a reader that walks those buffers in place, which avoids holding a second
+ * copy of the entire list in memory. Callbacks that opt into kStream must only consume the list through the
+ * TLVReader API (e.g. DataModel::Decode), and not assume that GetReadPoint() points at the whole list.
+ *
  */
 class BufferedReadCallback : public ReadClient::Callback
 {
 public:
-    BufferedReadCallback(Callback & callback) : mCallback(callback) {}
+    enum class ListBufferingMode : uint8_t
+    {
+        kReassemble, ///< Deliver chunked lists from one contiguous buffer.
+        kStream,     ///< Deliver chunked lists from the buffered chunks, without reassembling them.
+    };
+
+    BufferedReadCallback(Callback & callback, ListBufferingMode mode = ListBufferingMode::kReassemble) :
+        mCallback(callback), mListBufferingMode(mode)
+    {}
 
 private:
+    /*
+     * Presents the buffered list elements as a single TLV array without copying them: an array start,
+     * every buffered packet buffer in order, then an end of container.
+     *
+     * Unlike TLVPacketBufferBackingStore, this keeps no read state of its own (the position of a reader
+     * is derived from how much it has read), so readers created off-of readers can share it.
+     */
+    class BufferedListBackingStore : public TLV::TLVBackingStore
+    {
+    public:
+        BufferedListBackingStore(const std::vector<System::PacketBufferHandle> & bufferedList) : mBufferedList(bufferedList) {}
+
+        uint32_t GetTotalLength() const;
+
+        CHIP_ERROR OnInit(TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
+        CHIP_ERROR GetNextBuffer(TLV::TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override;
+        CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+        {
+            return CHIP_ERROR_NOT_IMPLEMENTED;
+        }
+        CHIP_ERROR GetNewBuffer(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+        {
+            return CHIP_ERROR_NOT_IMPLEMENTED;
+        }
+        CHIP_ERROR FinalizeBuffer(TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+        {
+            return CHIP_ERROR_NOT_IMPLEMENTED;
+        }
+
+    private:
+        const std::vector<System::PacketBufferHandle> & mBufferedList;
+    };
+
     /*
      * Generates the reconsistuted TLV array from the stored individual list elements
      */
@@ -128,9 +175,18 @@ private:
      *
      */
     CHIP_ERROR BufferListItem(TLV::TLVReader & reader);
+
+    /*
+     * kStream counterpart of BufferListItem: copies the list item where the reader is positioned into the
+     * last buffered packet buffer, only allocating a new one when it does not fit. An item never straddles
+     * two buffers, so that string and byte string elements stay contiguous for TLVReader::GetDataPtr.
+     */
+    CHIP_ERROR PackListItem(TLV::TLVReader & reader);
+
     ConcreteDataAttributePath mBufferedPath;
     std::vector<System::PacketBufferHandle> mBufferedList;
     Callback & mCallback;
+    ListBufferingMode mListBufferingMode;
 };
 
 } // namespace app
@@ -49,8 +49,8 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
 
 } // anonymous namespace
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
 {
     Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
     TLV::TLVReader reader;
@@ -65,56 +65,36 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVR
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                                 const StatusIB & aStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::UpdateCache(const ConcreteDataAttributePath & aPath,
+                                                                          TLV::TLVReader * apData, const StatusIB & aStatus)
 {
-    AttributeState state;
-    bool endpointIsNew = false;
-
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
-    {
-        //
-        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
-        // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
-        // we can appropriately notify our clients of the addition of a new endpoint.
-        //
-        endpointIsNew = true;
-    }
+    //
+    // Since we might potentially be creating a new entry for aPath.mEndpointId that wasn't there before, we need to
+    // check if an entry didn't exist there previously and remember that so that we can appropriately notify our clients
+    // of the addition of a new endpoint.
+    //
+    bool endpointIsNew = !mCache.HasEndpoint(aPath.mEndpointId);
 
     if (apData)
     {
         uint32_t elementSize = 0;
         ReturnErrorOnFailure(GetElementTLVSize(apData, elementSize));
 
-        if constexpr (CanEnableDataCaching)
+        if (mCacheData)
         {
-            if (mCacheData)
-            {
-                Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-                backingBuffer.Calloc(elementSize);
-                VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-                TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
-                ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-                ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-
-                state.template Set<AttributeData>(std::move(backingBuffer));
-            }
-            else
-            {
-                state.template Set<uint32_t>(elementSize);
-            }
+            ReturnErrorOnFailure(mCache.SetData(aPath, *apData, elementSize));
         }
         else
         {
-            state = elementSize;
+            mCache.SetSize(aPath, elementSize);
         }
 
         //
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
         //
-        mCache[aPath.mEndpointId][aPath.mClusterId].mCommittedDataVersion.ClearValue();
+        mCache.FindOrAddCluster(aPath.mEndpointId, aPath.mClusterId).mCommittedDataVersion.ClearValue();
 
         // This commits a pending data version if the last report path is valid and it is different from the current path.
         if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
@@ -135,27 +115,20 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
         if (foundEncompassingWildcardPath)
         {
-            mCache[aPath.mEndpointId][aPath.mClusterId].mPendingDataVersion = aPath.mDataVersion;
+            mCache.FindOrAddCluster(aPath.mEndpointId, aPath.mClusterId).mPendingDataVersion = aPath.mDataVersion;
         }
 
         mLastReportDataPath = aPath;
     }
     else
     {
-        if constexpr (CanEnableDataCaching)
+        if (mCacheData)
         {
-            if (mCacheData)
-            {
-                state.template Set<StatusIB>(aStatus);
-            }
-            else
-            {
-                state.template Set<uint32_t>(SizeOfStatusIB(aStatus));
-            }
+            mCache.SetStatus(aPath, aStatus);
         }
         else
         {
-            state = SizeOfStatusIB(aStatus);
+            mCache.SetSize(aPath, SizeOfStatusIB(aStatus));
         }
     }
 
@@ -168,8 +141,6 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
-
     if (mCacheData)
     {
         mChangedAttributeSet.insert(aPath);
@@ -178,9 +149,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                                      const StatusIB * apStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::UpdateEventCache(const EventHeader & aEventHeader,
+                                                                               TLV::TLVReader * apData, const StatusIB * apStatus)
 {
     if (apData)
     {
@@ -227,8 +198,8 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::OnReportBegin()
 {
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     mChangedAttributeSet.clear();
@@ -236,15 +207,15 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
     mCallback.OnReportBegin();
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::CommitPendingDataVersion()
 {
     if (!mLastReportDataPath.IsValidConcreteClusterPath())
     {
         return;
     }
 
-    auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
+    auto & lastClusterInfo = mCache.FindOrAddCluster(mLastReportDataPath.mEndpointId, mLastReportDataPath.mClusterId);
     if (lastClusterInfo.mPendingDataVersion.HasValue())
     {
         lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
@@ -252,8 +223,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
     }
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::OnReportEnd()
 {
     CommitPendingDataVersion();
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
@@ -282,35 +253,35 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
 {
-    CHIP_ERROR err;
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
-
-    if (attributeState->template Is<StatusIB>())
+    if constexpr (CanEnableDataCaching)
     {
-        return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
-    }
+        CachedAttribute attribute;
+        ReturnErrorOnFailure(mCache.GetAttribute(path, attribute));
+
+        if (attribute.mKind == CachedAttribute::Kind::kStatus)
+        {
+            return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
+        }
+
+        if (attribute.mKind != CachedAttribute::Kind::kData)
+        {
+            return CHIP_ERROR_KEY_NOT_FOUND;
+        }
 
-    if (!attributeState->template Is<AttributeData>())
+        reader.Init(attribute.mData);
+        return reader.Next();
+    }
+    else
     {
         return CHIP_ERROR_KEY_NOT_FOUND;
     }
-
-    reader.Init(attributeState->template Get<AttributeData>().Get(), attributeState->template Get<AttributeData>().AllocatedSize());
-    return reader.Next();
-}
-
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
-{
-    return CHIP_ERROR_KEY_NOT_FOUND;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
 {
     CHIP_ERROR err;
 
@@ -326,67 +297,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EndpointState *
-ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
-{
-    auto endpointIter = mCache.find(endpointId);
-    if (endpointIter == mCache.end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &endpointIter->second;
-}
-
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
-ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const
-{
-    auto endpointState = GetEndpointState(endpointId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
-
-    auto clusterState = endpointState->find(clusterId);
-    if (clusterState == endpointState->end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &clusterState->second;
-}
-
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::AttributeState *
-ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                                            CHIP_ERROR & err) const
-{
-    auto clusterState = GetClusterState(endpointId, clusterId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
-
-    auto attributeState = clusterState->mAttributes.find(attributeId);
-    if (attributeState == clusterState->mAttributes.end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &attributeState->second;
-}
-
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EventData *
-ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+const typename ClusterStateCacheT<CanEnableDataCaching, Storage>::EventData *
+ClusterStateCacheT<CanEnableDataCaching, Storage>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
 {
     EventData compareKey;
 
@@ -402,9 +315,9 @@ ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber,
     return &(*eventData);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                               const StatusIB & aStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::OnAttributeData(const ConcreteDataAttributePath & aPath,
+                                                                        TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     //
     // Since the cache itself is a ReadClient::Callback, it may be incorrectly passed in directly when registering with the
@@ -434,21 +347,20 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDat
     mCallback.OnAttributeData(aPath, apData ? &dataSnapshot : nullptr, aStatus);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetVersion(const ConcreteClusterPath & aPath,
-                                                                Optional<DataVersion> & aVersion) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::GetVersion(const ConcreteClusterPath & aPath,
+                                                                         Optional<DataVersion> & aVersion) const
 {
     VerifyOrReturnError(aPath.IsValidConcreteClusterPath(), CHIP_ERROR_INVALID_ARGUMENT);
-    CHIP_ERROR err;
-    auto clusterState = GetClusterState(aPath.mEndpointId, aPath.mClusterId, err);
-    ReturnErrorOnFailure(err);
-    aVersion = clusterState->mCommittedDataVersion;
+    auto versions = mCache.FindCluster(aPath.mEndpointId, aPath.mClusterId);
+    VerifyOrReturnError(versions != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    aVersion = versions->mCommittedDataVersion;
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                           const StatusIB * apStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
+                                                                    const StatusIB * apStatus)
 {
     VerifyOrDie(apData != nullptr || apStatus != nullptr);
 
@@ -462,31 +374,30 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & a
     mCallback.OnEventData(aEventHeader, apData ? &dataSnapshot : nullptr, apStatus);
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
 {
-    CHIP_ERROR err;
+    if constexpr (CanEnableDataCaching)
+    {
+        CachedAttribute attribute;
+        ReturnErrorOnFailure(mCache.GetAttribute(path, attribute));
 
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
+        if (attribute.mKind != CachedAttribute::Kind::kStatus)
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
 
-    if (!attributeState->template Is<StatusIB>())
+        status = attribute.mStatus;
+        return CHIP_NO_ERROR;
+    }
+    else
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-
-    status = attributeState->template Get<StatusIB>();
-    return CHIP_NO_ERROR;
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
-{
-    return CHIP_ERROR_INVALID_ARGUMENT;
-}
-
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEventPath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::GetStatus(const ConcreteEventPath & path, StatusIB & status) const
 {
     auto statusIter = mEventStatusCache.find(path);
     if (statusIter == mEventStatusCache.end())
@@ -498,66 +409,57 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEve
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::GetSortedFilters(
+    std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
-    for (auto const & endpointIter : mCache)
-    {
-        EndpointId endpointId = endpointIter.first;
-        for (auto const & clusterIter : endpointIter.second)
-        {
-            if (!clusterIter.second.mCommittedDataVersion.HasValue())
+    mCache.ForEachEndpoint([&](EndpointId endpointId) {
+        return mCache.ForEachCluster(endpointId, [&](ClusterId clusterId) {
+            const CachedClusterVersions * versions = mCache.FindCluster(endpointId, clusterId);
+            if (!versions->mCommittedDataVersion.HasValue())
             {
-                continue;
+                return CHIP_NO_ERROR;
             }
-            DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
+            DataVersion dataVersion = versions->mCommittedDataVersion.Value();
             size_t clusterSize      = 0;
-            ClusterId clusterId     = clusterIter.first;
 
-            for (auto const & attributeIter : clusterIter.second.mAttributes)
-            {
-                if constexpr (CanEnableDataCaching)
+            mCache.ForEachAttribute(endpointId, clusterId, [&clusterSize](AttributeId, const CachedAttribute & attribute) {
+                switch (attribute.mKind)
                 {
-                    if (attributeIter.second.template Is<StatusIB>())
-                    {
-                        clusterSize += SizeOfStatusIB(attributeIter.second.template Get<StatusIB>());
-                    }
-                    else if (attributeIter.second.template Is<uint32_t>())
-                    {
-                        clusterSize += attributeIter.second.template Get<uint32_t>();
-                    }
-                    else
-                    {
-                        VerifyOrDie(attributeIter.second.template Is<AttributeData>());
-                        TLV::TLVReader bufReader;
-                        bufReader.Init(attributeIter.second.template Get<AttributeData>().Get(),
-                                       attributeIter.second.template Get<AttributeData>().AllocatedSize());
-                        ReturnOnFailure(bufReader.Next());
-                        // Skip to the end of the element.
-                        ReturnOnFailure(bufReader.Skip());
-
-                        // Compute the amount of value data
-                        clusterSize += bufReader.GetLengthRead();
-                    }
+                case CachedAttribute::Kind::kStatus:
+                    clusterSize += SizeOfStatusIB(attribute.mStatus);
+                    break;
+                case CachedAttribute::Kind::kSize:
+                    clusterSize += attribute.mSize;
+                    break;
+                case CachedAttribute::Kind::kData: {
+                    TLV::TLVReader bufReader;
+                    bufReader.Init(attribute.mData);
+                    ReturnErrorOnFailure(bufReader.Next());
+                    // Skip to the end of the element.
+                    ReturnErrorOnFailure(bufReader.Skip());
+
+                    // Compute the amount of value data
+                    clusterSize += bufReader.GetLengthRead();
+                    break;
                 }
-                else
-                {
-                    clusterSize += attributeIter.second;
                 }
-            }
+                return CHIP_NO_ERROR;
+            });
 
             if (clusterSize == 0)
             {
                 // No data in this cluster, so no point in sending a dataVersion
                 // along at all.
-                continue;
+                return CHIP_NO_ERROR;
             }
 
             DataVersionFilter filter(endpointId, clusterId, dataVersion);
 
             aVector.push_back(std::make_pair(filter, clusterSize));
-        }
-    }
+            return CHIP_NO_ERROR;
+        });
+    });
 
     std::sort(aVector.begin(), aVector.end(),
               [](const std::pair<DataVersionFilter, size_t> & x, const std::pair<DataVersionFilter, size_t> & y) {
@@ -565,8 +467,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
               });
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterList(
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::OnUpdateDataVersionFilterList(
     DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder, const Span<AttributePathParams> & aAttributePaths,
     bool & aEncodedDataVersionList)
 {
@@ -640,49 +542,26 @@ exit:
     return err;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(EndpointId endpointId)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::ClearAttributes(EndpointId endpointId)
 {
-    mCache.erase(endpointId);
+    mCache.EraseEndpoint(endpointId);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClusterPath & cluster)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::ClearAttributes(const ConcreteClusterPath & cluster)
 {
-    // Can't use GetEndpointState here, since that only handles const things.
-    auto endpointIter = mCache.find(cluster.mEndpointId);
-    if (endpointIter == mCache.end())
-    {
-        return;
-    }
-
-    auto & endpointState = endpointIter->second;
-    endpointState.erase(cluster.mClusterId);
+    mCache.EraseCluster(cluster);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttributePath & attribute)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::ClearAttribute(const ConcreteAttributePath & attribute)
 {
-    // Can't use GetClusterState here, since that only handles const things.
-    auto endpointIter = mCache.find(attribute.mEndpointId);
-    if (endpointIter == mCache.end())
-    {
-        return;
-    }
-
-    auto & endpointState = endpointIter->second;
-    auto clusterIter     = endpointState.find(attribute.mClusterId);
-    if (clusterIter == endpointState.end())
-    {
-        return;
-    }
-
-    auto & clusterState = clusterIter->second;
-    clusterState.mAttributes.erase(attribute.mAttributeId);
+    mCache.EraseAttribute(attribute);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(ConcreteClusterPath & aPath)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::GetLastReportDataPath(ConcreteClusterPath & aPath)
 {
     if (mLastReportDataPath.IsValidConcreteClusterPath())
     {
@@ -695,6 +574,8 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(Concr
 // Ensure that our out-of-line template methods actually get compiled.
 template class ClusterStateCacheT<true>;
 template class ClusterStateCacheT<false>;
+template class ClusterStateCacheT<true, ClusterStateCacheStorage::kFlatHash>;
+template class ClusterStateCacheT<false, ClusterStateCacheStorage::kFlatHash>;
 
 } // namespace app
 } // namespace chip
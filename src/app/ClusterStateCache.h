@@ -24,6 +24,7 @@
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
 #include <app/BufferedReadCallback.h>
+#include <app/ClusterStateCacheStorage.h>
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
@@ -65,8 +66,13 @@ namespace app {
  * 1. This already includes the BufferedReadCallback, so there is no need to add that to the ReadClient callback chain.
  * 2. The same cache cannot be used by multiple subscribe/read interactions at the same time.
  *
+ * Attribute state is kept in nested std::maps by default.  Passing ClusterStateCacheStorage::kFlatHash as the Storage
+ * parameter switches to open-addressed hash tables with the attribute TLV of each cluster packed into one arena (see
+ * ClusterStateFlatStorage), which uses far fewer heap allocations for caches of large nodes.  In that mode, TLV
+ * obtained from Get() is only valid until any attribute of the same cluster is updated.
+ *
  */
-template <bool CanEnableDataCaching>
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage = ClusterStateCacheStorage::kMap>
 class ClusterStateCacheT : protected ReadClient::Callback
 {
 public:
@@ -372,18 +378,9 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func) const
     {
-        CHIP_ERROR err;
-
-        auto clusterState = GetClusterState(endpointId, clusterId, err);
-        ReturnErrorOnFailure(err);
-
-        for (auto & attributeIter : clusterState->mAttributes)
-        {
-            const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
-            ReturnErrorOnFailure(func(path));
-        }
-
-        return CHIP_NO_ERROR;
+        return mCache.ForEachAttribute(endpointId, clusterId, [&](AttributeId attributeId, const CachedAttribute &) {
+            return func(ConcreteAttributePath(endpointId, clusterId, attributeId));
+        });
     }
 
     /*
@@ -402,21 +399,10 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func) const
     {
-        for (auto & endpointIter : mCache)
-        {
-            for (auto & clusterIter : endpointIter.second)
-            {
-                if (clusterIter.first == clusterId)
-                {
-                    for (auto & attributeIter : clusterIter.second.mAttributes)
-                    {
-                        const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
-                        ReturnErrorOnFailure(func(path));
-                    }
-                }
-            }
-        }
-        return CHIP_NO_ERROR;
+        return mCache.ForEachEndpoint([&](EndpointId endpointId) {
+            CHIP_ERROR err = ForEachAttribute(endpointId, clusterId, func);
+            return err == CHIP_ERROR_KEY_NOT_FOUND ? CHIP_NO_ERROR : err;
+        });
     }
 
     /*
@@ -435,15 +421,7 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
-        auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
-        {
-            for (auto & clusterIter : endpointIter->second)
-            {
-                ReturnErrorOnFailure(func(clusterIter.first));
-            }
-        }
-        return CHIP_NO_ERROR;
+        return mCache.ForEachCluster(endpointId, func);
     }
 
     /*
@@ -548,34 +526,6 @@ public:
     CHIP_ERROR GetLastReportDataPath(ConcreteClusterPath & aPath);
 
 private:
-    // An attribute state can be one of three things:
-    // * If we got a path-specific error for the attribute, the corresponding
-    //   status.
-    // * If we got data for the attribute and we are storing data ourselves, the
-    //   data.
-    // * If we got data for the attribute and we are not storing data
-    //   oureselves, the size of the data, so we can still prioritize sending
-    //   DataVersions correctly.
-    //
-    // The data for a single attribute is not going to be gigabytes in size, so
-    // using uint32_t for the size is fine; on 64-bit systems this can save
-    // quite a bit of space.
-    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
-    using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
-    // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
-    //
-    // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
-    // value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
-    // and we must not be in the middle of receiving reports for that cluster.
-    struct ClusterState
-    {
-        std::map<AttributeId, AttributeState> mAttributes;
-        Optional<DataVersion> mPendingDataVersion;
-        Optional<DataVersion> mCommittedDataVersion;
-    };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
-
     struct Comparator
     {
         bool operator()(const AttributePathParams & x, const AttributePathParams & y) const
@@ -598,23 +548,6 @@ private:
         }
     };
 
-    /*
-     * These functions provide a way to index into the cached state with different sub-sets of a path, returning
-     * appropriate slices of the data as requested.
-     *
-     * In all variants, the respective slice is returned if a valid path is provided. 'err' is updated to reflect
-     * the status of the operation.
-     *
-     * Notable status values:
-     *      - If a cluster instance corresponding to endpointId and clusterId doesn't exist in the cache,
-     *        CHIP_ERROR_KEY_NOT_FOUND shall be returned.
-     *
-     */
-    const EndpointState * GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const;
-    const ClusterState * GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const;
-    const AttributeState * GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                             CHIP_ERROR & err) const;
-
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
     /*
@@ -688,7 +621,7 @@ private:
     CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize);
 
     Callback & mCallback;
-    NodeState mCache;
+    ClusterStateStorage<CanEnableDataCaching, Storage> mCache;
     std::set<ConcreteAttributePath> mChangedAttributeSet;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
@@ -703,6 +636,7 @@ private:
 
 using ClusterStateCache       = ClusterStateCacheT<true>;
 using ClusterStateCacheNoData = ClusterStateCacheT<false>;
+using ClusterStateCacheFlat   = ClusterStateCacheT<true, ClusterStateCacheStorage::kFlatHash>;
 
 };     // namespace app
 };     // namespace chip
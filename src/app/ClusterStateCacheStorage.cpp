@@ -0,0 +1,476 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterStateCacheStorage.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+constexpr uint32_t kEmptySlot   = UINT32_MAX;
+constexpr uint32_t kDeletedSlot = UINT32_MAX - 1;
+constexpr size_t kNoSlot        = SIZE_MAX;
+constexpr size_t kMinTableSize  = 16;
+
+// Arena garbage below this is not worth a compaction pass.
+constexpr size_t kMinArenaGarbage = 64;
+
+// MurmurHash3 finalizer: endpoint, cluster and attribute IDs are small and clustered, so spread them over all bits
+// before masking down to a table slot.
+uint32_t Mix(uint32_t aValue)
+{
+    aValue ^= aValue >> 16;
+    aValue *= 0x85ebca6b;
+    aValue ^= aValue >> 13;
+    aValue *= 0xc2b2ae35;
+    aValue ^= aValue >> 16;
+    return aValue;
+}
+
+uint32_t HashCluster(EndpointId endpointId, ClusterId clusterId)
+{
+    return Mix(clusterId ^ Mix(endpointId));
+}
+
+uint32_t HashAttribute(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId)
+{
+    return Mix(attributeId ^ HashCluster(endpointId, clusterId));
+}
+
+// Smallest table that keeps aCount entries at most half full.
+size_t TableSizeFor(size_t aCount)
+{
+    size_t size = kMinTableSize;
+    while (size < aCount * 2)
+    {
+        size *= 2;
+    }
+    return size;
+}
+
+bool NeedsRebuild(const std::vector<uint32_t> & table, size_t aUsedSlots)
+{
+    return (aUsedSlots + 1) * 4 > table.size() * 3;
+}
+
+// Returns the slot holding the entry for which matches() is true, or kNoSlot.
+template <typename Matches>
+size_t FindSlot(const std::vector<uint32_t> & table, uint32_t hash, Matches matches)
+{
+    VerifyOrReturnValue(!table.empty(), kNoSlot);
+
+    const size_t mask = table.size() - 1;
+    for (size_t slot = hash & mask;; slot = (slot + 1) & mask)
+    {
+        const uint32_t entry = table[slot];
+        if (entry == kEmptySlot)
+        {
+            return kNoSlot;
+        }
+        if (entry != kDeletedSlot && matches(entry))
+        {
+            return slot;
+        }
+    }
+}
+
+// Stores index in the first free slot of its probe sequence.  Returns whether that slot had never been used, so the
+// caller can account for it in its used slot count.
+bool InsertSlot(std::vector<uint32_t> & table, uint32_t hash, uint32_t index)
+{
+    const size_t mask = table.size() - 1;
+    for (size_t slot = hash & mask;; slot = (slot + 1) & mask)
+    {
+        const uint32_t entry = table[slot];
+        if (entry == kEmptySlot || entry == kDeletedSlot)
+        {
+            table[slot] = index;
+            return entry == kEmptySlot;
+        }
+    }
+}
+
+} // anonymous namespace
+
+bool ClusterStateFlatStorage::HasEndpoint(EndpointId endpointId) const
+{
+    return FindEndpoint(endpointId) != nullptr;
+}
+
+const ClusterStateFlatStorage::Endpoint * ClusterStateFlatStorage::FindEndpoint(EndpointId endpointId) const
+{
+    auto endpointIter = std::lower_bound(mEndpoints.begin(), mEndpoints.end(), endpointId,
+                                         [](const Endpoint & endpoint, EndpointId id) { return endpoint.mEndpointId < id; });
+    VerifyOrReturnValue(endpointIter != mEndpoints.end() && endpointIter->mEndpointId == endpointId, nullptr);
+    return &*endpointIter;
+}
+
+uint32_t ClusterStateFlatStorage::FindClusterIndex(EndpointId endpointId, ClusterId clusterId) const
+{
+    size_t slot = FindSlot(mClusterTable, HashCluster(endpointId, clusterId), [&](uint32_t index) {
+        return mClusters[index].mClusterId == clusterId && mClusters[index].mEndpointId == endpointId;
+    });
+    return slot != kNoSlot ? mClusterTable[slot] : kNoIndex;
+}
+
+uint32_t ClusterStateFlatStorage::FindAttributeIndex(const ConcreteAttributePath & path) const
+{
+    size_t slot = FindSlot(mAttributeTable, HashAttribute(path.mEndpointId, path.mClusterId, path.mAttributeId),
+                           [&](uint32_t index) {
+                               const Attribute & attribute = mAttributes[index];
+                               return attribute.mAttributeId == path.mAttributeId && attribute.mClusterId == path.mClusterId &&
+                                   attribute.mEndpointId == path.mEndpointId;
+                           });
+    return slot != kNoSlot ? mAttributeTable[slot] : kNoIndex;
+}
+
+uint32_t ClusterStateFlatStorage::FindOrAddClusterIndex(EndpointId endpointId, ClusterId clusterId)
+{
+    uint32_t clusterIndex = FindClusterIndex(endpointId, clusterId);
+    VerifyOrReturnValue(clusterIndex == kNoIndex, clusterIndex);
+
+    if (NeedsRebuild(mClusterTable, mClusterTableUsed))
+    {
+        RebuildClusterTable(TableSizeFor(mClusterCount + 1));
+    }
+
+    if (mFreeCluster != kNoIndex)
+    {
+        clusterIndex = mFreeCluster;
+        mFreeCluster = mClusters[clusterIndex].mNext;
+    }
+    else
+    {
+        clusterIndex = static_cast<uint32_t>(mClusters.size());
+        mClusters.emplace_back();
+    }
+
+    Cluster & cluster       = mClusters[clusterIndex];
+    cluster.mEndpointId     = endpointId;
+    cluster.mClusterId      = clusterId;
+    cluster.mInUse          = true;
+    cluster.mFirstAttribute = kNoIndex;
+    cluster.mVersions       = CachedClusterVersions();
+    cluster.mLiveBytes      = 0;
+    mClusterCount++;
+    if (InsertSlot(mClusterTable, HashCluster(endpointId, clusterId), clusterIndex))
+    {
+        mClusterTableUsed++;
+    }
+
+    auto endpointIter = std::lower_bound(mEndpoints.begin(), mEndpoints.end(), endpointId,
+                                         [](const Endpoint & endpoint, EndpointId id) { return endpoint.mEndpointId < id; });
+    if (endpointIter == mEndpoints.end() || endpointIter->mEndpointId != endpointId)
+    {
+        endpointIter = mEndpoints.insert(endpointIter, Endpoint{ endpointId, kNoIndex });
+    }
+
+    uint32_t * link = &endpointIter->mFirstCluster;
+    while (*link != kNoIndex && mClusters[*link].mClusterId < clusterId)
+    {
+        link = &mClusters[*link].mNext;
+    }
+    cluster.mNext = *link;
+    *link         = clusterIndex;
+
+    return clusterIndex;
+}
+
+uint32_t ClusterStateFlatStorage::FindOrAddAttributeIndex(const ConcreteAttributePath & path)
+{
+    uint32_t attributeIndex = FindAttributeIndex(path);
+    VerifyOrReturnValue(attributeIndex == kNoIndex, attributeIndex);
+
+    const uint32_t clusterIndex = FindOrAddClusterIndex(path.mEndpointId, path.mClusterId);
+
+    if (NeedsRebuild(mAttributeTable, mAttributeTableUsed))
+    {
+        RebuildAttributeTable(TableSizeFor(mAttributeCount + 1));
+    }
+
+    if (mFreeAttribute != kNoIndex)
+    {
+        attributeIndex = mFreeAttribute;
+        mFreeAttribute = mAttributes[attributeIndex].mNext;
+    }
+    else
+    {
+        attributeIndex = static_cast<uint32_t>(mAttributes.size());
+        mAttributes.emplace_back();
+    }
+
+    Attribute & attribute  = mAttributes[attributeIndex];
+    attribute.mEndpointId  = path.mEndpointId;
+    attribute.mClusterId   = path.mClusterId;
+    attribute.mAttributeId = path.mAttributeId;
+    attribute.mCluster     = clusterIndex;
+    attribute.mKind        = CachedAttribute::Kind::kSize;
+    attribute.mStatus      = StatusIB();
+    attribute.mOffset      = 0;
+    attribute.mSize        = 0;
+    mAttributeCount++;
+    if (InsertSlot(mAttributeTable, HashAttribute(path.mEndpointId, path.mClusterId, path.mAttributeId), attributeIndex))
+    {
+        mAttributeTableUsed++;
+    }
+
+    uint32_t * link = &mClusters[clusterIndex].mFirstAttribute;
+    while (*link != kNoIndex && mAttributes[*link].mAttributeId < path.mAttributeId)
+    {
+        link = &mAttributes[*link].mNext;
+    }
+    attribute.mNext = *link;
+    *link           = attributeIndex;
+
+    return attributeIndex;
+}
+
+CHIP_ERROR ClusterStateFlatStorage::SetData(const ConcreteAttributePath & path, TLV::TLVReader & aData, uint32_t aSize)
+{
+    const bool endpointIsNew    = !HasEndpoint(path.mEndpointId);
+    const bool clusterIsNew     = FindClusterIndex(path.mEndpointId, path.mClusterId) == kNoIndex;
+    const uint32_t clusterIndex = FindOrAddClusterIndex(path.mEndpointId, path.mClusterId);
+    Cluster & cluster           = mClusters[clusterIndex];
+
+    const size_t garbage = cluster.mArena.size() - cluster.mLiveBytes;
+    if (garbage >= kMinArenaGarbage && garbage > cluster.mLiveBytes)
+    {
+        CompactArena(cluster, aSize);
+    }
+
+    // Write the new value before letting go of the old one, so a failure leaves the cache as it was.
+    const size_t offset = cluster.mArena.size();
+    cluster.mArena.resize(offset + aSize);
+
+    TLV::TLVWriter writer;
+    writer.Init(cluster.mArena.data() + offset, aSize);
+    CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), aData);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = writer.Finalize();
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        cluster.mArena.resize(offset);
+        if (endpointIsNew)
+        {
+            EraseEndpoint(path.mEndpointId);
+        }
+        else if (clusterIsNew)
+        {
+            EraseCluster(ConcreteClusterPath(path.mEndpointId, path.mClusterId));
+        }
+        return err;
+    }
+
+    // The cluster exists at this point, so adding the attribute cannot move the cluster record.
+    Attribute & attribute = mAttributes[FindOrAddAttributeIndex(path)];
+    ReleaseValue(attribute);
+    attribute.mKind   = CachedAttribute::Kind::kData;
+    attribute.mOffset = static_cast<uint32_t>(offset);
+    attribute.mSize   = aSize;
+    cluster.mLiveBytes += aSize;
+    return CHIP_NO_ERROR;
+}
+
+void ClusterStateFlatStorage::SetStatus(const ConcreteAttributePath & path, const StatusIB & aStatus)
+{
+    Attribute & attribute = mAttributes[FindOrAddAttributeIndex(path)];
+    ReleaseValue(attribute);
+    attribute.mKind   = CachedAttribute::Kind::kStatus;
+    attribute.mStatus = aStatus;
+}
+
+void ClusterStateFlatStorage::SetSize(const ConcreteAttributePath & path, uint32_t aSize)
+{
+    Attribute & attribute = mAttributes[FindOrAddAttributeIndex(path)];
+    ReleaseValue(attribute);
+    attribute.mKind = CachedAttribute::Kind::kSize;
+    attribute.mSize = aSize;
+}
+
+CHIP_ERROR ClusterStateFlatStorage::GetAttribute(const ConcreteAttributePath & path, CachedAttribute & aAttribute) const
+{
+    const uint32_t attributeIndex = FindAttributeIndex(path);
+    VerifyOrReturnError(attributeIndex != kNoIndex, CHIP_ERROR_KEY_NOT_FOUND);
+
+    const Attribute & attribute = mAttributes[attributeIndex];
+    aAttribute                  = ToCachedAttribute(attribute, mClusters[attribute.mCluster]);
+    return CHIP_NO_ERROR;
+}
+
+void ClusterStateFlatStorage::ReleaseValue(Attribute & attribute)
+{
+    if (attribute.mKind == CachedAttribute::Kind::kData)
+    {
+        mClusters[attribute.mCluster].mLiveBytes -= attribute.mSize;
+    }
+    attribute.mKind = CachedAttribute::Kind::kSize;
+    attribute.mSize = 0;
+}
+
+void ClusterStateFlatStorage::CompactArena(Cluster & cluster, size_t aReserve)
+{
+    std::vector<uint8_t> arena;
+    arena.reserve(cluster.mLiveBytes + aReserve);
+
+    for (uint32_t i = cluster.mFirstAttribute; i != kNoIndex; i = mAttributes[i].mNext)
+    {
+        Attribute & attribute = mAttributes[i];
+        if (attribute.mKind == CachedAttribute::Kind::kData)
+        {
+            const auto value  = cluster.mArena.begin() + attribute.mOffset;
+            attribute.mOffset = static_cast<uint32_t>(arena.size());
+            arena.insert(arena.end(), value, value + attribute.mSize);
+        }
+    }
+
+    cluster.mArena.swap(arena);
+}
+
+void ClusterStateFlatStorage::FreeAttribute(uint32_t attributeIndex)
+{
+    Attribute & attribute = mAttributes[attributeIndex];
+
+    size_t slot = FindSlot(mAttributeTable, HashAttribute(attribute.mEndpointId, attribute.mClusterId, attribute.mAttributeId),
+                           [attributeIndex](uint32_t index) { return index == attributeIndex; });
+    VerifyOrDie(slot != kNoSlot);
+    mAttributeTable[slot] = kDeletedSlot;
+
+    attribute.mCluster = kNoIndex;
+    attribute.mNext    = mFreeAttribute;
+    mFreeAttribute     = attributeIndex;
+    mAttributeCount--;
+}
+
+void ClusterStateFlatStorage::FreeCluster(uint32_t clusterIndex)
+{
+    Cluster & cluster = mClusters[clusterIndex];
+
+    for (uint32_t i = cluster.mFirstAttribute; i != kNoIndex;)
+    {
+        const uint32_t next = mAttributes[i].mNext;
+        FreeAttribute(i);
+        i = next;
+    }
+
+    size_t slot = FindSlot(mClusterTable, HashCluster(cluster.mEndpointId, cluster.mClusterId),
+                           [clusterIndex](uint32_t index) { return index == clusterIndex; });
+    VerifyOrDie(slot != kNoSlot);
+    mClusterTable[slot] = kDeletedSlot;
+
+    std::vector<uint8_t>().swap(cluster.mArena);
+    cluster.mInUse          = false;
+    cluster.mFirstAttribute = kNoIndex;
+    cluster.mNext           = mFreeCluster;
+    mFreeCluster            = clusterIndex;
+    mClusterCount--;
+}
+
+void ClusterStateFlatStorage::EraseEndpoint(EndpointId endpointId)
+{
+    auto endpointIter = std::lower_bound(mEndpoints.begin(), mEndpoints.end(), endpointId,
+                                         [](const Endpoint & endpoint, EndpointId id) { return endpoint.mEndpointId < id; });
+    VerifyOrReturn(endpointIter != mEndpoints.end() && endpointIter->mEndpointId == endpointId);
+
+    for (uint32_t i = endpointIter->mFirstCluster; i != kNoIndex;)
+    {
+        const uint32_t next = mClusters[i].mNext;
+        FreeCluster(i);
+        i = next;
+    }
+
+    mEndpoints.erase(endpointIter);
+}
+
+void ClusterStateFlatStorage::EraseCluster(const ConcreteClusterPath & cluster)
+{
+    const uint32_t clusterIndex = FindClusterIndex(cluster.mEndpointId, cluster.mClusterId);
+    VerifyOrReturn(clusterIndex != kNoIndex);
+
+    // Like ClusterStateMapStorage, the endpoint itself stays even if this was its last cluster.
+    auto endpointIter = std::lower_bound(mEndpoints.begin(), mEndpoints.end(), cluster.mEndpointId,
+                                         [](const Endpoint & endpoint, EndpointId id) { return endpoint.mEndpointId < id; });
+    VerifyOrDie(endpointIter != mEndpoints.end() && endpointIter->mEndpointId == cluster.mEndpointId);
+
+    uint32_t * link = &endpointIter->mFirstCluster;
+    while (*link != clusterIndex)
+    {
+        link = &mClusters[*link].mNext;
+    }
+    *link = mClusters[clusterIndex].mNext;
+
+    FreeCluster(clusterIndex);
+}
+
+void ClusterStateFlatStorage::EraseAttribute(const ConcreteAttributePath & path)
+{
+    const uint32_t attributeIndex = FindAttributeIndex(path);
+    VerifyOrReturn(attributeIndex != kNoIndex);
+
+    Attribute & attribute = mAttributes[attributeIndex];
+    Cluster & cluster     = mClusters[attribute.mCluster];
+
+    uint32_t * link = &cluster.mFirstAttribute;
+    while (*link != attributeIndex)
+    {
+        link = &mAttributes[*link].mNext;
+    }
+    *link = attribute.mNext;
+
+    ReleaseValue(attribute);
+    if (cluster.mLiveBytes == 0)
+    {
+        std::vector<uint8_t>().swap(cluster.mArena);
+    }
+
+    FreeAttribute(attributeIndex);
+}
+
+void ClusterStateFlatStorage::RebuildClusterTable(size_t aCapacity)
+{
+    mClusterTable.assign(aCapacity, kEmptySlot);
+    for (uint32_t i = 0; i < mClusters.size(); i++)
+    {
+        if (mClusters[i].mInUse)
+        {
+            InsertSlot(mClusterTable, HashCluster(mClusters[i].mEndpointId, mClusters[i].mClusterId), i);
+        }
+    }
+    mClusterTableUsed = mClusterCount;
+}
+
+void ClusterStateFlatStorage::RebuildAttributeTable(size_t aCapacity)
+{
+    mAttributeTable.assign(aCapacity, kEmptySlot);
+    for (uint32_t i = 0; i < mAttributes.size(); i++)
+    {
+        const Attribute & attribute = mAttributes[i];
+        if (attribute.mCluster != kNoIndex)
+        {
+            InsertSlot(mAttributeTable, HashAttribute(attribute.mEndpointId, attribute.mClusterId, attribute.mAttributeId), i);
+        }
+    }
+    mAttributeTableUsed = mAttributeCount;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,477 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Attribute storage back-ends for ClusterStateCacheT.
+ *
+ *      ClusterStateMapStorage keeps every attribute in nested std::maps with a separate heap allocation per value.
+ *      ClusterStateFlatStorage keeps attribute and cluster records in flat arrays indexed by open-addressed hash
+ *      tables, with the attribute TLV of each cluster packed into a single per-cluster arena.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/MessageDef/StatusIB.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+#include <lib/support/Variant.h>
+
+#include <map>
+#include <type_traits>
+#include <vector>
+
+namespace chip {
+namespace app {
+
+/*
+ * Selects how ClusterStateCacheT stores attribute state.
+ */
+enum class ClusterStateCacheStorage : uint8_t
+{
+    kMap,      ///< Nested std::map per endpoint and cluster, one heap allocation per attribute value.
+    kFlatHash, ///< Open-addressed hash tables over flat record arrays, attribute values packed in per-cluster arenas.
+};
+
+// mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
+//
+// mCommittedDataVersion represents a known data version for a cluster.  In order for this to have a
+// value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
+// and we must not be in the middle of receiving reports for that cluster.
+struct CachedClusterVersions
+{
+    Optional<DataVersion> mPendingDataVersion;
+    Optional<DataVersion> mCommittedDataVersion;
+};
+
+/*
+ * A read-only view of the cached state of one attribute.  mData points into the storage and is only valid until
+ * the storage is next modified.
+ */
+struct CachedAttribute
+{
+    enum class Kind : uint8_t
+    {
+        kStatus, ///< A path-specific error was received, see mStatus.
+        kData,   ///< The attribute TLV is cached, see mData.
+        kSize,   ///< Only the encoded size of the attribute is cached, see mSize.
+    };
+
+    Kind mKind = Kind::kSize;
+    StatusIB mStatus;
+    ByteSpan mData;
+    uint32_t mSize = 0;
+};
+
+/*
+ * The original ClusterStateCache storage: EndpointId -> ClusterId -> AttributeId maps.
+ */
+template <bool CanEnableDataCaching>
+class ClusterStateMapStorage
+{
+public:
+    bool HasEndpoint(EndpointId endpointId) const { return mCache.find(endpointId) != mCache.end(); }
+
+    const CachedClusterVersions * FindCluster(EndpointId endpointId, ClusterId clusterId) const
+    {
+        const ClusterState * clusterState = FindClusterState(endpointId, clusterId);
+        return clusterState != nullptr ? &clusterState->mVersions : nullptr;
+    }
+
+    CachedClusterVersions & FindOrAddCluster(EndpointId endpointId, ClusterId clusterId)
+    {
+        return mCache[endpointId][clusterId].mVersions;
+    }
+
+    /*
+     * Copy the element apData is positioned on into the cache.  aSize must be its encoded size.
+     */
+    CHIP_ERROR SetData(const ConcreteAttributePath & path, TLV::TLVReader & aData, uint32_t aSize)
+    {
+        if constexpr (CanEnableDataCaching)
+        {
+            AttributeData backingBuffer;
+            backingBuffer.Calloc(aSize);
+            VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+            TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), aSize);
+            ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), aData));
+            ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+
+            AttributeState state;
+            state.template Set<AttributeData>(std::move(backingBuffer));
+            StoreState(path, std::move(state));
+            return CHIP_NO_ERROR;
+        }
+        else
+        {
+            return CHIP_ERROR_NOT_IMPLEMENTED;
+        }
+    }
+
+    void SetStatus(const ConcreteAttributePath & path, const StatusIB & aStatus)
+    {
+        if constexpr (CanEnableDataCaching)
+        {
+            AttributeState state;
+            state.template Set<StatusIB>(aStatus);
+            StoreState(path, std::move(state));
+        }
+    }
+
+    void SetSize(const ConcreteAttributePath & path, uint32_t aSize)
+    {
+        AttributeState state;
+        if constexpr (CanEnableDataCaching)
+        {
+            state.template Set<uint32_t>(aSize);
+        }
+        else
+        {
+            state = aSize;
+        }
+        StoreState(path, std::move(state));
+    }
+
+    /*
+     * Returns CHIP_ERROR_KEY_NOT_FOUND if nothing is cached for the path.
+     */
+    CHIP_ERROR GetAttribute(const ConcreteAttributePath & path, CachedAttribute & aAttribute) const
+    {
+        const ClusterState * clusterState = FindClusterState(path.mEndpointId, path.mClusterId);
+        VerifyOrReturnError(clusterState != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+        auto attributeIter = clusterState->mAttributes.find(path.mAttributeId);
+        VerifyOrReturnError(attributeIter != clusterState->mAttributes.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+        aAttribute = ToCachedAttribute(attributeIter->second);
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * Calls func(AttributeId, const CachedAttribute &) for every attribute of the cluster, in increasing attribute ID
+     * order.  Returns CHIP_ERROR_KEY_NOT_FOUND if the cluster is not in the cache.
+     */
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func) const
+    {
+        const ClusterState * clusterState = FindClusterState(endpointId, clusterId);
+        VerifyOrReturnError(clusterState != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+        for (auto & attributeIter : clusterState->mAttributes)
+        {
+            ReturnErrorOnFailure(func(attributeIter.first, ToCachedAttribute(attributeIter.second)));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * Calls func(ClusterId) for every cluster of the endpoint, in increasing cluster ID order.
+     */
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
+    {
+        auto endpointIter = mCache.find(endpointId);
+        VerifyOrReturnError(endpointIter != mCache.end(), CHIP_NO_ERROR);
+
+        for (auto & clusterIter : endpointIter->second)
+        {
+            ReturnErrorOnFailure(func(clusterIter.first));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * Calls func(EndpointId) for every endpoint, in increasing endpoint ID order.
+     */
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachEndpoint(IteratorFunc func) const
+    {
+        for (auto & endpointIter : mCache)
+        {
+            ReturnErrorOnFailure(func(endpointIter.first));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void EraseEndpoint(EndpointId endpointId) { mCache.erase(endpointId); }
+
+    void EraseCluster(const ConcreteClusterPath & cluster)
+    {
+        auto endpointIter = mCache.find(cluster.mEndpointId);
+        if (endpointIter != mCache.end())
+        {
+            endpointIter->second.erase(cluster.mClusterId);
+        }
+    }
+
+    void EraseAttribute(const ConcreteAttributePath & attribute)
+    {
+        auto endpointIter = mCache.find(attribute.mEndpointId);
+        if (endpointIter == mCache.end())
+        {
+            return;
+        }
+
+        auto clusterIter = endpointIter->second.find(attribute.mClusterId);
+        if (clusterIter != endpointIter->second.end())
+        {
+            clusterIter->second.mAttributes.erase(attribute.mAttributeId);
+        }
+    }
+
+private:
+    // An attribute state can be one of three things:
+    // * If we got a path-specific error for the attribute, the corresponding
+    //   status.
+    // * If we got data for the attribute and we are storing data ourselves, the
+    //   data.
+    // * If we got data for the attribute and we are not storing data
+    //   oureselves, the size of the data, so we can still prioritize sending
+    //   DataVersions correctly.
+    //
+    // The data for a single attribute is not going to be gigabytes in size, so
+    // using uint32_t for the size is fine; on 64-bit systems this can save
+    // quite a bit of space.
+    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+    using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
+    struct ClusterState
+    {
+        std::map<AttributeId, AttributeState> mAttributes;
+        CachedClusterVersions mVersions;
+    };
+    using EndpointState = std::map<ClusterId, ClusterState>;
+    using NodeState     = std::map<EndpointId, EndpointState>;
+
+    const ClusterState * FindClusterState(EndpointId endpointId, ClusterId clusterId) const
+    {
+        auto endpointIter = mCache.find(endpointId);
+        VerifyOrReturnValue(endpointIter != mCache.end(), nullptr);
+
+        auto clusterIter = endpointIter->second.find(clusterId);
+        VerifyOrReturnValue(clusterIter != endpointIter->second.end(), nullptr);
+
+        return &clusterIter->second;
+    }
+
+    void StoreState(const ConcreteAttributePath & path, AttributeState && state)
+    {
+        mCache[path.mEndpointId][path.mClusterId].mAttributes[path.mAttributeId] = std::move(state);
+    }
+
+    static CachedAttribute ToCachedAttribute(const AttributeState & state)
+    {
+        CachedAttribute attribute;
+        if constexpr (CanEnableDataCaching)
+        {
+            if (state.template Is<StatusIB>())
+            {
+                attribute.mKind   = CachedAttribute::Kind::kStatus;
+                attribute.mStatus = state.template Get<StatusIB>();
+            }
+            else if (state.template Is<AttributeData>())
+            {
+                const AttributeData & data = state.template Get<AttributeData>();
+                attribute.mKind            = CachedAttribute::Kind::kData;
+                attribute.mData            = ByteSpan(data.Get(), data.AllocatedSize());
+            }
+            else
+            {
+                attribute.mSize = state.template Get<uint32_t>();
+            }
+        }
+        else
+        {
+            attribute.mSize = state;
+        }
+        return attribute;
+    }
+
+    NodeState mCache;
+};
+
+/*
+ * Attribute storage with one flat record per cluster and per attribute.
+ *
+ * Lookups go through two open-addressed, linearly probed hash tables: one keyed by (EndpointId, ClusterId) and one keyed
+ * by the full concrete attribute path.  Records that get removed are put on a free list and reused.  Each cluster record
+ * also chains its attributes in increasing attribute ID order, and the endpoints chain their clusters the same way, so
+ * iteration order matches ClusterStateMapStorage.
+ *
+ * The TLV of every attribute in a cluster is appended to a single per-cluster arena.  Overwritten values leave garbage
+ * behind that is compacted away once it outweighs the live data, so updating any attribute of a cluster may move the
+ * cached TLV of the other attributes of that cluster.
+ */
+class ClusterStateFlatStorage
+{
+public:
+    bool HasEndpoint(EndpointId endpointId) const;
+
+    const CachedClusterVersions * FindCluster(EndpointId endpointId, ClusterId clusterId) const
+    {
+        uint32_t clusterIndex = FindClusterIndex(endpointId, clusterId);
+        return clusterIndex != kNoIndex ? &mClusters[clusterIndex].mVersions : nullptr;
+    }
+
+    CachedClusterVersions & FindOrAddCluster(EndpointId endpointId, ClusterId clusterId)
+    {
+        return mClusters[FindOrAddClusterIndex(endpointId, clusterId)].mVersions;
+    }
+
+    CHIP_ERROR SetData(const ConcreteAttributePath & path, TLV::TLVReader & aData, uint32_t aSize);
+    void SetStatus(const ConcreteAttributePath & path, const StatusIB & aStatus);
+    void SetSize(const ConcreteAttributePath & path, uint32_t aSize);
+
+    CHIP_ERROR GetAttribute(const ConcreteAttributePath & path, CachedAttribute & aAttribute) const;
+
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func) const
+    {
+        uint32_t clusterIndex = FindClusterIndex(endpointId, clusterId);
+        VerifyOrReturnError(clusterIndex != kNoIndex, CHIP_ERROR_KEY_NOT_FOUND);
+
+        const Cluster & cluster = mClusters[clusterIndex];
+        for (uint32_t i = cluster.mFirstAttribute; i != kNoIndex; i = mAttributes[i].mNext)
+        {
+            ReturnErrorOnFailure(func(mAttributes[i].mAttributeId, ToCachedAttribute(mAttributes[i], cluster)));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
+    {
+        const Endpoint * endpoint = FindEndpoint(endpointId);
+        VerifyOrReturnError(endpoint != nullptr, CHIP_NO_ERROR);
+
+        for (uint32_t i = endpoint->mFirstCluster; i != kNoIndex; i = mClusters[i].mNext)
+        {
+            ReturnErrorOnFailure(func(mClusters[i].mClusterId));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename IteratorFunc>
+    CHIP_ERROR ForEachEndpoint(IteratorFunc func) const
+    {
+        for (auto & endpoint : mEndpoints)
+        {
+            ReturnErrorOnFailure(func(endpoint.mEndpointId));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void EraseEndpoint(EndpointId endpointId);
+    void EraseCluster(const ConcreteClusterPath & cluster);
+    void EraseAttribute(const ConcreteAttributePath & attribute);
+
+private:
+    static constexpr uint32_t kNoIndex = UINT32_MAX;
+
+    struct Attribute
+    {
+        EndpointId mEndpointId;
+        ClusterId mClusterId;
+        AttributeId mAttributeId;
+        uint32_t mCluster; // Index of the owning cluster record, kNoIndex while on the free list.
+        uint32_t mNext;    // Next attribute of the cluster by attribute ID, or next free record.
+        CachedAttribute::Kind mKind;
+        StatusIB mStatus;
+        uint32_t mOffset; // Start of the TLV in the cluster arena, for kData.
+        uint32_t mSize;   // Length of the TLV for kData, encoded size for kSize.
+    };
+
+    struct Cluster
+    {
+        EndpointId mEndpointId;
+        ClusterId mClusterId;
+        bool mInUse;
+        uint32_t mFirstAttribute;
+        uint32_t mNext; // Next cluster of the endpoint by cluster ID, or next free record.
+        CachedClusterVersions mVersions;
+        std::vector<uint8_t> mArena;
+        size_t mLiveBytes;
+    };
+
+    struct Endpoint
+    {
+        EndpointId mEndpointId;
+        uint32_t mFirstCluster;
+    };
+
+    uint32_t FindClusterIndex(EndpointId endpointId, ClusterId clusterId) const;
+    uint32_t FindAttributeIndex(const ConcreteAttributePath & path) const;
+    uint32_t FindOrAddClusterIndex(EndpointId endpointId, ClusterId clusterId);
+    uint32_t FindOrAddAttributeIndex(const ConcreteAttributePath & path);
+    const Endpoint * FindEndpoint(EndpointId endpointId) const;
+
+    void ReleaseValue(Attribute & attribute);
+    void CompactArena(Cluster & cluster, size_t aReserve);
+    void FreeAttribute(uint32_t attributeIndex);
+    void FreeCluster(uint32_t clusterIndex);
+
+    void RebuildClusterTable(size_t aCapacity);
+    void RebuildAttributeTable(size_t aCapacity);
+
+    CachedAttribute ToCachedAttribute(const Attribute & attribute, const Cluster & cluster) const
+    {
+        CachedAttribute cached;
+        cached.mKind = attribute.mKind;
+        switch (attribute.mKind)
+        {
+        case CachedAttribute::Kind::kStatus:
+            cached.mStatus = attribute.mStatus;
+            break;
+        case CachedAttribute::Kind::kData:
+            cached.mData = ByteSpan(cluster.mArena.data() + attribute.mOffset, attribute.mSize);
+            break;
+        case CachedAttribute::Kind::kSize:
+            cached.mSize = attribute.mSize;
+            break;
+        }
+        return cached;
+    }
+
+    std::vector<Attribute> mAttributes;
+    std::vector<Cluster> mClusters;
+    std::vector<Endpoint> mEndpoints; // Sorted by endpoint ID.
+    uint32_t mFreeAttribute = kNoIndex;
+    uint32_t mFreeCluster   = kNoIndex;
+    size_t mAttributeCount  = 0;
+    size_t mClusterCount    = 0;
+
+    // Slots hold a record index, or one of the empty/deleted markers.  Sizes are zero or a power of two, and the
+    // tables are rebuilt before live plus deleted slots exceed three quarters of them.
+    std::vector<uint32_t> mAttributeTable;
+    std::vector<uint32_t> mClusterTable;
+    size_t mAttributeTableUsed = 0;
+    size_t mClusterTableUsed   = 0;
+};
+
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+using ClusterStateStorage = std::conditional_t<Storage == ClusterStateCacheStorage::kFlatHash, ClusterStateFlatStorage,
+                                               ClusterStateMapStorage<CanEnableDataCaching>>;
+
+} // namespace app
+} // namespace chip
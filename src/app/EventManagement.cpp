@@ -28,6 +28,9 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#include <algorithm>
+#include <string.h>
+
 using namespace chip::TLV;
 
 namespace chip {
@@ -66,6 +69,70 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+    EventNumber mEvictedEventNumber     = 0;
+    ClusterId mEvictedClusterId         = 0;
+};
+
+/**
+ * @brief
+ *   A read-only backing store over a contiguous range of the events in a CircularEventBuffer, handling the wraparound of the
+ *   underlying storage.  Lets a fetch start reading at a seek point instead of at the head of the buffer.
+ */
+class CircularEventBufferRange : public TLV::TLVBackingStore
+{
+public:
+    /**
+     * @param[in] aBuffer    The buffer to read from.
+     * @param[in] aPosition  Distance from the head of the buffer to the first event to read.
+     * @param[in] aLength    Number of bytes to read, must end on an event boundary within the buffer.
+     */
+    CircularEventBufferRange(const CircularEventBuffer & aBuffer, uint32_t aPosition, uint32_t aLength) :
+        mpQueue(aBuffer.GetQueue()), mQueueSize(aBuffer.GetTotalDataLength()),
+        mStart((static_cast<uint32_t>(aBuffer.QueueHead() - aBuffer.GetQueue()) + aPosition) % aBuffer.GetTotalDataLength()),
+        mLength(aLength)
+    {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = nullptr;
+        return GetNextBuffer(reader, bufStart, bufLen);
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        const uint32_t untilWrap = mQueueSize - mStart;
+        if (bufStart == nullptr)
+        {
+            bufStart = mpQueue + mStart;
+            bufLen   = std::min(mLength, untilWrap);
+        }
+        else if (bufStart == mpQueue + mQueueSize && mLength > untilWrap)
+        {
+            bufStart = mpQueue;
+            bufLen   = mLength - untilWrap;
+        }
+        else
+        {
+            bufLen = 0;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mpQueue;
+    uint32_t mQueueSize;
+    uint32_t mStart;
+    uint32_t mLength;
 };
 
 /**
@@ -203,7 +270,11 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
             // EvictEvent function
 
-            if (err != CHIP_NO_ERROR)
+            if (err == CHIP_NO_ERROR)
+            {
+                eventBuffer->IndexEviction(ctx.mEvictedEventNumber);
+            }
+            else
             {
                 VerifyOrExit(ctx.mSpaceNeededForMovedEvent != 0, /* no-op, return err */);
                 VerifyOrExit(eventBuffer->GetNextCircularEventBuffer() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
@@ -215,8 +286,11 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // Since we're calling CopyElement and we've checked
                     // that there is space in the next buffer, we don't expect
                     // this to fail.
-                    err = CopyToNextBuffer(eventBuffer);
+                    CircularEventBuffer * nextBuffer = eventBuffer->GetNextCircularEventBuffer();
+                    const uint8_t * movedEventStart  = nextBuffer->QueueTail();
+                    err                              = CopyToNextBuffer(eventBuffer);
                     SuccessOrExit(err);
+                    nextBuffer->IndexEvent(ctx.mEvictedEventNumber, ctx.mEvictedClusterId, movedEventStart);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
                     err                                 = eventBuffer->EvictHead();
@@ -226,6 +300,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // caller know that we could not honor the
                     // request
                     SuccessOrExit(err);
+                    eventBuffer->IndexEviction(ctx.mEvictedEventNumber);
                     continue;
                 }
                 // we cannot copy event outright. We remember the
@@ -425,6 +500,7 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     aEventNumber                 = 0;
     CircularTLVWriter checkpoint = writer;
     EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
+    const uint8_t * eventStart   = nullptr;
     EventOptions opts;
 
     Timestamp timestamp;
@@ -463,9 +539,12 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = EnsureSpaceInCircularBuffer(requestSize, aEventOptions.mPriority);
     SuccessOrExit(err);
 
-    err = ConstructEvent(&ctxt, apDelegate, &opts);
+    eventStart = mpEventBuffer->QueueTail();
+    err        = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
+    mpEventBuffer->IndexEvent(mLastEventNumber, opts.mPath.mClusterId, eventStart);
+
     mBytesWritten += writer.GetLengthWritten();
 
 exit:
@@ -646,22 +725,27 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
                                              EventNumber & aEventMin, size_t & aEventCount,
                                              const Access::SubjectDescriptor & aSubjectDescriptor)
 {
-    // TODO: Add particular set of event Paths in FetchEventsSince so that we can filter the interested paths
-    CHIP_ERROR err     = CHIP_NO_ERROR;
-    const bool recurse = false;
-    TLVReader reader;
-    CircularEventBufferWrapper bufWrapper;
+    CHIP_ERROR err = CHIP_NO_ERROR;
     EventLoadOutContext context(aWriter, PriorityLevel::Invalid, aEventMin);
+    CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical);
+    uint32_t interestSummary     = 0;
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
-    SuccessOrExit(err);
+    VerifyOrExit(buffer != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
 
-    err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
-    if (err == CHIP_END_OF_TLV)
+    for (auto * path = apEventPathList; path != nullptr; path = path->mpNext)
     {
-        err = CHIP_NO_ERROR;
+        interestSummary |= path->mValue.HasWildcardClusterId() ? UINT32_MAX
+                                                               : CircularEventBuffer::ClusterSummaryFor(path->mValue.mClusterId);
+    }
+
+    // Events get older going from the lowest priority buffer to the highest one, so walking the buffers the other way around
+    // visits the events in the order they were numbered.
+    for (; buffer != nullptr; buffer = buffer->GetPreviousCircularEventBuffer())
+    {
+        err = FetchEventsFromBuffer(*buffer, interestSummary, context);
+        SuccessOrExit(err);
     }
 
 exit:
@@ -679,6 +763,52 @@ exit:
     return err;
 }
 
+CHIP_ERROR EventManagement::FetchEventsFromBuffer(CircularEventBuffer & aBuffer, uint32_t aInterestSummary,
+                                                  EventLoadOutContext & aContext)
+{
+    const uint32_t length = aBuffer.DataLength();
+    VerifyOrReturnError(length > 0, CHIP_NO_ERROR);
+
+    auto copyEvents = [&](uint32_t aPosition, uint32_t aLength) {
+        CircularEventBufferRange range(aBuffer, aPosition, aLength);
+        TLVReader reader;
+        ReturnErrorOnFailure(reader.Init(range, aLength));
+        CHIP_ERROR err = TLV::Utilities::Iterate(reader, CopyEventsSince, &aContext, false /*recurse*/);
+        return err == CHIP_END_OF_TLV ? CHIP_NO_ERROR : err;
+    };
+
+    // The seek points describe the buffer only if every eviction went through EnsureSpaceInCircularBuffer; should that ever not
+    // be the case, fall back to reading the whole buffer.
+    const CircularEventBuffer::SeekPoint * seekPoints = aBuffer.GetSeekPoints();
+    const size_t seekPointCount                       = aBuffer.GetSeekPointCount();
+    uint32_t positions[CHIP_CONFIG_EVENT_LOGGING_SEEK_POINTS];
+    bool indexed = seekPointCount > 0;
+    for (size_t i = 0; indexed && i < seekPointCount; i++)
+    {
+        positions[i] = aBuffer.PositionOf(seekPoints[i].mOffset);
+        indexed      = (positions[i] < length) && (i == 0 ? positions[i] == 0 : positions[i] > positions[i - 1]);
+    }
+    if (!indexed)
+    {
+        return copyEvents(0, length);
+    }
+
+    for (size_t i = 0; i < seekPointCount; i++)
+    {
+        const bool last              = (i + 1 == seekPointCount);
+        const EventNumber newestHere = last ? aBuffer.GetNewestEventNumber() : seekPoints[i + 1].mEventNumber - 1;
+        if (newestHere < aContext.mStartingEventNumber || (seekPoints[i].mClusterSummary & aInterestSummary) == 0)
+        {
+            // Nothing in this segment would be reported.  Account for it as if its events had been read and filtered out, so
+            // that aEventMin still moves past them.
+            aContext.mCurrentEventNumber = newestHere;
+            continue;
+        }
+        ReturnErrorOnFailure(copyEvents(positions[i], (last ? length : positions[i + 1]) - positions[i]));
+    }
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR EventManagement::FabricRemovedCB(const TLV::TLVReader & aReader, size_t aDepth, void * apContext)
 {
     // the function does not actually remove the event, instead, it sets the fabric index to an invalid value.
@@ -831,6 +961,8 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
 
     ReclaimEventCtx * const ctx             = static_cast<ReclaimEventCtx *>(apAppData);
     CircularEventBuffer * const eventBuffer = ctx->mpEventBuffer;
+    ctx->mEvictedEventNumber                = context.mEventNumber;
+    ctx->mEvictedClusterId                  = context.mClusterId;
     if (eventBuffer->IsFinalDestinationForPriority(imp))
     {
         ChipLogProgress(EventLogging,
@@ -863,9 +995,75 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
                                CircularEventBuffer * apNext, PriorityLevel aPriorityLevel)
 {
     TLVCircularBuffer::Init(apBuffer, aBufferLength);
-    mpPrev    = apPrev;
-    mpNext    = apNext;
-    mPriority = aPriorityLevel;
+    mpPrev             = apPrev;
+    mpNext             = apNext;
+    mPriority          = aPriorityLevel;
+    mSeekPointCount    = 0;
+    mNewestEventNumber = 0;
+}
+
+uint32_t CircularEventBuffer::ClusterSummaryFor(ClusterId aClusterId)
+{
+    uint32_t hash = aClusterId * 0x9e3779b1;
+    return 1u << (hash >> 27);
+}
+
+uint32_t CircularEventBuffer::PositionOf(uint32_t aOffset) const
+{
+    const uint32_t head = static_cast<uint32_t>(QueueHead() - GetQueue());
+    return (aOffset + GetTotalDataLength() - head) % GetTotalDataLength();
+}
+
+void CircularEventBuffer::IndexEvent(EventNumber aEventNumber, ClusterId aClusterId, const uint8_t * apEventStart)
+{
+    const uint32_t offset  = static_cast<uint32_t>(apEventStart - GetQueue());
+    const uint32_t summary = ClusterSummaryFor(aClusterId);
+
+    // Seek points go roughly every 1/CHIP_CONFIG_EVENT_LOGGING_SEEK_POINTS of the buffer.  A seek point is only taken at an event
+    // numbered above everything already in the buffer, so that nothing before it can have the number it records.
+    if (mSeekPointCount > 0)
+    {
+        SeekPoint & current     = mSeekPoints[mSeekPointCount - 1];
+        const uint32_t distance = (offset + GetTotalDataLength() - current.mOffset) % GetTotalDataLength();
+        if (aEventNumber <= mNewestEventNumber || distance < GetTotalDataLength() / CHIP_CONFIG_EVENT_LOGGING_SEEK_POINTS)
+        {
+            current.mClusterSummary |= summary;
+            mNewestEventNumber = std::max(mNewestEventNumber, aEventNumber);
+            return;
+        }
+    }
+
+    if (mSeekPointCount == MATTER_ARRAY_SIZE(mSeekPoints))
+    {
+        // Fold the second segment into the first one, which keeps the first seek point at the head of the buffer.
+        mSeekPoints[0].mClusterSummary |= mSeekPoints[1].mClusterSummary;
+        memmove(&mSeekPoints[1], &mSeekPoints[2], (mSeekPointCount - 2) * sizeof(SeekPoint));
+        mSeekPointCount--;
+    }
+    mSeekPoints[mSeekPointCount++] = { aEventNumber, offset, summary };
+    mNewestEventNumber             = aEventNumber;
+}
+
+void CircularEventBuffer::IndexEviction(EventNumber aEventNumber)
+{
+    if (DataLength() == 0)
+    {
+        mSeekPointCount = 0;
+        return;
+    }
+    VerifyOrReturn(mSeekPointCount > 0);
+
+    // The evicted event belonged to the first segment.  Either the second segment now starts at the head, or the first segment
+    // shrinks to the event after the evicted one, whose number is at least one more.
+    const uint32_t head = static_cast<uint32_t>(QueueHead() - GetQueue()) % GetTotalDataLength();
+    if (mSeekPointCount > 1 && mSeekPoints[1].mOffset == head)
+    {
+        memmove(&mSeekPoints[0], &mSeekPoints[1], (mSeekPointCount - 1) * sizeof(SeekPoint));
+        mSeekPointCount--;
+        return;
+    }
+    mSeekPoints[0].mOffset      = head;
+    mSeekPoints[0].mEventNumber = std::max(mSeekPoints[0].mEventNumber, aEventNumber + 1);
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
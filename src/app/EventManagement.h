@@ -34,6 +34,7 @@
 #include <app/MessageDef/StatusIB.h>
 #include <app/data-model-provider/EventsGenerator.h>
 #include <app/util/basic-types.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/TLVCircularBuffer.h>
 #include <lib/support/CHIPCounter.h>
 #include <lib/support/LinkedList.h>
@@ -130,6 +131,49 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   A position in the buffer where an event starts.
+     *
+     * The events between a seek point and the next one (or the end of the buffer) form a segment.  mEventNumber is greater than
+     * the number of any event before the segment and at most the number of any event in it.  mClusterSummary has the
+     * ClusterSummaryFor bit of every cluster that logged an event in the segment set.
+     */
+    struct SeekPoint
+    {
+        EventNumber mEventNumber;
+        uint32_t mOffset; ///< Offset of the event from the start of the underlying storage
+        uint32_t mClusterSummary;
+    };
+
+    static uint32_t ClusterSummaryFor(ClusterId aClusterId);
+
+    /**
+     * @brief
+     *   Update the seek points after an event was appended to the buffer.
+     *
+     * @param[in] aEventNumber  The number of the event.
+     * @param[in] aClusterId    The cluster the event was logged for.
+     * @param[in] apEventStart  Where the event starts in the buffer, i.e. QueueTail() before the event was written.
+     */
+    void IndexEvent(EventNumber aEventNumber, ClusterId aClusterId, const uint8_t * apEventStart);
+
+    /**
+     * @brief
+     *   Update the seek points after the event at the head of the buffer, numbered aEventNumber, was evicted.
+     */
+    void IndexEviction(EventNumber aEventNumber);
+
+    const SeekPoint * GetSeekPoints() const { return mSeekPoints; }
+    size_t GetSeekPointCount() const { return mSeekPointCount; }
+    EventNumber GetNewestEventNumber() const { return mNewestEventNumber; }
+
+    /**
+     * @brief
+     *   Convert an offset from the start of the underlying storage into a distance from the head of the buffer.
+     */
+    uint32_t PositionOf(uint32_t aOffset) const;
+
     ~CircularEventBuffer() override = default;
 
 private:
@@ -141,6 +185,12 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+    static_assert(CHIP_CONFIG_EVENT_LOGGING_SEEK_POINTS >= 2, "Event buffers need at least two seek points");
+
+    SeekPoint mSeekPoints[CHIP_CONFIG_EVENT_LOGGING_SEEK_POINTS]; ///< Ordered by offset from the head, the first one is at the head
+    size_t mSeekPointCount         = 0;
+    EventNumber mNewestEventNumber = 0; ///< Number of the last event appended to the buffer
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -494,6 +544,17 @@ private:
      */
     static CHIP_ERROR CopyEventsSince(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
 
+    /**
+     * @brief
+     *   Internal API used to implement #FetchEventsSince
+     *
+     * Copy the events of a single buffer that apContext asks for into its TLVWriter.  The seek points of the buffer are used to
+     * skip the events numbered below the starting event number and the segments whose cluster summary has no bit in common with
+     * aInterestSummary.
+     */
+    static CHIP_ERROR FetchEventsFromBuffer(CircularEventBuffer & aBuffer, uint32_t aInterestSummary,
+                                            EventLoadOutContext & aContext);
+
     /**
      * @brief Internal iterator function used to scan and filter though event logs
      *
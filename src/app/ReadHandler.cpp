@@ -105,6 +105,7 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
             return;
         }
     }
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().RegisterInterestPaths(*this);
     for (size_t i = 0; i < resumptionSessionEstablisher.mSubscriptionInfo.mEventPaths.AllocatedSize(); i++)
     {
         EventPathParams params = resumptionSessionEstablisher.mSubscriptionInfo.mEventPaths[i].GetParams();
@@ -155,6 +156,7 @@ ReadHandler::~ReadHandler()
     {
         mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReportConfirm();
     }
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().UnregisterInterestPaths(*this);
     mManagementCallback.GetInteractionModelEngine()->ReleaseAttributePathList(mpAttributePathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseEventPathList(mpEventPathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
@@ -506,6 +508,7 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
     if (CHIP_END_OF_TLV == err)
     {
         mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
+        mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().RegisterInterestPaths(*this);
         mAttributePathExpandPosition = AttributePathExpandIterator::Position::StartIterating(mpAttributePathList);
         err                          = CHIP_NO_ERROR;
     }
@@ -325,6 +325,9 @@ private:
 
         // Don't need the response for report data if true
         SuppressResponse = (1 << 5),
+
+        // The attribute paths of this handler could not be added to the reporting engine interest index.
+        InterestPathsUnindexed = (1 << 6),
     };
 
     /**
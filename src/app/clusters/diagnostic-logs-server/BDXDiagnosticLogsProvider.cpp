@@ -153,11 +153,7 @@ void BDXDiagnosticLogsProvider::OnMsgToSend(TransferSession::OutputEvent & event
 
     // All messages sent from the Sender expect a response, except for a StatusReport which would indicate an error and the
     // end of the transfer.
-    Messaging::SendFlags sendFlags;
-    if (!isStatusReport)
-    {
-        sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse);
-    }
+    auto sendFlags = GetTransferMessageSendFlags(*mBDXTransferExchangeCtx, msgTypeData, !isStatusReport);
 
     auto err =
         mBDXTransferExchangeCtx->SendMessage(msgTypeData.ProtocolId, msgTypeData.MessageType, std::move(event.MsgData), sendFlags);
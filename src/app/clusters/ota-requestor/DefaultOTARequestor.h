@@ -25,6 +25,7 @@
 #include <app/CASESessionManager.h>
 #include <app/server/Server.h>
 #include <protocols/bdx/BdxMessages.h>
+#include <protocols/bdx/TransferFacilitator.h>
 
 #include "BDXDownloader.h"
 #include "OTARequestorDriver.h"
@@ -134,12 +135,10 @@ private:
             ChipLogDetail(SoftwareUpdate, "BDX::SendMessage");
             VerifyOrReturnError(mExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-            chip::Messaging::SendFlags sendFlags;
-            if (!event.msgTypeData.HasMessageType(chip::bdx::MessageType::BlockAckEOF) &&
-                !event.msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
-            {
-                sendFlags.Set(chip::Messaging::SendMessageFlags::kExpectResponse);
-            }
+            const bool expectResponse = !event.msgTypeData.HasMessageType(chip::bdx::MessageType::BlockAckEOF) &&
+                !event.msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport);
+            chip::Messaging::SendFlags sendFlags =
+                chip::bdx::GetTransferMessageSendFlags(*mExchangeCtx, event.msgTypeData, expectResponse);
             CHIP_ERROR err = mExchangeCtx->SendMessage(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType,
                                                        event.MsgData.Retain(), sendFlags);
             if (err != CHIP_NO_ERROR)
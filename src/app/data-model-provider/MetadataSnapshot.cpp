@@ -0,0 +1,139 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/data-model-provider/MetadataSnapshot.h>
+
+#include <app/data-model-provider/ProviderMetadataTree.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+MetadataSnapshot * MetadataSnapshot::Create(ProviderMetadataTree & tree, CacheAttributesPredicate cacheAttributes, void * context)
+{
+    ListBuilder<EndpointId> endpointIds;
+    ListBuilder<Range> endpointClusters;
+    ListBuilder<ClusterId> clusterIds;
+    ListBuilder<Range> clusterAttributes;
+    ListBuilder<AttributeId> attributeIds;
+
+    ReadOnlyBuffer<EndpointEntry> endpoints = tree.EndpointsIgnoreError();
+    VerifyOrReturnValue(endpointIds.EnsureAppendCapacity(endpoints.size()) == CHIP_NO_ERROR, nullptr);
+    VerifyOrReturnValue(endpointClusters.EnsureAppendCapacity(endpoints.size()) == CHIP_NO_ERROR, nullptr);
+
+    for (const auto & endpoint : endpoints)
+    {
+        ReadOnlyBuffer<ServerClusterEntry> clusters = tree.ServerClustersIgnoreError(endpoint.id);
+        VerifyOrReturnValue(CanCastTo<uint32_t>(clusterIds.Size() + clusters.size()), nullptr);
+        VerifyOrReturnValue(clusterIds.EnsureAppendCapacity(clusters.size()) == CHIP_NO_ERROR, nullptr);
+        VerifyOrReturnValue(clusterAttributes.EnsureAppendCapacity(clusters.size()) == CHIP_NO_ERROR, nullptr);
+
+        const Range clusterRange = { static_cast<uint32_t>(clusterIds.Size()), static_cast<uint32_t>(clusters.size()) };
+        VerifyOrReturnValue(endpointIds.Append(endpoint.id) == CHIP_NO_ERROR, nullptr);
+        VerifyOrReturnValue(endpointClusters.Append(clusterRange) == CHIP_NO_ERROR, nullptr);
+
+        for (const auto & cluster : clusters)
+        {
+            const ConcreteClusterPath path(endpoint.id, cluster.clusterId);
+            Range attributeRange = { kNotCached, 0 };
+
+            if (cacheAttributes(context, path))
+            {
+                ReadOnlyBuffer<AttributeEntry> attributes = tree.AttributesIgnoreError(path);
+                VerifyOrReturnValue(CanCastTo<uint32_t>(attributeIds.Size() + attributes.size()), nullptr);
+                VerifyOrReturnValue(attributeIds.EnsureAppendCapacity(attributes.size()) == CHIP_NO_ERROR, nullptr);
+
+                attributeRange = { static_cast<uint32_t>(attributeIds.Size()), static_cast<uint32_t>(attributes.size()) };
+                for (const auto & attribute : attributes)
+                {
+                    VerifyOrReturnValue(attributeIds.Append(attribute.attributeId) == CHIP_NO_ERROR, nullptr);
+                }
+            }
+
+            VerifyOrReturnValue(clusterIds.Append(cluster.clusterId) == CHIP_NO_ERROR, nullptr);
+            VerifyOrReturnValue(clusterAttributes.Append(attributeRange) == CHIP_NO_ERROR, nullptr);
+        }
+    }
+
+    MetadataSnapshot * snapshot = Platform::New<MetadataSnapshot>();
+    VerifyOrReturnValue(snapshot != nullptr, nullptr);
+
+    snapshot->mEndpointIds       = endpointIds.TakeBuffer();
+    snapshot->mEndpointClusters  = endpointClusters.TakeBuffer();
+    snapshot->mClusterIds        = clusterIds.TakeBuffer();
+    snapshot->mClusterAttributes = clusterAttributes.TakeBuffer();
+    snapshot->mAttributeIds      = attributeIds.TakeBuffer();
+    return snapshot;
+}
+
+Span<const ClusterId> MetadataSnapshot::ServerClusters(EndpointId endpointId) const
+{
+    for (size_t i = 0; i < mEndpointIds.size(); i++)
+    {
+        if (mEndpointIds[i] == endpointId)
+        {
+            return mClusterIds.SubSpan(mEndpointClusters[i].first, mEndpointClusters[i].count);
+        }
+    }
+    return {};
+}
+
+bool MetadataSnapshot::FindCluster(const ConcreteClusterPath & path, size_t & index) const
+{
+    for (size_t i = 0; i < mEndpointIds.size(); i++)
+    {
+        if (mEndpointIds[i] != path.mEndpointId)
+        {
+            continue;
+        }
+
+        const Range & clusters = mEndpointClusters[i];
+        for (index = clusters.first; index < clusters.first + clusters.count; index++)
+        {
+            if (mClusterIds[index] == path.mClusterId)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    return false;
+}
+
+bool MetadataSnapshot::Attributes(const ConcreteClusterPath & path, Span<const AttributeId> & attributes) const
+{
+    size_t index;
+    if (!FindCluster(path, index))
+    {
+        // Clusters that do not exist have no attributes, which is as much as the provider would say.
+        attributes = {};
+        return true;
+    }
+
+    const Range & range = mClusterAttributes[index];
+    VerifyOrReturnValue(range.first != kNotCached, false);
+
+    attributes = mAttributeIds.SubSpan(range.first, range.count);
+    return true;
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -0,0 +1,93 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteClusterPath.h>
+#include <app/data-model-provider/MetadataList.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/ReferenceCounted.h>
+#include <lib/support/Span.h>
+
+#include <cstdint>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+class ProviderMetadataTree;
+
+/// An immutable copy of the endpoint/server cluster/attribute ID structure of a
+/// data model, as it was when the snapshot was created.
+///
+/// Expanding wildcard paths walks this structure over and over (every report of
+/// every wildcard subscription, resumed once per chunk). Providers whose
+/// structure rarely changes can keep a snapshot and hand it out, so that walking
+/// it needs neither provider calls nor allocations.
+///
+/// Snapshots are reference counted: a provider replaces its snapshot when its
+/// structure changes, while anyone still holding the old one keeps a consistent
+/// (if outdated) view until they release it.
+class MetadataSnapshot : public ReferenceCounted<MetadataSnapshot>
+{
+public:
+    /// Decides whether the attributes of a cluster are fixed for as long as the
+    /// structure generation of the provider does not change, and may be cached.
+    using CacheAttributesPredicate = bool (*)(void * context, const ConcreteClusterPath & path);
+
+    /// Creates a snapshot of the current structure of `tree`.
+    ///
+    /// Returns nullptr if the snapshot could not be allocated. The caller owns the
+    /// initial reference.
+    static MetadataSnapshot * Create(ProviderMetadataTree & tree, CacheAttributesPredicate cacheAttributes, void * context);
+
+    /// All (enabled) endpoints, in provider order.
+    Span<const EndpointId> Endpoints() const { return mEndpointIds; }
+
+    /// The server clusters on `endpointId`, in provider order. Empty if the endpoint does not exist.
+    Span<const ClusterId> ServerClusters(EndpointId endpointId) const;
+
+    /// Sets `attributes` to the attributes of the cluster at `path`, in provider order, and returns true.
+    ///
+    /// Returns false if the snapshot does not cache the attributes of that cluster, in which case
+    /// they have to be requested from the provider.
+    bool Attributes(const ConcreteClusterPath & path, Span<const AttributeId> & attributes) const;
+
+private:
+    struct Range
+    {
+        uint32_t first;
+        uint32_t count;
+    };
+
+    static constexpr uint32_t kNotCached = UINT32_MAX;
+
+    // Endpoint i has server clusters mClusterIds[mEndpointClusters[i].first...], and cluster j has attributes
+    // mAttributeIds[mClusterAttributes[j].first...] (unless mClusterAttributes[j].first is kNotCached).
+    ReadOnlyBuffer<EndpointId> mEndpointIds;
+    ReadOnlyBuffer<Range> mEndpointClusters;
+    ReadOnlyBuffer<ClusterId> mClusterIds;
+    ReadOnlyBuffer<Range> mClusterAttributes;
+    ReadOnlyBuffer<AttributeId> mAttributeIds;
+
+    /// Index into mClusterIds of the given cluster, if present.
+    bool FindCluster(const ConcreteClusterPath & path, size_t & index) const;
+};
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -22,6 +22,7 @@
 #include <app/ConcreteClusterPath.h>
 #include <app/ConcreteCommandPath.h>
 #include <app/data-model-provider/MetadataList.h>
+#include <app/data-model-provider/MetadataSnapshot.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/data-model/List.h>
 #include <lib/support/Span.h>
@@ -90,6 +91,13 @@ public:
     /// the attribute changes.
     virtual void Temporary_ReportAttributeChanged(const AttributePathParams & path) = 0;
 
+    /// Returns a snapshot of the current endpoint/cluster/attribute structure, retained on behalf of
+    /// the caller (who MUST Release() it), or nullptr if the provider does not keep snapshots.
+    ///
+    /// Callers that walk the structure repeatedly (e.g. wildcard path expansion) can use the snapshot
+    /// instead of the Endpoints/ServerClusters/Attributes calls above.
+    virtual MetadataSnapshot * RetainMetadataSnapshot() { return nullptr; }
+
     // "convenience" functions that just return the data and ignore the error
     // This returns the `ListBuilder<..>::TakeBuffer` from their equivalent fuctions as-is,
     // even after an error (e.g. not found would return empty data).
@@ -0,0 +1,387 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyPathSet.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+namespace {
+
+uint32_t MixBits(uint32_t value)
+{
+    value ^= value >> 16;
+    value *= 0x7feb352d;
+    value ^= value >> 15;
+    value *= 0x846ca68b;
+    value ^= value >> 16;
+    return value;
+}
+
+} // namespace
+
+uint16_t DirtyPathSet::ClusterBucket(EndpointId endpoint, ClusterId cluster) const
+{
+    return static_cast<uint16_t>(MixBits(cluster ^ MixBits(endpoint)) & mBucketMask);
+}
+
+uint16_t DirtyPathSet::EndpointBucket(EndpointId endpoint) const
+{
+    return static_cast<uint16_t>(MixBits(endpoint) & mBucketMask);
+}
+
+uint16_t & DirtyPathSet::ClusterChainHead(const AttributePathParams & path)
+{
+    if (path.HasWildcardEndpointId())
+    {
+        return mWildcardEndpointHead;
+    }
+    return mClusterBuckets[ClusterBucket(path.mEndpointId, path.mClusterId)];
+}
+
+void DirtyPathSet::Link(uint16_t index)
+{
+    Entry & entry = mEntries[index];
+
+    uint16_t & clusterHead = ClusterChainHead(entry);
+    entry.mNextInCluster   = clusterHead;
+    clusterHead            = index;
+
+    entry.mNextInEndpoint = kNoEntry;
+    if (!entry.HasWildcardEndpointId())
+    {
+        uint16_t & endpointHead = mEndpointBuckets[EndpointBucket(entry.mEndpointId)];
+        entry.mNextInEndpoint   = endpointHead;
+        endpointHead            = index;
+    }
+}
+
+void DirtyPathSet::Unlink(uint16_t index)
+{
+    Entry & entry = mEntries[index];
+
+    for (uint16_t * link = &ClusterChainHead(entry); *link != kNoEntry; link = &mEntries[*link].mNextInCluster)
+    {
+        if (*link == index)
+        {
+            *link = entry.mNextInCluster;
+            break;
+        }
+    }
+
+    if (!entry.HasWildcardEndpointId())
+    {
+        for (uint16_t * link = &mEndpointBuckets[EndpointBucket(entry.mEndpointId)]; *link != kNoEntry;
+             link             = &mEntries[*link].mNextInEndpoint)
+        {
+            if (*link == index)
+            {
+                *link = entry.mNextInEndpoint;
+                break;
+            }
+        }
+    }
+
+    entry.mNextInCluster  = kNoEntry;
+    entry.mNextInEndpoint = kNoEntry;
+}
+
+uint16_t DirtyPathSet::Allocate(const AttributePathParams & aPath, uint64_t aGeneration)
+{
+    uint16_t index = mFreeHead;
+    VerifyOrReturnValue(index != kNoEntry, kNoEntry);
+
+    Entry & entry                            = mEntries[index];
+    mFreeHead                                = entry.mNextInCluster;
+    static_cast<AttributePathParams &>(entry) = aPath;
+    entry.mGeneration                        = aGeneration;
+    Link(index);
+    mAllocated++;
+    return index;
+}
+
+void DirtyPathSet::Release(uint16_t index)
+{
+    Unlink(index);
+    mEntries[index].mGeneration    = 0;
+    mEntries[index].mNextInCluster = mFreeHead;
+    mFreeHead                      = index;
+    mAllocated--;
+}
+
+void DirtyPathSet::ReleaseAll()
+{
+    // Released entries are always unlinked, so an empty set with a free list has nothing to reset. This keeps clearing the
+    // dirty set after every report cheap for large capacities.
+    VerifyOrReturn(mAllocated != 0 || mFreeHead == kNoEntry);
+
+    for (uint16_t i = 0; i <= mBucketMask; i++)
+    {
+        mClusterBuckets[i]  = kNoEntry;
+        mEndpointBuckets[i] = kNoEntry;
+    }
+    for (uint16_t i = 0; i < mCapacity; i++)
+    {
+        mEntries[i].mGeneration     = 0;
+        mEntries[i].mNextInCluster  = static_cast<uint16_t>(i + 1 < mCapacity ? i + 1 : kNoEntry);
+        mEntries[i].mNextInEndpoint = kNoEntry;
+    }
+    mWildcardEndpointHead = kNoEntry;
+    mFreeHead             = 0;
+    mAllocated            = 0;
+}
+
+bool DirtyPathSet::ClearTombPaths()
+{
+    const uint16_t allocatedBefore = mAllocated;
+
+    for (uint16_t i = 0; i <= mBucketMask; i++)
+    {
+        mClusterBuckets[i]  = kNoEntry;
+        mEndpointBuckets[i] = kNoEntry;
+    }
+    mWildcardEndpointHead = kNoEntry;
+    mFreeHead             = kNoEntry;
+    mAllocated            = 0;
+
+    // Walk backwards so that the free list hands out the lowest indexes first.
+    for (uint16_t i = mCapacity; i-- > 0;)
+    {
+        Entry & entry = mEntries[i];
+        if (entry.mGeneration == 0)
+        {
+            entry.mNextInEndpoint = kNoEntry;
+            entry.mNextInCluster  = mFreeHead;
+            mFreeHead             = i;
+            continue;
+        }
+        Link(i);
+        mAllocated++;
+    }
+
+    return mAllocated < allocatedBefore;
+}
+
+template <typename Predicate>
+DirtyPathSet::Entry * DirtyPathSet::FindCovering(EndpointId endpoint, ClusterId cluster, Predicate && predicate) const
+{
+    auto scan = [&](uint16_t head) -> Entry * {
+        for (uint16_t i = head; i != kNoEntry; i = mEntries[i].mNextInCluster)
+        {
+            if (predicate(mEntries[i]))
+            {
+                return &mEntries[i];
+            }
+        }
+        return nullptr;
+    };
+
+    // A path can only be covered by stored paths with the same endpoint and cluster, with the same endpoint and a wildcard
+    // cluster, or with a wildcard endpoint.
+    Entry * found = nullptr;
+    if (endpoint != kInvalidEndpointId)
+    {
+        if (cluster != kInvalidClusterId && (found = scan(mClusterBuckets[ClusterBucket(endpoint, cluster)])) != nullptr)
+        {
+            return found;
+        }
+        if ((found = scan(mClusterBuckets[ClusterBucket(endpoint, kInvalidClusterId)])) != nullptr)
+        {
+            return found;
+        }
+    }
+    return scan(mWildcardEndpointHead);
+}
+
+bool DirtyPathSet::IsPathDirtySince(const ConcreteAttributePath & aPath, uint64_t aGeneration) const
+{
+    return FindCovering(aPath.mEndpointId, aPath.mClusterId, [&](const Entry & entry) {
+               return entry.mGeneration > aGeneration && entry.IsAttributePathSupersetOf(aPath);
+           }) != nullptr;
+}
+
+bool DirtyPathSet::MergeOverlappedAttributePath(const AttributePathParams & aPath, uint64_t aGeneration)
+{
+    Entry * covering = FindCovering(aPath.mEndpointId, aPath.mClusterId,
+                                    [&](const Entry & entry) { return entry.IsAttributePathSupersetOf(aPath); });
+    if (covering != nullptr)
+    {
+        covering->mGeneration = aGeneration;
+        return true;
+    }
+
+    // The new path may cover several stored paths: the first one is replaced by the new path, the others are redundant and
+    // released.
+    uint16_t replaced = kNoEntry;
+    auto absorb       = [&](uint16_t index) {
+        if (!aPath.IsAttributePathSupersetOf(mEntries[index]))
+        {
+            return;
+        }
+        if (replaced == kNoEntry)
+        {
+            replaced = index;
+            return;
+        }
+        Release(index);
+    };
+
+    if (!aPath.HasWildcardEndpointId() && !aPath.HasWildcardClusterId())
+    {
+        for (uint16_t i = mClusterBuckets[ClusterBucket(aPath.mEndpointId, aPath.mClusterId)], next; i != kNoEntry; i = next)
+        {
+            next = mEntries[i].mNextInCluster;
+            absorb(i);
+        }
+    }
+    else if (!aPath.HasWildcardEndpointId())
+    {
+        for (uint16_t i = mEndpointBuckets[EndpointBucket(aPath.mEndpointId)], next; i != kNoEntry; i = next)
+        {
+            next = mEntries[i].mNextInEndpoint;
+            absorb(i);
+        }
+    }
+    else
+    {
+        // Wildcard endpoint paths are rare enough that walking the whole set is fine.
+        for (uint16_t i = 0; i < mCapacity; i++)
+        {
+            if (mEntries[i].mGeneration != 0)
+            {
+                absorb(i);
+            }
+        }
+    }
+
+    VerifyOrReturnValue(replaced != kNoEntry, false);
+
+    Unlink(replaced);
+    static_cast<AttributePathParams &>(mEntries[replaced]) = aPath;
+    mEntries[replaced].mGeneration                        = aGeneration;
+    Link(replaced);
+    return true;
+}
+
+bool DirtyPathSet::MergePathsUnderSameCluster()
+{
+    bool merged = false;
+
+    for (uint16_t bucket = 0; bucket <= mBucketMask; bucket++)
+    {
+        for (uint16_t outer = mClusterBuckets[bucket]; outer != kNoEntry; outer = mEntries[outer].mNextInCluster)
+        {
+            Entry & outerPath = mEntries[outer];
+            if (outerPath.HasWildcardClusterId() || outerPath.mGeneration == 0)
+            {
+                continue;
+            }
+            for (uint16_t inner = outerPath.mNextInCluster; inner != kNoEntry; inner = mEntries[inner].mNextInCluster)
+            {
+                Entry & innerPath = mEntries[inner];
+                if (innerPath.mGeneration == 0 || innerPath.mEndpointId != outerPath.mEndpointId ||
+                    innerPath.mClusterId != outerPath.mClusterId)
+                {
+                    continue;
+                }
+                if (innerPath.mGeneration > outerPath.mGeneration)
+                {
+                    outerPath.mGeneration = innerPath.mGeneration;
+                }
+                outerPath.SetWildcardAttributeId();
+
+                // Releasing entries would break the chains we are walking, mark the path as a tomb by setting its generation
+                // to 0 and then clear it later.
+                innerPath.mGeneration = 0;
+                merged                = true;
+            }
+        }
+    }
+
+    return merged && ClearTombPaths();
+}
+
+bool DirtyPathSet::MergePathsUnderSameEndpoint()
+{
+    bool merged = false;
+
+    for (uint16_t bucket = 0; bucket <= mBucketMask; bucket++)
+    {
+        for (uint16_t outer = mEndpointBuckets[bucket]; outer != kNoEntry; outer = mEntries[outer].mNextInEndpoint)
+        {
+            Entry & outerPath = mEntries[outer];
+            if (outerPath.mGeneration == 0)
+            {
+                continue;
+            }
+            for (uint16_t inner = outerPath.mNextInEndpoint; inner != kNoEntry; inner = mEntries[inner].mNextInEndpoint)
+            {
+                Entry & innerPath = mEntries[inner];
+                if (innerPath.mGeneration == 0 || innerPath.mEndpointId != outerPath.mEndpointId)
+                {
+                    continue;
+                }
+                if (innerPath.mGeneration > outerPath.mGeneration)
+                {
+                    outerPath.mGeneration = innerPath.mGeneration;
+                }
+                // This changes the (endpoint, cluster) key of the outer path, ClearTombPaths rebuilds the indexes.
+                outerPath.SetWildcardClusterId();
+                outerPath.SetWildcardAttributeId();
+
+                innerPath.mGeneration = 0;
+                merged                = true;
+            }
+        }
+    }
+
+    return merged && ClearTombPaths();
+}
+
+CHIP_ERROR DirtyPathSet::InsertPath(const AttributePathParams & aPath, uint64_t aGeneration)
+{
+    VerifyOrReturnError(aGeneration != 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!MergeOverlappedAttributePath(aPath, aGeneration), CHIP_NO_ERROR);
+
+    if (Exhausted() && !MergePathsUnderSameCluster() && !MergePathsUnderSameEndpoint())
+    {
+        ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
+        ReleaseAll();
+        Allocate(AttributePathParams(), aGeneration);
+    }
+
+    VerifyOrReturnError(!MergeOverlappedAttributePath(aPath, aGeneration), CHIP_NO_ERROR);
+    ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
+
+    if (Allocate(aPath, aGeneration) == kNoEntry)
+    {
+        // This should not happen, this path should be merged into the wildcard endpoint at least.
+        ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,205 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the set of dirty attribute paths tracked by the reporting engine.
+ *
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Iterators.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * A bounded set of dirty attribute paths, each tagged with the dirty set generation at which it was last marked dirty.
+ *
+ * Paths with a concrete endpoint are chained into two hash indexes: one keyed by (endpoint, cluster), where a wildcard
+ * cluster is its own key, and one keyed by endpoint only. Paths with a wildcard endpoint are kept on a separate list, which
+ * is expected to hold at most a handful of entries. This lets the reporting engine answer "is this concrete path dirty" and
+ * "which stored path covers this new path" by looking at three short chains instead of walking the whole set.
+ *
+ * When the set is full, paths are coarsened first by cluster, then by endpoint, and finally into a single wildcard path, so
+ * the set never grows past its capacity and never loses a dirty path.
+ *
+ * Storage is provided by DirtyPathSetWithStorage.
+ */
+class DirtyPathSet
+{
+public:
+    struct Entry : public AttributePathParams
+    {
+        // A generation of 0 marks an unused (or about to be released) entry.
+        uint64_t mGeneration = 0;
+
+    private:
+        friend class DirtyPathSet;
+
+        // Link in the (endpoint, cluster) chain, the wildcard endpoint list or the free list.
+        uint16_t mNextInCluster = kNoEntry;
+        // Link in the endpoint chain.
+        uint16_t mNextInEndpoint = kNoEntry;
+    };
+
+    DirtyPathSet(const DirtyPathSet &)             = delete;
+    DirtyPathSet & operator=(const DirtyPathSet &) = delete;
+
+    /**
+     * If the provided path is covered by one of the stored paths, update the generation of that path. Otherwise, if the
+     * provided path is a superset of some stored paths, replace them with the provided path.
+     *
+     * Returns whether one of the stored paths is now a superset of the provided path.
+     */
+    bool MergeOverlappedAttributePath(const AttributePathParams & aPath, uint64_t aGeneration);
+
+    /**
+     * Record the provided path as dirty at the given (non-zero) generation, coarsening the stored paths if the set is full.
+     */
+    CHIP_ERROR InsertPath(const AttributePathParams & aPath, uint64_t aGeneration);
+
+    /**
+     * Returns whether some stored path covering the provided concrete path was marked dirty after the given generation.
+     */
+    bool IsPathDirtySince(const ConcreteAttributePath & aPath, uint64_t aGeneration) const;
+
+    /**
+     * Merge the stored paths sharing an endpoint and a cluster into a wildcard attribute path.
+     *
+     * Returns whether we have released any paths.
+     */
+    bool MergePathsUnderSameCluster();
+
+    /**
+     * Merge the stored paths sharing an endpoint into a wildcard cluster path.
+     *
+     * Returns whether we have released any paths.
+     */
+    bool MergePathsUnderSameEndpoint();
+
+    void ReleaseAll();
+
+    size_t Allocated() const { return mAllocated; }
+    size_t Capacity() const { return mCapacity; }
+    bool Exhausted() const { return mAllocated == mCapacity; }
+
+    /**
+     * Call a function for each stored path. The function takes a `const Entry *` and returns a Loop value.
+     *
+     * The set must not be modified while iterating.
+     */
+    template <typename Function>
+    Loop ForEachActiveObject(Function && function) const
+    {
+        for (uint16_t i = 0; i < mCapacity; i++)
+        {
+            if (mEntries[i].mGeneration != 0 && function(static_cast<const Entry *>(&mEntries[i])) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+protected:
+    static constexpr uint16_t kNoEntry = UINT16_MAX;
+
+    static constexpr size_t BucketCountFor(size_t capacity)
+    {
+        size_t count = 1;
+        while (count < capacity)
+        {
+            count <<= 1;
+        }
+        return count;
+    }
+
+    DirtyPathSet(Entry * entries, uint16_t capacity, uint16_t * clusterBuckets, uint16_t * endpointBuckets,
+                 uint16_t bucketCount) :
+        mEntries(entries),
+        mClusterBuckets(clusterBuckets), mEndpointBuckets(endpointBuckets), mCapacity(capacity), mBucketMask(bucketCount - 1)
+    {}
+
+private:
+    uint16_t ClusterBucket(EndpointId endpoint, ClusterId cluster) const;
+    uint16_t EndpointBucket(EndpointId endpoint) const;
+
+    // Head of the (endpoint, cluster) chain for the path, or of the wildcard endpoint list.
+    uint16_t & ClusterChainHead(const AttributePathParams & path);
+
+    void Link(uint16_t index);
+    void Unlink(uint16_t index);
+    uint16_t Allocate(const AttributePathParams & aPath, uint64_t aGeneration);
+    void Release(uint16_t index);
+
+    /**
+     * Find a stored path that may cover paths under the given endpoint and cluster and satisfies the predicate.
+     */
+    template <typename Predicate>
+    Entry * FindCovering(EndpointId endpoint, ClusterId cluster, Predicate && predicate) const;
+
+    /**
+     * Rebuild the indexes, releasing every entry whose generation has been set to 0.
+     *
+     * Returns whether we have released any paths.
+     */
+    bool ClearTombPaths();
+
+    Entry * mEntries;
+    uint16_t * mClusterBuckets;
+    uint16_t * mEndpointBuckets;
+    uint16_t mCapacity;
+    uint16_t mBucketMask;
+    uint16_t mWildcardEndpointHead = kNoEntry;
+    uint16_t mFreeHead             = kNoEntry;
+    uint16_t mAllocated            = 0;
+};
+
+template <size_t kCapacity>
+class DirtyPathSetWithStorage : public DirtyPathSet
+{
+public:
+    static_assert(kCapacity > 0 && kCapacity <= (1u << 15), "Dirty path set indexes and bucket counts must fit in 16 bits");
+
+    DirtyPathSetWithStorage() :
+        DirtyPathSet(mEntryStorage, static_cast<uint16_t>(kCapacity), mClusterBucketStorage, mEndpointBucketStorage,
+                     static_cast<uint16_t>(kBucketCount))
+    {
+        ReleaseAll();
+    }
+
+private:
+    static constexpr size_t kBucketCount = BucketCountFor(kCapacity);
+
+    Entry mEntryStorage[kCapacity];
+    uint16_t mClusterBucketStorage[kBucketCount];
+    uint16_t mEndpointBucketStorage[kBucketCount];
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
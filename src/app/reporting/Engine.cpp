@@ -18,6 +18,8 @@
 
 #include <access/AccessRestrictionProvider.h>
 #include <access/Privilege.h>
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
 #include <app/AppConfig.h>
 #include <app/AttributePathExpandIterator.h>
 #include <app/ConcreteEventPath.h>
@@ -52,6 +54,9 @@ namespace {
 
 using Protocols::InteractionModel::Status;
 
+constexpr AttributePathParams kDeviceTypeListPath(Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::DeviceTypeList::Id);
+constexpr AttributePathParams kPartsListPath(Clusters::Descriptor::Id, Clusters::Descriptor::Attributes::PartsList::Id);
+
 /// Returns the status of ACL validation.
 ///   If the return value has a status set, that means the ACL check failed,
 ///   the read must not be performed, and the returned status (which may
@@ -245,6 +250,8 @@ void Engine::Shutdown()
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
     mGlobalDirtySet.ReleaseAll();
+    mInterestIndex.ReleaseAll();
+    mNumUnindexedReadHandlers = 0;
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -327,21 +334,9 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         {
             if (!apReadHandler->IsPriming())
             {
-                bool concretePathDirty = false;
-                // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration > apReadHandler->mPreviousReportsBeginGeneration)
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
+                // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                // started a report that it completed: those paths already got reported.
+                bool concretePathDirty = mGlobalDirtySet.IsPathDirtySince(readPath, apReadHandler->mPreviousReportsBeginGeneration);
 
                 if (!concretePathDirty)
                 {
@@ -915,164 +910,92 @@ void Engine::Run()
 
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->IsAttributePathSupersetOf(aAttributePath))
-        {
-            path->mGeneration = GetDirtySetGeneration();
-            return Loop::Break;
-        }
-        if (aAttributePath.IsAttributePathSupersetOf(*path))
-        {
-            // TODO: the wildcard input path may be superset of next paths in globalDirtySet, it is fine at this moment, since
-            // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
-            // want.
-            // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
-            path->mEndpointId  = aAttributePath.mEndpointId;
-            path->mClusterId   = aAttributePath.mClusterId;
-            path->mListIndex   = aAttributePath.mListIndex;
-            path->mAttributeId = aAttributePath.mAttributeId;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    return mGlobalDirtySet.MergeOverlappedAttributePath(aAttributePath, GetDirtySetGeneration());
 }
 
-bool Engine::ClearTombPaths()
+CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
 {
-    bool pathReleased = false;
-    mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->mGeneration == 0)
-        {
-            mGlobalDirtySet.ReleaseObject(path);
-            pathReleased = true;
-        }
-        return Loop::Continue;
-    });
-    return pathReleased;
+    return mGlobalDirtySet.InsertPath(aAttributePath, GetDirtySetGeneration());
 }
 
-bool Engine::MergeDirtyPathsUnderSameCluster()
+void Engine::RegisterInterestPaths(ReadHandler & aReadHandler)
 {
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardClusterId() || outerPath->mGeneration == 0)
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            // We don't support paths with a wildcard endpoint + a concrete cluster in global dirty set, so we do a simple == check
-            // here.
-            if (innerPath->mEndpointId != outerPath->mEndpointId || innerPath->mClusterId != outerPath->mClusterId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration > outerPath->mGeneration)
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration = 0;
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-
-    return ClearTombPaths();
+    if (mInterestIndex.Add(aReadHandler, aReadHandler.GetAttributePathList()) != CHIP_NO_ERROR)
+    {
+        ChipLogProgress(DataManagement, "Interest index full, attribute changes will be checked against every ReadHandler");
+        aReadHandler.mFlags.Set(ReadHandler::ReadHandlerFlags::InterestPathsUnindexed);
+        mNumUnindexedReadHandlers++;
+    }
 }
 
-bool Engine::MergeDirtyPathsUnderSameEndpoint()
+void Engine::UnregisterInterestPaths(ReadHandler & aReadHandler)
 {
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardEndpointId() || outerPath->mGeneration == 0)
+    if (aReadHandler.mFlags.Has(ReadHandler::ReadHandlerFlags::InterestPathsUnindexed))
+    {
+        aReadHandler.mFlags.Clear(ReadHandler::ReadHandlerFlags::InterestPathsUnindexed);
+        // The count is reset on Shutdown, which may happen before the handler is destroyed.
+        if (mNumUnindexedReadHandlers > 0)
         {
-            return Loop::Continue;
+            mNumUnindexedReadHandlers--;
         }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mEndpointId != outerPath->mEndpointId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration > outerPath->mGeneration)
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardClusterId();
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration = 0;
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-    return ClearTombPaths();
-}
-
-CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
-{
-    VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
-
-    if (mGlobalDirtySet.Exhausted() && !MergeDirtyPathsUnderSameCluster() && !MergeDirtyPathsUnderSameEndpoint())
-    {
-        ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
-        mGlobalDirtySet.ReleaseAll();
-        auto object         = mGlobalDirtySet.CreateObject();
-        object->mGeneration = GetDirtySetGeneration();
-    }
-
-    VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
-    ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
-
-    auto object = mGlobalDirtySet.CreateObject();
-    if (object == nullptr)
-    {
-        // This should not happen, this path should be merged into the wildcard endpoint at least.
-        ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
-        return CHIP_ERROR_NO_MEMORY;
+        return;
     }
-    *object             = aAttributePath;
-    object->mGeneration = GetDirtySetGeneration();
-
-    return CHIP_NO_ERROR;
+    mInterestIndex.Remove(aReadHandler, aReadHandler.GetAttributePathList());
 }
 
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
 
+    // Data model providers report device type and endpoint changes as Descriptor changes, which invalidate the device type
+    // resolutions remembered by access control.
+    if (aAttributePath.Intersects(kDeviceTypeListPath) || aAttributePath.Intersects(kPartsListPath))
+    {
+        GetAccessControl().InvalidateDeviceTypeCache();
+    }
+
     bool intersectsInterestPath     = false;
     DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
-    mpImEngine->mReadHandlers.ForEachActiveObject([&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
-        // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
-        // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
-        // waiting for a response to the last message chunk for read interactions.
-        if (handler->CanStartReporting() || handler->IsAwaitingReportResponse())
+
+    // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
+    // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
+    // waiting for a response to the last message chunk for read interactions.
+    auto markHandlerDirty = [&](ReadHandler & handler) {
+        if (handler.CanStartReporting() || handler.IsAwaitingReportResponse())
         {
+            handler.AttributePathIsDirty(dataModel, aAttributePath);
+            intersectsInterestPath = true;
+        }
+    };
+
+    if (!aAttributePath.IsWildcardPath() && mNumUnindexedReadHandlers == 0)
+    {
+        ConcreteAttributePath path(aAttributePath.mEndpointId, aAttributePath.mClusterId, aAttributePath.mAttributeId);
+        mInterestIndex.ForEachInterestedHandler(path, [&](ReadHandler & handler) {
+            // A handler may have several paths intersecting this one; AttributePathIsDirty sets its dirty generation to the
+            // current one, so that it is only marked once.
+            if (handler.mDirtyGeneration != GetDirtySetGeneration())
+            {
+                markHandlerDirty(handler);
+            }
+            return Loop::Continue;
+        });
+    }
+    else
+    {
+        mpImEngine->mReadHandlers.ForEachActiveObject([&aAttributePath, &markHandlerDirty](ReadHandler * handler) {
             for (auto object = handler->GetAttributePathList(); object != nullptr; object = object->mpNext)
             {
                 if (object->mValue.Intersects(aAttributePath))
                 {
-                    handler->AttributePathIsDirty(dataModel, aAttributePath);
-                    intersectsInterestPath = true;
+                    markHandlerDirty(*handler);
                     break;
                 }
             }
-        }
 
-        return Loop::Continue;
-    });
+            return Loop::Continue;
+        });
+    }
 
     if (!intersectsInterestPath)
     {
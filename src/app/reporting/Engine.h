@@ -29,6 +29,8 @@
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
 #include <app/data-model-provider/ProviderChangeListener.h>
+#include <app/reporting/DirtyPathSet.h>
+#include <app/reporting/InterestIndex.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -121,6 +123,14 @@ public:
         }
     }
 
+    /**
+     * Index the attribute paths of a read handler, so that SetDirty only visits it when one of those paths changes.  Must be
+     * called once the attribute path list of the handler is final, and balanced by UnregisterInterestPaths before that list is
+     * released.
+     */
+    void RegisterInterestPaths(ReadHandler & aReadHandler);
+    void UnregisterInterestPaths(ReadHandler & aReadHandler);
+
     uint32_t GetNumReportsInFlight() const { return mNumReportsInFlight; }
 
     uint64_t GetDirtySetGeneration() const { return mDirtyGeneration; }
@@ -151,13 +161,6 @@ private:
 
     bool IsRunScheduled() const { return mRunScheduled; }
 
-    struct AttributePathParamsWithGeneration : public AttributePathParams
-    {
-        AttributePathParamsWithGeneration() {}
-        AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
-        uint64_t mGeneration = 0;
-    };
-
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
@@ -207,29 +210,6 @@ private:
      */
     bool MergeOverlappedAttributePath(const AttributePathParams & aAttributePath);
 
-    /**
-     * If we are running out of ObjectPool for the global dirty set, we will try to merge the existing items by clusters.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool MergeDirtyPathsUnderSameCluster();
-
-    /**
-     * If we are running out of ObjectPool for the global dirty set and we cannot find a slot after merging the existing items by
-     * clusters, we will try to merge the existing items by endpoints.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool MergeDirtyPathsUnderSameEndpoint();
-
-    /**
-     * During the iterating of the paths, releasing the object in the inner loop will cause undefined behavior of the ObjectPool, so
-     * we replace the items to be cleared by a tomb first, then clear all the tombs after the iteration.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool ClearTombPaths();
-
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
     inline void BumpDirtySetGeneration() { mDirtyGeneration++; }
@@ -262,12 +242,14 @@ private:
      *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
      *
      */
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    // For unit tests, always use inline allocation for code coverage.
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mGlobalDirtySet;
-#else
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
-#endif
+    DirtyPathSetWithStorage<CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
+
+    /**
+     *  mInterestIndex maps the attribute paths requested by read handlers back to those handlers. Handlers whose paths did not
+     *  fit are counted in mNumUnindexedReadHandlers; while there are any, SetDirty checks every handler.
+     */
+    InterestIndexWithStorage<ReadHandler, CHIP_IM_SERVER_MAX_NUM_INTEREST_PATHS> mInterestIndex;
+    uint32_t mNumUnindexedReadHandlers = 0;
 
     /**
      * A generation counter for the dirty attrbute set.
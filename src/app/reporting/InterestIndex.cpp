@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/InterestIndex.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+namespace {
+
+uint32_t MixBits(uint32_t value)
+{
+    value ^= value >> 16;
+    value *= 0x7feb352d;
+    value ^= value >> 15;
+    value *= 0x846ca68b;
+    value ^= value >> 16;
+    return value;
+}
+
+bool HasSameKey(const AttributePathParams & path, EndpointId endpoint, ClusterId cluster, AttributeId attribute)
+{
+    return path.mEndpointId == endpoint && path.mClusterId == cluster && path.mAttributeId == attribute;
+}
+
+} // namespace
+
+uint16_t & InterestIndex::BucketFor(EndpointId endpoint, ClusterId cluster, AttributeId attribute) const
+{
+    uint32_t hash = MixBits(attribute ^ MixBits(cluster ^ MixBits(endpoint)));
+    return mBuckets[hash & mBucketMask];
+}
+
+void InterestIndex::ReleaseAll()
+{
+    for (uint16_t i = 0; i <= mBucketMask; i++)
+    {
+        mBuckets[i] = kNoEntry;
+    }
+    for (uint16_t i = 0; i < mCapacity; i++)
+    {
+        mEntries[i].mHandler = nullptr;
+        mEntries[i].mPath    = nullptr;
+        mEntries[i].mNext    = static_cast<uint16_t>(i + 1 < mCapacity ? i + 1 : kNoEntry);
+    }
+    mFreeHead  = 0;
+    mAllocated = 0;
+}
+
+CHIP_ERROR InterestIndex::AddPaths(void * handler, const SingleLinkedListNode<AttributePathParams> * paths)
+{
+    for (auto * node = paths; node != nullptr; node = node->mpNext)
+    {
+        if (mFreeHead == kNoEntry)
+        {
+            RemovePaths(handler, paths);
+            return CHIP_ERROR_NO_MEMORY;
+        }
+
+        const AttributePathParams & path = node->mValue;
+        uint16_t index                   = mFreeHead;
+        Entry & entry                    = mEntries[index];
+        uint16_t & head                  = BucketFor(path.mEndpointId, path.mClusterId, path.mAttributeId);
+
+        mFreeHead      = entry.mNext;
+        entry.mHandler = handler;
+        entry.mPath    = &path;
+        entry.mNext    = head;
+        head           = index;
+        mAllocated++;
+    }
+    return CHIP_NO_ERROR;
+}
+
+void InterestIndex::RemoveFromBucket(const void * handler, const AttributePathParams & path)
+{
+    uint16_t * link = &BucketFor(path.mEndpointId, path.mClusterId, path.mAttributeId);
+    while (*link != kNoEntry)
+    {
+        uint16_t index = *link;
+        Entry & entry  = mEntries[index];
+        if (entry.mHandler != handler)
+        {
+            link = &entry.mNext;
+            continue;
+        }
+
+        *link          = entry.mNext;
+        entry.mHandler = nullptr;
+        entry.mPath    = nullptr;
+        entry.mNext    = mFreeHead;
+        mFreeHead      = index;
+        mAllocated--;
+    }
+}
+
+void InterestIndex::RemovePaths(const void * handler, const SingleLinkedListNode<AttributePathParams> * paths)
+{
+    for (auto * node = paths; node != nullptr; node = node->mpNext)
+    {
+        RemoveFromBucket(handler, node->mValue);
+    }
+}
+
+Loop InterestIndex::ForEachInterestedHandlerInner(const ConcreteAttributePath & path, void * context, Visitor visitor) const
+{
+    const EndpointId endpoints[]   = { path.mEndpointId, kInvalidEndpointId };
+    const ClusterId clusters[]     = { path.mClusterId, kInvalidClusterId };
+    const AttributeId attributes[] = { path.mAttributeId, kInvalidAttributeId };
+
+    // Every requested path intersecting a concrete path is keyed by some mix of that path's components and wildcards. Entries
+    // are only matched against the exact key of the probe, so each of them is visited once even if two probes share a bucket.
+    for (EndpointId endpoint : endpoints)
+    {
+        for (ClusterId cluster : clusters)
+        {
+            for (AttributeId attribute : attributes)
+            {
+                for (uint16_t i = BucketFor(endpoint, cluster, attribute); i != kNoEntry; i = mEntries[i].mNext)
+                {
+                    const Entry & entry = mEntries[i];
+                    if (HasSameKey(*entry.mPath, endpoint, cluster, attribute) &&
+                        visitor(context, entry.mHandler) == Loop::Break)
+                    {
+                        return Loop::Break;
+                    }
+                }
+            }
+        }
+    }
+    return Loop::Finish;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
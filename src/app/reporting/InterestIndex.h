@@ -0,0 +1,157 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a reverse index from attribute paths to the read handlers interested in them.
+ *
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Iterators.h>
+#include <lib/support/LinkedList.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * A bounded reverse index from the attribute paths requested by read handlers to those handlers.
+ *
+ * Each requested path is hashed by its (endpoint, cluster, attribute) triple, where a wildcard component is kept as its own
+ * value. The handlers interested in a concrete path are then found by probing the eight combinations of that path's
+ * components and wildcards, instead of intersecting the dirty path with every path of every handler.
+ *
+ * The index only stores pointers to the handlers and to their path list nodes, which must outlive their registration.
+ *
+ * This class is type-erased, use InterestIndexWithStorage.
+ */
+class InterestIndex
+{
+public:
+    InterestIndex(const InterestIndex &)             = delete;
+    InterestIndex & operator=(const InterestIndex &) = delete;
+
+    void ReleaseAll();
+
+    size_t Allocated() const { return mAllocated; }
+    size_t Capacity() const { return mCapacity; }
+
+protected:
+    static constexpr uint16_t kNoEntry = UINT16_MAX;
+
+    struct Entry
+    {
+        void * mHandler                   = nullptr;
+        const AttributePathParams * mPath = nullptr;
+        // Link in the bucket chain or in the free list.
+        uint16_t mNext = kNoEntry;
+    };
+
+    using Visitor = Loop (*)(void * context, void * handler);
+
+    static constexpr size_t BucketCountFor(size_t capacity)
+    {
+        size_t count = 1;
+        while (count < capacity)
+        {
+            count <<= 1;
+        }
+        return count;
+    }
+
+    InterestIndex(Entry * entries, uint16_t capacity, uint16_t * buckets, uint16_t bucketCount) :
+        mEntries(entries), mBuckets(buckets), mCapacity(capacity), mBucketMask(static_cast<uint16_t>(bucketCount - 1))
+    {}
+
+    /**
+     * Index every path of the list for the handler. Either all the paths are indexed, or none is and CHIP_ERROR_NO_MEMORY is
+     * returned.
+     */
+    CHIP_ERROR AddPaths(void * handler, const SingleLinkedListNode<AttributePathParams> * paths);
+
+    /**
+     * Remove every entry of the handler for the paths of the list.
+     */
+    void RemovePaths(const void * handler, const SingleLinkedListNode<AttributePathParams> * paths);
+
+    /**
+     * Call the visitor for each (handler, requested path) pair whose requested path intersects the concrete path. A handler
+     * is visited once per intersecting path.
+     */
+    Loop ForEachInterestedHandlerInner(const ConcreteAttributePath & path, void * context, Visitor visitor) const;
+
+private:
+    uint16_t & BucketFor(EndpointId endpoint, ClusterId cluster, AttributeId attribute) const;
+    void RemoveFromBucket(const void * handler, const AttributePathParams & path);
+
+    Entry * mEntries;
+    uint16_t * mBuckets;
+    uint16_t mCapacity;
+    uint16_t mBucketMask;
+    uint16_t mFreeHead  = kNoEntry;
+    uint16_t mAllocated = 0;
+};
+
+template <typename Handler, size_t kCapacity>
+class InterestIndexWithStorage : public InterestIndex
+{
+public:
+    static_assert(kCapacity > 0 && kCapacity <= (1u << 15), "Interest index indexes and bucket counts must fit in 16 bits");
+
+    InterestIndexWithStorage() :
+        InterestIndex(mEntryStorage, static_cast<uint16_t>(kCapacity), mBucketStorage, static_cast<uint16_t>(kBucketCount))
+    {
+        ReleaseAll();
+    }
+
+    CHIP_ERROR Add(Handler & handler, const SingleLinkedListNode<AttributePathParams> * paths) { return AddPaths(&handler, paths); }
+
+    void Remove(const Handler & handler, const SingleLinkedListNode<AttributePathParams> * paths) { RemovePaths(&handler, paths); }
+
+    /**
+     * Call a function for each handler having requested a path that intersects the provided concrete path. The function takes
+     * a `Handler &` and returns a Loop value; it may be called several times for the same handler.
+     */
+    template <typename Function>
+    Loop ForEachInterestedHandler(const ConcreteAttributePath & path, Function && function) const
+    {
+        using FunctionType = std::remove_reference_t<Function>;
+        return ForEachInterestedHandlerInner(path, &function, [](void * context, void * handler) {
+            return (*static_cast<FunctionType *>(context))(*static_cast<Handler *>(handler));
+        });
+    }
+
+private:
+    static constexpr size_t kBucketCount = BucketCountFor(kCapacity);
+
+    Entry mEntryStorage[kCapacity];
+    uint16_t mBucketStorage[kBucketCount];
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
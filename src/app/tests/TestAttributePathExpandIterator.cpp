@@ -23,6 +23,8 @@
 #include <app/ConcreteAttributePath.h>
 #include <app/EventManagement.h>
 #include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <app/util/mock/MockNodeConfig.h>
 #include <data-model-providers/codegen/Instance.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/StringBuilderAdapters.h>
@@ -32,6 +34,8 @@
 #include <lib/support/LinkedList.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#include <algorithm>
+
 using namespace chip;
 using namespace chip::Test;
 using namespace chip::app;
@@ -516,4 +520,75 @@ TEST_F(TestAttributePathExpandIterator, TestMultipleClusInfo)
     }
 }
 
+#if CHIP_CONFIG_DATA_MODEL_METADATA_SNAPSHOTS
+
+TEST_F(TestAttributePathExpandIterator, TestMetadataSnapshotReused)
+{
+    DataModel::Provider * provider = CodegenDataModelProviderInstance(nullptr /* delegate */);
+
+    DataModel::MetadataSnapshot * first  = provider->RetainMetadataSnapshot();
+    DataModel::MetadataSnapshot * second = provider->RetainMetadataSnapshot();
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+
+    // every mock endpoint is in the snapshot, with all its clusters and their attributes
+    EXPECT_EQ(first->Endpoints().size(), 3u);
+    EXPECT_EQ(first->ServerClusters(kMockEndpoint3).size(), 4u);
+    EXPECT_EQ(first->ServerClusters(kInvalidEndpointId).size(), 0u);
+
+    Span<const AttributeId> attributes;
+    ASSERT_TRUE(first->Attributes(ConcreteClusterPath(kMockEndpoint2, MockClusterId(3)), attributes));
+    EXPECT_NE(std::find(attributes.begin(), attributes.end(), MockAttributeId(3)), attributes.end());
+
+    first->Release();
+    second->Release();
+}
+
+TEST_F(TestAttributePathExpandIterator, TestMetadataSnapshotRebuiltOnStructureChange)
+{
+    DataModel::Provider * provider = CodegenDataModelProviderInstance(nullptr /* delegate */);
+
+    DataModel::MetadataSnapshot * original = provider->RetainMetadataSnapshot();
+    ASSERT_NE(original, nullptr);
+
+    const MockNodeConfig config({
+        MockEndpointConfig(kMockEndpoint2, { MockClusterConfig(MockClusterId(1), { MockAttributeConfig(MockAttributeId(1)) }) }),
+    });
+    SetMockNodeConfig(config);
+
+    P paths[] = {
+        { kMockEndpoint2, MockClusterId(1), MockAttributeId(1) },
+        { kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::GeneratedCommandList::Id },
+        { kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::AcceptedCommandList::Id },
+        { kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::AttributeList::Id },
+    };
+
+    SingleLinkedListNode<app::AttributePathParams> clusInfo;
+    app::ConcreteAttributePath path;
+    size_t index = 0;
+
+    auto position = AttributePathExpandIterator::Position::StartIterating(&clusInfo);
+    app::AttributePathExpandIterator iter(provider, position);
+    while (iter.Next(path))
+    {
+        EXPECT_LT(index, MATTER_ARRAY_SIZE(paths));
+        EXPECT_EQ(paths[index], path);
+        index++;
+    }
+    EXPECT_EQ(index, MATTER_ARRAY_SIZE(paths));
+
+    // The new structure got a new snapshot; the one retained before the change is unaffected.
+    DataModel::MetadataSnapshot * updated = provider->RetainMetadataSnapshot();
+    ASSERT_NE(updated, nullptr);
+    EXPECT_NE(updated, original);
+    EXPECT_EQ(updated->Endpoints().size(), 1u);
+    EXPECT_EQ(original->Endpoints().size(), 3u);
+
+    updated->Release();
+    original->Release();
+    ResetMockNodeConfig();
+}
+
+#endif // CHIP_CONFIG_DATA_MODEL_METADATA_SNAPSHOTS
+
 } // namespace
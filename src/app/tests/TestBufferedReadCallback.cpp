@@ -15,6 +15,7 @@
  *    See the License for the specific language governing permissions and
  *    limitations under the License.
  */
+#include <cstring>
 #include <vector>
 
 #include "app-common/zap-generated/ids/Attributes.h"
@@ -24,6 +25,7 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app/BufferedReadCallback.h>
+#include <app/StatusResponse.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
 #include <app/tests/AppTestContext.h>
@@ -51,6 +53,7 @@ struct ValidationInstruction
         kListAttributeC_Empty,
         kListAttributeC_NotEmpty,
         kListAttributeC_NotEmpty_Chunked,
+        kListAttributeC_NotEmpty_MultiBuffer,
         kListAttributeC_Error,
         kListAttributeD_Empty,
         kListAttributeD_NotEmpty,
@@ -64,6 +67,10 @@ struct ValidationInstruction
 
 using InstructionListType = std::vector<ValidationInstruction>;
 
+// A list whose items carry enough payload that, once buffered, it spans several MTU sized packet buffers.
+constexpr uint32_t kMultiBufferListLength  = 64;
+constexpr size_t kMultiBufferPayloadLength = 100;
+
 using TestBufferedReadCallback = chip::Test::AppContext;
 
 class DataSeriesValidator : public BufferedReadCallback::Callback
@@ -193,6 +200,70 @@ void DataSeriesValidator::OnAttributeData(const ConcreteDataAttributePath & aPat
         break;
     }
 
+    case ValidationInstruction::kListAttributeC_NotEmpty_MultiBuffer: {
+        ChipLogProgress(DataManagement, "\t\t -- Validating C[%" PRIu32 "] over several buffers", kMultiBufferListLength);
+
+        EXPECT_EQ(aPath.mEndpointId, 0u);
+        EXPECT_EQ(aPath.mClusterId, Clusters::UnitTesting::Id);
+        EXPECT_EQ(aPath.mAttributeId, Clusters::UnitTesting::Attributes::ListStructOctetString::Id);
+        EXPECT_EQ(aPath.mListOp, ConcreteDataAttributePath::ListOperation::ReplaceAll);
+        EXPECT_GT(apData->GetRemainingLength(), kMaxSecureSduLengthBytes);
+
+        //
+        // Decode through a copy of the reader, leaving the one we were handed positioned on the list.
+        //
+        {
+            Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo::DecodableType value;
+            TLV::TLVReader copy;
+            size_t len;
+
+            copy.Init(*apData);
+            EXPECT_EQ(DataModel::Decode(copy, value), CHIP_NO_ERROR);
+            EXPECT_EQ(value.ComputeSize(&len), CHIP_NO_ERROR);
+            EXPECT_EQ(len, kMultiBufferListLength);
+
+            auto iter      = value.begin();
+            uint32_t index = 0;
+            while (iter.Next())
+            {
+                auto & iterValue = iter.GetValue();
+                EXPECT_EQ(iterValue.member1, index);
+                ASSERT_EQ(iterValue.member2.size(), kMultiBufferPayloadLength);
+                for (uint8_t byte : iterValue.member2)
+                {
+                    EXPECT_EQ(byte, static_cast<uint8_t>(index));
+                }
+                index++;
+            }
+            EXPECT_EQ(iter.GetStatus(), CHIP_NO_ERROR);
+            EXPECT_EQ(index, kMultiBufferListLength);
+        }
+
+        //
+        // Walk the same list item by item through a container reader opened on the original reader.
+        //
+        {
+            TLV::TLVReader listReader;
+            uint32_t index = 0;
+            CHIP_ERROR err;
+
+            EXPECT_EQ(apData->OpenContainer(listReader), CHIP_NO_ERROR);
+            while ((err = listReader.Next()) == CHIP_NO_ERROR)
+            {
+                Clusters::UnitTesting::Structs::TestListStructOctet::DecodableType item;
+                EXPECT_EQ(DataModel::Decode(listReader, item), CHIP_NO_ERROR);
+                EXPECT_EQ(item.member1, index);
+                EXPECT_EQ(item.member2.size(), kMultiBufferPayloadLength);
+                index++;
+            }
+            EXPECT_EQ(err, CHIP_END_OF_TLV);
+            EXPECT_EQ(index, kMultiBufferListLength);
+            EXPECT_EQ(apData->CloseContainer(listReader), CHIP_NO_ERROR);
+        }
+
+        break;
+    }
+
     case ValidationInstruction::kListAttributeD_Empty: {
         ChipLogProgress(DataManagement, "\t\t -- Validating D[]");
 
@@ -458,6 +529,53 @@ void DataSeriesGenerator::Generate()
             break;
         }
 
+        case ValidationInstruction::kListAttributeC_NotEmpty_MultiBuffer: {
+            hasData = false;
+            Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo::Type value;
+
+            {
+                ChipLogProgress(DataManagement, "\t -- Generating C[]");
+
+                path.mAttributeId = Clusters::UnitTesting::Attributes::ListStructOctetString::Id;
+                path.mListOp      = ConcreteDataAttributePath::ListOperation::ReplaceAll;
+                EXPECT_EQ(DataModel::Encode(writer, TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+
+                writer.Finalize(&handle);
+                reader.Init(std::move(handle));
+                EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+                callback->OnAttributeData(path, &reader, status);
+            }
+
+            ChipLogProgress(DataManagement, "\t -- Generating C0..C%" PRIu32 " with %u byte payloads", kMultiBufferListLength,
+                            static_cast<unsigned>(kMultiBufferPayloadLength));
+
+            for (uint32_t i = 0; i < kMultiBufferListLength; i++)
+            {
+                Clusters::UnitTesting::Structs::TestListStructOctet::Type listItem;
+                uint8_t payload[kMultiBufferPayloadLength];
+
+                handle = System::PacketBufferHandle::New(1000);
+                writer.Init(std::move(handle), true);
+                status = StatusIB();
+
+                path.mAttributeId = Clusters::UnitTesting::Attributes::ListStructOctetString::Id;
+                path.mListOp      = ConcreteDataAttributePath::ListOperation::AppendItem;
+
+                memset(payload, static_cast<uint8_t>(i), sizeof(payload));
+                listItem.member1 = i;
+                listItem.member2 = ByteSpan(payload);
+
+                EXPECT_EQ(DataModel::Encode(writer, TLV::AnonymousTag(), listItem), CHIP_NO_ERROR);
+
+                writer.Finalize(&handle);
+                reader.Init(std::move(handle));
+                EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+                callback->OnAttributeData(path, &reader, status);
+            }
+
+            break;
+        }
+
         case ValidationInstruction::kListAttributeD_NotEmpty_Chunked: {
             hasData = false;
             Clusters::UnitTesting::Attributes::ListInt8u::TypeInfo::Type value;
@@ -515,86 +633,107 @@ void DataSeriesGenerator::Generate()
     callback->OnReportEnd();
 }
 
-void RunAndValidateSequence(std::vector<ValidationInstruction> instructionList)
+void RunAndValidateSequence(std::vector<ValidationInstruction> instructionList, BufferedReadCallback::ListBufferingMode mode)
 {
     DataSeriesValidator validator(instructionList);
-    BufferedReadCallback bufferedCallback(validator);
+    BufferedReadCallback bufferedCallback(validator, mode);
     DataSeriesGenerator generator(bufferedCallback, instructionList);
     generator.Generate();
 
     EXPECT_EQ(validator.mCurrentInstruction, instructionList.size());
 }
 
-TEST_F(TestBufferedReadCallback, TestBufferedSequences)
+void ValidateSequences(BufferedReadCallback::ListBufferingMode mode)
 {
+    auto runAndValidateSequence = [mode](InstructionListType instructionList) { RunAndValidateSequence(instructionList, mode); };
+
     ChipLogProgress(DataManagement, "Validating various sequences of attribute data IBs...");
 
     ChipLogProgress(DataManagement, "A --> A");
-    RunAndValidateSequence({ { ValidationInstruction::kSimpleAttributeA } });
+    runAndValidateSequence({ { ValidationInstruction::kSimpleAttributeA } });
 
     ChipLogProgress(DataManagement, "A A --> A A");
-    RunAndValidateSequence({ { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kSimpleAttributeA } });
+    runAndValidateSequence({ { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kSimpleAttributeA } });
 
     ChipLogProgress(DataManagement, "A B --> A B");
-    RunAndValidateSequence({ { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kSimpleAttributeB } });
+    runAndValidateSequence({ { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kSimpleAttributeB } });
 
     ChipLogProgress(DataManagement, "A C[] --> A C[]");
-    RunAndValidateSequence({ { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kListAttributeC_Empty } });
+    runAndValidateSequence({ { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kListAttributeC_Empty } });
 
     ChipLogProgress(DataManagement, "C[] C[] --> C[]");
-    RunAndValidateSequence({ { ValidationInstruction::kListAttributeC_Empty, ValidationInstruction::kDiscardedChunk },
+    runAndValidateSequence({ { ValidationInstruction::kListAttributeC_Empty, ValidationInstruction::kDiscardedChunk },
                              { ValidationInstruction::kListAttributeC_Empty } });
 
     ChipLogProgress(DataManagement, "C[2] C[] --> C[]");
-    RunAndValidateSequence({ { ValidationInstruction::kListAttributeC_NotEmpty, ValidationInstruction::kDiscardedChunk },
+    runAndValidateSequence({ { ValidationInstruction::kListAttributeC_NotEmpty, ValidationInstruction::kDiscardedChunk },
                              { ValidationInstruction::kListAttributeC_Empty } });
 
     ChipLogProgress(DataManagement, "C[] C[2] --> C[2]");
-    RunAndValidateSequence({ { ValidationInstruction::kListAttributeC_Empty, ValidationInstruction::kDiscardedChunk },
+    runAndValidateSequence({ { ValidationInstruction::kListAttributeC_Empty, ValidationInstruction::kDiscardedChunk },
                              { ValidationInstruction::kListAttributeC_NotEmpty } });
 
     ChipLogProgress(DataManagement, "C[] A C[2] --> C[] A C[2]");
-    RunAndValidateSequence({ { ValidationInstruction::kListAttributeC_Empty },
+    runAndValidateSequence({ { ValidationInstruction::kListAttributeC_Empty },
                              { ValidationInstruction::kSimpleAttributeA },
                              { ValidationInstruction::kListAttributeC_NotEmpty } });
 
     ChipLogProgress(DataManagement, "C[] C[2] A --> C[] C[2] A");
-    RunAndValidateSequence({ { ValidationInstruction::kListAttributeC_Empty },
+    runAndValidateSequence({ { ValidationInstruction::kListAttributeC_Empty },
                              { ValidationInstruction::kSimpleAttributeA },
                              { ValidationInstruction::kListAttributeC_NotEmpty } });
 
     ChipLogProgress(DataManagement, "C[] D[] --> C[] D[]");
-    RunAndValidateSequence({ { ValidationInstruction::kListAttributeC_Empty }, { ValidationInstruction::kListAttributeD_Empty } });
+    runAndValidateSequence({ { ValidationInstruction::kListAttributeC_Empty }, { ValidationInstruction::kListAttributeD_Empty } });
 
     ChipLogProgress(DataManagement, "C[2] D[] --> C[2] D[]");
-    RunAndValidateSequence(
+    runAndValidateSequence(
         { { ValidationInstruction::kListAttributeC_NotEmpty }, { ValidationInstruction::kListAttributeD_Empty } });
 
     ChipLogProgress(DataManagement, "C[2] C|e --> C|e");
-    RunAndValidateSequence({ { ValidationInstruction::kListAttributeC_NotEmpty, ValidationInstruction::kDiscardedChunk },
+    runAndValidateSequence({ { ValidationInstruction::kListAttributeC_NotEmpty, ValidationInstruction::kDiscardedChunk },
                              { ValidationInstruction::kListAttributeC_Error } });
 
     ChipLogProgress(DataManagement, "A C|e --> A C|e");
-    RunAndValidateSequence({ { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kListAttributeC_Error } });
+    runAndValidateSequence({ { ValidationInstruction::kSimpleAttributeA }, { ValidationInstruction::kListAttributeC_Error } });
 
     ChipLogProgress(DataManagement, "C|e C[2] --> C|e C[2]");
-    RunAndValidateSequence(
+    runAndValidateSequence(
         { { ValidationInstruction::kListAttributeC_Error }, { ValidationInstruction::kListAttributeC_NotEmpty } });
 
     ChipLogProgress(DataManagement, "C[] C0 C1 --> C[2]");
-    RunAndValidateSequence({ { ValidationInstruction::kListAttributeC_NotEmpty_Chunked } });
+    runAndValidateSequence({ { ValidationInstruction::kListAttributeC_NotEmpty_Chunked } });
 
     ChipLogProgress(DataManagement, "C[] C0 C1 C[] --> C[]");
-    RunAndValidateSequence({
+    runAndValidateSequence({
         { ValidationInstruction::kListAttributeC_NotEmpty_Chunked, ValidationInstruction::kDiscardedChunk },
         { ValidationInstruction::kListAttributeC_Empty },
     });
 
+    ChipLogProgress(DataManagement, "C[] C0 .. C63 --> C[64] spanning several buffers");
+    runAndValidateSequence({ { ValidationInstruction::kListAttributeC_NotEmpty_MultiBuffer } });
+
+    ChipLogProgress(DataManagement, "C[] C0 .. C63 A --> C[64] A");
+    runAndValidateSequence({
+        { ValidationInstruction::kListAttributeC_NotEmpty_MultiBuffer },
+        { ValidationInstruction::kSimpleAttributeA },
+    });
+
     ChipLogProgress(DataManagement, "C[] C0 C1 D[] D0 D1 --> C[2] D[2]");
-    RunAndValidateSequence({
+    runAndValidateSequence({
         { ValidationInstruction::kListAttributeC_NotEmpty_Chunked },
         { ValidationInstruction::kListAttributeD_NotEmpty_Chunked },
     });
 }
 
+TEST_F(TestBufferedReadCallback, TestBufferedSequences)
+{
+    ValidateSequences(BufferedReadCallback::ListBufferingMode::kReassemble);
+}
+
+TEST_F(TestBufferedReadCallback, TestStreamedSequences)
+{
+    ValidateSequences(BufferedReadCallback::ListBufferingMode::kStream);
+}
+
 } // namespace
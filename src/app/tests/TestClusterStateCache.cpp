@@ -278,7 +278,8 @@ void DataSeriesGenerator::Generate(ForwardedDataCallbackValidator & dataCallback
     callback->OnReportEnd();
 }
 
-class CacheValidator : public ClusterStateCache::Callback
+template <typename CacheType>
+class CacheValidator : public CacheType::Callback
 {
 public:
     CacheValidator(AttributeInstructionListType & instructionList, ForwardedDataCallbackValidator & dataCallbackValidator);
@@ -309,7 +310,7 @@ private:
         }
     }
 
-    void DecodeAttribute(const AttributeInstruction & instruction, const ConcreteAttributePath & path, ClusterStateCache * cache)
+    void DecodeAttribute(const AttributeInstruction & instruction, const ConcreteAttributePath & path, CacheType * cache)
     {
         CHIP_ERROR err;
         bool gotStatus = false;
@@ -322,7 +323,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating A");
 
             Clusters::UnitTesting::Attributes::Int16u::TypeInfo::DecodableType v = 0;
-            err = cache->Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -341,7 +342,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating B");
 
             Clusters::UnitTesting::Attributes::OctetString::TypeInfo::DecodableType v;
-            err = cache->Get<Clusters::UnitTesting::Attributes::OctetString::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::OctetString::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -360,7 +361,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating C");
 
             Clusters::UnitTesting::Attributes::StructAttr::TypeInfo::DecodableType v;
-            err = cache->Get<Clusters::UnitTesting::Attributes::StructAttr::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::StructAttr::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -379,7 +380,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating D");
 
             Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo::DecodableType v;
-            err = cache->Get<Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -409,10 +410,9 @@ private:
         }
     }
 
-    void DecodeClusterObject(const AttributeInstruction & instruction, const ConcreteAttributePath & path,
-                             ClusterStateCache * cache)
+    void DecodeClusterObject(const AttributeInstruction & instruction, const ConcreteAttributePath & path, CacheType * cache)
     {
-        std::list<ClusterStateCache::AttributeStatus> statusList;
+        std::list<typename CacheType::AttributeStatus> statusList;
         EXPECT_EQ(cache->Get(path.mEndpointId, path.mClusterId, clusterValue, statusList), CHIP_NO_ERROR);
 
         if (instruction.mValueType == AttributeInstruction::kData)
@@ -462,7 +462,7 @@ private:
         }
     }
 
-    void OnAttributeChanged(ClusterStateCache * cache, const ConcreteAttributePath & path) override
+    void OnAttributeChanged(CacheType * cache, const ConcreteAttributePath & path) override
     {
         StatusIB status;
 
@@ -490,14 +490,14 @@ private:
         }
     }
 
-    void OnClusterChanged(ClusterStateCache * cache, EndpointId endpointId, ClusterId clusterId) override
+    void OnClusterChanged(CacheType * cache, EndpointId endpointId, ClusterId clusterId) override
     {
         auto iter = mExpectedClusters.find(std::make_tuple(endpointId, clusterId));
         ASSERT_NE(iter, mExpectedClusters.end());
         mExpectedClusters.erase(iter);
     }
 
-    void OnEndpointAdded(ClusterStateCache * cache, EndpointId endpointId) override
+    void OnEndpointAdded(CacheType * cache, EndpointId endpointId) override
     {
         auto iter = mExpectedEndpoints.find(endpointId);
         ASSERT_NE(iter, mExpectedEndpoints.end());
@@ -523,8 +523,9 @@ private:
     ForwardedDataCallbackValidator & mDataCallbackValidator;
 };
 
-CacheValidator::CacheValidator(AttributeInstructionListType & instructionList,
-                               ForwardedDataCallbackValidator & dataCallbackValidator) :
+template <typename CacheType>
+CacheValidator<CacheType>::CacheValidator(AttributeInstructionListType & instructionList,
+                                          ForwardedDataCallbackValidator & dataCallbackValidator) :
     mDataCallbackValidator(dataCallbackValidator)
 {
     for (auto & instruction : instructionList)
@@ -542,11 +543,12 @@ CacheValidator::CacheValidator(AttributeInstructionListType & instructionList,
     }
 }
 
+template <typename CacheType>
 void RunAndValidateSequence(AttributeInstructionListType list)
 {
     ForwardedDataCallbackValidator dataCallbackValidator;
-    CacheValidator client(list, dataCallbackValidator);
-    ClusterStateCache cache(client);
+    CacheValidator<CacheType> client(list, dataCallbackValidator);
+    CacheType cache(client);
 
     // In order for the cache to track our data versions, we need to claim to it
     // that we are dealing with a wildcard path.  And we need to do that before
@@ -712,7 +714,8 @@ void RunAndValidateSequence(AttributeInstructionListType list)
  * E1:A1 --- Endpoint 1, Attribute A, Version 1
  *
  */
-TEST_F(TestClusterStateCache, TestCache)
+template <typename CacheType>
+void ValidateSequences()
 {
     ChipLogProgress(DataManagement, "Validating various sequences of attribute data IBs...");
 
@@ -720,55 +723,66 @@ TEST_F(TestClusterStateCache, TestCache)
     // Validate a range of types and ensure that they can be successfully decoded.
     //
     ChipLogProgress(DataManagement, "E1:A1 --> E1:A1");
-    RunAndValidateSequence({ AttributeInstruction(
+    RunAndValidateSequence<CacheType>({ AttributeInstruction(
 
         AttributeInstruction::kAttributeA, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E1:B1 --> E1:B1");
-    RunAndValidateSequence({ AttributeInstruction(
+    RunAndValidateSequence<CacheType>({ AttributeInstruction(
 
         AttributeInstruction::kAttributeB, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E1:C1 --> E1:C1");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeC, 1, AttributeInstruction::kData) });
+    RunAndValidateSequence<CacheType>({ AttributeInstruction(AttributeInstruction::kAttributeC, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E1:D1 --> E1:D1");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
+    RunAndValidateSequence<CacheType>({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     //
     // Validate that a newer version of a data item over-rides the
     // previous copy.
     //
     ChipLogProgress(DataManagement, "E1:D1 E1:D2 --> E1:D2");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
-                             AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
+    RunAndValidateSequence<CacheType>({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
+                                        AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     //
     // Validate that a newer StatusIB over-rides a previous data value.
     //
     ChipLogProgress(DataManagement, "E1:D1 E1:D2s --> E1:D2s");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
-                             AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus) });
+    RunAndValidateSequence<CacheType>({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
+                                        AttributeInstruction(AttributeInstruction::kAttributeD, 1,
+                                                             AttributeInstruction::kStatus) });
 
     //
     // Validate that a newer data value over-rides a previous status value.
     //
     ChipLogProgress(DataManagement, "E1:D1s E1:D2 --> E1:D2");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus),
-                             AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
+    RunAndValidateSequence<CacheType>({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus),
+                                        AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     //
     // Validate data across different endpoints.
     //
     ChipLogProgress(DataManagement, "E0:D1 E1:D2 --> E0:D1 E1:D2");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 0, AttributeInstruction::kData),
-                             AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
+    RunAndValidateSequence<CacheType>({ AttributeInstruction(AttributeInstruction::kAttributeD, 0, AttributeInstruction::kData),
+                                        AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E0:A1 E0:B2 E0:A3 E0:B4 --> E0:A3 E0:B4");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
-                             AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData),
-                             AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
-                             AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
+    RunAndValidateSequence<CacheType>({ AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
+                                        AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData),
+                                        AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
+                                        AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
+}
+
+TEST_F(TestClusterStateCache, TestCache)
+{
+    ValidateSequences<ClusterStateCache>();
+}
+
+TEST_F(TestClusterStateCache, TestFlatHashCache)
+{
+    ValidateSequences<ClusterStateCacheFlat>();
 }
 
 } // namespace
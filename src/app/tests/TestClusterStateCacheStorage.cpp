@@ -0,0 +1,238 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterStateCacheStorage.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+using MapStorage = ClusterStateMapStorage<true>;
+
+class TestClusterStateCacheStorage : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+// Everything a storage holds, flattened in iteration order.
+struct DumpEntry
+{
+    EndpointId mEndpointId;
+    ClusterId mClusterId;
+    AttributeId mAttributeId;
+    CachedAttribute::Kind mKind;
+    Protocols::InteractionModel::Status mStatus;
+    std::vector<uint8_t> mData;
+    uint32_t mSize;
+    Optional<DataVersion> mCommittedDataVersion;
+
+    bool operator==(const DumpEntry & other) const
+    {
+        return std::tie(mEndpointId, mClusterId, mAttributeId, mKind, mStatus, mData, mSize) ==
+            std::tie(other.mEndpointId, other.mClusterId, other.mAttributeId, other.mKind, other.mStatus, other.mData,
+                     other.mSize) &&
+            mCommittedDataVersion == other.mCommittedDataVersion;
+    }
+};
+
+// Endpoints and clusters without attributes show up as entries with kInvalidClusterId / kInvalidAttributeId.
+template <typename Storage>
+std::vector<DumpEntry> Dump(const Storage & storage)
+{
+    std::vector<DumpEntry> dump;
+    storage.ForEachEndpoint([&](EndpointId endpointId) {
+        dump.push_back({ endpointId, kInvalidClusterId, kInvalidAttributeId, CachedAttribute::Kind::kSize,
+                         Protocols::InteractionModel::Status::Success, {}, 0, NullOptional });
+        return storage.ForEachCluster(endpointId, [&](ClusterId clusterId) {
+            const CachedClusterVersions * versions = storage.FindCluster(endpointId, clusterId);
+            EXPECT_NE(versions, nullptr);
+            dump.push_back({ endpointId, clusterId, kInvalidAttributeId, CachedAttribute::Kind::kSize,
+                             Protocols::InteractionModel::Status::Success, {}, 0, versions->mCommittedDataVersion });
+            return storage.ForEachAttribute(endpointId, clusterId, [&](AttributeId attributeId, const CachedAttribute & cached) {
+                dump.push_back({ endpointId, clusterId, attributeId, cached.mKind, cached.mStatus.mStatus,
+                                 std::vector<uint8_t>(cached.mData.begin(), cached.mData.end()), cached.mSize, NullOptional });
+
+                // Point lookups must agree with iteration.
+                CachedAttribute found;
+                EXPECT_EQ(storage.GetAttribute(ConcreteAttributePath(endpointId, clusterId, attributeId), found), CHIP_NO_ERROR);
+                EXPECT_EQ(found.mKind, cached.mKind);
+                EXPECT_TRUE(found.mData.data_equal(cached.mData));
+                return CHIP_NO_ERROR;
+            });
+        });
+    });
+    return dump;
+}
+
+// Encodes an attribute value whose length depends on aSeed, so that overwrites change the arena layout.
+CHIP_ERROR EncodeValue(uint32_t aSeed, uint8_t * aBuffer, size_t aBufferSize, TLV::TLVReader & aReader)
+{
+    uint8_t bytes[64];
+    const size_t length = aSeed % sizeof(bytes);
+    for (size_t i = 0; i < length; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(aSeed + i);
+    }
+
+    TLV::TLVWriter writer;
+    writer.Init(aBuffer, aBufferSize);
+    if (aSeed % 3 == 0)
+    {
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), aSeed));
+    }
+    else
+    {
+        ReturnErrorOnFailure(writer.PutBytes(TLV::AnonymousTag(), bytes, static_cast<uint32_t>(length)));
+    }
+    ReturnErrorOnFailure(writer.Finalize());
+
+    aReader.Init(aBuffer, writer.GetLengthWritten());
+    return aReader.Next();
+}
+
+template <typename Storage>
+void SetValue(Storage & storage, const ConcreteAttributePath & path, uint32_t aSeed)
+{
+    uint8_t buffer[128];
+    TLV::TLVReader reader;
+    ASSERT_EQ(EncodeValue(aSeed, buffer, sizeof(buffer), reader), CHIP_NO_ERROR);
+
+    TLV::TLVReader sizeReader;
+    sizeReader.Init(reader);
+    ASSERT_EQ(sizeReader.Skip(), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.SetData(path, reader, sizeReader.GetLengthRead()), CHIP_NO_ERROR);
+}
+
+TEST_F(TestClusterStateCacheStorage, TestFlatHashMatchesMap)
+{
+    MapStorage mapStorage;
+    ClusterStateFlatStorage flatStorage;
+
+    // A small ID space, so that the same paths get overwritten and erased over and over.
+    uint32_t seed = 1;
+    for (uint32_t step = 0; step < 20000; step++)
+    {
+        seed = seed * 1103515245 + 12345;
+        const ConcreteAttributePath path(static_cast<EndpointId>((seed >> 4) % 4), static_cast<ClusterId>((seed >> 8) % 6),
+                                         static_cast<AttributeId>((seed >> 12) % 10));
+        const uint32_t operation = (seed >> 20) % 100;
+
+        if (operation < 55)
+        {
+            SetValue(mapStorage, path, seed >> 16);
+            SetValue(flatStorage, path, seed >> 16);
+        }
+        else if (operation < 65)
+        {
+            StatusIB status(Protocols::InteractionModel::Status::UnsupportedAttribute);
+            mapStorage.SetStatus(path, status);
+            flatStorage.SetStatus(path, status);
+        }
+        else if (operation < 75)
+        {
+            mapStorage.SetSize(path, seed >> 24);
+            flatStorage.SetSize(path, seed >> 24);
+        }
+        else if (operation < 85)
+        {
+            mapStorage.FindOrAddCluster(path.mEndpointId, path.mClusterId).mCommittedDataVersion.SetValue(seed);
+            flatStorage.FindOrAddCluster(path.mEndpointId, path.mClusterId).mCommittedDataVersion.SetValue(seed);
+        }
+        else if (operation < 93)
+        {
+            mapStorage.EraseAttribute(path);
+            flatStorage.EraseAttribute(path);
+        }
+        else if (operation < 98)
+        {
+            mapStorage.EraseCluster(path);
+            flatStorage.EraseCluster(path);
+        }
+        else
+        {
+            mapStorage.EraseEndpoint(path.mEndpointId);
+            flatStorage.EraseEndpoint(path.mEndpointId);
+        }
+
+        EXPECT_EQ(mapStorage.HasEndpoint(path.mEndpointId), flatStorage.HasEndpoint(path.mEndpointId));
+
+        CachedAttribute mapAttribute;
+        CachedAttribute flatAttribute;
+        EXPECT_EQ(mapStorage.GetAttribute(path, mapAttribute), flatStorage.GetAttribute(path, flatAttribute));
+        EXPECT_EQ(mapAttribute.mKind, flatAttribute.mKind);
+        EXPECT_TRUE(mapAttribute.mData.data_equal(flatAttribute.mData));
+
+        if (step % 500 == 0)
+        {
+            ASSERT_TRUE(Dump(mapStorage) == Dump(flatStorage));
+        }
+    }
+
+    ASSERT_TRUE(Dump(mapStorage) == Dump(flatStorage));
+}
+
+TEST_F(TestClusterStateCacheStorage, TestFlatHashMissingPaths)
+{
+    ClusterStateFlatStorage storage;
+    CachedAttribute attribute;
+
+    EXPECT_FALSE(storage.HasEndpoint(1));
+    EXPECT_EQ(storage.FindCluster(1, 2), nullptr);
+    EXPECT_EQ(storage.GetAttribute(ConcreteAttributePath(1, 2, 3), attribute), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(storage.ForEachAttribute(1, 2, [](AttributeId, const CachedAttribute &) { return CHIP_NO_ERROR; }),
+              CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(storage.ForEachCluster(1, [](ClusterId) { return CHIP_ERROR_INTERNAL; }), CHIP_NO_ERROR);
+
+    // Erasing things that are not there is a no-op.
+    storage.EraseAttribute(ConcreteAttributePath(1, 2, 3));
+    storage.EraseCluster(ConcreteClusterPath(1, 2));
+    storage.EraseEndpoint(1);
+
+    // A value that fails to copy leaves no trace behind.
+    uint8_t buffer[128];
+    TLV::TLVReader reader;
+    ASSERT_EQ(EncodeValue(40, buffer, sizeof(buffer), reader), CHIP_NO_ERROR);
+    EXPECT_NE(storage.SetData(ConcreteAttributePath(1, 2, 3), reader, 4), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasEndpoint(1));
+    EXPECT_EQ(storage.FindCluster(1, 2), nullptr);
+    EXPECT_EQ(storage.GetAttribute(ConcreteAttributePath(1, 2, 3), attribute), CHIP_ERROR_KEY_NOT_FOUND);
+
+    // Nor does it disturb what was cached before.
+    SetValue(storage, ConcreteAttributePath(1, 2, 3), 7);
+    ASSERT_EQ(EncodeValue(40, buffer, sizeof(buffer), reader), CHIP_NO_ERROR);
+    EXPECT_NE(storage.SetData(ConcreteAttributePath(1, 2, 3), reader, 4), CHIP_NO_ERROR);
+    ASSERT_EQ(storage.GetAttribute(ConcreteAttributePath(1, 2, 3), attribute), CHIP_NO_ERROR);
+    ASSERT_EQ(attribute.mKind, CachedAttribute::Kind::kData);
+    ASSERT_EQ(EncodeValue(7, buffer, sizeof(buffer), reader), CHIP_NO_ERROR);
+    EXPECT_TRUE(attribute.mData.data_equal(ByteSpan(buffer, attribute.mData.size())));
+}
+
+} // namespace
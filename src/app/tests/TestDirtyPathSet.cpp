@@ -0,0 +1,260 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/DirtyPathSet.h>
+#include <lib/core/StringBuilderAdapters.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+constexpr size_t kLargeCapacity = 2048;
+
+// Reference model: every inserted path with the generation it was inserted at.
+struct InsertedPath
+{
+    AttributePathParams path;
+    uint64_t generation;
+};
+
+bool IsDirtyInReference(const std::vector<InsertedPath> & inserted, const ConcreteAttributePath & path, uint64_t since)
+{
+    for (const auto & item : inserted)
+    {
+        if (item.generation > since && item.path.IsAttributePathSupersetOf(path))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Contains(const DirtyPathSet & set, const AttributePathParams & path)
+{
+    return set.ForEachActiveObject([&](const DirtyPathSet::Entry * entry) {
+        return static_cast<const AttributePathParams &>(*entry) == path ? Loop::Break : Loop::Continue;
+    }) == Loop::Break;
+}
+
+TEST(TestDirtyPathSet, TestLookupHonorsWildcardsAndGenerations)
+{
+    DirtyPathSetWithStorage<8> set;
+
+    EXPECT_EQ(set.InsertPath(AttributePathParams(1, 6, 0), 10), CHIP_NO_ERROR);
+    EXPECT_EQ(set.InsertPath(AttributePathParams(EndpointId(2), ClusterId(8)), 11), CHIP_NO_ERROR);
+    EXPECT_EQ(set.InsertPath(AttributePathParams(3), 12), CHIP_NO_ERROR);
+    EXPECT_EQ(set.InsertPath(AttributePathParams(kInvalidEndpointId, 0x28, 5), 13), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 4u);
+
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(1, 6, 0), 9));
+    EXPECT_FALSE(set.IsPathDirtySince(ConcreteAttributePath(1, 6, 0), 10));
+    EXPECT_FALSE(set.IsPathDirtySince(ConcreteAttributePath(1, 6, 1), 0));
+    EXPECT_FALSE(set.IsPathDirtySince(ConcreteAttributePath(1, 8, 0), 0));
+
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(2, 8, 0), 10));
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(2, 8, 0xFFF8), 10));
+    EXPECT_FALSE(set.IsPathDirtySince(ConcreteAttributePath(2, 8, 0), 11));
+    EXPECT_FALSE(set.IsPathDirtySince(ConcreteAttributePath(2, 6, 0), 0));
+
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(3, 6, 0), 11));
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(3, 0x0101, 7), 11));
+
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(7, 0x28, 5), 12));
+    EXPECT_FALSE(set.IsPathDirtySince(ConcreteAttributePath(7, 0x28, 5), 13));
+    EXPECT_FALSE(set.IsPathDirtySince(ConcreteAttributePath(7, 0x28, 4), 0));
+
+    // Marking a covered path dirty again refreshes the generation of the covering path.
+    EXPECT_EQ(set.InsertPath(AttributePathParams(2, 8, 3), 20), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 4u);
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(2, 8, 0), 19));
+
+    set.ReleaseAll();
+    EXPECT_EQ(set.Allocated(), 0u);
+    EXPECT_FALSE(set.IsPathDirtySince(ConcreteAttributePath(2, 8, 0), 0));
+}
+
+TEST(TestDirtyPathSet, TestWildcardPathReplacesAllCoveredPaths)
+{
+    DirtyPathSetWithStorage<16> set;
+
+    for (AttributeId i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(set.InsertPath(AttributePathParams(1, 6, i), 1 + i), CHIP_NO_ERROR);
+        EXPECT_EQ(set.InsertPath(AttributePathParams(1, 8, i), 1 + i), CHIP_NO_ERROR);
+        EXPECT_EQ(set.InsertPath(AttributePathParams(2, 6, i), 1 + i), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(set.Allocated(), 12u);
+
+    EXPECT_EQ(set.InsertPath(AttributePathParams(EndpointId(1), ClusterId(6)), 10), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 9u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(EndpointId(1), ClusterId(6))));
+
+    EXPECT_EQ(set.InsertPath(AttributePathParams(1), 11), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 5u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(1)));
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(1, 8, 0), 10));
+
+    EXPECT_EQ(set.InsertPath(AttributePathParams(EndpointId(2), kInvalidClusterId, 0), 12), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 5u);
+    EXPECT_EQ(set.InsertPath(AttributePathParams(kInvalidEndpointId, 6, kInvalidAttributeId), 13), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 3u);
+
+    EXPECT_EQ(set.InsertPath(AttributePathParams(), 14), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 1u);
+    EXPECT_TRUE(Contains(set, AttributePathParams()));
+}
+
+TEST(TestDirtyPathSet, TestCoarseningKeepsUnrelatedPaths)
+{
+    DirtyPathSetWithStorage<4> set;
+
+    // Two attributes of the same cluster are merged, the others are kept as-is.
+    EXPECT_EQ(set.InsertPath(AttributePathParams(1, 6, 0), 1), CHIP_NO_ERROR);
+    EXPECT_EQ(set.InsertPath(AttributePathParams(2, 6, 0), 2), CHIP_NO_ERROR);
+    EXPECT_EQ(set.InsertPath(AttributePathParams(1, 6, 1), 3), CHIP_NO_ERROR);
+    EXPECT_EQ(set.InsertPath(AttributePathParams(3, 8, 0), 4), CHIP_NO_ERROR);
+    EXPECT_EQ(set.InsertPath(AttributePathParams(3, 0x28, 0), 5), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 4u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(EndpointId(1), ClusterId(6))));
+    EXPECT_TRUE(Contains(set, AttributePathParams(2, 6, 0)));
+    EXPECT_TRUE(Contains(set, AttributePathParams(3, 8, 0)));
+    EXPECT_TRUE(Contains(set, AttributePathParams(3, 0x28, 0)));
+    // The merged path keeps the newest generation of the paths it replaced.
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(1, 6, 5), 2));
+
+    // Two clusters of the same endpoint are merged, the others are kept as-is.
+    EXPECT_EQ(set.InsertPath(AttributePathParams(5, 6, 0), 6), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 4u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(EndpointId(1), ClusterId(6))));
+    EXPECT_TRUE(Contains(set, AttributePathParams(2, 6, 0)));
+    EXPECT_TRUE(Contains(set, AttributePathParams(3)));
+    EXPECT_TRUE(Contains(set, AttributePathParams(5, 6, 0)));
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(3, 8, 0), 4));
+    EXPECT_FALSE(set.IsPathDirtySince(ConcreteAttributePath(3, 8, 0), 5));
+
+    // Nothing left to merge: everything collapses into a single wildcard path.
+    EXPECT_EQ(set.InsertPath(AttributePathParams(6, 6, 0), 7), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Allocated(), 1u);
+    EXPECT_TRUE(Contains(set, AttributePathParams()));
+    EXPECT_TRUE(set.IsPathDirtySince(ConcreteAttributePath(2, 6, 0), 6));
+}
+
+TEST(TestDirtyPathSet, TestLargeSetScaling)
+{
+    auto set = std::make_unique<DirtyPathSetWithStorage<kLargeCapacity>>();
+
+    // 1500 distinct attribute paths spread over 100 endpoints, as reported by a large bridge.
+    std::vector<InsertedPath> inserted;
+    uint64_t generation = 1;
+    for (EndpointId endpoint = 1; endpoint <= 100; endpoint++)
+    {
+        for (ClusterId cluster = 0; cluster < 5; cluster++)
+        {
+            for (AttributeId attribute = 0; attribute < 3; attribute++)
+            {
+                AttributePathParams path(endpoint, 0x0400 + cluster, attribute);
+                EXPECT_EQ(set->InsertPath(path, generation), CHIP_NO_ERROR);
+                inserted.push_back({ path, generation });
+                generation++;
+            }
+        }
+    }
+    EXPECT_EQ(set->Allocated(), inserted.size());
+
+    for (EndpointId endpoint = 0; endpoint <= 101; endpoint++)
+    {
+        for (ClusterId cluster = 0; cluster < 6; cluster++)
+        {
+            for (AttributeId attribute = 0; attribute < 4; attribute++)
+            {
+                ConcreteAttributePath path(endpoint, 0x0400 + cluster, attribute);
+                for (uint64_t since : { uint64_t(0), uint64_t(750), generation })
+                {
+                    EXPECT_EQ(set->IsPathDirtySince(path, since), IsDirtyInReference(inserted, path, since));
+                }
+            }
+        }
+    }
+
+    // Marking a whole endpoint dirty replaces its 15 paths with a single one.
+    EXPECT_EQ(set->InsertPath(AttributePathParams(50), generation), CHIP_NO_ERROR);
+    EXPECT_EQ(set->Allocated(), inserted.size() - 14);
+    EXPECT_TRUE(set->IsPathDirtySince(ConcreteAttributePath(50, 0x0405, 9), generation - 1));
+    EXPECT_FALSE(set->IsPathDirtySince(ConcreteAttributePath(51, 0x0405, 9), 0));
+}
+
+TEST(TestDirtyPathSet, TestLargeSetCoarseningNeverLosesPaths)
+{
+    auto set = std::make_unique<DirtyPathSetWithStorage<kLargeCapacity>>();
+
+    // Overflow the set several times: every path ever inserted must still be reported as dirty.
+    std::vector<InsertedPath> inserted;
+    uint64_t generation = 1;
+    uint32_t seed       = 1;
+    for (size_t i = 0; i < 3 * kLargeCapacity; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        AttributePathParams path(static_cast<EndpointId>(1 + (seed >> 8) % 64), static_cast<ClusterId>((seed >> 16) % 16),
+                                 static_cast<AttributeId>((seed >> 4) % 32));
+        EXPECT_EQ(set->InsertPath(path, generation), CHIP_NO_ERROR);
+        EXPECT_LE(set->Allocated(), kLargeCapacity);
+        inserted.push_back({ path, generation });
+        generation++;
+    }
+
+    for (const auto & item : inserted)
+    {
+        ConcreteAttributePath path(item.path.mEndpointId, item.path.mClusterId, item.path.mAttributeId);
+        EXPECT_TRUE(set->IsPathDirtySince(path, item.generation - 1));
+    }
+}
+
+TEST(TestDirtyPathSet, LargeSetLookup)
+{
+    auto set = std::make_unique<DirtyPathSetWithStorage<kLargeCapacity>>();
+
+    uint64_t generation = 1;
+    for (EndpointId endpoint = 1; endpoint <= 128; endpoint++)
+    {
+        for (AttributeId attribute = 0; attribute < 16; attribute++)
+        {
+            EXPECT_EQ(set->InsertPath(AttributePathParams(endpoint, 0x0402, attribute), generation++), CHIP_NO_ERROR);
+        }
+    }
+    EXPECT_EQ(set->Allocated(), kLargeCapacity);
+
+    // A full set still finds exactly the paths that were inserted
+    for (EndpointId endpoint = 1; endpoint <= 128; endpoint++)
+    {
+        for (AttributeId attribute = 0; attribute < 32; attribute++)
+        {
+            EXPECT_EQ(set->IsPathDirtySince(ConcreteAttributePath(endpoint, 0x0402, attribute), 0), attribute < 16);
+        }
+    }
+}
+
+} // namespace
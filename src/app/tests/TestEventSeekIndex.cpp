@@ -0,0 +1,265 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <access/SubjectDescriptor.h>
+#include <app/EventLoggingDelegate.h>
+#include <app/EventLoggingTypes.h>
+#include <app/EventManagement.h>
+#include <app/MessageDef/EventReportIB.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/core/TLV.h>
+#include <lib/core/TLVUtilities.h>
+#include <lib/support/CHIPCounter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/ScopedBuffer.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+constexpr EndpointId kTestEndpointId  = 1;
+constexpr ClusterId kFirstClusterId   = 0x0400;
+constexpr size_t kClusterCount        = 8;
+constexpr EventId kTestEventId        = 1;
+constexpr TLV::Tag kTestEventValueTag = TLV::ContextTag(1);
+constexpr uint32_t kFetchBufferSize   = 16 * 1024;
+
+uint8_t gDebugEventBuffer[4096];
+uint8_t gInfoEventBuffer[4096];
+uint8_t gCritEventBuffer[4096];
+CircularEventBuffer gCircularEventBuffer[3];
+
+class TestEventSeekIndex : public Test::AppContext
+{
+public:
+    // Performs setup for each individual test in the test suite
+    void SetUp() override
+    {
+        const LogStorageResources logStorageResources[] = {
+            { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), PriorityLevel::Debug },
+            { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), PriorityLevel::Info },
+            { &gCritEventBuffer[0], sizeof(gCritEventBuffer), PriorityLevel::Critical },
+        };
+
+        AppContext::SetUp();
+        VerifyOrReturn(!HasFailure());
+
+        ASSERT_EQ(mEventCounter.Init(0), CHIP_NO_ERROR);
+        EventManagement::CreateEventManagement(&GetExchangeManager(), MATTER_ARRAY_SIZE(logStorageResources), gCircularEventBuffer,
+                                               logStorageResources, &mEventCounter);
+    }
+
+    // Performs teardown for each individual test in the test suite
+    void TearDown() override
+    {
+        EventManagement::DestroyEventManagement();
+        AppContext::TearDown();
+    }
+
+private:
+    MonotonicallyIncreasingCounter<EventNumber> mEventCounter;
+};
+
+class TestEventGenerator : public EventLoggingDelegate
+{
+public:
+    CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) override
+    {
+        TLV::TLVType dataContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::ContextTag(to_underlying(EventDataIB::Tag::kData)),
+                                                    TLV::kTLVType_Structure, dataContainerType));
+        ReturnErrorOnFailure(aWriter.Put(kTestEventValueTag, mValue));
+        return aWriter.EndContainer(dataContainerType);
+    }
+
+    uint32_t mValue = 0;
+};
+
+struct StoredEvent
+{
+    EventNumber mEventNumber;
+    ClusterId mClusterId;
+
+    bool operator==(const StoredEvent & aOther) const
+    {
+        return mEventNumber == aOther.mEventNumber && mClusterId == aOther.mClusterId;
+    }
+};
+
+CHIP_ERROR CollectEvent(const TLV::TLVReader & aReader, size_t, void * apContext)
+{
+    EventReportIB::Parser report;
+    EventDataIB::Parser data;
+    EventPathIB::Parser path;
+    StoredEvent event;
+
+    ReturnErrorOnFailure(report.Init(aReader));
+    ReturnErrorOnFailure(report.GetEventData(&data));
+    ReturnErrorOnFailure(data.GetPath(&path));
+    ReturnErrorOnFailure(path.GetCluster(&event.mClusterId));
+    ReturnErrorOnFailure(data.GetEventNumber(&event.mEventNumber));
+    static_cast<std::vector<StoredEvent> *>(apContext)->push_back(event);
+    return CHIP_NO_ERROR;
+}
+
+std::vector<StoredEvent> CollectEvents(TLV::TLVReader & aReader)
+{
+    std::vector<StoredEvent> events;
+    CHIP_ERROR err = TLV::Utilities::Iterate(aReader, CollectEvent, &events, false /*recurse*/);
+    EXPECT_TRUE(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+    return events;
+}
+
+// Every event in the log, by walking all the buffers the way FetchEventsSince did before it used seek points.
+std::vector<StoredEvent> ScanLog()
+{
+    TLV::TLVReader reader;
+    CircularEventBufferWrapper bufWrapper;
+    EXPECT_EQ(EventManagement::GetInstance().GetEventReader(reader, PriorityLevel::Critical, &bufWrapper), CHIP_NO_ERROR);
+    return CollectEvents(reader);
+}
+
+std::vector<StoredEvent> Expected(const std::vector<StoredEvent> & aLog, EventNumber aEventMin, const EventPathParams & aPath)
+{
+    std::vector<StoredEvent> expected;
+    for (const auto & event : aLog)
+    {
+        if (event.mEventNumber >= aEventMin && (aPath.HasWildcardClusterId() || aPath.mClusterId == event.mClusterId))
+        {
+            expected.push_back(event);
+        }
+    }
+    return expected;
+}
+
+// Fetch everything matching aPath from aEventMin on, in as many chunks of at most aChunkSize bytes as it takes.
+std::vector<StoredEvent> Fetch(EventNumber & aEventMin, const EventPathParams & aPath, uint32_t aChunkSize)
+{
+    SingleLinkedListNode<EventPathParams> pathNode;
+    pathNode.mValue = aPath;
+
+    Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+    VerifyOrDie(backingStore.Alloc(aChunkSize));
+
+    std::vector<StoredEvent> events;
+    while (true)
+    {
+        TLV::TLVWriter writer;
+        size_t eventCount = 0;
+        writer.Init(backingStore.Get(), aChunkSize);
+        CHIP_ERROR err = EventManagement::GetInstance().FetchEventsSince(writer, &pathNode, aEventMin, eventCount,
+                                                                         Access::SubjectDescriptor{});
+
+        TLV::TLVReader reader;
+        reader.Init(backingStore.Get(), writer.GetLengthWritten());
+        std::vector<StoredEvent> chunk = CollectEvents(reader);
+        EXPECT_EQ(chunk.size(), eventCount);
+        events.insert(events.end(), chunk.begin(), chunk.end());
+
+        if (err != CHIP_ERROR_NO_MEMORY && err != CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            EXPECT_TRUE(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+            return events;
+        }
+        VerifyOrDie(eventCount > 0);
+    }
+}
+
+void LogEvents(size_t aCount, uint32_t & aSeed)
+{
+    TestEventGenerator generator;
+    EventNumber eventNumber;
+    for (size_t i = 0; i < aCount; i++)
+    {
+        aSeed             = aSeed * 1103515245 + 12345;
+        ClusterId cluster = static_cast<ClusterId>(kFirstClusterId + (aSeed >> 8) % kClusterCount);
+        EventOptions options;
+        options.mPath     = { kTestEndpointId, cluster, kTestEventId };
+        options.mPriority = static_cast<PriorityLevel>(static_cast<uint8_t>(PriorityLevel::Debug) + (aSeed >> 16) % 3);
+        generator.mValue  = aSeed;
+        EXPECT_EQ(EventManagement::GetInstance().LogEvent(&generator, options, eventNumber), CHIP_NO_ERROR);
+    }
+}
+
+TEST_F(TestEventSeekIndex, TestFetchMatchesFullScan)
+{
+    uint32_t seed = 1;
+
+    // Enough events to wrap the buffers, evicting and promoting along the way.
+    for (size_t round = 0; round < 24; round++)
+    {
+        LogEvents(25, seed);
+
+        const std::vector<StoredEvent> log = ScanLog();
+        ASSERT_FALSE(log.empty());
+        for (size_t i = 1; i < log.size(); i++)
+        {
+            EXPECT_LT(log[i - 1].mEventNumber, log[i].mEventNumber);
+        }
+
+        const EventNumber newest        = log.back().mEventNumber;
+        const EventNumber startPoints[] = { 0, log.front().mEventNumber, log[log.size() / 2].mEventNumber, newest - 3, newest,
+                                            newest + 1 };
+        for (EventNumber start : startPoints)
+        {
+            std::vector<EventPathParams> paths = { EventPathParams() };
+            for (size_t cluster = 0; cluster <= kClusterCount; cluster++)
+            {
+                paths.push_back(EventPathParams(kTestEndpointId, static_cast<ClusterId>(kFirstClusterId + cluster), kTestEventId));
+            }
+
+            for (const auto & path : paths)
+            {
+                EventNumber eventMin = start;
+                EXPECT_EQ(Fetch(eventMin, path, kFetchBufferSize), Expected(log, start, path));
+                EXPECT_EQ(eventMin, newest + 1);
+
+                // Small chunks must pick up exactly where the previous one stopped.
+                eventMin = start;
+                EXPECT_EQ(Fetch(eventMin, path, 160), Expected(log, start, path));
+                EXPECT_EQ(eventMin, newest + 1);
+            }
+        }
+    }
+}
+
+TEST_F(TestEventSeekIndex, TestFetchNewestEvent)
+{
+    uint32_t seed = 7;
+    LogEvents(2000, seed);
+
+    const std::vector<StoredEvent> log = ScanLog();
+    ASSERT_GT(log.size(), 2u);
+    const EventPathParams path(kTestEndpointId, log.back().mClusterId, kTestEventId);
+
+    // What a subscription does on every report: ask for the events logged since the last one, for a single cluster.
+    EventNumber eventMin = log.back().mEventNumber;
+    const auto fetched   = Fetch(eventMin, path, kFetchBufferSize);
+    EXPECT_EQ(fetched, Expected(log, log.back().mEventNumber, path));
+    EXPECT_EQ(fetched.size(), 1u);
+    EXPECT_EQ(eventMin, log.back().mEventNumber + 1);
+}
+
+} // namespace
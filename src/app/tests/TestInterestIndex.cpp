@@ -0,0 +1,244 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/InterestIndex.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/LinkedList.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+// Stands in for a ReadHandler: the index never looks into the handlers it stores.
+struct FakeHandler
+{
+    std::vector<SingleLinkedListNode<AttributePathParams>> paths;
+
+    explicit FakeHandler(std::initializer_list<AttributePathParams> aPaths)
+    {
+        for (const auto & path : aPaths)
+        {
+            Append(path);
+        }
+    }
+
+    void Append(const AttributePathParams & path)
+    {
+        paths.emplace_back();
+        paths.back().mValue = path;
+    }
+
+    // Must be called once the paths are final, since the vector may reallocate.
+    const SingleLinkedListNode<AttributePathParams> * List()
+    {
+        for (size_t i = 0; i + 1 < paths.size(); i++)
+        {
+            paths[i].mpNext = &paths[i + 1];
+        }
+        return paths.empty() ? nullptr : &paths.front();
+    }
+
+    bool Intersects(const AttributePathParams & dirtyPath) const
+    {
+        for (const auto & node : paths)
+        {
+            if (node.mValue.Intersects(dirtyPath))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+template <size_t N>
+std::set<FakeHandler *> InterestedHandlers(const InterestIndexWithStorage<FakeHandler, N> & index,
+                                           const ConcreteAttributePath & path)
+{
+    std::set<FakeHandler *> handlers;
+    index.ForEachInterestedHandler(path, [&](FakeHandler & handler) {
+        handlers.insert(&handler);
+        return Loop::Continue;
+    });
+    return handlers;
+}
+
+TEST(TestInterestIndex, TestWildcardBuckets)
+{
+    InterestIndexWithStorage<FakeHandler, 16> index;
+
+    FakeHandler concrete{ AttributePathParams(1, 6, 0) };
+    FakeHandler clusterWide{ AttributePathParams(EndpointId(1), ClusterId(6)) };
+    FakeHandler endpointWide{ AttributePathParams(2) };
+    FakeHandler anyEndpoint{ AttributePathParams(kInvalidEndpointId, 6, 0), AttributePathParams(kInvalidEndpointId, 8, 0) };
+    FakeHandler global{ AttributePathParams(kInvalidEndpointId, kInvalidClusterId, 0xFFFD) };
+    FakeHandler everything{ AttributePathParams() };
+
+    for (FakeHandler * handler : { &concrete, &clusterWide, &endpointWide, &anyEndpoint, &global, &everything })
+    {
+        EXPECT_EQ(index.Add(*handler, handler->List()), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(index.Allocated(), 7u);
+
+    EXPECT_EQ(InterestedHandlers(index, ConcreteAttributePath(1, 6, 0)),
+              (std::set<FakeHandler *>{ &concrete, &clusterWide, &anyEndpoint, &everything }));
+    EXPECT_EQ(InterestedHandlers(index, ConcreteAttributePath(1, 6, 1)), (std::set<FakeHandler *>{ &clusterWide, &everything }));
+    EXPECT_EQ(InterestedHandlers(index, ConcreteAttributePath(2, 6, 0)),
+              (std::set<FakeHandler *>{ &endpointWide, &anyEndpoint, &everything }));
+    EXPECT_EQ(InterestedHandlers(index, ConcreteAttributePath(3, 8, 0)), (std::set<FakeHandler *>{ &anyEndpoint, &everything }));
+    EXPECT_EQ(InterestedHandlers(index, ConcreteAttributePath(3, 0x28, 0xFFFD)),
+              (std::set<FakeHandler *>{ &global, &everything }));
+
+    index.Remove(everything, everything.List());
+    index.Remove(anyEndpoint, anyEndpoint.List());
+    EXPECT_EQ(index.Allocated(), 4u);
+    EXPECT_EQ(InterestedHandlers(index, ConcreteAttributePath(1, 6, 0)), (std::set<FakeHandler *>{ &concrete, &clusterWide }));
+    EXPECT_TRUE(InterestedHandlers(index, ConcreteAttributePath(3, 8, 0)).empty());
+
+    index.ReleaseAll();
+    EXPECT_EQ(index.Allocated(), 0u);
+    EXPECT_TRUE(InterestedHandlers(index, ConcreteAttributePath(1, 6, 0)).empty());
+}
+
+TEST(TestInterestIndex, TestVisitsEachIntersectingPath)
+{
+    InterestIndexWithStorage<FakeHandler, 8> index;
+
+    FakeHandler handler{ AttributePathParams(1, 6, 0), AttributePathParams(EndpointId(1), ClusterId(6)), AttributePathParams() };
+    EXPECT_EQ(index.Add(handler, handler.List()), CHIP_NO_ERROR);
+
+    size_t visits = 0;
+    index.ForEachInterestedHandler(ConcreteAttributePath(1, 6, 0), [&](FakeHandler & visited) {
+        EXPECT_EQ(&visited, &handler);
+        visits++;
+        return Loop::Continue;
+    });
+    EXPECT_EQ(visits, 3u);
+
+    visits = 0;
+    EXPECT_EQ(index.ForEachInterestedHandler(ConcreteAttributePath(1, 6, 0),
+                                             [&](FakeHandler &) {
+                                                 visits++;
+                                                 return Loop::Break;
+                                             }),
+              Loop::Break);
+    EXPECT_EQ(visits, 1u);
+}
+
+TEST(TestInterestIndex, TestFullIndexAddsNothing)
+{
+    InterestIndexWithStorage<FakeHandler, 4> index;
+
+    FakeHandler first{ AttributePathParams(1, 6, 0), AttributePathParams(1, 6, 1), AttributePathParams(1, 6, 2) };
+    FakeHandler second{ AttributePathParams(1, 6, 3), AttributePathParams(1, 6, 4) };
+
+    EXPECT_EQ(index.Add(first, first.List()), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Add(second, second.List()), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(index.Allocated(), 3u);
+    EXPECT_TRUE(InterestedHandlers(index, ConcreteAttributePath(1, 6, 3)).empty());
+
+    index.Remove(first, first.List());
+    EXPECT_EQ(index.Add(second, second.List()), CHIP_NO_ERROR);
+    EXPECT_EQ(InterestedHandlers(index, ConcreteAttributePath(1, 6, 4)), (std::set<FakeHandler *>{ &second }));
+}
+
+constexpr size_t kSubscriptions        = 100;
+constexpr size_t kPathsPerHandler      = 50;
+constexpr size_t kSubscriptionCapacity = kSubscriptions * kPathsPerHandler;
+
+std::vector<std::unique_ptr<FakeHandler>> MakeSubscriptions()
+{
+    // 100 subscriptions of 50 paths each over 20 endpoints: mostly concrete attributes, with a few cluster and endpoint
+    // wildcards and one path every subscription shares.
+    std::vector<std::unique_ptr<FakeHandler>> handlers;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < kSubscriptions; i++)
+    {
+        auto handler = std::make_unique<FakeHandler>(std::initializer_list<AttributePathParams>{});
+        handler->Append(AttributePathParams(0, 0x0028, 0));
+        for (size_t j = 1; j < kPathsPerHandler; j++)
+        {
+            seed = seed * 1103515245 + 12345;
+            EndpointId endpoint = static_cast<EndpointId>(1 + (seed >> 8) % 20);
+            ClusterId cluster   = static_cast<ClusterId>(0x0400 + (seed >> 16) % 8);
+            switch ((seed >> 4) % 16)
+            {
+            case 0:
+                handler->Append(AttributePathParams(endpoint, cluster));
+                break;
+            case 1:
+                handler->Append(AttributePathParams(kInvalidEndpointId, cluster, 0));
+                break;
+            default:
+                handler->Append(AttributePathParams(endpoint, cluster, static_cast<AttributeId>((seed >> 24) % 8)));
+                break;
+            }
+        }
+        handlers.push_back(std::move(handler));
+    }
+    return handlers;
+}
+
+TEST(TestInterestIndex, TestMatchesLinearScan)
+{
+    auto index    = std::make_unique<InterestIndexWithStorage<FakeHandler, kSubscriptionCapacity>>();
+    auto handlers = MakeSubscriptions();
+    for (auto & handler : handlers)
+    {
+        EXPECT_EQ(index->Add(*handler, handler->List()), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(index->Allocated(), kSubscriptionCapacity);
+
+    for (EndpointId endpoint = 0; endpoint <= 21; endpoint++)
+    {
+        for (ClusterId cluster = 0x0400; cluster < 0x0409; cluster++)
+        {
+            for (AttributeId attribute = 0; attribute < 9; attribute++)
+            {
+                ConcreteAttributePath path(endpoint, cluster, attribute);
+                std::set<FakeHandler *> expected;
+                for (auto & handler : handlers)
+                {
+                    if (handler->Intersects(AttributePathParams(endpoint, cluster, attribute)))
+                    {
+                        expected.insert(handler.get());
+                    }
+                }
+                EXPECT_EQ(InterestedHandlers(*index, path), expected);
+            }
+        }
+    }
+
+    for (auto & handler : handlers)
+    {
+        index->Remove(*handler, handler->List());
+    }
+    EXPECT_EQ(index->Allocated(), 0u);
+}
+
+} // namespace
@@ -169,11 +169,9 @@ bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 
 bool TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
 {
-    auto path = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    VerifyOrReturnError(path != nullptr, false);
-    *path             = aPath;
-    path->mGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
-    return true;
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    VerifyOrReturnError(!engine.mGlobalDirtySet.Exhausted(), false);
+    return engine.mGlobalDirtySet.InsertPath(aPath, engine.GetDirtySetGeneration()) == CHIP_NO_ERROR;
 }
 
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
@@ -224,10 +222,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
+    EXPECT_TRUE(InsertToDirtySet(AttributePathParams(1, 1, 1)));
 
     {
         AttributePathParams testClusterInfo;
@@ -251,6 +246,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
         testClusterInfo.mClusterId   = 1;
         testClusterInfo.mAttributeId = kInvalidAttributeId;
         EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(EndpointId(1), ClusterId(1))));
     }
 
     {
@@ -258,7 +254,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
         testClusterInfo.mClusterId   = kInvalidClusterId;
         testClusterInfo.mAttributeId = kInvalidAttributeId;
         EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mClusterId == kInvalidClusterId && clusterInfo->mAttributeId == kInvalidAttributeId);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams()));
     }
 
     {
@@ -267,8 +263,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
         testClusterInfo.mClusterId   = kInvalidClusterId;
         testClusterInfo.mAttributeId = kInvalidAttributeId;
         EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mEndpointId == kInvalidEndpointId && clusterInfo->mClusterId == kInvalidClusterId &&
-                    clusterInfo->mAttributeId == kInvalidAttributeId);
+        EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams()));
     }
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
@@ -19,6 +19,7 @@
 
 #include <app/util/attribute-storage-detail.h>
 
+#include <access/AccessControl.h>
 #include <app/AttributeAccessInterfaceRegistry.h>
 #include <app/CommandHandlerInterfaceRegistry.h>
 #include <app/InteractionModelEngine.h>
@@ -35,6 +36,8 @@
 #include <platform/LockTracker.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <algorithm>
+
 using chip::Protocols::InteractionModel::Status;
 
 // Attribute storage depends on knowing the current layout/setup of attributes
@@ -148,6 +151,80 @@ bool emberAfIsThisDataTypeAListType(EmberAfAttributeType dataType)
     return dataType == ZCL_ARRAY_ATTRIBUTE_TYPE;
 }
 
+// Index of the configured endpoints, sorted by endpoint id and then by endpoint index, so that an endpoint id is resolved
+// with a binary search instead of a walk over every endpoint.  Kept in sync with emAfEndpoints[].endpoint by
+// emberAfEndpointConfigure, emberAfSetDynamicEndpoint and emberAfClearDynamicEndpoint.
+struct EndpointLookupEntry
+{
+    EndpointId endpoint;
+    uint16_t index;
+};
+
+EndpointLookupEntry endpointLookup[MAX_ENDPOINT_COUNT];
+uint16_t endpointLookupCount = 0;
+
+#if FIXED_ENDPOINT_COUNT > 0
+// Offset of the attribute storage of each fixed endpoint within attributeData.
+uint16_t fixedEndpointStorageOffsets[FIXED_ENDPOINT_COUNT];
+#endif // FIXED_ENDPOINT_COUNT > 0
+
+bool endpointLookupLess(const EndpointLookupEntry & entry, const EndpointLookupEntry & other)
+{
+    return entry.endpoint < other.endpoint || (entry.endpoint == other.endpoint && entry.index < other.index);
+}
+
+// Returns the first entry for the given endpoint id, or the end of the lookup.
+// Entries sharing the same endpoint id follow it in increasing endpoint index order.
+const EndpointLookupEntry * firstLookupEntry(EndpointId endpoint)
+{
+    return std::lower_bound(endpointLookup, endpointLookup + endpointLookupCount, EndpointLookupEntry{ endpoint, 0 },
+                            endpointLookupLess);
+}
+
+const EndpointLookupEntry * endOfLookup()
+{
+    return endpointLookup + endpointLookupCount;
+}
+
+void addEndpointToLookup(uint16_t index)
+{
+    VerifyOrDie(endpointLookupCount < MAX_ENDPOINT_COUNT);
+
+    EndpointLookupEntry entry{ emAfEndpoints[index].endpoint, index };
+    EndpointLookupEntry * position =
+        std::upper_bound(endpointLookup, endpointLookup + endpointLookupCount, entry, endpointLookupLess);
+    memmove(position + 1, position, static_cast<size_t>(endpointLookup + endpointLookupCount - position) * sizeof(entry));
+    *position = entry;
+    endpointLookupCount++;
+}
+
+void removeEndpointFromLookup(uint16_t index)
+{
+    EndpointLookupEntry entry{ emAfEndpoints[index].endpoint, index };
+    EndpointLookupEntry * position =
+        std::lower_bound(endpointLookup, endpointLookup + endpointLookupCount, entry, endpointLookupLess);
+    if (position == endOfLookup() || position->index != index)
+    {
+        return;
+    }
+
+    memmove(position, position + 1, static_cast<size_t>(endpointLookup + endpointLookupCount - position - 1) * sizeof(entry));
+    endpointLookupCount--;
+}
+
+// Returns the offset of the attribute storage of the endpoint at the given index within attributeData.
+// Dynamic endpoints have no storage there.
+uint16_t storageOffsetFromIndex(uint16_t index)
+{
+#if FIXED_ENDPOINT_COUNT > 0
+    if (index < FIXED_ENDPOINT_COUNT)
+    {
+        return fixedEndpointStorageOffsets[index];
+    }
+#endif // FIXED_ENDPOINT_COUNT > 0
+    return 0;
+}
+
 uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
 {
     if (endpoint == kInvalidEndpointId)
@@ -155,10 +232,10 @@ uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
+    for (auto * entry = firstLookupEntry(endpoint); entry != endOfLookup() && entry->endpoint == endpoint; entry++)
     {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
+        uint16_t epi = entry->index;
+        if (epi < emberAfEndpointCount() &&
             (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
         {
             return epi;
@@ -207,6 +284,7 @@ void emberAfEndpointConfigure()
 #endif // ZAP_FIXED_ENDPOINT_DATA_VERSION_COUNT > 0
 
     DataVersion * currentDataVersions = fixedEndpointDataVersions;
+    uint16_t storageOffset            = 0;
     for (ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
     {
         emAfEndpoints[ep].endpoint = fixedEndpoints[ep];
@@ -222,6 +300,10 @@ void emberAfEndpointConfigure()
         // Increment currentDataVersions by 1 (slot) for every server cluster
         // this endpoint has.
         currentDataVersions += emberAfClusterCountByIndex(ep, /* server = */ true);
+
+        // Fixed endpoints lay out their attribute storage one after the other in attributeData.
+        fixedEndpointStorageOffsets[ep] = storageOffset;
+        storageOffset                   = static_cast<uint16_t>(storageOffset + emAfEndpoints[ep].endpointType->endpointSize);
     }
 
 #endif // FIXED_ENDPOINT_COUNT > 0
@@ -238,6 +320,15 @@ void emberAfEndpointConfigure()
         }
     }
 #endif
+
+    endpointLookupCount = 0;
+    for (ep = 0; ep < MAX_ENDPOINT_COUNT; ep++)
+    {
+        if (emAfEndpoints[ep].endpoint != kInvalidEndpointId)
+        {
+            addEndpointToLookup(ep);
+        }
+    }
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
@@ -252,12 +343,11 @@ uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
         return kEmberInvalidEndpointIndex;
     }
 
-    uint16_t index;
-    for (index = FIXED_ENDPOINT_COUNT; index < MAX_ENDPOINT_COUNT; index++)
+    for (auto * entry = firstLookupEntry(id); entry != endOfLookup() && entry->endpoint == id; entry++)
     {
-        if (emAfEndpoints[index].endpoint == id)
+        if (entry->index >= FIXED_ENDPOINT_COUNT)
         {
-            return static_cast<uint16_t>(index - FIXED_ENDPOINT_COUNT);
+            return static_cast<uint16_t>(entry->index - FIXED_ENDPOINT_COUNT);
         }
     }
     return kEmberInvalidEndpointIndex;
@@ -285,12 +375,9 @@ CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberA
     }
 
     index = static_cast<uint16_t>(realIndex);
-    for (uint16_t i = FIXED_ENDPOINT_COUNT; i < MAX_ENDPOINT_COUNT; i++)
+    if (emberAfGetDynamicIndexFromEndpoint(id) != kEmberInvalidEndpointIndex)
     {
-        if (emAfEndpoints[i].endpoint == id)
-        {
-            return CHIP_ERROR_ENDPOINT_EXISTS;
-        }
+        return CHIP_ERROR_ENDPOINT_EXISTS;
     }
 
     const size_t bufferSize = Compatibility::Internal::gEmberAttributeIOBufferSpan.size();
@@ -317,6 +404,7 @@ CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberA
             }
         }
     }
+    removeEndpointFromLookup(index);
     emAfEndpoints[index].endpoint       = id;
     emAfEndpoints[index].deviceTypeList = deviceTypeList;
     emAfEndpoints[index].endpointType   = ep;
@@ -324,6 +412,7 @@ CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberA
     // Start the endpoint off as disabled.
     emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isEnabled);
     emAfEndpoints[index].parentEndpointId = parentEndpointId;
+    addEndpointToLookup(index);
 
     emberAfSetDynamicEndpointCount(MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT);
 
@@ -356,6 +445,7 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index)
     {
         ep = emAfEndpoints[index].endpoint;
         emberAfEndpointEnableDisable(ep, false);
+        removeEndpointFromLookup(index);
         emAfEndpoints[index].endpoint = kInvalidEndpointId;
     }
 
@@ -601,128 +691,112 @@ Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord,
 {
     assertChipStackLockedByCurrentThread();
 
-    uint16_t attributeOffsetIndex = 0;
-
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    uint16_t ep = findIndexFromEndpoint(attRecord->endpoint, true /* ignoreDisabledEndpoints */);
+    if (ep == kEmberInvalidEndpointIndex)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+    }
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
-            {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    // Is this a dynamic endpoint?
+    bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+
+    // Dynamic endpoints are external and don't factor into storage size
+    uint16_t attributeOffsetIndex            = storageOffsetFromIndex(ep);
+    const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+    uint8_t clusterIndex;
+    for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        if (emAfMatchCluster(cluster, attRecord))
+        { // Got the cluster
+            uint16_t attrIndex;
+            for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
             {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+                const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                if (emAfMatchAttribute(cluster, am, attRecord))
+                { // Got the attribute
+                    // If passed metadata location is not null, populate
+                    if (metadata != nullptr)
+                    {
+                        *metadata = am;
+                    }
+
                     {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
+                        uint8_t * attributeLocation =
+                            (am->mask & MATTER_ATTRIBUTE_FLAG_SINGLETON ? singletonAttributeLocation(am)
+                                                                        : attributeData + attributeOffsetIndex);
+                        uint8_t *src, *dst;
+                        if (write)
+                        {
+                            src = buffer;
+                            dst = attributeLocation;
+                            if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
                             {
-                                *metadata = am;
+                                return Status::UnsupportedAccess;
+                            }
+                        }
+                        else
+                        {
+                            if (buffer == nullptr)
+                            {
+                                return Status::Success;
                             }
 
+                            src = attributeLocation;
+                            dst = buffer;
+                            if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
                             {
-                                uint8_t * attributeLocation =
-                                    (am->mask & MATTER_ATTRIBUTE_FLAG_SINGLETON ? singletonAttributeLocation(am)
-                                                                                : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == nullptr)
-                                    {
-                                        return Status::Success;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            am->attributeId))
-                                    {
-                                        return Status::UnsupportedAccess;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
-                                {
-                                    if (write)
-                                    {
-                                        return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
-                                                                                     buffer);
-                                    }
-
-                                    if (readLength < emberAfAttributeSize(am))
-                                    {
-                                        // Prevent a potential buffer overflow
-                                        return Status::ResourceExhausted;
-                                    }
-
-                                    return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
-                                                                                buffer, emberAfAttributeSize(am));
-                                }
-
-                                // Internal storage is only supported for fixed endpoints
-                                if (!isDynamicEndpoint)
-                                {
-                                    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                                }
-
-                                return Status::Failure;
+                                return Status::UnsupportedAccess;
                             }
                         }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE) &&
-                                !(am->mask & MATTER_ATTRIBUTE_FLAG_SINGLETON))
+
+                        // Is the attribute externally stored?
+                        if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
+                        {
+                            if (write)
+                            {
+                                return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am, buffer);
+                            }
+
+                            if (readLength < emberAfAttributeSize(am))
                             {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                                // Prevent a potential buffer overflow
+                                return Status::ResourceExhausted;
                             }
+
+                            return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
+                                                                        emberAfAttributeSize(am));
                         }
-                    }
 
-                    // Attribute is not in the cluster.
-                    return Status::UnsupportedAttribute;
-                }
+                        // Internal storage is only supported for fixed endpoints
+                        if (!isDynamicEndpoint)
+                        {
+                            return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+                        }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+                        return Status::Failure;
+                    }
+                }
+                else
+                { // Not the attribute we are looking for
+                    // Increase the index if attribute is not externally stored
+                    if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE) && !(am->mask & MATTER_ATTRIBUTE_FLAG_SINGLETON))
+                    {
+                        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                    }
+                }
             }
 
-            // Cluster is not in the endpoint.
-            return Status::UnsupportedCluster;
+            // Attribute is not in the cluster.
+            return Status::UnsupportedAttribute;
         }
 
-        // Not the endpoint we are looking for
-        // Dynamic endpoints are external and don't factor into storage size
-        if (!isDynamicEndpoint)
-        {
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
-        }
+        // Not the cluster we are looking for
+        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
     }
-    return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+
+    // Cluster is not in the endpoint.
+    return Status::UnsupportedCluster;
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
@@ -766,18 +840,18 @@ const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endp
 
 uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask)
 {
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    for (auto * entry = firstLookupEntry(endpoint); entry != endOfLookup() && entry->endpoint == endpoint; entry++)
     {
-        // Check the endpoint id first, because that way we avoid examining the
-        // endpoint type for endpoints that are not actually defined.
-        if (emAfEndpoints[ep].endpoint == endpoint)
+        if (entry->index >= emberAfEndpointCount())
         {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t index                            = 0xFF;
-            if (emberAfFindClusterInType(endpointType, clusterId, mask, &index) != nullptr)
-            {
-                return index;
-            }
+            continue;
+        }
+
+        const EmberAfEndpointType * endpointType = emAfEndpoints[entry->index].endpointType;
+        uint8_t index                            = 0xFF;
+        if (emberAfFindClusterInType(endpointType, clusterId, mask, &index) != nullptr)
+        {
+            return index;
         }
     }
     return 0xFF;
@@ -983,6 +1057,9 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
                                 emberAfGlobalInteractionModelAttributesChangedListener());
     }
 
+    // Device type targets of access control entries may now resolve differently.
+    Access::GetAccessControl().InvalidateDeviceTypeCache();
+
     emberMetadataStructureGeneration++;
     return true;
 }
@@ -1089,6 +1166,7 @@ CHIP_ERROR emberAfSetDeviceTypeList(EndpointId endpoint, Span<const EmberAfDevic
     }
 
     emAfEndpoints[endpointIndex].deviceTypeList = deviceTypeList;
+    Access::GetAccessControl().InvalidateDeviceTypeCache();
     return CHIP_NO_ERROR;
 }
 
@@ -0,0 +1,337 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <access/AccessControl.h>
+#include <access/AuthMode.h>
+#include <access/Privilege.h>
+#include <access/RequestPath.h>
+#include <access/SubjectDescriptor.h>
+#include <access/examples/ExampleAccessControlDelegate.h>
+#include <lib/support/CodeUtils.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Access;
+using namespace chip::Benchmarks;
+
+constexpr FabricIndex kFabricCount     = 2;
+constexpr size_t kEntriesPerFabric     = 4;
+constexpr size_t kSubjectsPerEntry     = 4;
+constexpr NodeId kFirstNodeId          = 0x0000'0000'0001'0000;
+constexpr ClusterId kTargetClusters[]  = { 0x0006, 0x0008, 0x0300 };
+constexpr EndpointId kTargetEndpoint   = 1;
+constexpr ClusterId kUntargetedCluster = 0x0101;
+
+constexpr size_t kLargeEntryCount       = 256;
+constexpr EndpointId kLargeEndpoints    = 16;
+constexpr ClusterId kLargeClusters      = 8;
+constexpr DeviceTypeId kLargeDeviceType = 0x0000'0100;
+
+class NoDeviceTypeResolver : public AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+};
+
+NodeId SubjectFor(FabricIndex fabric, size_t entry, size_t subject)
+{
+    return kFirstNodeId + (fabric * kEntriesPerFabric + entry) * kSubjectsPerEntry + subject;
+}
+
+// Fill every fabric's ACL: an administrator entry, then operate entries whose subjects are each
+// granted a few clusters on one endpoint.
+CHIP_ERROR Populate(AccessControl & accessControl)
+{
+    for (FabricIndex fabric = 1; fabric <= kFabricCount; fabric++)
+    {
+        for (size_t i = 0; i < kEntriesPerFabric; i++)
+        {
+            AccessControl::Entry entry;
+            ReturnErrorOnFailure(accessControl.PrepareEntry(entry));
+            ReturnErrorOnFailure(entry.SetFabricIndex(fabric));
+            ReturnErrorOnFailure(entry.SetAuthMode(AuthMode::kCase));
+            ReturnErrorOnFailure(entry.SetPrivilege(i == 0 ? Privilege::kAdminister : Privilege::kOperate));
+            for (size_t j = 0; j < kSubjectsPerEntry; j++)
+            {
+                ReturnErrorOnFailure(entry.AddSubject(nullptr, SubjectFor(fabric, i, j)));
+            }
+            if (i != 0)
+            {
+                for (ClusterId cluster : kTargetClusters)
+                {
+                    AccessControl::Entry::Target target;
+                    target.flags    = AccessControl::Entry::Target::kCluster | AccessControl::Entry::Target::kEndpoint;
+                    target.cluster  = cluster;
+                    target.endpoint = kTargetEndpoint;
+                    ReturnErrorOnFailure(entry.AddTarget(nullptr, target));
+                }
+            }
+            ReturnErrorOnFailure(accessControl.CreateEntry(nullptr, fabric, nullptr, entry));
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Keeps an access control list of any size in memory, where the example delegate is bounded per fabric.
+class LargeAccessControlDelegate : public AccessControl::Delegate
+{
+public:
+    struct EntryStorage
+    {
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        Privilege privilege;
+        std::vector<NodeId> subjects;
+        std::vector<AccessControl::Entry::Target> targets;
+    };
+
+    std::vector<EntryStorage> mEntries;
+
+    CHIP_ERROR Entries(AccessControl::EntryIterator & iterator, const FabricIndex * fabricIndex) const override
+    {
+        mIteratorDelegate.mEntries     = &mEntries;
+        mIteratorDelegate.mFabricIndex = (fabricIndex != nullptr) ? *fabricIndex : kUndefinedFabricIndex;
+        mIteratorDelegate.mIndex       = 0;
+        iterator.SetDelegate(mIteratorDelegate);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                     Privilege requestPrivilege) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    class EntryDelegate : public AccessControl::Entry::Delegate
+    {
+    public:
+        CHIP_ERROR GetAuthMode(AuthMode & authMode) const override
+        {
+            authMode = mStorage->authMode;
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetFabricIndex(FabricIndex & fabricIndex) const override
+        {
+            fabricIndex = mStorage->fabricIndex;
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetPrivilege(Privilege & privilege) const override
+        {
+            privilege = mStorage->privilege;
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetSubjectCount(size_t & count) const override
+        {
+            count = mStorage->subjects.size();
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetSubject(size_t index, NodeId & subject) const override
+        {
+            VerifyOrReturnError(index < mStorage->subjects.size(), CHIP_ERROR_SENTINEL);
+            subject = mStorage->subjects[index];
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetTargetCount(size_t & count) const override
+        {
+            count = mStorage->targets.size();
+            return CHIP_NO_ERROR;
+        }
+
+        CHIP_ERROR GetTarget(size_t index, AccessControl::Entry::Target & target) const override
+        {
+            VerifyOrReturnError(index < mStorage->targets.size(), CHIP_ERROR_SENTINEL);
+            target = mStorage->targets[index];
+            return CHIP_NO_ERROR;
+        }
+
+        const EntryStorage * mStorage = nullptr;
+    };
+
+    class IteratorDelegate : public AccessControl::EntryIterator::Delegate
+    {
+    public:
+        CHIP_ERROR Next(AccessControl::Entry & entry) override
+        {
+            while (mIndex < mEntries->size())
+            {
+                const EntryStorage & storage = (*mEntries)[mIndex++];
+                if (mFabricIndex == kUndefinedFabricIndex || storage.fabricIndex == mFabricIndex)
+                {
+                    mEntryDelegate.mStorage = &storage;
+                    entry.SetDelegate(mEntryDelegate);
+                    return CHIP_NO_ERROR;
+                }
+            }
+            return CHIP_ERROR_SENTINEL;
+        }
+
+        const std::vector<EntryStorage> * mEntries = nullptr;
+        FabricIndex mFabricIndex                   = kUndefinedFabricIndex;
+        size_t mIndex                              = 0;
+        EntryDelegate mEntryDelegate;
+    };
+
+    mutable IteratorDelegate mIteratorDelegate;
+};
+
+// Each entry grants a few nodes access to a few clusters on a few endpoints, like on a bridge.
+void PopulateLarge(LargeAccessControlDelegate & delegate)
+{
+    using Target = AccessControl::Entry::Target;
+
+    for (size_t i = 0; i < kLargeEntryCount; ++i)
+    {
+        LargeAccessControlDelegate::EntryStorage storage = { .fabricIndex = 1,
+                                                             .authMode    = AuthMode::kCase,
+                                                             .privilege   = Privilege::kOperate };
+        for (NodeId j = 0; j < kSubjectsPerEntry; ++j)
+        {
+            storage.subjects.push_back(kFirstNodeId + i * kSubjectsPerEntry + j);
+        }
+        for (uint16_t j = 0; j < 3; ++j)
+        {
+            storage.targets.push_back({ .flags    = Target::kCluster | Target::kEndpoint,
+                                        .cluster  = static_cast<ClusterId>((i + j) % kLargeClusters),
+                                        .endpoint = static_cast<EndpointId>((i + j) % kLargeEndpoints) });
+        }
+        if (i % 16 == 0)
+        {
+            storage.targets.push_back({ .flags = Target::kDeviceType, .deviceType = kLargeDeviceType + i });
+        }
+        delegate.mEntries.push_back(std::move(storage));
+    }
+}
+
+void RunCheck(State & state, const RequestPath & requestPath, CHIP_ERROR expected)
+{
+    NoDeviceTypeResolver deviceTypeResolver;
+    AccessControl accessControl;
+    CHIP_ERROR err = accessControl.Init(Examples::GetAccessControlDelegate(), deviceTypeResolver);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = Populate(accessControl);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+    }
+
+    // The last subject of the last entry on the last fabric, so that nothing is found early.
+    SubjectDescriptor subjectDescriptor;
+    subjectDescriptor.fabricIndex = kFabricCount;
+    subjectDescriptor.authMode    = AuthMode::kCase;
+    subjectDescriptor.subject     = SubjectFor(kFabricCount, kEntriesPerFabric - 1, kSubjectsPerEntry - 1);
+
+    while (state.KeepRunning())
+    {
+        err = accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate);
+        if (err != expected)
+        {
+            state.SkipWithError(err == CHIP_NO_ERROR ? CHIP_ERROR_INCORRECT_STATE : err);
+        }
+    }
+
+    accessControl.Finish();
+}
+
+CHIP_BENCHMARK(AccessControl, CheckGranted)
+{
+    RequestPath requestPath;
+    requestPath.cluster     = kTargetClusters[2];
+    requestPath.endpoint    = kTargetEndpoint;
+    requestPath.requestType = RequestType::kCommandInvokeRequest;
+    requestPath.entityId    = 0x00;
+
+    RunCheck(state, requestPath, CHIP_NO_ERROR);
+}
+
+CHIP_BENCHMARK(AccessControl, CheckDenied)
+{
+    RequestPath requestPath;
+    requestPath.cluster     = kUntargetedCluster;
+    requestPath.endpoint    = kTargetEndpoint;
+    requestPath.requestType = RequestType::kCommandInvokeRequest;
+    requestPath.entityId    = 0x00;
+
+    RunCheck(state, requestPath, CHIP_ERROR_ACCESS_DENIED);
+}
+
+// A wildcard read of kLargeEndpoints * kLargeClusters paths against kLargeEntryCount entries on one fabric.
+void RunCheckLargeList(State & state, NodeId subject, size_t expectedAllowed)
+{
+    LargeAccessControlDelegate delegate;
+    PopulateLarge(delegate);
+
+    NoDeviceTypeResolver deviceTypeResolver;
+    AccessControl accessControl;
+    CHIP_ERROR err = accessControl.Init(&delegate, deviceTypeResolver);
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+    }
+
+    SubjectDescriptor subjectDescriptor;
+    subjectDescriptor.fabricIndex = 1;
+    subjectDescriptor.authMode    = AuthMode::kCase;
+    subjectDescriptor.subject     = subject;
+
+    while (state.KeepRunning())
+    {
+        size_t allowed = 0;
+        for (EndpointId endpoint = 0; endpoint < kLargeEndpoints; ++endpoint)
+        {
+            for (ClusterId cluster = 0; cluster < kLargeClusters; ++cluster)
+            {
+                RequestPath requestPath;
+                requestPath.cluster  = cluster;
+                requestPath.endpoint = endpoint;
+                allowed += (accessControl.Check(subjectDescriptor, requestPath, Privilege::kView) == CHIP_NO_ERROR) ? 1 : 0;
+            }
+        }
+        if (allowed != expectedAllowed)
+        {
+            state.SkipWithError(CHIP_ERROR_INCORRECT_STATE);
+        }
+    }
+
+    accessControl.Finish();
+}
+
+CHIP_BENCHMARK(AccessControl, CheckLargeListGranted)
+{
+    // The last subject of the last entry, whose three targets are each a distinct path.
+    RunCheckLargeList(state, kFirstNodeId + kLargeEntryCount * kSubjectsPerEntry - 1, 3);
+}
+
+CHIP_BENCHMARK(AccessControl, CheckLargeListDenied)
+{
+    RunCheckLargeList(state, kFirstNodeId - 1, 0);
+}
+
+} // namespace
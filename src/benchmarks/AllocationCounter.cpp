@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Counts heap allocations for the benchmarks.
+ *
+ *      Where the linker supports it, the build wraps the C allocator
+ *      (-Wl,--wrap=malloc and friends) so that every allocation made by the
+ *      stack is seen here, whether it comes from Platform::MemoryAlloc, a
+ *      heap-backed PacketBuffer or operator new. Elsewhere allocations are not
+ *      counted, and reported as such.
+ */
+
+#include "Benchmark.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifndef CHIP_BENCHMARKS_WRAP_MALLOC
+#define CHIP_BENCHMARKS_WRAP_MALLOC 0
+#endif
+
+namespace {
+
+std::atomic<uint64_t> gAllocations{ 0 };
+std::atomic<uint64_t> gAllocatedBytes{ 0 };
+
+[[maybe_unused]] void CountAllocation(size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    gAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+} // namespace
+
+#if CHIP_BENCHMARKS_WRAP_MALLOC
+
+extern "C" {
+
+void * __real_malloc(size_t size);
+void * __real_calloc(size_t count, size_t size);
+void * __real_realloc(void * ptr, size_t size);
+
+void * __wrap_malloc(size_t size)
+{
+    CountAllocation(size);
+    return __real_malloc(size);
+}
+
+void * __wrap_calloc(size_t count, size_t size)
+{
+    CountAllocation(count * size);
+    return __real_calloc(count, size);
+}
+
+void * __wrap_realloc(void * ptr, size_t size)
+{
+    CountAllocation(size);
+    return __real_realloc(ptr, size);
+}
+
+} // extern "C"
+
+// The C++ runtime's own operator new calls malloc from inside the runtime
+// library, out of reach of --wrap, so route it through the wrapped malloc.
+void * operator new(size_t size)
+{
+    void * ptr = malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+    {
+        abort();
+    }
+    return ptr;
+}
+
+void * operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void * operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return malloc(size == 0 ? 1 : size);
+}
+
+void * operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void * ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void * ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void * ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+#endif // CHIP_BENCHMARKS_WRAP_MALLOC
+
+namespace chip {
+namespace Benchmarks {
+
+bool AllocationCountingSupported()
+{
+    return CHIP_BENCHMARKS_WRAP_MALLOC;
+}
+
+AllocationStats GetAllocationStats()
+{
+    AllocationStats stats;
+    stats.mAllocations = gAllocations.load(std::memory_order_relaxed);
+    stats.mBytes       = gAllocatedBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace Benchmarks
+} // namespace chip
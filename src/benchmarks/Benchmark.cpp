@@ -0,0 +1,87 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+namespace chip {
+namespace Benchmarks {
+
+namespace {
+
+Registration *& Head()
+{
+    static Registration * head = nullptr;
+    return head;
+}
+
+Registration *& Tail()
+{
+    static Registration * tail = nullptr;
+    return tail;
+}
+
+} // namespace
+
+void State::PauseTiming()
+{
+    if (!mRunning)
+    {
+        return;
+    }
+
+    const auto now                    = std::chrono::steady_clock::now();
+    const AllocationStats allocations = GetAllocationStats();
+
+    mElapsed += std::chrono::duration_cast<std::chrono::nanoseconds>(now - mStartTime);
+    mAllocations.mAllocations += allocations.mAllocations - mStartAllocations.mAllocations;
+    mAllocations.mBytes += allocations.mBytes - mStartAllocations.mBytes;
+    mRunning = false;
+}
+
+void State::ResumeTiming()
+{
+    if (mRunning)
+    {
+        return;
+    }
+
+    mRunning          = true;
+    mStartAllocations = GetAllocationStats();
+    mStartTime        = std::chrono::steady_clock::now();
+}
+
+Registration::Registration(const char * name, BenchmarkFunction function) : mName(name), mFunction(function)
+{
+    if (Tail() == nullptr)
+    {
+        Head() = this;
+    }
+    else
+    {
+        Tail()->mNext = this;
+    }
+    Tail() = this;
+}
+
+const Registration * Registration::First()
+{
+    return Head();
+}
+
+} // namespace Benchmarks
+} // namespace chip
@@ -0,0 +1,164 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      A minimal micro-benchmark harness: benchmarks register themselves with
+ *      CHIP_BENCHMARK and are run by chip-benchmarks, which reports the time,
+ *      heap allocations and heap bytes per operation of each as JSON.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Benchmarks {
+
+/**
+ * Heap activity seen by the process so far. Only counted when the harness was
+ * able to interpose the allocator (see AllocationCounter.cpp).
+ */
+struct AllocationStats
+{
+    uint64_t mAllocations = 0;
+    uint64_t mBytes       = 0;
+};
+
+bool AllocationCountingSupported();
+AllocationStats GetAllocationStats();
+
+/**
+ * Passed to every benchmark; the benchmark does any setup it needs, then runs
+ * the operation being measured once per iteration of
+ *
+ *     while (state.KeepRunning())
+ *     {
+ *         ...
+ *     }
+ *
+ * Only the time and allocations between the first and the last call to
+ * KeepRunning() are measured, minus any PauseTiming()/ResumeTiming() section.
+ */
+class State
+{
+public:
+    explicit State(uint64_t iterations) : mIterations(iterations) {}
+
+    bool KeepRunning()
+    {
+        if (!mStarted)
+        {
+            mStarted = true;
+            ResumeTiming();
+        }
+        if (mRemaining > 0 && mError == CHIP_NO_ERROR)
+        {
+            mRemaining--;
+            return true;
+        }
+        PauseTiming();
+        return false;
+    }
+
+    /**
+     * Alternative to the KeepRunning() loop for benchmarks that perform all of
+     * their GetIterations() operations at once, e.g. spread over several
+     * threads: only the call to @p function is measured.
+     */
+    template <typename Function>
+    void RunAll(Function && function)
+    {
+        mStarted = true;
+        ResumeTiming();
+        function();
+        mRemaining = 0;
+        PauseTiming();
+    }
+
+    /// Exclude per-iteration setup or teardown from the measurement.
+    void PauseTiming();
+    void ResumeTiming();
+
+    /// Abort the benchmark; it is reported with this error instead of results.
+    void SkipWithError(CHIP_ERROR error)
+    {
+        mError     = error;
+        mRemaining = 0;
+    }
+
+    uint64_t GetIterations() const { return mIterations; }
+    CHIP_ERROR GetError() const { return mError; }
+    std::chrono::nanoseconds GetElapsed() const { return mElapsed; }
+    const AllocationStats & GetAllocations() const { return mAllocations; }
+
+private:
+    const uint64_t mIterations;
+    uint64_t mRemaining = mIterations;
+    bool mStarted       = false;
+    bool mRunning       = false;
+    CHIP_ERROR mError   = CHIP_NO_ERROR;
+
+    std::chrono::steady_clock::time_point mStartTime;
+    AllocationStats mStartAllocations;
+    std::chrono::nanoseconds mElapsed{ 0 };
+    AllocationStats mAllocations;
+};
+
+using BenchmarkFunction = void (*)(State & state);
+
+/**
+ * A registered benchmark. Instances are created by CHIP_BENCHMARK at static
+ * initialization time and linked into a list in registration order.
+ */
+class Registration
+{
+public:
+    Registration(const char * name, BenchmarkFunction function);
+
+    const char * GetName() const { return mName; }
+    BenchmarkFunction GetFunction() const { return mFunction; }
+    const Registration * GetNext() const { return mNext; }
+
+    static const Registration * First();
+
+private:
+    const char * mName;
+    BenchmarkFunction mFunction;
+    Registration * mNext = nullptr;
+};
+
+} // namespace Benchmarks
+} // namespace chip
+
+/**
+ * Define and register a benchmark called `group/name`:
+ *
+ *     CHIP_BENCHMARK(TLV, EncodeStruct)
+ *     {
+ *         while (state.KeepRunning()) { ... }
+ *     }
+ */
+#define CHIP_BENCHMARK(group, name)                                                                                                \
+    static void Benchmark_##group##_##name(::chip::Benchmarks::State & state);                                                     \
+    static const ::chip::Benchmarks::Registration gRegistration_##group##_##name(#group "/" #name, &Benchmark_##group##_##name);   \
+    static void Benchmark_##group##_##name(::chip::Benchmarks::State & state)
@@ -0,0 +1,94 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "BenchmarkContext.h"
+
+#include <access/AccessControl.h>
+#include <access/examples/PermissiveAccessControlDelegate.h>
+#include <app/InteractionModelEngine.h>
+#include <app/reporting/tests/MockReportScheduler.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Benchmarks {
+
+namespace {
+
+constexpr System::Clock::Timeout kServiceIOTimeout = System::Clock::Seconds16(5);
+
+class NoDeviceTypeResolver : public Access::AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+} gDeviceTypeResolver;
+
+Access::AccessControl gPermissiveAccessControl;
+
+} // namespace
+
+CHIP_ERROR LoopbackContext::Init()
+{
+    ReturnErrorOnFailure(mTransport.Init());
+    return MessagingContext::Init(&mTransport.GetTransportMgr(), &mTransport.GetIOContext());
+}
+
+void LoopbackContext::Shutdown()
+{
+    MessagingContext::Shutdown();
+    mTransport.Shutdown();
+}
+
+CHIP_ERROR LoopbackContext::ServiceIOUntil(const std::function<bool()> & done)
+{
+    const System::Clock::Timestamp start = System::SystemClock().GetMonotonicTimestamp();
+
+    while (!done() || mTransport.GetLoopback().HasPendingMessages())
+    {
+        VerifyOrReturnError(System::SystemClock().GetMonotonicTimestamp() - start < kServiceIOTimeout, CHIP_ERROR_TIMEOUT);
+        mTransport.GetIOContext().DriveIO();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AppContext::Init()
+{
+    ReturnErrorOnFailure(GetTransport().Init());
+    ReturnErrorOnFailure(DeviceLayer::PlatformMgr().InitChipStack());
+    ReturnErrorOnFailure(MessagingContext::Init(&GetTransport().GetTransportMgr(), &GetTransport().GetIOContext()));
+
+    ReturnErrorOnFailure(app::InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                                          app::reporting::GetDefaultReportScheduler()));
+    Access::SetAccessControl(gPermissiveAccessControl);
+    return Access::GetAccessControl().Init(Access::Examples::GetPermissiveAccessControlDelegate(), gDeviceTypeResolver);
+}
+
+void AppContext::Shutdown()
+{
+    Access::GetAccessControl().Finish();
+    Access::ResetAccessControlToDefault();
+    app::InteractionModelEngine::GetInstance()->Shutdown();
+
+    MessagingContext::Shutdown();
+    DeviceLayer::PlatformMgr().Shutdown();
+    GetTransport().Shutdown();
+}
+
+} // namespace Benchmarks
+} // namespace chip
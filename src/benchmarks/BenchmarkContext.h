@@ -0,0 +1,68 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <messaging/tests/MessagingContext.h>
+#include <transport/tests/LoopbackTransportManager.h>
+
+#include <functional>
+
+namespace chip {
+namespace Benchmarks {
+
+/**
+ * Two nodes, Alice and Bob, with PASE sessions to each other over the loopback
+ * transport, as in the messaging unit tests.
+ */
+class LoopbackContext : public Test::MessagingContext
+{
+public:
+    virtual CHIP_ERROR Init();
+    virtual void Shutdown();
+
+    Test::LoopbackTransportManager & GetTransport() { return mTransport; }
+
+    /**
+     * Drive the loopback transport and the system layer until `done` returns
+     * true and no message is in flight anymore.
+     *
+     * Unlike LoopbackTransportManager::DrainAndServiceIO, this does not idle
+     * the event loop once there is no more work, which would otherwise
+     * dominate the measurement.
+     */
+    CHIP_ERROR ServiceIOUntil(const std::function<bool()> & done);
+
+private:
+    Test::LoopbackTransportManager mTransport;
+};
+
+/**
+ * LoopbackContext plus the device layer, an InteractionModelEngine on top of
+ * the messaging stack, and permissive access control, as in the app unit tests.
+ */
+class AppContext : public LoopbackContext
+{
+public:
+    CHIP_ERROR Init() override;
+    void Shutdown() override;
+};
+
+} // namespace Benchmarks
+} // namespace chip
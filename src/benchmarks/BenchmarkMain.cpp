@@ -0,0 +1,258 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      chip-benchmarks: runs the micro-benchmarks registered with
+ *      CHIP_BENCHMARK and prints their results as JSON, e.g.
+ *
+ *      {
+ *        "allocations_counted": true,
+ *        "benchmarks": [
+ *          {"name": "TLV/EncodeStruct", "iterations": 2097152, "ns_per_op": 95.3, "allocs_per_op": 0.00, "bytes_per_op": 0.0}
+ *        ]
+ *      }
+ *
+ *      Each benchmark is run with an increasing number of iterations until
+ *      one run takes at least the minimum time, and that run is reported.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/core/ErrorStr.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+using namespace chip::Benchmarks;
+
+constexpr uint64_t kMaxIterations = 1000000000;
+
+struct Options
+{
+    const char * mFilter = nullptr;
+    const char * mOutput = nullptr;
+    uint32_t mMinTimeMs  = 500;
+};
+
+struct Result
+{
+    const char * mName;
+    uint64_t mIterations;
+    std::chrono::nanoseconds mElapsed;
+    AllocationStats mAllocations;
+    CHIP_ERROR mError;
+};
+
+void PrintUsage(const char * program)
+{
+    fprintf(stderr,
+            "Usage: %s [--filter=<substring>] [--min-time-ms=<ms>] [--output=<file>]\n"
+            "\n"
+            "  --filter       Only run the benchmarks whose name contains <substring>.\n"
+            "  --min-time-ms  Minimum measured duration of each benchmark (default: 500).\n"
+            "  --output       Write the JSON results to <file> instead of stdout.\n",
+            program);
+}
+
+bool ParseArgs(int argc, char ** argv, Options & options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char * arg = argv[i];
+        if (strncmp(arg, "--filter=", strlen("--filter=")) == 0)
+        {
+            options.mFilter = arg + strlen("--filter=");
+        }
+        else if (strncmp(arg, "--output=", strlen("--output=")) == 0)
+        {
+            options.mOutput = arg + strlen("--output=");
+        }
+        else if (strncmp(arg, "--min-time-ms=", strlen("--min-time-ms=")) == 0)
+        {
+            char * end;
+            unsigned long value = strtoul(arg + strlen("--min-time-ms="), &end, 10);
+            if (*end != '\0' || value == 0 || value > UINT32_MAX)
+            {
+                return false;
+            }
+            options.mMinTimeMs = static_cast<uint32_t>(value);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Keep the results apart from the logs.
+void LogToStderr(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    fprintf(stderr, "[%s] ", module);
+    vfprintf(stderr, msg, args);
+    fputc('\n', stderr);
+}
+
+Result Run(const Registration & benchmark, std::chrono::nanoseconds minTime)
+{
+    uint64_t iterations = 1;
+
+    while (true)
+    {
+        State state(iterations);
+        benchmark.GetFunction()(state);
+
+        Result result = { benchmark.GetName(), iterations, state.GetElapsed(), state.GetAllocations(), state.GetError() };
+        if (result.mError != CHIP_NO_ERROR || result.mElapsed >= minTime || iterations >= kMaxIterations)
+        {
+            return result;
+        }
+
+        // Aim a little past the minimum time, without growing by more than 100x in a single step since the
+        // first, short runs are the least accurate.
+        const uint64_t elapsed = std::max<uint64_t>(static_cast<uint64_t>(result.mElapsed.count()), 1);
+        uint64_t next          = iterations * static_cast<uint64_t>(minTime.count()) / elapsed * 6 / 5;
+        next                   = std::min(std::max(next, iterations + 1), iterations * 100);
+        iterations             = std::min(next, kMaxIterations);
+    }
+}
+
+void WriteJsonString(FILE * out, const char * str)
+{
+    fputc('"', out);
+    for (; *str != '\0'; str++)
+    {
+        if (*str == '"' || *str == '\\')
+        {
+            fputc('\\', out);
+        }
+        fputc(*str, out);
+    }
+    fputc('"', out);
+}
+
+void WriteJson(FILE * out, const std::vector<Result> & results)
+{
+    fprintf(out, "{\n  \"allocations_counted\": %s,\n  \"benchmarks\": [", AllocationCountingSupported() ? "true" : "false");
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result & result = results[i];
+
+        fprintf(out, "%s\n    {\"name\": ", i == 0 ? "" : ",");
+        WriteJsonString(out, result.mName);
+
+        if (result.mError != CHIP_NO_ERROR)
+        {
+            fprintf(out, ", \"error\": ");
+            WriteJsonString(out, chip::ErrorStr(result.mError, false));
+            fprintf(out, "}");
+            continue;
+        }
+
+        const double iterations = static_cast<double>(result.mIterations);
+        fprintf(out, ", \"iterations\": %" PRIu64 ", \"ns_per_op\": %.1f", result.mIterations,
+                static_cast<double>(result.mElapsed.count()) / iterations);
+        if (AllocationCountingSupported())
+        {
+            fprintf(out, ", \"allocs_per_op\": %.2f, \"bytes_per_op\": %.1f}",
+                    static_cast<double>(result.mAllocations.mAllocations) / iterations,
+                    static_cast<double>(result.mAllocations.mBytes) / iterations);
+        }
+        else
+        {
+            fprintf(out, ", \"allocs_per_op\": null, \"bytes_per_op\": null}");
+        }
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+}
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    Options options;
+    if (!ParseArgs(argc, argv, options))
+    {
+        PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // The test helpers the benchmarks are built on print to stdout, so keep the
+    // original stdout for the results and send everything else to stderr.
+    FILE * out = fdopen(dup(STDOUT_FILENO), "w");
+    if (out == nullptr || dup2(STDERR_FILENO, STDOUT_FILENO) < 0)
+    {
+        fprintf(stderr, "Failed to redirect stdout\n");
+        return EXIT_FAILURE;
+    }
+
+    // Logging in the measured paths would be measured too.
+    chip::Logging::SetLogRedirectCallback(LogToStderr);
+    chip::Logging::SetLogFilter(chip::Logging::kLogCategory_Error);
+
+    if (chip::Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to initialize memory\n");
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Result> results;
+    bool failed = false;
+    for (const Registration * benchmark = Registration::First(); benchmark != nullptr; benchmark = benchmark->GetNext())
+    {
+        if (options.mFilter != nullptr && strstr(benchmark->GetName(), options.mFilter) == nullptr)
+        {
+            continue;
+        }
+
+        fprintf(stderr, "Running %s\n", benchmark->GetName());
+        results.push_back(Run(*benchmark, std::chrono::milliseconds(options.mMinTimeMs)));
+        failed = failed || results.back().mError != CHIP_NO_ERROR;
+    }
+
+    if (options.mOutput != nullptr)
+    {
+        fclose(out);
+        out = fopen(options.mOutput, "w");
+        if (out == nullptr)
+        {
+            fprintf(stderr, "Failed to open %s\n", options.mOutput);
+            return EXIT_FAILURE;
+        }
+    }
+
+    WriteJson(out, results);
+    fclose(out);
+
+    chip::Platform::MemoryShutdown();
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
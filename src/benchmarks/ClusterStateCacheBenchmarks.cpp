@@ -0,0 +1,157 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <app/ClusterStateCacheStorage.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+
+#include <memory>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Benchmarks;
+
+using MapStorage = ClusterStateMapStorage<true>;
+
+// Roughly a large bridge: many endpoints with a dozen clusters of two dozen attributes each.
+constexpr EndpointId kEndpoints   = 32;
+constexpr ClusterId kClusters     = 12;
+constexpr AttributeId kAttributes = 24;
+
+// Encodes an attribute value whose length depends on aSeed.
+CHIP_ERROR EncodeValue(uint32_t aSeed, uint8_t * aBuffer, size_t aBufferSize, TLV::TLVReader & aReader)
+{
+    uint8_t bytes[64];
+    const size_t length = aSeed % sizeof(bytes);
+    for (size_t i = 0; i < length; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(aSeed + i);
+    }
+
+    TLV::TLVWriter writer;
+    writer.Init(aBuffer, aBufferSize);
+    if (aSeed % 3 == 0)
+    {
+        ReturnErrorOnFailure(writer.Put(TLV::AnonymousTag(), aSeed));
+    }
+    else
+    {
+        ReturnErrorOnFailure(writer.PutBytes(TLV::AnonymousTag(), bytes, static_cast<uint32_t>(length)));
+    }
+    ReturnErrorOnFailure(writer.Finalize());
+
+    aReader.Init(aBuffer, writer.GetLengthWritten());
+    return aReader.Next();
+}
+
+template <typename Storage>
+CHIP_ERROR Populate(Storage & storage)
+{
+    for (EndpointId endpoint = 0; endpoint < kEndpoints; endpoint++)
+    {
+        for (ClusterId cluster = 0; cluster < kClusters; cluster++)
+        {
+            for (AttributeId attribute = 0; attribute < kAttributes; attribute++)
+            {
+                uint8_t buffer[128];
+                TLV::TLVReader reader;
+                ReturnErrorOnFailure(EncodeValue(endpoint + cluster + attribute, buffer, sizeof(buffer), reader));
+
+                TLV::TLVReader sizeReader;
+                sizeReader.Init(reader);
+                ReturnErrorOnFailure(sizeReader.Skip());
+                ReturnErrorOnFailure(
+                    storage.SetData(ConcreteAttributePath(endpoint, cluster, attribute), reader, sizeReader.GetLengthRead()));
+            }
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Caching every attribute of the bridge; bytes_per_op is the heap the storage takes for it.
+template <typename Storage>
+void RunPopulate(State & state)
+{
+    while (state.KeepRunning())
+    {
+        auto storage   = std::make_unique<Storage>();
+        CHIP_ERROR err = Populate(*storage);
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+
+        state.PauseTiming();
+        storage.reset();
+        state.ResumeTiming();
+    }
+}
+
+// Looking up random attributes of the bridge, as ClusterStateCache::Get does.
+template <typename Storage>
+void RunLookup(State & state)
+{
+    auto storage   = std::make_unique<Storage>();
+    CHIP_ERROR err = Populate(*storage);
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+    }
+
+    uint32_t seed = 1;
+    while (state.KeepRunning())
+    {
+        seed = seed * 1103515245 + 12345;
+        const ConcreteAttributePath path(static_cast<EndpointId>((seed >> 8) % kEndpoints),
+                                         static_cast<ClusterId>((seed >> 12) % kClusters),
+                                         static_cast<AttributeId>((seed >> 16) % kAttributes));
+        CachedAttribute attribute;
+        err = storage->GetAttribute(path, attribute);
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+    }
+}
+
+CHIP_BENCHMARK(ClusterStateCache, MapStoragePopulate)
+{
+    RunPopulate<MapStorage>(state);
+}
+
+CHIP_BENCHMARK(ClusterStateCache, FlatStoragePopulate)
+{
+    RunPopulate<ClusterStateFlatStorage>(state);
+}
+
+CHIP_BENCHMARK(ClusterStateCache, MapStorageLookup)
+{
+    RunLookup<MapStorage>(state);
+}
+
+CHIP_BENCHMARK(ClusterStateCache, FlatStorageLookup)
+{
+    RunLookup<ClusterStateFlatStorage>(state);
+}
+
+} // namespace
@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+
+#include <cstring>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::Crypto;
+
+enum class KeyKind
+{
+    // Derived by the keystore, as CASE and PASE do for the session keys.
+    kSessionKey,
+    // The same key material, imported as a plain key.
+    kImportedKey,
+};
+
+ByteSpan ToSpan(const char * str)
+{
+    return ByteSpan(reinterpret_cast<const uint8_t *>(str), strlen(str));
+}
+
+// The per-message encryption and decryption done by CryptoContext. Depending on the crypto backend, session keys may
+// reuse a keyed cipher context instead of setting up the cipher for each message.
+void RunEncryptDecrypt(State & state, KeyKind kind, size_t length)
+{
+    DefaultSessionKeystore keystore;
+
+    Aes128KeyHandle i2r;
+    Aes128KeyHandle r2i;
+    Aes128KeyHandle imported;
+    AttestationChallenge challenge;
+    CHIP_ERROR err = keystore.DeriveSessionKeys(ToSpan("secret"), ToSpan("salt123"), ToSpan("info123"), i2r, r2i, challenge);
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+    err = keystore.CreateKey(i2r.As<Symmetric128BitsKeyByteArray>(), imported);
+    const Aes128KeyHandle & key = (kind == KeyKind::kSessionKey) ? i2r : imported;
+
+    uint8_t aad[24]   = { 0 };
+    uint8_t nonce[13] = { 0 };
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+    Platform::ScopedMemoryBuffer<uint8_t> plaintext;
+    Platform::ScopedMemoryBuffer<uint8_t> ciphertext;
+    if (err == CHIP_NO_ERROR && (!plaintext.Calloc(length) || !ciphertext.Alloc(length)))
+    {
+        err = CHIP_ERROR_NO_MEMORY;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+    }
+
+    uint8_t i = 0;
+    while (state.KeepRunning())
+    {
+        nonce[0] = i++;
+        err = AES_CCM_encrypt(plaintext.Get(), length, aad, sizeof(aad), key, nonce, sizeof(nonce), ciphertext.Get(), tag,
+                              sizeof(tag));
+        if (err == CHIP_NO_ERROR)
+        {
+            err = AES_CCM_decrypt(ciphertext.Get(), length, aad, sizeof(aad), tag, sizeof(tag), key, nonce, sizeof(nonce),
+                                  plaintext.Get());
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+    }
+
+    keystore.DestroyKey(i2r);
+    keystore.DestroyKey(r2i);
+    keystore.DestroyKey(imported);
+}
+
+CHIP_BENCHMARK(AesCcm, EncryptDecrypt64WithSessionKey)
+{
+    RunEncryptDecrypt(state, KeyKind::kSessionKey, 64);
+}
+
+CHIP_BENCHMARK(AesCcm, EncryptDecrypt64WithImportedKey)
+{
+    RunEncryptDecrypt(state, KeyKind::kImportedKey, 64);
+}
+
+CHIP_BENCHMARK(AesCcm, EncryptDecrypt1024WithSessionKey)
+{
+    RunEncryptDecrypt(state, KeyKind::kSessionKey, 1024);
+}
+
+CHIP_BENCHMARK(AesCcm, EncryptDecrypt1024WithImportedKey)
+{
+    RunEncryptDecrypt(state, KeyKind::kImportedKey, 1024);
+}
+
+} // namespace
@@ -0,0 +1,158 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+#include <access/SubjectDescriptor.h>
+#include <app/AttributePathParams.h>
+#include <app/AttributeValueEncoder.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/InteractionModelEngine.h>
+#include <app/MessageDef/AttributeReportIBs.h>
+#include <app/MessageDef/ReportDataMessage.h>
+#include <app/ReadClient.h>
+#include <app/ReadPrepareParams.h>
+#include <app/tests/test-interaction-model-api.h>
+#include <app/util/mock/Constants.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <lib/support/TypeTraits.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Benchmarks;
+
+constexpr size_t kChunkSize        = 512;
+constexpr size_t kListLength       = 128;
+constexpr uint8_t kListItem[16]    = { 0 };
+constexpr DataVersion kDataVersion = 0x1234;
+
+// One chunk of a report: encode as much of the list as fits in `buffer`, picking up where `state` says the
+// previous chunk stopped, the way the reporting engine does.
+CHIP_ERROR EncodeListChunk(MutableByteSpan buffer, AttributeEncodeState & state)
+{
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+    AttributeReportIBs::Builder builder;
+
+    writer.Init(buffer);
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(builder.Init(&writer, to_underlying(ReportDataMessage::Tag::kAttributeReportIBs)));
+
+    Access::SubjectDescriptor subject;
+    AttributeValueEncoder encoder(builder, subject, ConcreteAttributePath(1, 0x0031, 0x0000), kDataVersion,
+                                  /* aIsFabricFiltered = */ false, state);
+    CHIP_ERROR err = encoder.EncodeList([](const auto & itemEncoder) -> CHIP_ERROR {
+        for (size_t i = 0; i < kListLength; i++)
+        {
+            ReturnErrorOnFailure(itemEncoder.Encode(ByteSpan(kListItem)));
+        }
+        return CHIP_NO_ERROR;
+    });
+    state = encoder.GetState();
+    return err;
+}
+
+// Encode a list that takes several chunks, as for a large list attribute that does not fit in one report.
+CHIP_BENCHMARK(AttributeValueEncoder, EncodeListChunked)
+{
+    uint8_t buffer[kChunkSize];
+
+    while (state.KeepRunning())
+    {
+        AttributeEncodeState encodeState;
+        CHIP_ERROR err;
+        size_t chunks = 0;
+        do
+        {
+            err = EncodeListChunk(MutableByteSpan(buffer), encodeState);
+            chunks++;
+        } while ((err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL) && chunks <= kListLength);
+
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+    }
+}
+
+class ReadCompletion : public ReadClient::Callback
+{
+public:
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        mAttributes++;
+    }
+    void OnError(CHIP_ERROR aError) override { mError = aError; }
+    void OnDone(ReadClient * apReadClient) override { mDone = true; }
+
+    size_t mAttributes = 0;
+    CHIP_ERROR mError  = CHIP_NO_ERROR;
+    bool mDone         = false;
+};
+
+// Read a whole mock cluster, one of whose attributes is a list too large for a single report, so that the
+// read handler goes through Engine::BuildAndSendSingleReportData once per chunk.
+CHIP_ERROR ReadChunkedCluster(AppContext & context)
+{
+    ReadCompletion callback;
+    ReadClient readClient(InteractionModelEngine::GetInstance(), &context.GetExchangeManager(), callback,
+                          ReadClient::InteractionType::Read);
+
+    AttributePathParams path(Test::kMockEndpoint3, Test::MockClusterId(2));
+    ReadPrepareParams params(context.GetSessionBobToAlice());
+    params.mpAttributePathParamsList    = &path;
+    params.mAttributePathParamsListSize = 1;
+
+    ReturnErrorOnFailure(readClient.SendRequest(params));
+    ReturnErrorOnFailure(context.ServiceIOUntil([&] { return callback.mDone; }));
+    ReturnErrorOnFailure(callback.mError);
+    return callback.mAttributes > 0 ? CHIP_NO_ERROR : CHIP_ERROR_INCORRECT_STATE;
+}
+
+CHIP_BENCHMARK(ReportingEngine, ReadChunkedCluster)
+{
+    AppContext context;
+    CHIP_ERROR err = context.Init();
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    InteractionModelEngine * engine   = InteractionModelEngine::GetInstance();
+    DataModel::Provider * oldProvider = engine->SetDataModelProvider(&TestImCustomDataModel::Instance());
+
+    while (state.KeepRunning())
+    {
+        err = ReadChunkedCluster(context);
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+    }
+
+    engine->SetDataModelProvider(oldProvider);
+    context.Shutdown();
+}
+
+} // namespace
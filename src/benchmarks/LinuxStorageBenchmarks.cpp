@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/CodeUtils.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::DeviceLayer::Internal;
+
+constexpr uint32_t kKeys       = 64;
+constexpr size_t kValueSize    = 128;
+constexpr size_t kMaxKeyLength = 16;
+
+// Removes the file at a per-process path on construction and destruction.
+class ScratchFile
+{
+public:
+    explicit ScratchFile(const char * suffix) : mPath("/tmp/chip-benchmarks-" + std::to_string(getpid()) + suffix)
+    {
+        unlink(mPath.c_str());
+    }
+    ~ScratchFile() { unlink(mPath.c_str()); }
+
+    const char * Path() const { return mPath.c_str(); }
+
+private:
+    std::string mPath;
+};
+
+void KeyFor(uint64_t i, char (&key)[kMaxKeyLength])
+{
+    snprintf(key, sizeof(key), "k%u", static_cast<unsigned>(i % kKeys));
+}
+
+/**
+ * Runs put (and, once every key has been written, get) against kKeys keys with
+ * kValueSize-byte values, the way the KVS manager drives the platform store.
+ */
+template <typename PutFn, typename GetFn>
+void RunPutGet(State & state, bool measureGet, PutFn && put, GetFn && get)
+{
+    uint8_t value[kValueSize];
+    char key[kMaxKeyLength];
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    if (measureGet)
+    {
+        for (uint32_t i = 0; i < kKeys && err == CHIP_NO_ERROR; i++)
+        {
+            KeyFor(i, key);
+            memset(value, static_cast<int>(i), sizeof(value));
+            err = put(key, value);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+    }
+
+    uint64_t i = 0;
+    while (state.KeepRunning())
+    {
+        KeyFor(i, key);
+        if (measureGet)
+        {
+            err = get(key, value);
+        }
+        else
+        {
+            memset(value, static_cast<int>(i), sizeof(value));
+            err = put(key, value);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+        i++;
+    }
+}
+
+// The INI store, used by default, rewrites the whole file on every commit.
+void RunIni(State & state, bool measureGet)
+{
+    ScratchFile file(".ini");
+    ChipLinuxStorage storage;
+    CHIP_ERROR err = storage.Init(file.Path());
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    RunPutGet(
+        state, measureGet,
+        [&](const char * key, const uint8_t * value) -> CHIP_ERROR {
+            ReturnErrorOnFailure(storage.WriteValueBin(key, value, kValueSize));
+            return storage.Commit();
+        },
+        [&](const char * key, uint8_t * value) -> CHIP_ERROR {
+            size_t size;
+            return storage.ReadValueBin(key, value, kValueSize, size);
+        });
+}
+
+// The log-structured store appends a record for every write.
+void RunLog(State & state, bool measureGet)
+{
+    ScratchFile file(".log");
+    ChipLinuxStorageLog storage;
+    CHIP_ERROR err = storage.Init(file.Path());
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    RunPutGet(
+        state, measureGet, [&](const char * key, const uint8_t * value) { return storage.Put(key, value, kValueSize); },
+        [&](const char * key, uint8_t * value) { return storage.Get(key, value, kValueSize); });
+
+    storage.Shutdown();
+}
+
+CHIP_BENCHMARK(LinuxStorage, IniPut)
+{
+    RunIni(state, false);
+}
+
+CHIP_BENCHMARK(LinuxStorage, IniGet)
+{
+    RunIni(state, true);
+}
+
+CHIP_BENCHMARK(LinuxStorage, LogPut)
+{
+    RunLog(state, false);
+}
+
+CHIP_BENCHMARK(LinuxStorage, LogGet)
+{
+    RunLog(state, true);
+}
+
+} // namespace
@@ -0,0 +1,324 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+#include <lib/support/CodeUtils.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeDelegate.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/ReliableMessageMgr.h>
+#include <messaging/ReliableMessageProtocolConfig.h>
+#include <protocols/Protocols.h>
+#include <protocols/bdx/BdxMessages.h>
+#include <protocols/echo/Echo.h>
+#include <transport/SessionManager.h>
+#include <transport/SessionMessageDelegate.h>
+#include <transport/raw/MessageHeader.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::Messaging;
+
+// About the size of a typical Interaction Model message.
+constexpr size_t kPayloadSize = 256;
+uint8_t gPayload[kPayloadSize];
+
+class CountingSessionMessageDelegate : public SessionMessageDelegate
+{
+public:
+    void OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader, const SessionHandle & session,
+                           DuplicateMessage isDuplicate, System::PacketBufferHandle && msgBuf) override
+    {
+        mReceived++;
+    }
+
+    uint64_t mReceived = 0;
+};
+
+class CountingExchangeDelegate : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        mReceived++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    uint64_t mReceived = 0;
+};
+
+// Encrypt a message on Alice's session, loop it back, and decrypt and dispatch it on Bob's: the whole
+// SessionManager send and receive path, without the exchange layer on top.
+CHIP_ERROR EncryptAndDispatch(LoopbackContext & context, const SessionHandle & session, CountingSessionMessageDelegate & delegate)
+{
+    SessionManager & sessionManager = context.GetSecureSessionManager();
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(Protocols::Echo::MsgType::EchoRequest);
+
+    EncryptedPacketBufferHandle preparedMessage;
+    ReturnErrorOnFailure(sessionManager.PrepareMessage(session, payloadHeader,
+                                                       MessagePacketBuffer::NewWithData(gPayload, kPayloadSize), preparedMessage));
+    ReturnErrorOnFailure(sessionManager.SendPreparedMessage(session, preparedMessage));
+
+    const uint64_t expected = delegate.mReceived + 1;
+    return context.ServiceIOUntil([&] { return delegate.mReceived == expected; });
+}
+
+// Send an unsolicited message from Alice and have Bob's ExchangeManager match it to its handler and
+// a new exchange, which closes once the message is handled.
+CHIP_ERROR SendUnsolicited(LoopbackContext & context, CountingExchangeDelegate & delegate)
+{
+    ExchangeContext * ec = context.NewExchangeToBob(&delegate);
+    VerifyOrReturnError(ec != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // Without an MRP ack to wait for, the exchange closes as soon as the message is sent.
+    CHIP_ERROR err = ec->SendMessage(Protocols::Echo::MsgType::EchoRequest,
+                                     MessagePacketBuffer::NewWithData(gPayload, kPayloadSize),
+                                     SendFlags(SendMessageFlags::kNoAutoRequestAck));
+    if (err != CHIP_NO_ERROR)
+    {
+        ec->Close();
+        return err;
+    }
+
+    const uint64_t expected = delegate.mReceived + 1;
+    return context.ServiceIOUntil([&] { return delegate.mReceived == expected; });
+}
+
+// Keeps every exchange it receives a message on open, so that the same exchange can be dispatched to again.
+class KeepOpenExchangeDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        mLastExchange = ec;
+        ec->WillSendMessage();
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    ExchangeContext * mLastExchange = nullptr;
+};
+
+// Hand a response to `ec` straight to its ExchangeManager, as SessionManager does once it has decrypted it.
+void DeliverResponse(ExchangeManager & exchangeManager, ExchangeContext * ec)
+{
+    PacketHeader packetHeader;
+    packetHeader.SetSessionId(1);
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(ec->GetExchangeId())
+        .SetInitiator(false)
+        .SetMessageType(Protocols::BDX::Id, to_underlying(bdx::MessageType::BlockQuery));
+
+    static_cast<SessionMessageDelegate &>(exchangeManager)
+        .OnMessageReceived(packetHeader, payloadHeader, ec->GetSessionHandle(), SessionMessageDelegate::DuplicateMessage::No,
+                           System::PacketBufferHandle::New(0));
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_SYSTEM_CONFIG_USE_LWIP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE == 0
+// Exchanges, retransmission entries and packet buffers are all allocated from the heap.
+constexpr size_t kActiveExchanges  = 256;
+constexpr size_t kInFlightMessages = 2000;
+#else
+constexpr size_t kActiveExchanges = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS;
+// Half of the exchanges send, the other half is left for the ephemeral exchanges acknowledging them.
+constexpr size_t kInFlightMessages = std::min<size_t>(CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE) / 2;
+#endif
+
+CHIP_BENCHMARK(SessionManager, EncryptAndDispatch)
+{
+    LoopbackContext context;
+    CHIP_ERROR err = context.Init();
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    SessionHandle session = context.GetSessionAliceToBob();
+    CountingSessionMessageDelegate delegate;
+    context.GetSecureSessionManager().SetMessageDelegate(&delegate);
+
+    while (state.KeepRunning())
+    {
+        err = EncryptAndDispatch(context, session, delegate);
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+    }
+
+    context.GetSecureSessionManager().SetMessageDelegate(&context.GetExchangeManager());
+    context.Shutdown();
+}
+
+CHIP_BENCHMARK(ExchangeManager, UnsolicitedDispatch)
+{
+    LoopbackContext context;
+    CHIP_ERROR err = context.Init();
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    CountingExchangeDelegate delegate;
+    err = context.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::Echo::MsgType::EchoRequest, &delegate);
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+    }
+
+    while (state.KeepRunning())
+    {
+        err = SendUnsolicited(context, delegate);
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+    }
+
+    context.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::Echo::MsgType::EchoRequest);
+    context.Shutdown();
+}
+
+// Dispatch a message to the oldest of kActiveExchanges open exchanges.
+CHIP_BENCHMARK(ExchangeManager, DispatchWithManyExchanges)
+{
+    LoopbackContext context;
+    CHIP_ERROR err = context.Init();
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    KeepOpenExchangeDelegate delegate;
+    std::vector<ExchangeContext *> exchanges;
+    while (exchanges.size() < kActiveExchanges)
+    {
+        ExchangeContext * ec = context.NewExchangeToBob(&delegate);
+        if (ec == nullptr)
+        {
+            state.SkipWithError(CHIP_ERROR_NO_MEMORY);
+            break;
+        }
+        exchanges.push_back(ec);
+    }
+
+    while (state.KeepRunning())
+    {
+        DeliverResponse(context.GetExchangeManager(), exchanges.front());
+        if (delegate.mLastExchange != exchanges.front())
+        {
+            state.SkipWithError(CHIP_ERROR_INCORRECT_STATE);
+        }
+        delegate.mLastExchange = nullptr;
+    }
+
+    for (ExchangeContext * ec : exchanges)
+    {
+        ec->Close();
+    }
+    context.Shutdown();
+}
+
+// Send a reliable message and process its acknowledgement while kInFlightMessages - 1 other messages wait in the
+// retransmission table.
+CHIP_BENCHMARK(ReliableMessageMgr, AckWithManyInFlightMessages)
+{
+    LoopbackContext context;
+    CHIP_ERROR err = context.Init();
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    ReliableMessageMgr * rm = context.GetExchangeManager().GetReliableMessageMgr();
+    CountingExchangeDelegate delegate;
+
+    // Park all but one of the in-flight messages on a lossy link, with a retry interval long enough for them to stay in the
+    // retransmission table while the remaining exchange sends and gets acknowledgements.
+    context.GetSessionBobToAlice()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        System::Clock::Milliseconds32(60000), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        System::Clock::Milliseconds32(60000), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+
+    auto & loopback             = context.GetTransport().GetLoopback();
+    loopback.mNumMessagesToDrop = kInFlightMessages - 1;
+
+    auto sendToAlice = [&]() -> CHIP_ERROR {
+        ExchangeContext * ec = context.NewExchangeToAlice(&delegate);
+        VerifyOrReturnError(ec != nullptr, CHIP_ERROR_NO_MEMORY);
+        return ec->SendMessage(Protocols::Echo::MsgType::EchoRequest, MessagePacketBuffer::NewWithData(gPayload, kPayloadSize));
+    };
+
+    for (size_t i = 0; i + 1 < kInFlightMessages && err == CHIP_NO_ERROR; i++)
+    {
+        err = sendToAlice();
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = context.ServiceIOUntil([&] { return loopback.mNumMessagesToDrop == 0; });
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+    }
+
+    while (state.KeepRunning())
+    {
+        err = sendToAlice();
+        if (err == CHIP_NO_ERROR)
+        {
+            err = context.ServiceIOUntil([&] { return rm->TestGetCountRetransTable() == static_cast<int>(kInFlightMessages - 1); });
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+    }
+
+    rm->EnumerateRetransTable([&](auto * entry) {
+        rm->ClearRetransTable(*entry);
+        return Loop::Continue;
+    });
+    context.Shutdown();
+}
+
+} // namespace
@@ -0,0 +1,309 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/Flags.h>
+#include <ota-provider-common/MappedBdxOtaSender.h>
+#include <protocols/bdx/BdxMessages.h>
+#include <protocols/bdx/TransferFacilitator.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using bdx::TransferSession;
+
+constexpr size_t kImageSize                         = 2 * 1024 * 1024;
+constexpr char kFileDesignator[]                    = "ota-image.bin";
+constexpr System::Clock::Timeout kTransferTimeout   = System::Clock::Seconds16(60);
+constexpr System::Clock::Timeout kRequestorPollFreq = System::Clock::Milliseconds32(50);
+
+/**
+ * The BDX side of an OTA requestor: downloads the whole image with receiver-driven BlockQuery messages, checking every
+ * block against the expected contents.
+ */
+class SimulatedRequestor : public bdx::Initiator
+{
+public:
+    ~SimulatedRequestor() override { Finish(CHIP_ERROR_CANCELLED); }
+
+    CHIP_ERROR Start(LoopbackContext & context, ByteSpan expectedImage)
+    {
+        mExpectedImage = expectedImage;
+        mReceived      = 0;
+        mDone          = false;
+        mError         = CHIP_NO_ERROR;
+
+        mExchangeCtx = context.NewExchangeToBob(this);
+        VerifyOrReturnError(mExchangeCtx != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        TransferSession::TransferInitData initData;
+        initData.TransferCtlFlags = bdx::TransferControlFlags::kReceiverDrive;
+        initData.MaxBlockSize     = MappedBdxOtaSender::kDefaultMaxBlockSize;
+        initData.FileDesignator   = Uint8::from_const_char(kFileDesignator);
+        initData.FileDesLength    = static_cast<uint16_t>(strlen(kFileDesignator));
+        ReturnErrorOnFailure(InitiateTransfer(&context.GetSystemLayer(), bdx::TransferRole::kReceiver, initData, kTransferTimeout,
+                                              kRequestorPollFreq));
+
+        // Send the ReceiveInit now rather than on the first poll.
+        PollUntilIdle();
+        return CHIP_NO_ERROR;
+    }
+
+    bool IsDone() const { return mDone; }
+    CHIP_ERROR GetError() const { return mError; }
+
+private:
+    CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && payload) override
+    {
+        CHIP_ERROR err = TransferFacilitator::OnMessageReceived(ec, payloadHeader, std::move(payload));
+
+        // Reply from the event loop, as a requestor on another node would: answering from here would have the loopback
+        // transport run the whole download inside this call.
+        if (mSystemLayer != nullptr)
+        {
+            mSystemLayer->StartTimer(System::Clock::kZero, HandlePollTimer, this);
+        }
+        return err;
+    }
+
+    static void HandlePollTimer(System::Layer * systemLayer, void * appState)
+    {
+        static_cast<SimulatedRequestor *>(appState)->PollUntilIdle();
+    }
+
+    void PollUntilIdle()
+    {
+        do
+        {
+            VerifyOrReturn(mSystemLayer != nullptr);
+            mHadOutput = false;
+            PollForOutput();
+        } while (mHadOutput);
+    }
+
+    void HandleTransferSessionOutput(TransferSession::OutputEvent & event) override
+    {
+        mHadOutput = (event.EventType != TransferSession::OutputEventType::kNone);
+        switch (event.EventType)
+        {
+        case TransferSession::OutputEventType::kNone:
+        case TransferSession::OutputEventType::kAckReceived:
+            break;
+        case TransferSession::OutputEventType::kAcceptReceived:
+            Check(mTransfer.PrepareBlockQuery());
+            break;
+        case TransferSession::OutputEventType::kMsgToSend: {
+            const bool isLast = event.msgTypeData.HasMessageType(bdx::MessageType::BlockAckEOF) ||
+                event.msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport);
+            Messaging::SendFlags sendFlags;
+            VerifyOrDo(isLast, sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse));
+
+            Messaging::ExchangeContext * ec = mExchangeCtx;
+            if (ec == nullptr)
+            {
+                Finish(CHIP_ERROR_INCORRECT_STATE);
+                break;
+            }
+            if (isLast)
+            {
+                // The exchange closes itself once a message that expects no response is sent.
+                mExchangeCtx = nullptr;
+            }
+
+            CHIP_ERROR err =
+                ec->SendMessage(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType, std::move(event.MsgData), sendFlags);
+            if (err != CHIP_NO_ERROR && isLast)
+            {
+                ec->Close();
+            }
+            Check(err);
+            if (isLast)
+            {
+                Finish(mReceived == mExpectedImage.size() ? CHIP_NO_ERROR : CHIP_ERROR_INCORRECT_STATE);
+            }
+            break;
+        }
+        case TransferSession::OutputEventType::kBlockReceived: {
+            const ByteSpan block(event.blockdata.Data, event.blockdata.Length);
+            if ((block.size() > mExpectedImage.size() - mReceived) ||
+                !block.data_equal(mExpectedImage.SubSpan(mReceived, block.size())))
+            {
+                Check(CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+                break;
+            }
+            mReceived += block.size();
+            Check(event.blockdata.IsEof ? mTransfer.PrepareBlockAck() : mTransfer.PrepareBlockQuery());
+            break;
+        }
+        default:
+            Finish(CHIP_ERROR_INTERNAL);
+            break;
+        }
+    }
+
+    void OnExchangeClosing(Messaging::ExchangeContext * ec) override
+    {
+        if (mExchangeCtx == ec)
+        {
+            mExchangeCtx = nullptr;
+            Finish(CHIP_ERROR_CONNECTION_ABORTED);
+        }
+    }
+
+    void Check(CHIP_ERROR err)
+    {
+        if (err != CHIP_NO_ERROR)
+        {
+            Finish(err);
+        }
+    }
+
+    void Finish(CHIP_ERROR err)
+    {
+        VerifyOrReturn(!mDone);
+        mDone  = true;
+        mError = err;
+        if (mSystemLayer != nullptr)
+        {
+            mSystemLayer->CancelTimer(HandlePollTimer, this);
+        }
+        ResetTransfer();
+        if (mExchangeCtx != nullptr)
+        {
+            Messaging::ExchangeContext * ec = mExchangeCtx;
+            mExchangeCtx                    = nullptr;
+            ec->Close();
+        }
+    }
+
+    ByteSpan mExpectedImage;
+    size_t mReceived = 0;
+    bool mHadOutput  = false;
+    bool mDone       = false;
+    CHIP_ERROR mError;
+};
+
+/// A file holding a pseudo-random OTA image, removed when done.
+class TemporaryImage
+{
+public:
+    ~TemporaryImage()
+    {
+        if (mPath[0] != '\0')
+        {
+            unlink(mPath);
+        }
+    }
+
+    CHIP_ERROR Create()
+    {
+        VerifyOrReturnError(mContents.Alloc(kImageSize), CHIP_ERROR_NO_MEMORY);
+        uint32_t seed = 1;
+        for (size_t i = 0; i < kImageSize; i++)
+        {
+            seed               = seed * 1103515245 + 12345;
+            mContents.Get()[i] = static_cast<uint8_t>(seed >> 16);
+        }
+
+        strcpy(mPath, "/tmp/chip-benchmarks-ota-XXXXXX");
+        int fd = mkstemp(mPath);
+        VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+        const bool written = (write(fd, mContents.Get(), kImageSize) == static_cast<ssize_t>(kImageSize));
+        close(fd);
+        return written ? CHIP_NO_ERROR : CHIP_ERROR_WRITE_FAILED;
+    }
+
+    const char * GetPath() const { return mPath; }
+    ByteSpan GetContents() const { return ByteSpan(mContents.Get(), kImageSize); }
+
+private:
+    char mPath[64] = {};
+    Platform::ScopedMemoryBuffer<uint8_t> mContents;
+};
+
+// Download a 2 MB image to `requestorCount` requestors at once, all served by one MappedBdxOtaSender.
+void DownloadImage(State & state, size_t requestorCount)
+{
+    TemporaryImage image;
+    LoopbackContext context;
+    MappedBdxOtaSender sender;
+    CHIP_ERROR err = image.Create();
+    SuccessOrExit(err);
+    SuccessOrExit(err = context.Init());
+
+    sender.SetMaxTransfers(requestorCount);
+    SuccessOrExit(err = sender.Init(&context.GetSystemLayer(), &context.GetExchangeManager()));
+    SuccessOrExit(err = sender.PublishImage(CharSpan::fromCharString(kFileDesignator), image.GetPath()));
+
+    {
+        std::vector<SimulatedRequestor> requestors(requestorCount);
+        while (state.KeepRunning())
+        {
+            for (auto & requestor : requestors)
+            {
+                SuccessOrExit(err = requestor.Start(context, image.GetContents()));
+            }
+
+            SuccessOrExit(err = context.ServiceIOUntil([&] {
+                return std::all_of(requestors.begin(), requestors.end(), [](auto & r) { return r.IsDone(); }) &&
+                    sender.GetActiveTransferCount() == 0;
+            }));
+
+            for (auto & requestor : requestors)
+            {
+                SuccessOrExit(err = requestor.GetError());
+            }
+        }
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+    }
+    sender.Shutdown();
+    context.Shutdown();
+}
+
+CHIP_BENCHMARK(OtaProvider, MappedDownload2MBTo1Requestor)
+{
+    DownloadImage(state, 1);
+}
+
+// Every transfer holds messages queued on the loopback transport and awaiting acknowledgement, so many more requestors
+// than this would exhaust the default pool of CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE (15) buffers.
+CHIP_BENCHMARK(OtaProvider, MappedDownload2MBTo4Requestors)
+{
+    DownloadImage(state, 4);
+}
+
+} // namespace
@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Benchmarks;
+
+constexpr unsigned kProducerThreads = 4;
+
+// Keeps the producers from running arbitrarily far ahead of the event loop.
+constexpr uint64_t kMaxQueued = 4096;
+
+std::atomic<uint64_t> gWorkDone{ 0 };
+
+void CountWork(intptr_t)
+{
+    gWorkDone.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * kProducerThreads application threads schedule GetIterations() work items in
+ * total onto a running event loop, the way an application publishing sensor
+ * updates from its own threads would. Measures until the last of them has run.
+ */
+void ScheduleWorkFromThreads(State & state, bool lockStack)
+{
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().InitChipStack();
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    err = DeviceLayer::PlatformMgr().StartEventLoopTask();
+    if (err != CHIP_NO_ERROR)
+    {
+        DeviceLayer::PlatformMgr().Shutdown();
+        state.SkipWithError(err);
+        return;
+    }
+
+    const uint64_t total = state.GetIterations();
+    std::atomic<bool> go{ false };
+    std::atomic<bool> failed{ false };
+    std::mutex errorLock;
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    gWorkDone = 0;
+
+    std::vector<std::thread> producers;
+    for (unsigned i = 0; i < kProducerThreads; i++)
+    {
+        const uint64_t count = total / kProducerThreads + (i < total % kProducerThreads ? 1 : 0);
+        producers.emplace_back([count, lockStack, &go, &failed, &errorLock, &error]() {
+            while (!go.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+
+            for (uint64_t posted = 0; posted < count; posted++)
+            {
+                // Each producer assumes the others are as far along as it is.
+                while (posted * kProducerThreads > gWorkDone.load(std::memory_order_relaxed) + kMaxQueued)
+                {
+                    std::this_thread::yield();
+                }
+
+                if (lockStack)
+                {
+                    DeviceLayer::PlatformMgr().LockChipStack();
+                }
+                CHIP_ERROR scheduleErr = DeviceLayer::PlatformMgr().ScheduleWork(CountWork);
+                if (lockStack)
+                {
+                    DeviceLayer::PlatformMgr().UnlockChipStack();
+                }
+
+                if (scheduleErr != CHIP_NO_ERROR)
+                {
+                    std::lock_guard<std::mutex> lock(errorLock);
+                    error  = scheduleErr;
+                    failed = true;
+                    return;
+                }
+            }
+        });
+    }
+
+    state.RunAll([&]() {
+        go.store(true, std::memory_order_release);
+        for (auto & producer : producers)
+        {
+            producer.join();
+        }
+        while (!failed && gWorkDone.load(std::memory_order_relaxed) < total)
+        {
+            std::this_thread::yield();
+        }
+    });
+
+    if (failed)
+    {
+        state.SkipWithError(error);
+    }
+
+    DeviceLayer::PlatformMgr().StopEventLoopTask();
+    DeviceLayer::PlatformMgr().Shutdown();
+}
+
+} // namespace
+
+CHIP_BENCHMARK(PlatformManager, ScheduleWorkContended)
+{
+    ScheduleWorkFromThreads(state, false /* lockStack */);
+}
+
+// For comparison: what posting cost when every producer took the stack lock first.
+CHIP_BENCHMARK(PlatformManager, ScheduleWorkUnderStackLock)
+{
+    ScheduleWorkFromThreads(state, true /* lockStack */);
+}
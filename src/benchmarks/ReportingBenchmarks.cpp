@@ -0,0 +1,315 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+#include <access/SubjectDescriptor.h>
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/EventLoggingDelegate.h>
+#include <app/EventLoggingTypes.h>
+#include <app/EventManagement.h>
+#include <app/MessageDef/EventDataIB.h>
+#include <app/reporting/DirtyPathSet.h>
+#include <app/reporting/InterestIndex.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPCounter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/TypeTraits.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+using namespace chip::Benchmarks;
+
+uint32_t NextRandom(uint32_t & seed)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed;
+}
+
+// 128 endpoints of 16 dirty attributes each, looked up as half hits and half misses.
+CHIP_BENCHMARK(DirtyPathSet, LookupLargeSet)
+{
+    constexpr size_t kCapacity = 2048;
+    auto set                   = std::make_unique<DirtyPathSetWithStorage<kCapacity>>();
+
+    uint64_t generation = 1;
+    for (EndpointId endpoint = 1; endpoint <= 128; endpoint++)
+    {
+        for (AttributeId attribute = 0; attribute < 16; attribute++)
+        {
+            CHIP_ERROR err = set->InsertPath(AttributePathParams(endpoint, 0x0402, attribute), generation++);
+            if (err != CHIP_NO_ERROR)
+            {
+                state.SkipWithError(err);
+                return;
+            }
+        }
+    }
+
+    uint32_t i     = 0;
+    uint32_t dirty = 0;
+    while (state.KeepRunning())
+    {
+        ConcreteAttributePath path(static_cast<EndpointId>(1 + i % 128), 0x0402, static_cast<AttributeId>(i % 32));
+        dirty += set->IsPathDirtySince(path, 0) ? 1 : 0;
+        i++;
+    }
+    // Attributes 16 to 31 were never marked dirty.
+    if (dirty != i / 32 * 16 + std::min<uint32_t>(i % 32, 16))
+    {
+        state.SkipWithError(CHIP_ERROR_INCORRECT_STATE);
+    }
+}
+
+constexpr size_t kSubscriptions   = 100;
+constexpr size_t kPathsPerHandler = 50;
+
+// Stands in for a ReadHandler: the index never looks into the handlers it stores.
+struct Subscription
+{
+    std::vector<SingleLinkedListNode<AttributePathParams>> paths;
+
+    void Append(const AttributePathParams & path)
+    {
+        paths.emplace_back();
+        paths.back().mValue = path;
+    }
+
+    // Must be called once the paths are final, since the vector may reallocate.
+    const SingleLinkedListNode<AttributePathParams> * List()
+    {
+        for (size_t i = 0; i + 1 < paths.size(); i++)
+        {
+            paths[i].mpNext = &paths[i + 1];
+        }
+        return paths.empty() ? nullptr : &paths.front();
+    }
+
+    bool Intersects(const AttributePathParams & dirtyPath) const
+    {
+        for (const auto & node : paths)
+        {
+            if (node.mValue.Intersects(dirtyPath))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// 100 subscriptions of 50 paths each over 20 endpoints: mostly concrete attributes, with a few cluster and endpoint
+// wildcards and one path every subscription shares.
+std::vector<std::unique_ptr<Subscription>> MakeSubscriptions()
+{
+    std::vector<std::unique_ptr<Subscription>> subscriptions;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < kSubscriptions; i++)
+    {
+        auto subscription = std::make_unique<Subscription>();
+        subscription->Append(AttributePathParams(0, 0x0028, 0));
+        for (size_t j = 1; j < kPathsPerHandler; j++)
+        {
+            NextRandom(seed);
+            EndpointId endpoint = static_cast<EndpointId>(1 + (seed >> 8) % 20);
+            ClusterId cluster   = static_cast<ClusterId>(0x0400 + (seed >> 16) % 8);
+            switch ((seed >> 4) % 16)
+            {
+            case 0:
+                subscription->Append(AttributePathParams(endpoint, cluster));
+                break;
+            case 1:
+                subscription->Append(AttributePathParams(kInvalidEndpointId, cluster, 0));
+                break;
+            default:
+                subscription->Append(AttributePathParams(endpoint, cluster, static_cast<AttributeId>((seed >> 24) % 8)));
+                break;
+            }
+        }
+        subscriptions.push_back(std::move(subscription));
+    }
+    return subscriptions;
+}
+
+ConcreteAttributePath DirtyPath(uint32_t i)
+{
+    return ConcreteAttributePath(static_cast<EndpointId>(1 + i % 20), static_cast<ClusterId>(0x0400 + i % 8),
+                                 static_cast<AttributeId>(i % 8));
+}
+
+// Finding the subscriptions interested in an attribute marked dirty, with the index the reporting engine keeps.
+CHIP_BENCHMARK(InterestIndex, DirtyMarkManySubscriptions)
+{
+    auto index         = std::make_unique<InterestIndexWithStorage<Subscription, kSubscriptions * kPathsPerHandler>>();
+    auto subscriptions = MakeSubscriptions();
+    for (auto & subscription : subscriptions)
+    {
+        CHIP_ERROR err = index->Add(*subscription, subscription->List());
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+            return;
+        }
+    }
+
+    uint32_t i    = 0;
+    size_t visits = 0;
+    while (state.KeepRunning())
+    {
+        index->ForEachInterestedHandler(DirtyPath(i++), [&](Subscription &) {
+            visits++;
+            return Loop::Continue;
+        });
+    }
+    if (visits == 0)
+    {
+        state.SkipWithError(CHIP_ERROR_INCORRECT_STATE);
+    }
+
+    index->ReleaseAll();
+}
+
+// For comparison: the same lookup by checking every path of every subscription.
+CHIP_BENCHMARK(InterestIndex, DirtyMarkManySubscriptionsLinear)
+{
+    auto subscriptions = MakeSubscriptions();
+
+    uint32_t i     = 0;
+    size_t matches = 0;
+    while (state.KeepRunning())
+    {
+        const ConcreteAttributePath path = DirtyPath(i++);
+        for (auto & subscription : subscriptions)
+        {
+            matches += subscription->Intersects(AttributePathParams(path.mEndpointId, path.mClusterId, path.mAttributeId)) ? 1 : 0;
+        }
+    }
+    if (matches == 0)
+    {
+        state.SkipWithError(CHIP_ERROR_INCORRECT_STATE);
+    }
+}
+
+constexpr EndpointId kEventEndpointId = 1;
+constexpr ClusterId kFirstClusterId   = 0x0400;
+constexpr size_t kClusterCount        = 8;
+constexpr EventId kEventId            = 1;
+
+class EventGenerator : public EventLoggingDelegate
+{
+public:
+    CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) override
+    {
+        TLV::TLVType dataContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::ContextTag(to_underlying(EventDataIB::Tag::kData)),
+                                                    TLV::kTLVType_Structure, dataContainerType));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(1), mValue));
+        return aWriter.EndContainer(dataContainerType);
+    }
+
+    uint32_t mValue = 0;
+};
+
+uint8_t gDebugEventBuffer[4096];
+uint8_t gInfoEventBuffer[4096];
+uint8_t gCritEventBuffer[4096];
+CircularEventBuffer gCircularEventBuffer[3];
+
+// Log events over all the clusters until the buffers have wrapped, evicting and promoting along the way. On return,
+// aLastEvent and aLastCluster identify the newest event.
+CHIP_ERROR LogEvents(EventNumber & aLastEvent, ClusterId & aLastCluster)
+{
+    EventGenerator generator;
+    uint32_t seed = 7;
+    for (size_t i = 0; i < 2000; i++)
+    {
+        NextRandom(seed);
+        aLastCluster = static_cast<ClusterId>(kFirstClusterId + (seed >> 8) % kClusterCount);
+        EventOptions options;
+        options.mPath     = { kEventEndpointId, aLastCluster, kEventId };
+        options.mPriority = static_cast<PriorityLevel>(static_cast<uint8_t>(PriorityLevel::Debug) + (seed >> 16) % 3);
+        generator.mValue  = seed;
+        ReturnErrorOnFailure(EventManagement::GetInstance().LogEvent(&generator, options, aLastEvent));
+    }
+    return CHIP_NO_ERROR;
+}
+
+// What a subscription does on every report: ask for the events logged since the last one, for a single cluster.
+CHIP_BENCHMARK(EventManagement, FetchNewEvents)
+{
+    const LogStorageResources logStorageResources[] = {
+        { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), PriorityLevel::Debug },
+        { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), PriorityLevel::Info },
+        { &gCritEventBuffer[0], sizeof(gCritEventBuffer), PriorityLevel::Critical },
+    };
+
+    AppContext context;
+    CHIP_ERROR err = context.Init();
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    MonotonicallyIncreasingCounter<EventNumber> eventCounter;
+    EventNumber lastEvent = 0;
+    ClusterId lastCluster = kFirstClusterId;
+    err                   = eventCounter.Init(0);
+    if (err == CHIP_NO_ERROR)
+    {
+        EventManagement::CreateEventManagement(&context.GetExchangeManager(), MATTER_ARRAY_SIZE(logStorageResources),
+                                               gCircularEventBuffer, logStorageResources, &eventCounter);
+        err = LogEvents(lastEvent, lastCluster);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+    }
+
+    SingleLinkedListNode<EventPathParams> pathNode;
+    pathNode.mValue = EventPathParams(kEventEndpointId, lastCluster, kEventId);
+    uint8_t buffer[1024];
+
+    while (state.KeepRunning())
+    {
+        TLV::TLVWriter writer;
+        EventNumber eventMin = lastEvent;
+        size_t eventCount    = 0;
+        writer.Init(buffer);
+        err = EventManagement::GetInstance().FetchEventsSince(writer, &pathNode, eventMin, eventCount, Access::SubjectDescriptor{});
+        if ((err != CHIP_NO_ERROR && err != CHIP_END_OF_TLV) || eventCount != 1)
+        {
+            state.SkipWithError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV ? CHIP_ERROR_INCORRECT_STATE : err);
+        }
+    }
+
+    EventManagement::DestroyEventManagement();
+    context.Shutdown();
+}
+
+} // namespace
@@ -0,0 +1,104 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemTimer.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::System;
+
+constexpr size_t kPendingTimers = 1000;
+
+void TimerCallback(Layer *, void *) {}
+
+uint32_t NextRandom(uint32_t & seed)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+// Like a stack restarting its retransmission and idle timers, with kPendingTimers pending: cancel a timer by callback
+// and state, then start it again with a new deadline, moving time forward now and then.
+template <typename Queue>
+void RunTimerChurn(State & state)
+{
+    using Timer = typename Queue::Node;
+
+    LayerImpl layer;
+    CHIP_ERROR err = layer.Init();
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    Queue queue;
+    std::vector<int> states(kPendingTimers);
+    std::vector<std::unique_ptr<Timer>> timers;
+    uint32_t seed  = 3;
+    uint64_t nowMs = 0;
+    for (size_t i = 0; i < kPendingTimers; i++)
+    {
+        timers.push_back(std::make_unique<Timer>(layer, Clock::Timestamp(NextRandom(seed) % 30000), TimerCallback, &states[i]));
+        queue.Add(timers.back().get());
+    }
+
+    uint32_t i = 0;
+    while (state.KeepRunning())
+    {
+        const size_t index          = NextRandom(seed) % kPendingTimers;
+        Clock::Timestamp awakenTime = Clock::Timestamp(nowMs + 1 + NextRandom(seed) % 30000);
+        queue.Remove(TimerCallback, &states[index]);
+        timers[index] = std::make_unique<Timer>(layer, awakenTime, TimerCallback, &states[index]);
+        queue.Add(timers[index].get());
+
+        if (i++ % 64 == 0)
+        {
+            nowMs += 1;
+            for (TimerList expired = queue.ExtractEarlier(Clock::Timestamp(nowMs)); !expired.Empty();)
+            {
+                static_cast<void>(expired.PopEarliest());
+            }
+        }
+    }
+
+    queue.Clear();
+    layer.Shutdown();
+}
+
+CHIP_BENCHMARK(TimerList, Churn)
+{
+    RunTimerChurn<TimerList>(state);
+}
+
+CHIP_BENCHMARK(TimerWheel, Churn)
+{
+    RunTimerChurn<TimerWheel>(state);
+}
+
+} // namespace
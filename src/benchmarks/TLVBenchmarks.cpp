@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::TLV;
+
+constexpr size_t kListLength = 16;
+
+constexpr uint8_t kOctets[32] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+                                  0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+// A structure shaped like a typical cluster struct: a few integers, a boolean, a string, an octet string and a short list.
+CHIP_ERROR EncodeSample(TLVWriter & writer)
+{
+    TLVType outerType;
+    TLVType listType;
+
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerType));
+    ReturnErrorOnFailure(writer.Put(ContextTag(0), static_cast<uint8_t>(1)));
+    ReturnErrorOnFailure(writer.Put(ContextTag(1), static_cast<uint32_t>(0x12345678)));
+    ReturnErrorOnFailure(writer.Put(ContextTag(2), static_cast<uint64_t>(0x0123456789abcdef)));
+    ReturnErrorOnFailure(writer.PutBoolean(ContextTag(3), true));
+    ReturnErrorOnFailure(writer.PutString(ContextTag(4), "Living Room Light"));
+    ReturnErrorOnFailure(writer.Put(ContextTag(5), ByteSpan(kOctets)));
+    ReturnErrorOnFailure(writer.StartContainer(ContextTag(6), kTLVType_Array, listType));
+    for (size_t i = 0; i < kListLength; i++)
+    {
+        ReturnErrorOnFailure(writer.Put(AnonymousTag(), static_cast<uint16_t>(i * 1000)));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(listType));
+    return writer.EndContainer(outerType);
+}
+
+// Reads back every field of EncodeSample, returning a checksum so that none of it can be optimized away.
+CHIP_ERROR DecodeSample(TLVReader & reader, uint64_t & checksum)
+{
+    TLVType outerType;
+    TLVType listType;
+    uint8_t u8;
+    uint32_t u32;
+    uint64_t u64;
+    bool flag;
+    CharSpan string;
+    ByteSpan octets;
+
+    ReturnErrorOnFailure(reader.Next(kTLVType_Structure, AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(outerType));
+    ReturnErrorOnFailure(reader.Next(ContextTag(0)));
+    ReturnErrorOnFailure(reader.Get(u8));
+    ReturnErrorOnFailure(reader.Next(ContextTag(1)));
+    ReturnErrorOnFailure(reader.Get(u32));
+    ReturnErrorOnFailure(reader.Next(ContextTag(2)));
+    ReturnErrorOnFailure(reader.Get(u64));
+    ReturnErrorOnFailure(reader.Next(ContextTag(3)));
+    ReturnErrorOnFailure(reader.Get(flag));
+    ReturnErrorOnFailure(reader.Next(ContextTag(4)));
+    ReturnErrorOnFailure(reader.Get(string));
+    ReturnErrorOnFailure(reader.Next(ContextTag(5)));
+    ReturnErrorOnFailure(reader.Get(octets));
+    checksum += u8 + u32 + u64 + flag + string.size() + octets.size();
+
+    ReturnErrorOnFailure(reader.Next(kTLVType_Array, ContextTag(6)));
+    ReturnErrorOnFailure(reader.EnterContainer(listType));
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        uint16_t item;
+        ReturnErrorOnFailure(reader.Get(item));
+        checksum += item;
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(listType));
+    return reader.ExitContainer(outerType);
+}
+
+CHIP_ERROR EncodeSample(MutableByteSpan & buffer)
+{
+    TLVWriter writer;
+    writer.Init(buffer);
+    ReturnErrorOnFailure(EncodeSample(writer));
+    ReturnErrorOnFailure(writer.Finalize());
+    buffer.reduce_size(writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_BENCHMARK(TLV, EncodeStruct)
+{
+    uint8_t buffer[256];
+
+    while (state.KeepRunning())
+    {
+        MutableByteSpan encoded(buffer);
+        CHIP_ERROR err = EncodeSample(encoded);
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+    }
+}
+
+CHIP_BENCHMARK(TLV, DecodeStruct)
+{
+    uint8_t buffer[256];
+    MutableByteSpan encoded(buffer);
+
+    CHIP_ERROR err = EncodeSample(encoded);
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+        return;
+    }
+
+    volatile uint64_t sink = 0;
+    while (state.KeepRunning())
+    {
+        TLVReader reader;
+        reader.Init(encoded);
+
+        uint64_t checksum = 0;
+        err               = DecodeSample(reader, checksum);
+        if (err != CHIP_NO_ERROR)
+        {
+            state.SkipWithError(err);
+        }
+        sink = sink + checksum;
+    }
+}
+
+} // namespace
@@ -0,0 +1,114 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemError.h>
+#include <tracing/binary/binary_tracing.h>
+#include <tracing/json/json_tracing.h>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Benchmarks;
+
+// The binary backend drops events that its flush thread has not caught up with, which would make
+// it look faster than it is, so the flush thread gets a chance to run after this many scopes.
+constexpr uint64_t kScopesBetweenFlushes = 2048;
+
+/// A file for trace output, removed when done.
+class TemporaryTraceFile
+{
+public:
+    ~TemporaryTraceFile()
+    {
+        if (mPath[0] != '\0')
+        {
+            unlink(mPath);
+        }
+    }
+
+    CHIP_ERROR Create()
+    {
+        strcpy(mPath, "/tmp/chip-benchmarks-trace-XXXXXX");
+        int fd = mkstemp(mPath);
+        VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+        close(fd);
+        return CHIP_NO_ERROR;
+    }
+
+    const char * GetPath() const { return mPath; }
+
+private:
+    char mPath[64] = {};
+};
+
+// What MATTER_TRACE_SCOPE costs a thread for each registered backend
+template <typename TraceBackend>
+void TraceScopes(State & state, TraceBackend & backend)
+{
+    TemporaryTraceFile file;
+    CHIP_ERROR err = file.Create();
+    SuccessOrExit(err);
+    err = backend.OpenFile(file.GetPath());
+    SuccessOrExit(err);
+
+    for (uint64_t scopes = 1; state.KeepRunning(); scopes++)
+    {
+        backend.TraceBegin("Scope", "Benchmark");
+        backend.TraceEnd("Scope", "Benchmark");
+
+        if (scopes % kScopesBetweenFlushes == 0)
+        {
+            state.PauseTiming();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            state.ResumeTiming();
+        }
+    }
+
+    backend.CloseFile();
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        state.SkipWithError(err);
+    }
+}
+
+CHIP_BENCHMARK(Tracing, JsonScope)
+{
+    Tracing::Json::JsonBackend backend;
+    TraceScopes(state, backend);
+}
+
+CHIP_BENCHMARK(Tracing, BinaryScope)
+{
+    Tracing::Binary::BinaryBackend backend;
+    TraceScopes(state, backend);
+}
+
+} // namespace
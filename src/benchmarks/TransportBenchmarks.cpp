@@ -0,0 +1,67 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/CodeUtils.h>
+#include <transport/SecureSessionTable.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Benchmarks;
+using namespace chip::Transport;
+
+// The per-packet session lookup done by SessionManager::SecureUnicastMessageDispatch, with every session of the pool in
+// use.
+CHIP_BENCHMARK(SecureSessionTable, FindByLocalKeyFullTable)
+{
+    SecureSessionTable table;
+    table.Init();
+
+    for (uint16_t i = 0; i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE; i++)
+    {
+        auto session = table.CreateNewSecureSessionForTest(
+            SecureSession::Type::kCASE, static_cast<uint16_t>(i + 1), 1, static_cast<NodeId>(i + 2), CATValues(), i, 1,
+            ReliableMessageProtocolConfig(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                          System::Clock::Milliseconds16(0)));
+        if (!session.HasValue())
+        {
+            state.SkipWithError(CHIP_ERROR_NO_MEMORY);
+            break;
+        }
+    }
+
+    uint32_t i = 0;
+    while (state.KeepRunning())
+    {
+        const uint16_t localSessionId = static_cast<uint16_t>(1 + i++ % CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+        if (!table.FindSecureSessionByLocalKey(localSessionId).HasValue())
+        {
+            state.SkipWithError(CHIP_ERROR_KEY_NOT_FOUND);
+        }
+    }
+
+    table.ForEachSession([](auto * session) {
+        session->MarkForEviction();
+        return Loop::Continue;
+    });
+}
+
+} // namespace
@@ -0,0 +1,221 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/DataModelHandler.h>
+#include <app/util/attribute-storage.h>
+#include <app/util/endpoint-config-api.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+static_assert(CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT >= 3, "These tests need at least three dynamic endpoint slots");
+
+constexpr uint16_t kDynamicEndpointCount = CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT;
+
+//clang-format off
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(testClusterAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(0x00000001, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpointClusters)
+DECLARE_DYNAMIC_CLUSTER(Clusters::UnitTesting::Id, testClusterAttrs, ZAP_CLUSTER_MASK(SERVER), nullptr, nullptr),
+    DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(testEndpoint, testEndpointClusters);
+//clang-format on
+
+DataVersion gDataVersionStorage[kDynamicEndpointCount][MATTER_ARRAY_SIZE(testEndpointClusters)];
+
+class TestEmberEndpointLookup : public chip::Test::AppContext
+{
+protected:
+    void SetUp() override
+    {
+        AppContext::SetUp();
+
+        // Lay out the fixed endpoints and reset the dynamic ones.
+        InitDataModelHandler();
+    }
+
+    void TearDown() override
+    {
+        // Clear every dynamic endpoint a test left behind, re-enabling it first since clearing a disabled
+        // endpoint is a no-op.
+        for (uint16_t index = 0; index < kDynamicEndpointCount; index++)
+        {
+            EndpointId endpoint = emberAfEndpointFromIndex(RealIndex(index));
+            if (endpoint != kInvalidEndpointId)
+            {
+                emberAfEndpointEnableDisable(endpoint, true);
+                emberAfClearDynamicEndpoint(index);
+            }
+        }
+
+        AppContext::TearDown();
+    }
+
+    static CHIP_ERROR SetDynamicEndpoint(uint16_t index, EndpointId endpoint)
+    {
+        return emberAfSetDynamicEndpoint(index, endpoint, &testEndpoint, Span<DataVersion>(gDataVersionStorage[index]));
+    }
+
+    static uint16_t RealIndex(uint16_t dynamicIndex) { return static_cast<uint16_t>(emberAfFixedEndpointCount() + dynamicIndex); }
+
+    // Checks that the endpoint is enabled at the given dynamic index and resolves to it through every lookup.
+    static void ExpectDynamicEndpointAt(EndpointId endpoint, uint16_t dynamicIndex)
+    {
+        EXPECT_EQ(emberAfIndexFromEndpoint(endpoint), RealIndex(dynamicIndex));
+        EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(endpoint), dynamicIndex);
+        EXPECT_EQ(emberAfEndpointFromIndex(RealIndex(dynamicIndex)), endpoint);
+        EXPECT_TRUE(emberAfContainsServer(endpoint, Clusters::UnitTesting::Id));
+    }
+
+    static void ExpectNoEndpoint(EndpointId endpoint)
+    {
+        EXPECT_EQ(emberAfIndexFromEndpoint(endpoint), kEmberInvalidEndpointIndex);
+        EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(endpoint), kEmberInvalidEndpointIndex);
+        EXPECT_FALSE(emberAfContainsServer(endpoint, Clusters::UnitTesting::Id));
+    }
+};
+
+TEST_F(TestEmberEndpointLookup, TestFixedEndpointsResolveToTheirIndex)
+{
+    for (uint16_t index = 0; index < emberAfFixedEndpointCount(); index++)
+    {
+        EndpointId endpoint = emberAfEndpointFromIndex(index);
+        EXPECT_EQ(emberAfIndexFromEndpoint(endpoint), index);
+        EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(endpoint), kEmberInvalidEndpointIndex);
+    }
+
+    EXPECT_EQ(emberAfIndexFromEndpoint(kInvalidEndpointId), kEmberInvalidEndpointIndex);
+}
+
+TEST_F(TestEmberEndpointLookup, TestSetAndClearKeepLookupInSync)
+{
+    // Endpoint ids deliberately do not follow the index order, so that each insertion lands in a different
+    // position of the sorted lookup.
+    EXPECT_EQ(SetDynamicEndpoint(0, 40), CHIP_NO_ERROR);
+    EXPECT_EQ(SetDynamicEndpoint(2, 25), CHIP_NO_ERROR);
+    EXPECT_EQ(SetDynamicEndpoint(1, 12), CHIP_NO_ERROR);
+
+    ExpectDynamicEndpointAt(40, 0);
+    ExpectDynamicEndpointAt(12, 1);
+    ExpectDynamicEndpointAt(25, 2);
+    ExpectNoEndpoint(11);
+    ExpectNoEndpoint(13);
+    ExpectNoEndpoint(41);
+
+    EXPECT_EQ(emberAfClearDynamicEndpoint(1), 12);
+    ExpectNoEndpoint(12);
+    ExpectDynamicEndpointAt(40, 0);
+    ExpectDynamicEndpointAt(25, 2);
+
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), 40);
+    EXPECT_EQ(emberAfClearDynamicEndpoint(2), 25);
+    ExpectNoEndpoint(40);
+    ExpectNoEndpoint(25);
+
+    // Clearing an empty index is a no-op.
+    EXPECT_EQ(emberAfClearDynamicEndpoint(1), 0);
+}
+
+TEST_F(TestEmberEndpointLookup, TestReuseIndex)
+{
+    // Re-adding a cleared index, with another id and then with the original one.
+    EXPECT_EQ(SetDynamicEndpoint(0, 10), CHIP_NO_ERROR);
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), 10);
+    EXPECT_EQ(SetDynamicEndpoint(0, 11), CHIP_NO_ERROR);
+    ExpectNoEndpoint(10);
+    ExpectDynamicEndpointAt(11, 0);
+
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), 11);
+    EXPECT_EQ(SetDynamicEndpoint(0, 10), CHIP_NO_ERROR);
+    ExpectNoEndpoint(11);
+    ExpectDynamicEndpointAt(10, 0);
+
+    // Setting an occupied index replaces the endpoint there, and the old id no longer resolves.
+    EXPECT_EQ(SetDynamicEndpoint(0, 5), CHIP_NO_ERROR);
+    ExpectNoEndpoint(10);
+    ExpectDynamicEndpointAt(5, 0);
+}
+
+TEST_F(TestEmberEndpointLookup, TestInvalidDynamicEndpoints)
+{
+    EXPECT_EQ(SetDynamicEndpoint(0, 10), CHIP_NO_ERROR);
+
+    // The same id can not be registered at a second dynamic index, and the rejected index stays empty.
+    EXPECT_EQ(SetDynamicEndpoint(1, 10), CHIP_ERROR_ENDPOINT_EXISTS);
+    EXPECT_EQ(emberAfEndpointFromIndex(RealIndex(1)), kInvalidEndpointId);
+    ExpectDynamicEndpointAt(10, 0);
+
+    EXPECT_EQ(SetDynamicEndpoint(1, kInvalidEndpointId), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(emberAfSetDynamicEndpoint(kDynamicEndpointCount, 20, &testEndpoint, Span<DataVersion>(gDataVersionStorage[0])),
+              CHIP_ERROR_NO_MEMORY);
+    ExpectNoEndpoint(20);
+}
+
+TEST_F(TestEmberEndpointLookup, TestDisabledEndpoints)
+{
+    EXPECT_EQ(SetDynamicEndpoint(0, 10), CHIP_NO_ERROR);
+    EXPECT_EQ(SetDynamicEndpoint(1, 20), CHIP_NO_ERROR);
+
+    // A disabled endpoint keeps its lookup entry but is not resolved as an enabled endpoint.
+    EXPECT_TRUE(emberAfEndpointEnableDisable(10, false));
+    EXPECT_EQ(emberAfIndexFromEndpoint(10), kEmberInvalidEndpointIndex);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(10), 0);
+    EXPECT_FALSE(emberAfEndpointIndexIsEnabled(RealIndex(0)));
+    ExpectDynamicEndpointAt(20, 1);
+
+    // Clearing a disabled endpoint is a no-op, so its id stays taken.
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), 0);
+    EXPECT_EQ(SetDynamicEndpoint(2, 10), CHIP_ERROR_ENDPOINT_EXISTS);
+
+    EXPECT_TRUE(emberAfEndpointEnableDisable(10, true));
+    ExpectDynamicEndpointAt(10, 0);
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), 10);
+    ExpectNoEndpoint(10);
+    EXPECT_FALSE(emberAfEndpointEnableDisable(10, true));
+}
+
+TEST_F(TestEmberEndpointLookup, TestFixedEndpointsSurviveDynamicChanges)
+{
+    // Dynamic endpoints sorted on both sides of the fixed ones shift the fixed lookup entries around.
+    EXPECT_EQ(SetDynamicEndpoint(0, 0xFFFE), CHIP_NO_ERROR);
+    EXPECT_EQ(SetDynamicEndpoint(1, 100), CHIP_NO_ERROR);
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), 0xFFFE);
+    EXPECT_EQ(SetDynamicEndpoint(2, 0xFFFD), CHIP_NO_ERROR);
+
+    for (uint16_t index = 0; index < emberAfFixedEndpointCount(); index++)
+    {
+        EXPECT_EQ(emberAfIndexFromEndpoint(emberAfEndpointFromIndex(index)), index);
+    }
+    ExpectDynamicEndpointAt(100, 1);
+    ExpectDynamicEndpointAt(0xFFFD, 2);
+}
+
+} // namespace
@@ -22,6 +22,8 @@
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/PersistentData.h>
 #include <lib/support/Pool.h>
+
+#include <algorithm>
 #include <stdlib.h>
 
 namespace chip {
@@ -832,11 +834,14 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    InvalidateGroupSessionCache();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
+    // Cached group sessions were loaded from the previous storage
+    InvalidateGroupSessionCache();
     mStorage = storage;
 }
 
@@ -1349,6 +1354,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1415,6 +1421,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1447,6 +1454,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1523,6 +1531,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1594,6 +1603,7 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1695,6 +1705,8 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateGroupSessionCache();
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1836,15 +1848,151 @@ CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::PrivacyDecrypt(const ByteSpan
     return Crypto::AES_CTR_crypt(input.data(), input.size(), mPrivacyKey, nonce.data(), nonce.size(), output.data());
 }
 
+namespace {
+
+// Calls `callback(fabric, mapping, keyset, key)` for every operational key of the keyset of every
+// group-key mapping in storage, in the order group sessions are iterated. Mappings to a keyset
+// that does not exist are skipped.
+template <typename Callback>
+CHIP_ERROR ForEachStoredGroupSession(PersistentStorageDelegate * storage, Callback callback)
+{
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(storage);
+    VerifyOrReturnError(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(storage));
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            ReturnErrorOnFailure(mapping.Load(storage));
+
+            KeySetData keyset;
+            if (!keyset.Find(storage, fabric, mapping.keyset_id))
+            {
+                continue;
+            }
+            for (uint16_t k = 0; k < keyset.keys_count; ++k)
+            {
+                ReturnErrorOnFailure(callback(fabric, mapping, keyset, keyset.operational_keys[k]));
+            }
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR GroupDataProviderImpl::LoadGroupSessionCache()
+{
+    VerifyOrReturnError(IsInitialized() && mSessionKeystore != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    InvalidateGroupSessionCache();
+
+    size_t count = 0;
+    auto countEntry = [&count](const FabricData &, const KeyMapData &, const KeySetData &,
+                               const Crypto::GroupOperationalCredentials &) {
+        count++;
+        return CHIP_NO_ERROR;
+    };
+    ReturnErrorOnFailure(ForEachStoredGroupSession(mStorage, countEntry));
+    VerifyOrReturnError(count <= CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE, CHIP_ERROR_NO_MEMORY);
+
+    if (count > 0)
+    {
+        VerifyOrReturnError(mGroupSessionCache.Calloc(count), CHIP_ERROR_NO_MEMORY);
+    }
+
+    auto addEntry = [this, count](const FabricData & fabric, const KeyMapData & mapping, const KeySetData & keyset,
+                                  const Crypto::GroupOperationalCredentials & creds) {
+        VerifyOrReturnError(mGroupSessionCacheCount < count, CHIP_ERROR_INTERNAL);
+
+        GroupKeyContext * keyContext = Platform::New<GroupKeyContext>(*this, creds.encryption_key, creds.hash, creds.privacy_key);
+        VerifyOrReturnError(keyContext != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        // Insert sorted by session ID, after the entries with the same ID so that they keep the storage order
+        size_t index = mGroupSessionCacheCount++;
+        while (index > 0 && mGroupSessionCache[index - 1].session_id > creds.hash)
+        {
+            mGroupSessionCache[index] = mGroupSessionCache[index - 1];
+            index--;
+        }
+        mGroupSessionCache[index] = { creds.hash, fabric.fabric_index, mapping.group_id, keyset.policy, keyContext };
+        return CHIP_NO_ERROR;
+    };
+
+    CHIP_ERROR err = ForEachStoredGroupSession(mStorage, addEntry);
+    if (err != CHIP_NO_ERROR)
+    {
+        InvalidateGroupSessionCache();
+        return err;
+    }
+
+    mGroupSessionCacheLoaded = true;
+    return CHIP_NO_ERROR;
+}
+
+void GroupDataProviderImpl::InvalidateGroupSessionCache()
+{
+    for (size_t i = 0; i < mGroupSessionCacheCount; i++)
+    {
+        mGroupSessionCache[i].key_context->ReleaseKeys();
+        Platform::Delete(mGroupSessionCache[i].key_context);
+    }
+    mGroupSessionCache.Free();
+    mGroupSessionCacheCount      = 0;
+    mGroupSessionCacheLoaded     = false;
+    mGroupSessionCacheLoadFailed = false;
+    // Stop the iterators over the freed entries
+    mGroupSessionCacheGeneration++;
+}
+
 GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGroupSessions(uint16_t session_id)
 {
     VerifyOrReturnError(IsInitialized(), nullptr);
+
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    if (!mGroupSessionCacheLoaded && !mGroupSessionCacheLoadFailed)
+    {
+        // On failure, the iterators fall back to walking the records in storage until the group data changes
+        CHIP_ERROR err = LoadGroupSessionCache();
+        if (err != CHIP_NO_ERROR)
+        {
+            mGroupSessionCacheLoadFailed = true;
+            ChipLogError(Crypto, "Failed to load group sessions: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
     return mGroupSessionsIterator.CreateObject(*this, session_id);
 }
 
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+    if (provider.mGroupSessionCacheLoaded)
+    {
+        const GroupSessionCacheEntry * begin = provider.mGroupSessionCache.Get();
+        const GroupSessionCacheEntry * end   = begin + provider.mGroupSessionCacheCount;
+        const GroupSessionCacheEntry * first = std::lower_bound(
+            begin, end, session_id, [](const GroupSessionCacheEntry & entry, uint16_t id) { return entry.session_id < id; });
+
+        mUseCache        = true;
+        mCacheGeneration = provider.mGroupSessionCacheGeneration;
+        mCacheBegin      = static_cast<size_t>(first - begin);
+        mCacheIndex      = mCacheBegin;
+        mCacheEnd        = mCacheBegin;
+        while (mCacheEnd < provider.mGroupSessionCacheCount && provider.mGroupSessionCache[mCacheEnd].session_id == session_id)
+        {
+            mCacheEnd++;
+        }
+        return;
+    }
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1857,6 +2005,11 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
+    if (mUseCache)
+    {
+        return (mCacheGeneration == mProvider.mGroupSessionCacheGeneration) ? mCacheEnd - mCacheBegin : 0;
+    }
+
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
@@ -1896,8 +2049,26 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
     return count;
 }
 
+bool GroupDataProviderImpl::GroupSessionIteratorImpl::NextCached(GroupSession & output)
+{
+    VerifyOrReturnValue(mCacheGeneration == mProvider.mGroupSessionCacheGeneration, false);
+    VerifyOrReturnValue(mCacheIndex < mCacheEnd, false);
+
+    const GroupSessionCacheEntry & entry = mProvider.mGroupSessionCache[mCacheIndex++];
+    output.fabric_index                  = entry.fabric_index;
+    output.group_id                      = entry.group_id;
+    output.security_policy               = entry.security_policy;
+    output.keyContext                    = entry.key_context;
+    return true;
+}
+
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+    if (mUseCache)
+    {
+        return NextCached(output);
+    }
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
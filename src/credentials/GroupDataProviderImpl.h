@@ -20,6 +20,7 @@
 #include <crypto/SessionKeystore.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
 
 namespace chip {
 namespace Credentials {
@@ -43,7 +44,12 @@ public:
      */
     void SetStorageDelegate(PersistentStorageDelegate * storage);
 
-    void SetSessionKeystore(Crypto::SessionKeystore * keystore) { mSessionKeystore = keystore; }
+    void SetSessionKeystore(Crypto::SessionKeystore * keystore)
+    {
+        // Cached group session keys were created with the previous keystore
+        InvalidateGroupSessionCache();
+        mSessionKeystore = keystore;
+    }
     Crypto::SessionKeystore * GetSessionKeystore() const { return mSessionKeystore; }
 
     CHIP_ERROR Init() override;
@@ -230,8 +236,19 @@ protected:
         void Release() override;
 
     protected:
+        // Next() on the cached group sessions, see LoadGroupSessionCache()
+        bool NextCached(GroupSession & output);
+
         GroupDataProviderImpl & mProvider;
-        uint16_t mSessionId      = 0;
+        uint16_t mSessionId = 0;
+        // Range of mProvider.mGroupSessionCache matching the session ID, valid while the
+        // cache generation is unchanged. Unused if the cache could not be loaded.
+        bool mUseCache            = false;
+        uint32_t mCacheGeneration = 0;
+        size_t mCacheBegin        = 0;
+        size_t mCacheIndex        = 0;
+        size_t mCacheEnd          = 0;
+        // State of the walk through storage, when the cache is not used
         FabricIndex mFirstFabric = kUndefinedFabricIndex;
         FabricIndex mFabric      = kUndefinedFabricIndex;
         uint16_t mFabricCount    = 0;
@@ -243,8 +260,24 @@ protected:
         bool mFirstMap           = true;
         GroupKeyContext mGroupKeyContext;
     };
+    // A group session is one operational group key of a keyset mapped to a group. The cache keeps up to
+    // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE of them in memory, sorted by session ID, so that finding the candidate keys of a
+    // group message does not read the fabric, group-key map and keyset records from storage, and the keys are not imported
+    // into the keystore for every message.
+    struct GroupSessionCacheEntry
+    {
+        uint16_t session_id;
+        FabricIndex fabric_index;
+        GroupId group_id;
+        SecurityPolicy security_policy;
+        GroupKeyContext * key_context;
+    };
+
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
+    CHIP_ERROR LoadGroupSessionCache();
+    // Must be called whenever fabrics, keysets or group-key mappings change.
+    void InvalidateGroupSessionCache();
 
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
@@ -254,6 +287,12 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+    Platform::ScopedMemoryBuffer<GroupSessionCacheEntry> mGroupSessionCache;
+    size_t mGroupSessionCacheCount        = 0;
+    bool mGroupSessionCacheLoaded         = false;
+    uint32_t mGroupSessionCacheGeneration = 0;
+    // Set when loading failed, so that it is not retried before the group data changes
+    bool mGroupSessionCacheLoadFailed = false;
 };
 
 } // namespace Credentials
@@ -1222,6 +1222,195 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+// Storage delegate counting reads, to check which operations hit storage.
+class ReadCountingStorageDelegate : public chip::TestPersistentStorageDelegate
+{
+public:
+    size_t mReadCount = 0;
+
+protected:
+    CHIP_ERROR SyncGetKeyValueInternal(const char * key, void * buffer, uint16_t & size) override
+    {
+        mReadCount++;
+        return TestPersistentStorageDelegate::SyncGetKeyValueInternal(key, buffer, size);
+    }
+};
+
+size_t CountGroupSessions(GroupDataProvider & provider, uint16_t session_id, std::set<std::pair<FabricIndex, GroupId>> & found)
+{
+    GroupSession session;
+    auto it = provider.IterateGroupSessions(session_id);
+    VerifyOrReturnValue(it != nullptr, 0);
+
+    size_t count = 0;
+    while (it->Next(session))
+    {
+        EXPECT_NE(session.keyContext, nullptr);
+        found.emplace(session.fabric_index, session.group_id);
+        count++;
+    }
+    EXPECT_EQ(count, it->Count());
+    it->Release();
+    return count;
+}
+
+TEST_F(TestGroupDataProvider, TestGroupSessionsInMemory)
+{
+    ReadCountingStorageDelegate storage;
+    GroupDataProviderImpl provider(kMaxGroupsPerFabric, kMaxGroupKeysPerFabric);
+    provider.SetStorageDelegate(&storage);
+    provider.SetSessionKeystore(&sSessionKeystore);
+    ASSERT_EQ(provider.Init(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(provider.SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric1, 0, kGroup1Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric1, 1, kGroup2Keyset1), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider.GetKeyContext(kFabric1, kGroup1);
+    ASSERT_NE(nullptr, key_context);
+    const uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    std::set<std::pair<FabricIndex, GroupId>> found;
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 2u);
+    EXPECT_EQ(found, (std::set<std::pair<FabricIndex, GroupId>>{ { kFabric1, kGroup1 }, { kFabric1, kGroup2 } }));
+
+    // Once loaded, group sessions are found without reading storage
+    storage.mReadCount = 0;
+    found.clear();
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 2u);
+    EXPECT_EQ(CountGroupSessions(provider, static_cast<uint16_t>(session_id + 1), found), 0u);
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE >= 2
+    EXPECT_EQ(storage.mReadCount, 0u);
+#endif
+
+    // Group-key mapping changes are reflected, including on an ongoing iteration
+    GroupSession session;
+    auto it = provider.IterateGroupSessions(session_id);
+    ASSERT_NE(it, nullptr);
+    EXPECT_TRUE(it->Next(session));
+    EXPECT_EQ(provider.RemoveGroupKeyAt(kFabric1, 1), CHIP_NO_ERROR);
+    EXPECT_FALSE(it->Next(session));
+    it->Release();
+
+    found.clear();
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 1u);
+    EXPECT_EQ(found, (std::set<std::pair<FabricIndex, GroupId>>{ { kFabric1, kGroup1 } }));
+
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric1, 1, kGroup3Keyset1), CHIP_NO_ERROR);
+    found.clear();
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 2u);
+    EXPECT_EQ(found, (std::set<std::pair<FabricIndex, GroupId>>{ { kFabric1, kGroup1 }, { kFabric1, kGroup3 } }));
+
+    // Keys from other fabrics are derived with a different compressed fabric ID
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric2, 0, kGroup1Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 2u);
+
+    // Keyset and fabric removals are reflected
+    EXPECT_EQ(provider.RemoveKeySet(kFabric1, kKeysetId1), CHIP_NO_ERROR);
+    found.clear();
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 0u);
+
+    EXPECT_EQ(provider.SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric1, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 1u);
+
+    EXPECT_EQ(provider.RemoveFabric(kFabric1), CHIP_NO_ERROR);
+    found.clear();
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 0u);
+
+    provider.RemoveFabric(kFabric2);
+    provider.Finish();
+}
+
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0 && CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE < 15
+TEST_F(TestGroupDataProvider, TestGroupSessionsOverCacheSize)
+{
+    ReadCountingStorageDelegate storage;
+    GroupDataProviderImpl provider(kMaxGroupsPerFabric, kMaxGroupKeysPerFabric);
+    provider.SetStorageDelegate(&storage);
+    provider.SetSessionKeystore(&sSessionKeystore);
+    ASSERT_EQ(provider.Init(), CHIP_NO_ERROR);
+
+    // Five groups mapped to a keyset of three keys make 15 group sessions, more than the cache holds
+    EXPECT_EQ(provider.SetKeySet(kFabric1, kCompressedFabricId1, kKeySet3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric1, 0, kGroup1Keyset3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric1, 1, kGroup2Keyset3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric1, 2, kGroup3Keyset3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric1, 3, GroupKey(kGroup4, kKeysetId3)), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric1, 4, GroupKey(kGroup5, kKeysetId3)), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider.GetKeyContext(kFabric1, kGroup1);
+    ASSERT_NE(nullptr, key_context);
+    const uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    // Group sessions are still found, by walking storage
+    std::set<std::pair<FabricIndex, GroupId>> found;
+    storage.mReadCount = 0;
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 5u);
+    const size_t firstReadCount = storage.mReadCount;
+
+    // Loading the cache is not retried for every message
+    storage.mReadCount = 0;
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 5u);
+    const size_t walkReadCount = storage.mReadCount;
+    EXPECT_GT(walkReadCount, 0u);
+    EXPECT_LT(walkReadCount, firstReadCount);
+
+    storage.mReadCount = 0;
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 5u);
+    EXPECT_EQ(storage.mReadCount, walkReadCount);
+
+    // Once the group data changes, and the sessions fit, they are cached again
+    EXPECT_EQ(provider.RemoveGroupKeyAt(kFabric1, 4), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.RemoveGroupKeyAt(kFabric1, 3), CHIP_NO_ERROR);
+    found.clear();
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 3u);
+    EXPECT_EQ(found,
+              (std::set<std::pair<FabricIndex, GroupId>>{ { kFabric1, kGroup1 }, { kFabric1, kGroup2 }, { kFabric1, kGroup3 } }));
+
+    storage.mReadCount = 0;
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 3u);
+    EXPECT_EQ(storage.mReadCount, 0u);
+
+    provider.RemoveFabric(kFabric1);
+    provider.Finish();
+}
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0 && CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE < 15
+
+TEST_F(TestGroupDataProvider, TestGroupSessionsStorageChange)
+{
+    chip::TestPersistentStorageDelegate storage;
+    chip::TestPersistentStorageDelegate otherStorage;
+    GroupDataProviderImpl provider(kMaxGroupsPerFabric, kMaxGroupKeysPerFabric);
+    provider.SetStorageDelegate(&storage);
+    provider.SetSessionKeystore(&sSessionKeystore);
+    ASSERT_EQ(provider.Init(), CHIP_NO_ERROR);
+
+    EXPECT_EQ(provider.SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider.SetGroupKeyAt(kFabric1, 0, kGroup1Keyset1), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider.GetKeyContext(kFabric1, kGroup1);
+    ASSERT_NE(nullptr, key_context);
+    const uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    std::set<std::pair<FabricIndex, GroupId>> found;
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 1u);
+
+    // The group sessions cached from the previous storage are dropped
+    provider.SetStorageDelegate(&otherStorage);
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 0u);
+
+    provider.SetStorageDelegate(&storage);
+    EXPECT_EQ(CountGroupSessions(provider, session_id, found), 1u);
+
+    provider.RemoveFabric(kFabric1);
+    provider.Finish();
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
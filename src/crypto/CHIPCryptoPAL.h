@@ -644,10 +644,17 @@ private:
 
 using Symmetric128BitsKeyByteArray = uint8_t[CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES];
 
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+// The OpenSSL and BoringSSL backends keep a pointer to keyed AES-CCM cipher contexts after the key material
+inline constexpr size_t kSymmetric128BitsKeyHandleContextSize = CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES + sizeof(void *);
+#else
+inline constexpr size_t kSymmetric128BitsKeyHandleContextSize = CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES;
+#endif // CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+
 /**
  * @brief Platform-specific 128-bit symmetric key handle
  */
-class Symmetric128BitsKeyHandle : public SymmetricKeyHandle<CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES>
+class Symmetric128BitsKeyHandle : public SymmetricKeyHandle<kSymmetric128BitsKeyHandleContextSize>
 {
 };
 
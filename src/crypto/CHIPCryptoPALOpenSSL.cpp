@@ -20,7 +20,7 @@
  *      openSSL based implementation of CHIP crypto primitives
  */
 
-#include "CHIPCryptoPAL.h"
+#include "CHIPCryptoPALOpenSSL.h"
 
 #include <type_traits>
 
@@ -48,6 +48,7 @@
 #include <lib/support/BufferWriter.h>
 #include <lib/support/BytesToHex.h>
 #include <lib/support/CHIPArgParser.hpp>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/SafePointerCast.h>
@@ -146,6 +147,171 @@ static int _compareDaysAndSeconds(const int days, const int seconds)
     return 0;
 }
 
+namespace {
+
+#if !CHIP_CRYPTO_BORINGSSL
+// A cipher context keyed for one direction of AES-CCM. CCM fixes the nonce and tag lengths when the
+// key schedule is set up, so a message with different lengths requires the context to be keyed again.
+struct AesCcmKeyedContext
+{
+    EVP_CIPHER_CTX * mContext = nullptr;
+    // Lengths the context is keyed for, or 0 if it has not been keyed yet.
+    int mNonceLength = 0;
+    int mTagLength   = 0;
+};
+#endif // !CHIP_CRYPTO_BORINGSSL
+
+// Cipher contexts attached to an Aes128KeyHandle by AttachAesCcmContext().
+struct AesCcmCachedContext
+{
+    // Key material the contexts are keyed with. If the key material in the handle no longer
+    // matches, e.g. because it was overwritten directly, the handle uses the uncached path.
+    Symmetric128BitsKeyByteArray mKey;
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX * mAeadContext = nullptr;
+#else
+    AesCcmKeyedContext mEncrypt;
+    AesCcmKeyedContext mDecrypt;
+#endif // CHIP_CRYPTO_BORINGSSL
+};
+
+// Representation of the context of 128-bit key handles with this backend: the raw key material, as
+// with other backends, followed by the cipher contexts attached to the key, if any.
+struct OpenSSLSymmetric128BitsKey
+{
+    Symmetric128BitsKeyByteArray mKey;
+    AesCcmCachedContext * mCachedContext;
+};
+
+static_assert(sizeof(OpenSSLSymmetric128BitsKey) <= kSymmetric128BitsKeyHandleContextSize,
+              "Symmetric128BitsKeyHandle context is too small for the cached AES-CCM context");
+
+void FreeAesCcmCachedContext(AesCcmCachedContext * cached)
+{
+#if CHIP_CRYPTO_BORINGSSL
+    if (cached->mAeadContext != nullptr)
+    {
+        EVP_AEAD_CTX_free(cached->mAeadContext);
+    }
+#else
+    EVP_CIPHER_CTX_free(cached->mEncrypt.mContext);
+    EVP_CIPHER_CTX_free(cached->mDecrypt.mContext);
+#endif // CHIP_CRYPTO_BORINGSSL
+    ClearSecretData(cached->mKey);
+    Platform::Delete(cached);
+}
+
+AesCcmCachedContext * GetAesCcmCachedContext(const Aes128KeyHandle & key)
+{
+    AesCcmCachedContext * cached = key.As<OpenSSLSymmetric128BitsKey>().mCachedContext;
+    VerifyOrReturnValue(cached != nullptr, nullptr);
+    VerifyOrReturnValue(CRYPTO_memcmp(cached->mKey, key.As<Symmetric128BitsKeyByteArray>(), sizeof(cached->mKey)) == 0, nullptr);
+    return cached;
+}
+
+#if CHIP_CRYPTO_BORINGSSL
+// Returns the cached AEAD context for the key, or nullptr if the caller has to create its own.
+// The cached context is only set up for the default tag length; other lengths get their own context.
+EVP_AEAD_CTX * GetKeyedAeadContext(const Aes128KeyHandle & key, size_t tagLength)
+{
+    VerifyOrReturnValue(tagLength == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, nullptr);
+
+    AesCcmCachedContext * cached = GetAesCcmCachedContext(key);
+    VerifyOrReturnValue(cached != nullptr, nullptr);
+
+    if (cached->mAeadContext == nullptr)
+    {
+        cached->mAeadContext =
+            EVP_AEAD_CTX_new(EVP_aead_aes_128_ccm_matter(), cached->mKey, sizeof(cached->mKey), CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+    }
+
+    return cached->mAeadContext;
+}
+#else
+// Returns the cached cipher context for the key, set up with everything but the nonce and, when
+// decrypting, the expected tag. Returns nullptr if the caller has to set up its own context.
+EVP_CIPHER_CTX * GetKeyedCipherContext(const Aes128KeyHandle & key, bool encrypt, int nonceLength, int tagLength)
+{
+    AesCcmCachedContext * cached = GetAesCcmCachedContext(key);
+    VerifyOrReturnValue(cached != nullptr, nullptr);
+
+    AesCcmKeyedContext & keyed = encrypt ? cached->mEncrypt : cached->mDecrypt;
+    if (keyed.mNonceLength == nonceLength && keyed.mTagLength == tagLength)
+    {
+        return keyed.mContext;
+    }
+
+    const int enc      = encrypt ? 1 : 0;
+    keyed.mNonceLength = 0;
+    keyed.mTagLength   = 0;
+    VerifyOrReturnValue(EVP_CipherInit_ex(keyed.mContext, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, enc) == 1, nullptr);
+    VerifyOrReturnValue(EVP_CIPHER_CTX_ctrl(keyed.mContext, EVP_CTRL_CCM_SET_IVLEN, nonceLength, nullptr) == 1, nullptr);
+    VerifyOrReturnValue(EVP_CIPHER_CTX_ctrl(keyed.mContext, EVP_CTRL_CCM_SET_TAG, tagLength, nullptr) == 1, nullptr);
+    VerifyOrReturnValue(EVP_CipherInit_ex(keyed.mContext, nullptr, nullptr, cached->mKey, nullptr, enc) == 1, nullptr);
+    keyed.mNonceLength = nonceLength;
+    keyed.mTagLength   = tagLength;
+
+    return keyed.mContext;
+}
+
+// Makes the cached cipher context for the key be set up from scratch on its next use, so that an
+// operation that failed midway cannot leave state behind for the next message.
+void InvalidateKeyedCipherContext(const Aes128KeyHandle & key, bool encrypt)
+{
+    AesCcmCachedContext * cached = GetAesCcmCachedContext(key);
+    VerifyOrReturn(cached != nullptr);
+
+    AesCcmKeyedContext & keyed = encrypt ? cached->mEncrypt : cached->mDecrypt;
+    keyed.mNonceLength         = 0;
+    keyed.mTagLength           = 0;
+}
+#endif // CHIP_CRYPTO_BORINGSSL
+
+} // namespace
+
+void AttachAesCcmContext(Aes128KeyHandle & key)
+{
+    AesCcmCachedContext *& cached = key.AsMutable<OpenSSLSymmetric128BitsKey>().mCachedContext;
+
+    if (cached == nullptr)
+    {
+        auto * created = Platform::New<AesCcmCachedContext>();
+        VerifyOrReturn(created != nullptr);
+#if !CHIP_CRYPTO_BORINGSSL
+        created->mEncrypt.mContext = EVP_CIPHER_CTX_new();
+        created->mDecrypt.mContext = EVP_CIPHER_CTX_new();
+        if (created->mEncrypt.mContext == nullptr || created->mDecrypt.mContext == nullptr)
+        {
+            FreeAesCcmCachedContext(created);
+            return;
+        }
+#endif // !CHIP_CRYPTO_BORINGSSL
+        cached = created;
+    }
+
+    // The contexts are keyed lazily, on their first use with the new key material.
+    memcpy(cached->mKey, key.As<Symmetric128BitsKeyByteArray>(), sizeof(cached->mKey));
+#if CHIP_CRYPTO_BORINGSSL
+    if (cached->mAeadContext != nullptr)
+    {
+        EVP_AEAD_CTX_free(cached->mAeadContext);
+        cached->mAeadContext = nullptr;
+    }
+#else
+    cached->mEncrypt.mNonceLength = cached->mEncrypt.mTagLength = 0;
+    cached->mDecrypt.mNonceLength = cached->mDecrypt.mTagLength = 0;
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+void ReleaseAesCcmContext(Symmetric128BitsKeyHandle & key)
+{
+    AesCcmCachedContext *& cached = key.AsMutable<OpenSSLSymmetric128BitsKey>().mCachedContext;
+    VerifyOrReturn(cached != nullptr);
+
+    FreeAesCcmCachedContext(cached);
+    cached = nullptr;
+}
+
 CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
                            const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
                            uint8_t * tag, size_t tag_length)
@@ -160,8 +326,9 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
     size_t ciphertext_length = 0;
     const EVP_CIPHER * type  = nullptr;
 #endif
-    CHIP_ERROR error = CHIP_NO_ERROR;
-    int result       = 1;
+    CHIP_ERROR error     = CHIP_NO_ERROR;
+    int result           = 1;
+    bool contextIsCached = false;
 
     // Placeholder location for avoiding null params for plaintexts when
     // size is zero.
@@ -202,10 +369,16 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
 #endif // CHIP_CRYPTO_BORINGSSL
 
 #if CHIP_CRYPTO_BORINGSSL
-    aead = EVP_aead_aes_128_ccm_matter();
+    context         = GetKeyedAeadContext(key, tag_length);
+    contextIsCached = (context != nullptr);
+    if (!contextIsCached)
+    {
+        aead = EVP_aead_aes_128_ccm_matter();
 
-    context = EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+        context =
+            EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
+        VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+    }
 
     result = EVP_AEAD_CTX_seal_scatter(context, ciphertext, tag, &written_tag_len, tag_length, nonce, nonce_length, plaintext,
                                        plaintext_length, nullptr, 0, aad, aad_length);
@@ -213,27 +386,41 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
     VerifyOrExit(written_tag_len == tag_length, error = CHIP_ERROR_INTERNAL);
 #else
 
-    type = EVP_aes_128_ccm();
+    // Use the keyed context attached to the key, if any. Casts are safe because we checked nonce_length
+    // with CanCastTo and tag_length against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
+    context = GetKeyedCipherContext(key, /* encrypt = */ true, static_cast<int>(nonce_length), static_cast<int>(tag_length));
+    contextIsCached = (context != nullptr);
+    if (contextIsCached)
+    {
+        // Pass in nonce
+        result = EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
+    else
+    {
+        type = EVP_aes_128_ccm();
 
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+        context = EVP_CIPHER_CTX_new();
+        VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
 
-    // Pass in cipher
-    result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in cipher
+        result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_EncryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in key + nonce
+        static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+        result =
+            EVP_EncryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
 
     // Pass in plain text length
     VerifyOrExit(CanCastTo<int>(plaintext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
@@ -268,7 +455,16 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
 #endif // CHIP_CRYPTO_BORINGSSL
 
 exit:
-    if (context != nullptr)
+    if (contextIsCached)
+    {
+#if !CHIP_CRYPTO_BORINGSSL
+        if (error != CHIP_NO_ERROR)
+        {
+            InvalidateKeyedCipherContext(key, /* encrypt = */ true);
+        }
+#endif // !CHIP_CRYPTO_BORINGSSL
+    }
+    else if (context != nullptr)
     {
 #if CHIP_CRYPTO_BORINGSSL
         EVP_AEAD_CTX_free(context);
@@ -294,8 +490,9 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
     int bytesOutput          = 0;
     const EVP_CIPHER * type  = nullptr;
 #endif // CHIP_CRYPTO_BORINGSSL
-    CHIP_ERROR error = CHIP_NO_ERROR;
-    int result       = 1;
+    CHIP_ERROR error     = CHIP_NO_ERROR;
+    int result           = 1;
+    bool contextIsCached = false;
 
     // Placeholder location for avoiding null params for ciphertext when
     // size is zero.
@@ -334,41 +531,68 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
     VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
 
 #if CHIP_CRYPTO_BORINGSSL
-    aead = EVP_aead_aes_128_ccm_matter();
+    context         = GetKeyedAeadContext(key, tag_length);
+    contextIsCached = (context != nullptr);
+    if (!contextIsCached)
+    {
+        aead = EVP_aead_aes_128_ccm_matter();
 
-    context = EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+        context =
+            EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
+        VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+    }
 
     result = EVP_AEAD_CTX_open_gather(context, plaintext, nonce, nonce_length, ciphertext, ciphertext_length, tag, tag_length, aad,
                                       aad_length);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 #else
-    type = EVP_aes_128_ccm();
+    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
 
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+    // Use the keyed context attached to the key, if any
+    context = GetKeyedCipherContext(key, /* encrypt = */ false, static_cast<int>(nonce_length), static_cast<int>(tag_length));
+    contextIsCached = (context != nullptr);
+    if (contextIsCached)
+    {
+        // Pass in nonce
+        result = EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in cipher
-    result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in expected tag
+        // Removing "const" from |tag| here should hopefully be safe as
+        // we're writing the tag, not reading.
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                     const_cast<void *>(static_cast<const void *>(tag)));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
+    else
+    {
+        type = EVP_aes_128_ccm();
 
-    // Pass in nonce length
-    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        context = EVP_CIPHER_CTX_new();
+        VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
 
-    // Pass in expected tag
-    // Removing "const" from |tag| here should hopefully be safe as
-    // we're writing the tag, not reading.
-    VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
-                                              const_cast<void *>(static_cast<const void *>(tag)));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in cipher
+        result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_DecryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in nonce length
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+        // Pass in expected tag
+        // Removing "const" from |tag| here should hopefully be safe as
+        // we're writing the tag, not reading.
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                     const_cast<void *>(static_cast<const void *>(tag)));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+        // Pass in key + nonce
+        static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+        result =
+            EVP_DecryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
 
     // Pass in cipher text length
     VerifyOrExit(CanCastTo<int>(ciphertext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
@@ -397,7 +621,16 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
 #endif // CHIP_CRYPTO_BORINGSSL
 
 exit:
-    if (context != nullptr)
+    if (contextIsCached)
+    {
+#if !CHIP_CRYPTO_BORINGSSL
+        if (error != CHIP_NO_ERROR)
+        {
+            InvalidateKeyedCipherContext(key, /* encrypt = */ false);
+        }
+#endif // !CHIP_CRYPTO_BORINGSSL
+    }
+    else if (context != nullptr)
     {
 #if CHIP_CRYPTO_BORINGSSL
         EVP_AEAD_CTX_free(context);
@@ -0,0 +1,52 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Functions specific to the OpenSSL and BoringSSL based implementation of CHIP crypto primitives
+ */
+
+#pragma once
+
+#include "CHIPCryptoPAL.h"
+
+namespace chip {
+namespace Crypto {
+
+/**
+ * @brief Attach keyed AES-CCM cipher contexts to the key.
+ *
+ * Once attached, AES_CCM_encrypt() and AES_CCM_decrypt() with the key reuse the contexts and only
+ * load the nonce for each message, instead of allocating a context and expanding the key every time.
+ * The contexts must be released with ReleaseAesCcmContext() before the key handle goes away.
+ *
+ * Must be called after the key material has been written to the handle. If a context is already
+ * attached, it is re-keyed lazily on its next use. Failing to allocate the contexts is not an error:
+ * the key then keeps using the uncached path.
+ *
+ * The attached contexts are not safe for concurrent use, so the key must not be used for AES-CCM by
+ * several threads at the same time.
+ */
+void AttachAesCcmContext(Aes128KeyHandle & key);
+
+/**
+ * @brief Free the AES-CCM cipher contexts attached to the key by AttachAesCcmContext(), if any.
+ */
+void ReleaseAesCcmContext(Symmetric128BitsKeyHandle & key);
+
+} // namespace Crypto
+} // namespace chip
@@ -17,6 +17,10 @@
 
 #include <crypto/RawKeySessionKeystore.h>
 
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+#include <crypto/CHIPCryptoPALOpenSSL.h>
+#endif
+
 #include <lib/support/BufferReader.h>
 
 #include <cstdint>
@@ -80,10 +84,19 @@ CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const ByteSpan & secret, con
 
     Encoding::LittleEndian::Reader reader(keyMaterial, sizeof(keyMaterial));
 
-    return reader.ReadBytes(i2rKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
-        .ReadBytes(r2iKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
-        .ReadBytes(attestationChallenge.Bytes(), AttestationChallenge::Capacity())
-        .StatusCode();
+    ReturnErrorOnFailure(reader.ReadBytes(i2rKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
+                             .ReadBytes(r2iKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
+                             .ReadBytes(attestationChallenge.Bytes(), AttestationChallenge::Capacity())
+                             .StatusCode());
+
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+    // Session keys encrypt and decrypt every message of the session, so keep keyed cipher contexts
+    // for them rather than setting up the cipher for each message.
+    AttachAesCcmContext(i2rKey);
+    AttachAesCcmContext(r2iKey);
+#endif
+
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const HkdfKeyHandle & hkdfKey, const ByteSpan & salt, const ByteSpan & info,
@@ -95,6 +108,10 @@ CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const HkdfKeyHandle & hkdfKe
 
 void RawKeySessionKeystore::DestroyKey(Symmetric128BitsKeyHandle & key)
 {
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+    ReleaseAesCcmContext(key);
+#endif
+
     ClearSecretData(key.AsMutable<Symmetric128BitsKeyByteArray>());
 }
 
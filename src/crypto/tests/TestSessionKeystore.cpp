@@ -201,4 +201,74 @@ TEST_F(TestSessionKeystore, TestDeriveSessionKeys)
     }
 }
 
+TEST_F(TestSessionKeystore, TestSessionKeysAcrossMessages)
+{
+    TestSessionKeystoreImpl keystore;
+
+    Aes128KeyHandle i2r;
+    Aes128KeyHandle r2i;
+    AttestationChallenge challenge;
+    ASSERT_EQ(keystore.DeriveSessionKeys(ToSpan("secret"), ToSpan("salt123"), ToSpan("info123"), i2r, r2i, challenge),
+              CHIP_NO_ERROR);
+
+    // Import the same key material as a plain key, to compare with.
+    Aes128KeyHandle imported;
+    ASSERT_EQ(keystore.CreateKey(i2r.As<Symmetric128BitsKeyByteArray>(), imported), CHIP_NO_ERROR);
+
+    uint8_t plaintext[64];
+    uint8_t aad[8];
+    uint8_t nonce[13] = { 0 };
+    for (size_t i = 0; i < sizeof(plaintext); i++)
+    {
+        plaintext[i] = static_cast<uint8_t>(i);
+    }
+    memset(aad, 0xa5, sizeof(aad));
+
+    // Session keys are used for many messages in a row, with a different nonce, length and sometimes tag length each time.
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        const size_t length    = 1 + (i * 9u) % (sizeof(plaintext) - 1);
+        const size_t tagLength = (i == 5) ? 8 : CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
+        nonce[0]               = i;
+
+        uint8_t ciphertext[sizeof(plaintext)];
+        uint8_t expectedCiphertext[sizeof(plaintext)];
+        uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        uint8_t expectedTag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        EXPECT_EQ(AES_CCM_encrypt(plaintext, length, aad, sizeof(aad), i2r, nonce, sizeof(nonce), ciphertext, tag, tagLength),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(AES_CCM_encrypt(plaintext, length, aad, sizeof(aad), imported, nonce, sizeof(nonce), expectedCiphertext,
+                                  expectedTag, tagLength),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(ciphertext, expectedCiphertext, length), 0);
+        EXPECT_EQ(memcmp(tag, expectedTag, tagLength), 0);
+
+        // A message that fails authentication must not affect the next one.
+        uint8_t decrypted[sizeof(plaintext)];
+        tag[0] ^= 1;
+        EXPECT_NE(AES_CCM_decrypt(ciphertext, length, aad, sizeof(aad), tag, tagLength, i2r, nonce, sizeof(nonce), decrypted),
+                  CHIP_NO_ERROR);
+        tag[0] ^= 1;
+        EXPECT_EQ(AES_CCM_decrypt(ciphertext, length, aad, sizeof(aad), tag, tagLength, i2r, nonce, sizeof(nonce), decrypted),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(decrypted, plaintext, length), 0);
+    }
+
+    // The other session key must not be mixed up with the first one.
+    uint8_t ciphertext[16];
+    uint8_t expectedCiphertext[16];
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+    EXPECT_EQ(AES_CCM_encrypt(plaintext, sizeof(ciphertext), aad, sizeof(aad), r2i, nonce, sizeof(nonce), ciphertext, tag,
+                              sizeof(tag)),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(AES_CCM_encrypt(plaintext, sizeof(ciphertext), aad, sizeof(aad), imported, nonce, sizeof(nonce), expectedCiphertext,
+                              tag, sizeof(tag)),
+              CHIP_NO_ERROR);
+    EXPECT_NE(memcmp(ciphertext, expectedCiphertext, sizeof(ciphertext)), 0);
+
+    keystore.DestroyKey(i2r);
+    keystore.DestroyKey(r2i);
+    keystore.DestroyKey(imported);
+}
+
 } // namespace
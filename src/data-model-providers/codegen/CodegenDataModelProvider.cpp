@@ -427,6 +427,48 @@ const EmberAfCluster * CodegenDataModelProvider::FindServerCluster(const Concret
     return cluster;
 }
 
+DataModel::MetadataSnapshot * CodegenDataModelProvider::RetainMetadataSnapshot()
+{
+#if CHIP_CONFIG_DATA_MODEL_METADATA_SNAPSHOTS
+    if ((mMetadataSnapshot != nullptr) &&
+        ((mMetadataSnapshotEmberGeneration != emberAfMetadataStructureGeneration()) ||
+         (mMetadataSnapshotRegistryGeneration != mRegistry.StructureGeneration())))
+    {
+        // Holders of the previous snapshot keep it alive until they are done with it.
+        ReleaseMetadataSnapshot();
+    }
+
+    if (mMetadataSnapshot == nullptr)
+    {
+        // Clusters in mRegistry own their metadata and may change their attribute list at any
+        // time, so only the attributes of ember clusters (fixed per structure generation) are cached.
+        mMetadataSnapshot = DataModel::MetadataSnapshot::Create(
+            *this,
+            [](void * context, const ConcreteClusterPath & path) {
+                return static_cast<CodegenDataModelProvider *>(context)->mRegistry.Get(path) == nullptr;
+            },
+            this);
+        VerifyOrReturnValue(mMetadataSnapshot != nullptr, nullptr);
+
+        mMetadataSnapshotEmberGeneration    = emberAfMetadataStructureGeneration();
+        mMetadataSnapshotRegistryGeneration = mRegistry.StructureGeneration();
+    }
+
+    return mMetadataSnapshot->Retain();
+#else
+    return nullptr;
+#endif // CHIP_CONFIG_DATA_MODEL_METADATA_SNAPSHOTS
+}
+
+void CodegenDataModelProvider::ReleaseMetadataSnapshot()
+{
+    if (mMetadataSnapshot != nullptr)
+    {
+        mMetadataSnapshot->Release();
+        mMetadataSnapshot = nullptr;
+    }
+}
+
 CHIP_ERROR CodegenDataModelProvider::AcceptedCommands(const ConcreteClusterPath & path,
                                                       DataModel::ListBuilder<DataModel::AcceptedCommandEntry> & builder)
 {
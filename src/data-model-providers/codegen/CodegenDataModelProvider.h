@@ -44,9 +44,15 @@ namespace app {
 class CodegenDataModelProvider : public DataModel::Provider
 {
 public:
+    ~CodegenDataModelProvider() override { ReleaseMetadataSnapshot(); }
+
     /// clears out internal caching. Especially useful in unit tests,
     /// where path caching does not really apply (the same path may result in different outcomes)
-    void Reset() { mPreviouslyFoundCluster = std::nullopt; }
+    void Reset()
+    {
+        mPreviouslyFoundCluster = std::nullopt;
+        ReleaseMetadataSnapshot();
+    }
 
     void SetPersistentStorageDelegate(PersistentStorageDelegate * delegate) { mPersistentStorageDelegate = delegate; }
     PersistentStorageDelegate * GetPersistentStorageDelegate() { return mPersistentStorageDelegate; }
@@ -79,6 +85,8 @@ public:
 
     void Temporary_ReportAttributeChanged(const AttributePathParams & path) override;
 
+    DataModel::MetadataSnapshot * RetainMetadataSnapshot() override;
+
 protected:
     // Temporary hack for a test: Initializes the data model for testing purposes only.
     // This method serves as a placeholder and should NOT be used outside of specific tests.
@@ -109,6 +117,12 @@ private:
     std::optional<ClusterReference> mPreviouslyFoundCluster;
     unsigned mEmberMetadataStructureGeneration = 0;
 
+    // The snapshot returned by RetainMetadataSnapshot, and the ember and registry structure
+    // generations it was taken at.
+    DataModel::MetadataSnapshot * mMetadataSnapshot = nullptr;
+    unsigned mMetadataSnapshotEmberGeneration       = 0;
+    unsigned mMetadataSnapshotRegistryGeneration    = 0;
+
     // Ember requires a persistence provider, so we make sure we can always have something
     PersistentStorageDelegate * mPersistentStorageDelegate = nullptr;
 
@@ -121,6 +135,8 @@ private:
 
     /// Find the index of the given endpoint id
     std::optional<unsigned> TryFindEndpointIndex(EndpointId id) const;
+
+    void ReleaseMetadataSnapshot();
 };
 
 } // namespace app
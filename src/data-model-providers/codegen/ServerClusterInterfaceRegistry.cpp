@@ -63,6 +63,7 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Register(ServerClusterRegistration &
 
     entry.next     = mRegistrations;
     mRegistrations = &entry;
+    mStructureGeneration++;
 
     return CHIP_NO_ERROR;
 }
@@ -94,6 +95,7 @@ ServerClusterInterface * ServerClusterInterfaceRegistry::Unregister(const Concre
             }
 
             current->next = nullptr; // Make sure current does not look like part of a list.
+            mStructureGeneration++;
             if (mContext.has_value())
             {
                 current->serverClusterInterface->Shutdown();
@@ -138,6 +140,7 @@ void ServerClusterInterfaceRegistry::UnregisterAllFromEndpoint(EndpointId endpoi
             ServerClusterRegistration * actual_next = current->next;
 
             current->next = nullptr; // Make sure current does not look like part of a list.
+            mStructureGeneration++;
             if (mContext.has_value())
             {
                 current->serverClusterInterface->Shutdown();
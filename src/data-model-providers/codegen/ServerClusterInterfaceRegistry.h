@@ -140,8 +140,14 @@ public:
     // Invalidates current context.
     void ClearContext();
 
+    /// Increases every time a registration is added or removed, so that
+    /// anything derived from the set of registered clusters can tell when
+    /// it is out of date.
+    unsigned StructureGeneration() const { return mStructureGeneration; }
+
 private:
     ServerClusterRegistration * mRegistrations = nullptr;
+    unsigned mStructureGeneration              = 0;
 
     // A one-element cache to speed up finding a cluster within an endpoint.
     // The endpointId specifies which endpoint the cache belongs to.
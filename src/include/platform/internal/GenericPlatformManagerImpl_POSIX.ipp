@@ -168,9 +168,15 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDev
     SystemLayer().ScheduleWork(&_DispatchEventViaScheduleWork, eventCopyP);
     return CHIP_NO_ERROR;
 #else
-    mChipEventQueue.Push(*event);
+    bool wasEmpty;
+    ReturnErrorOnFailure(mChipEventQueue.Push(*event, wasEmpty));
 
-    SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
+    // The event loop drains the whole queue every time it wakes up, so only the first event
+    // posted since it last did needs to wake it.
+    if (wasEmpty)
+    {
+        SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
+    }
     return CHIP_NO_ERROR;
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
@@ -215,6 +221,11 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunEventLoop()
     Impl()->LockChipStack();
 
     SystemLayerSocketsLoop().EventLoopBegins();
+
+    // Events still queued from before the event loop (re)started may not have a wake up of their
+    // own pending (see _PostEvent), so dispatch them before waiting for anything.
+    ProcessDeviceEvents();
+
     do
     {
         SystemLayerSocketsLoop().PrepareEvents();
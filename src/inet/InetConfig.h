@@ -295,4 +295,23 @@
 #define INET_CONFIG_UDP_SOCKET_MREQN 0
 #endif
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
+ *
+ *  @brief
+ *    Maximum number of datagrams the socket-based implementation of UDP
+ *    endpoints receives per readiness event.
+ *
+ *  @details
+ *    Values greater than 1 require recvmmsg(). Receive buffers for a full
+ *    batch are kept by each listening endpoint between readiness events.
+ *    When set to 1, a single datagram is received with recvmsg().
+ *
+ *    Sends are not batched: every message is still sent with its own
+ *    sendmsg() call.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE 1
+#endif
+
 // clang-format on
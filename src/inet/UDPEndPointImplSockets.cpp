@@ -167,6 +167,65 @@ CHIP_ERROR IPv4Bind(int socket, const IPAddress & address, uint16_t port)
 }
 #endif // INET_CONFIG_ENABLE_IPV4
 
+// Fills in the source and destination of a received datagram from its peer address and IP_PKTINFO/IPV6_PKTINFO control messages.
+CHIP_ERROR ParseReceivedMessageInfo(struct msghdr & msgHeader, IPPacketInfo & packetInfo)
+{
+    const SockAddr & peerSockAddr = *static_cast<const SockAddr *>(msgHeader.msg_name);
+
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            packetInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            packetInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 } // anonymous namespace
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
@@ -410,6 +469,9 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
     // Send IP packet.
+    // TODO: Batch sends (sendmmsg(), and UDP_SEGMENT for messages to the same peer) as INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
+    // does for receives. That needs an outgoing datagram queue flushed once per event loop iteration, with send errors
+    // reported asynchronously to the transports, since SendMsg callers currently act on the status of each send right away.
     // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
     const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
     if (lenSent == -1)
@@ -434,6 +496,13 @@ void UDPEndPointImplSockets::CloseImpl()
         close(mSocket);
         mSocket = kInvalidSocketFd;
     }
+
+#if INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+    for (auto & buffer : mRecvBuffers)
+    {
+        buffer = nullptr;
+    }
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
 }
 
 void UDPEndPointImplSockets::Free()
@@ -578,6 +647,9 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         return;
     }
 
+#if INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+    HandlePendingReadBatch();
+#else
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -592,7 +664,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
     {
         struct iovec msgIOV;
         SockAddr lPeerSockAddr;
-        uint8_t controlData[256];
+        uint8_t controlData[kControlDataSize];
         struct msghdr msgHeader;
 
         msgIOV.iov_base = lBuffer->Start();
@@ -622,62 +694,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         else
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = ParseReceivedMessageInfo(msgHeader, lPacketInfo);
         }
     }
     else
@@ -697,7 +714,112 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
             OnReceiveError(this, lStatus, nullptr);
         }
     }
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+}
+
+#if INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+void UDPEndPointImplSockets::HandlePendingReadBatch()
+{
+    struct mmsghdr msgHeaders[kRecvBatchSize];
+    struct iovec msgIOVs[kRecvBatchSize];
+    SockAddr peerSockAddrs[kRecvBatchSize];
+    uint8_t controlData[kRecvBatchSize][kControlDataSize];
+
+    // Top up the receive buffers; buffers not filled by the previous batch are reused as-is.
+    unsigned int bufferCount = 0;
+    for (; bufferCount < kRecvBatchSize; bufferCount++)
+    {
+        System::PacketBufferHandle & buffer = mRecvBuffers[bufferCount];
+        if (buffer.IsNull())
+        {
+            buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+            if (buffer.IsNull())
+            {
+                break;
+            }
+        }
+
+        msgIOVs[bufferCount].iov_base = buffer->Start();
+        msgIOVs[bufferCount].iov_len  = buffer->AvailableDataLength();
+
+        memset(&peerSockAddrs[bufferCount], 0, sizeof(peerSockAddrs[bufferCount]));
+        memset(&msgHeaders[bufferCount], 0, sizeof(msgHeaders[bufferCount]));
+
+        struct msghdr & msgHeader = msgHeaders[bufferCount].msg_hdr;
+        msgHeader.msg_name        = &peerSockAddrs[bufferCount];
+        msgHeader.msg_namelen     = sizeof(peerSockAddrs[bufferCount]);
+        msgHeader.msg_iov         = &msgIOVs[bufferCount];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = controlData[bufferCount];
+        msgHeader.msg_controllen  = sizeof(controlData[bufferCount]);
+    }
+
+    if (bufferCount == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    const int received = recvmmsg(mSocket, msgHeaders, bufferCount, MSG_DONTWAIT, nullptr);
+    if (received == -1)
+    {
+        const CHIP_ERROR lStatus = CHIP_ERROR_POSIX(errno);
+        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+        return;
+    }
+
+    SYSTEM_STATS_SET(System::Stats::kInetLayer_UDPRecvBatchSize, static_cast<System::Stats::count_t>(received));
+
+    // The callbacks below may close and free this endpoint; keep it alive until the batch has been walked.
+    Retain();
+
+    for (int i = 0; i < received; i++)
+    {
+        // Stop delivering once a callback has closed the endpoint. CloseImpl() released the receive buffers.
+        if (mState != State::kListening || OnMessageReceived == nullptr)
+        {
+            break;
+        }
+
+        System::PacketBufferHandle lBuffer = std::move(mRecvBuffers[i]);
+        CHIP_ERROR lStatus                 = CHIP_NO_ERROR;
+        IPPacketInfo lPacketInfo;
+
+        lPacketInfo.Clear();
+        lPacketInfo.DestPort  = mBoundPort;
+        lPacketInfo.Interface = mBoundIntfId;
+
+        const size_t rcvLen = msgHeaders[i].msg_len;
+        if (lBuffer->AvailableDataLength() < rcvLen || (msgHeaders[i].msg_hdr.msg_flags & MSG_TRUNC) != 0)
+        {
+            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+        }
+        else
+        {
+            lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
+            lStatus = ParseReceivedMessageInfo(msgHeaders[i].msg_hdr, lPacketInfo);
+        }
+
+        if (lStatus == CHIP_NO_ERROR)
+        {
+            lBuffer.RightSize();
+            OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+    }
+
+    Release();
 }
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
 
 #ifdef IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
@@ -58,9 +58,22 @@ private:
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
 
+    // Space reserved for the control messages (IP_PKTINFO/IPV6_PKTINFO) of each received datagram.
+    static constexpr size_t kControlDataSize = 256;
+
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+#if INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+    static constexpr unsigned int kRecvBatchSize = INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE;
+
+    // Receives up to kRecvBatchSize datagrams with a single recvmmsg() call and delivers them in order.
+    void HandlePendingReadBatch();
+
+    // Receive buffers for the next batch. Buffers that were not filled by a batch are kept for the next one.
+    System::PacketBufferHandle mRecvBuffers[kRecvBatchSize];
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
     enum class MulticastOperation
@@ -375,6 +375,88 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 }
 
+#if INET_CONFIG_ENABLE_IPV4 && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+namespace {
+
+struct BurstReceiveState
+{
+    int mReceived   = 0;
+    int mCloseAfter = -1;
+    bool mInOrder   = true;
+};
+
+void HandleBurstMessageReceived(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    auto * state = static_cast<BurstReceiveState *>(endPoint->mAppState);
+    if (msg->DataLength() != 1 || msg->Start()[0] != static_cast<uint8_t>(state->mReceived))
+    {
+        state->mInOrder = false;
+    }
+    if (++state->mReceived == state->mCloseAfter)
+    {
+        endPoint->Close();
+    }
+}
+
+} // namespace
+
+// A burst of datagrams must be delivered completely and in order, however many are drained per readiness event,
+// and delivery must stop as soon as a receive callback closes the endpoint.
+TEST_F(TestInetEndPoint, TestUDPReceiveBurst)
+{
+    constexpr int kMessageCount = 20;
+    constexpr int kCloseAfter   = 3;
+
+    IPAddress loopback;
+    ASSERT_TRUE(IPAddress::FromString("127.0.0.1", loopback));
+
+#if INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+    SYSTEM_STATS_RESET(System::Stats::kInetLayer_UDPRecvBatchSize);
+    SYSTEM_STATS_RESET_HIGH_WATER_MARK_FOR_TESTING(System::Stats::kInetLayer_UDPRecvBatchSize);
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+
+    for (int closeAfter : { -1, kCloseAfter })
+    {
+        BurstReceiveState state;
+        state.mCloseAfter  = closeAfter;
+        const int expected = (closeAfter < 0) ? kMessageCount : closeAfter;
+
+        UDPEndPoint * receiver = nullptr;
+        UDPEndPoint * sender   = nullptr;
+        ASSERT_EQ(gUDP.NewEndPoint(&receiver), CHIP_NO_ERROR);
+        ASSERT_EQ(gUDP.NewEndPoint(&sender), CHIP_NO_ERROR);
+        ASSERT_EQ(receiver->Bind(IPAddressType::kIPv4, loopback, 0), CHIP_NO_ERROR);
+        ASSERT_EQ(receiver->Listen(HandleBurstMessageReceived, nullptr, &state), CHIP_NO_ERROR);
+
+        for (int i = 0; i < kMessageCount; i++)
+        {
+            PacketBufferHandle buf = PacketBufferHandle::New(1);
+            ASSERT_FALSE(buf.IsNull());
+            buf->Start()[0] = static_cast<uint8_t>(i);
+            buf->SetDataLength(1);
+            ASSERT_EQ(sender->SendTo(loopback, receiver->GetBoundPort(), std::move(buf)), CHIP_NO_ERROR);
+        }
+
+        for (int i = 0; i < 2 * kMessageCount && state.mReceived < expected; i++)
+        {
+            ServiceEvents(10);
+        }
+
+        EXPECT_TRUE(state.mInOrder);
+        EXPECT_EQ(state.mReceived, expected);
+
+        sender->Free();
+        receiver->Free();
+    }
+
+#if INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+    // The whole burst was queued on the socket before the first readiness event, so it was drained in full batches.
+    EXPECT_TRUE(
+        SYSTEM_STATS_TEST_HIGH_WATER_MARK(System::Stats::kInetLayer_UDPRecvBatchSize, INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE));
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+}
+#endif // INET_CONFIG_ENABLE_IPV4 && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
@@ -287,6 +287,18 @@
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 16
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+/**
+ *  @def CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+ *
+ *  @brief
+ *    Number of buckets of the index used to find the exchange context
+ *    a received message belongs to.
+ *
+ */
+#ifndef CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+#define CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
+#endif // CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS
+
 /**
  *  @def CHIP_CONFIG_MCSP_RECEIVE_TABLE_SIZE
  *
@@ -964,6 +976,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_MAX_NUM_INTEREST_PATHS
+ *
+ * @brief Defines the maximum number of read and subscription attribute paths indexed by the reporting engine, so that marking
+ *        an attribute dirty only visits the ReadHandlers interested in it. Paths beyond this limit are still honored, at the
+ *        cost of checking every ReadHandler on each change.
+ */
+#ifndef CHIP_IM_SERVER_MAX_NUM_INTEREST_PATHS
+#define CHIP_IM_SERVER_MAX_NUM_INTEREST_PATHS                                                                                      \
+    (CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS)
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1085,6 +1109,31 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+ *
+ * @brief Number of incoming CASE sessions the CASE server can simultaneously negotiate as a responder.
+ *
+ * One responder is always kept ready for the next Sigma1 with a reserved SecureSession. The others only allocate a
+ * SecureSession when a Sigma1 arrives while handshakes are already in progress, and release it once their handshake is
+ * done. A Sigma1 arriving while all the responders are busy gets a busy status report.
+ *
+ * Every responder holds a CASESession, so the default of one keeps the RAM footprint of a single responder. Nodes that
+ * expect several controllers to connect at once (bridges, hubs) can raise it. Test builds use two responders, so that
+ * concurrent handshakes are exercised by the unit tests.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+#if CHIP_CONFIG_TEST
+#define CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES 2
+#else
+#define CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES 1
+#endif // CHIP_CONFIG_TEST
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+
+#if CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES < 1
+#error "CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES must allow at least one handshake"
+#endif
+
 /**
  * @def CHIP_CONFIG_DEVICE_MAX_ACTIVE_DEVICES
  *
@@ -1151,6 +1200,21 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE
+ *
+ * @brief Defines the maximum number of group sessions kept in memory to decrypt group messages
+ *
+ * A group session is one operational key of a keyset mapped to a group. Each cached session holds a key context
+ * with its keys loaded in the session keystore. When the stored group data yields more sessions, group messages
+ * are decrypted by walking the records in storage instead. Set to 0 to disable the cache.
+ *
+ * Defaults to one fabric with every group mapped to a keyset of 3 keys.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE
+#define CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE (3 * CHIP_CONFIG_MAX_GROUPS_PER_FABRIC)
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1160,6 +1224,21 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_NAME_LENGTH 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DEVICE_TYPE_CACHE_SIZE
+ *
+ * Defines the number of device type resolutions (whether a device type is on
+ * an endpoint) remembered by access control when checking device type targets.
+ * Set to 0 to resolve device types on every check.
+ *
+ * Remembered resolutions are dropped when the data model provider changes, when
+ * ember endpoints or device type lists change, and when the Descriptor
+ * DeviceTypeList or PartsList attribute of any endpoint is marked dirty.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DEVICE_TYPE_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DEVICE_TYPE_CACHE_SIZE 8
+#endif
+
 /**
  * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC
  *
@@ -1301,6 +1380,23 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_SEEK_POINTS
+ *
+ * @brief
+ *   The number of seek points kept by each event logging buffer.
+ *
+ * A seek point records where an event starts in the buffer, its event number and a
+ * summary of the clusters that logged events up to the next seek point.  Reads use
+ * them to start at the first event they have not fetched yet and to skip stretches
+ * of the log they have no interest in.  New seek points are taken roughly every
+ * 1/CHIP_CONFIG_EVENT_LOGGING_SEEK_POINTS of the buffer size; each one costs 16
+ * bytes per buffer.  Must be at least 2.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_SEEK_POINTS
+#define CHIP_CONFIG_EVENT_LOGGING_SEEK_POINTS 8
+#endif /* CHIP_CONFIG_EVENT_LOGGING_SEEK_POINTS */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1858,6 +1954,21 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #error "CHIP_CONFIG_MAX_PATHS_PER_INVOKE is not allowed to be a number less than 1 or greater than 65535"
 #endif
 
+/**
+ * @def CHIP_CONFIG_DATA_MODEL_METADATA_SNAPSHOTS
+ *
+ * @brief
+ *   If asserted (1), the codegen data model provider keeps a snapshot of its endpoint, cluster and
+ *   attribute IDs, which wildcard path expansion walks instead of asking the provider for (freshly
+ *   allocated) lists every time it moves to another endpoint or cluster.
+ *
+ * The snapshot is rebuilt after every structural change (e.g. adding a dynamic endpoint) and takes
+ * 4 bytes per attribute and up to 12 bytes per cluster and per endpoint.
+ */
+#ifndef CHIP_CONFIG_DATA_MODEL_METADATA_SNAPSHOTS
+#define CHIP_CONFIG_DATA_MODEL_METADATA_SNAPSHOTS 1
+#endif // CHIP_CONFIG_DATA_MODEL_METADATA_SNAPSHOTS
+
 /**
  * @def CHIP_CONFIG_ICD_OBSERVERS_POOL_SIZE
  *
@@ -1889,6 +2000,57 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_BDX_LOG_TRANSFERS 5
 #endif // CHIP_CONFIG_MAX_BDX_LOG_TRANSFERS
 
+/**
+ *  @def CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+ *
+ *  @brief
+ *    If asserted (1), a BDX TransferSession may propose and accept the windowed mode, in which several blocks are in flight
+ *    at once.
+ *
+ *    The windowed mode is negotiated with a Transfer Control bit that the specification reserves, so it is only interoperable
+ *    between peers that were both built with this option.
+ *
+ *    A product enables it by defining this to 1 in its CHIPProjectConfig.h. Even then no transfer is windowed unless its
+ *    callers opt in: the initiator sets TransferSession::TransferInitData::Windowed, and the responder sets
+ *    TransferSession::TransferAcceptData::Windowed to TransferSession::IsWindowedProposed(). The SDK's own BDX users (OTA,
+ *    diagnostic logs) do not opt in. Test builds enable it so that the windowed mode is covered by the unit tests.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+#if CHIP_CONFIG_TEST
+#define CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER 1
+#else
+#define CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER 0
+#endif // CHIP_CONFIG_TEST
+#endif // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+
+/**
+ *  @def CHIP_CONFIG_BDX_WINDOW_SIZE
+ *
+ *  @brief
+ *    Maximum number of blocks that the sender of a windowed BDX transfer keeps in flight.
+ *
+ *    The window is not negotiated: every windowed receiver buffers up to 8 blocks, and values above that are clamped to it, so
+ *    peers do not need to agree on this value. A windowed sender keeps a copy of every unacknowledged block, so each windowed
+ *    TransferSession may hold up to this many message buffers.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_WINDOW_SIZE
+#define CHIP_CONFIG_BDX_WINDOW_SIZE 4
+#endif // CHIP_CONFIG_BDX_WINDOW_SIZE
+
+/**
+ *  @def CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS
+ *
+ *  @brief
+ *    Time, in milliseconds, without any progress after which the sender of a windowed BDX transfer retransmits the oldest
+ *    unacknowledged block.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS
+#define CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS 1000
+#endif // CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS
+
 /**
  *  @def CHIP_CONFIG_TEST_GOOGLETEST
  *
@@ -303,6 +303,8 @@ ExchangeContext::ExchangeContext(ExchangeManager * em, uint16_t ExchangeId, cons
     mFlags.Set(Flags::kFlagEphemeralExchange, isEphemeralExchange);
     mDelegate = delegate;
 
+    mExchangeMgr->AddToExchangeIndex(this);
+
     //
     // If we're an initiator and we just created this exchange, we obviously did so to send a message. Let's go ahead and
     // set the flag on this to correctly mark it as so.
@@ -351,6 +353,7 @@ ExchangeContext::~ExchangeContext()
     // the boolean parameter passed to DoClose() should not matter.
 
     DoClose(false);
+    mExchangeMgr->RemoveFromExchangeIndex(this);
     mExchangeMgr = nullptr;
 
 #if defined(CHIP_EXCHANGE_CONTEXT_DETAIL_LOGGING)
@@ -42,6 +42,16 @@ using namespace chip::System;
 namespace chip {
 namespace Messaging {
 
+namespace {
+
+// Orders unsolicited message handlers by protocol and then message type, with kAnyMessageType first.
+uint64_t UMHSortKey(Protocols::Id protocolId, int16_t msgType)
+{
+    return (static_cast<uint64_t>(protocolId.ToFullyQualifiedSpecForm()) << 16) | static_cast<uint16_t>(msgType + 1);
+}
+
+} // namespace
+
 /**
  *  Constructor for the ExchangeManager class.
  *  It sets the state to kState_NotInitialized.
@@ -74,6 +84,7 @@ CHIP_ERROR ExchangeManager::Init(SessionManager * sessionManager)
         // then re-initializes without removing registered handlers.
         handler.Reset();
     }
+    mUMHandlerCount = 0;
 
     sessionManager->SetMessageDelegate(this);
 
@@ -142,28 +153,28 @@ CHIP_ERROR ExchangeManager::UnregisterUnsolicitedMessageHandlerForType(Protocols
 
 CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler)
 {
-    UnsolicitedMessageHandlerSlot * selected = nullptr;
+    VerifyOrReturnError(handler != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto & umh : UMHandlerPool)
+    size_t index = FindUMH(protocolId, msgType);
+    if (index < mUMHandlerCount && UMHandlerPool[index].Matches(protocolId, msgType))
     {
-        if (!umh.IsInUse())
-        {
-            if (selected == nullptr)
-                selected = &umh;
-        }
-        else if (umh.Matches(protocolId, msgType))
-        {
-            umh.Handler = handler;
-            return CHIP_NO_ERROR;
-        }
+        UMHandlerPool[index].Handler = handler;
+        return CHIP_NO_ERROR;
     }
 
-    if (selected == nullptr)
+    if (mUMHandlerCount == MATTER_ARRAY_SIZE(UMHandlerPool))
         return CHIP_ERROR_TOO_MANY_UNSOLICITED_MESSAGE_HANDLERS;
 
-    selected->Handler     = handler;
-    selected->ProtocolId  = protocolId;
-    selected->MessageType = msgType;
+    for (size_t i = mUMHandlerCount; i > index; i--)
+    {
+        UMHandlerPool[i] = UMHandlerPool[i - 1];
+    }
+    mUMHandlerCount++;
+
+    UnsolicitedMessageHandlerSlot & selected = UMHandlerPool[index];
+    selected.Handler                         = handler;
+    selected.ProtocolId                      = protocolId;
+    selected.MessageType                     = msgType;
 
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
 
@@ -172,17 +183,95 @@ CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgTyp
 
 CHIP_ERROR ExchangeManager::UnregisterUMH(Protocols::Id protocolId, int16_t msgType)
 {
-    for (auto & umh : UMHandlerPool)
+    size_t index = FindUMH(protocolId, msgType);
+    if (index == mUMHandlerCount || !UMHandlerPool[index].Matches(protocolId, msgType))
+        return CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER;
+
+    mUMHandlerCount--;
+    for (size_t i = index; i < mUMHandlerCount; i++)
+    {
+        UMHandlerPool[i] = UMHandlerPool[i + 1];
+    }
+    UMHandlerPool[mUMHandlerCount].Reset();
+    SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
+
+    return CHIP_NO_ERROR;
+}
+
+size_t ExchangeManager::FindUMH(Protocols::Id protocolId, int16_t msgType) const
+{
+    // Index of the first handler that does not sort before the given protocol and message type.
+    const uint64_t key = UMHSortKey(protocolId, msgType);
+    size_t low         = 0;
+    size_t high        = mUMHandlerCount;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (UMHSortKey(UMHandlerPool[middle].ProtocolId, UMHandlerPool[middle].MessageType) < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+ExchangeManager::UnsolicitedMessageHandlerSlot * ExchangeManager::FindMatchingUMH(const PayloadHeader & payloadHeader)
+{
+    // Prefer handlers that can explicitly handle the message type over handlers that handle all messages for a protocol.
+    for (int16_t msgType : { static_cast<int16_t>(payloadHeader.GetMessageType()), kAnyMessageType })
     {
-        if (umh.IsInUse() && umh.Matches(protocolId, msgType))
+        size_t index = FindUMH(payloadHeader.GetProtocolID(), msgType);
+        if (index < mUMHandlerCount && UMHandlerPool[index].Matches(payloadHeader.GetProtocolID(), msgType))
         {
-            umh.Reset();
-            SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
-            return CHIP_NO_ERROR;
+            return &UMHandlerPool[index];
         }
     }
+    return nullptr;
+}
+
+ExchangeContext *& ExchangeManager::ExchangeIndexBucket(uint16_t exchangeId, bool isInitiator)
+{
+    // Locally initiated exchanges have consecutive IDs, which this spreads evenly over the buckets.
+    return mExchangeIndex[((static_cast<uint32_t>(exchangeId) << 1) | (isInitiator ? 1u : 0u)) % kExchangeIndexBuckets];
+}
 
-    return CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER;
+void ExchangeManager::AddToExchangeIndex(ExchangeContext * ec)
+{
+    ExchangeContext *& bucket = ExchangeIndexBucket(ec->GetExchangeId(), ec->IsInitiator());
+    ec->mNextInIndex          = bucket;
+    bucket                    = ec;
+}
+
+void ExchangeManager::RemoveFromExchangeIndex(ExchangeContext * ec)
+{
+    ExchangeContext ** link = &ExchangeIndexBucket(ec->GetExchangeId(), ec->IsInitiator());
+    while (*link != nullptr)
+    {
+        if (*link == ec)
+        {
+            *link            = ec->mNextInIndex;
+            ec->mNextInIndex = nullptr;
+            return;
+        }
+        link = &(*link)->mNextInIndex;
+    }
+}
+
+ExchangeContext * ExchangeManager::FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                                const PayloadHeader & payloadHeader)
+{
+    // The exchange ID and role select a bucket; the session of the exchange can change after it is indexed (for instance
+    // when its holder shifts to a new session with the same peer), so it is only compared by MatchExchange.
+    ExchangeContext * ec = ExchangeIndexBucket(payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator());
+    while (ec != nullptr && !ec->MatchExchange(session, packetHeader, payloadHeader))
+    {
+        ec = ec->mNextInIndex;
+    }
+    return ec;
 }
 
 void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
@@ -262,23 +351,14 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     if (!packetHeader.IsGroupSession())
     {
         // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-
-        if (found)
+        ExchangeContext * ec = FindExchange(session, packetHeader, payloadHeader);
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
             return;
         }
     }
@@ -308,24 +388,8 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     // unsolicited messages must be marked as being from an initiator.
     if (!msgFlags.Has(MessageFlagValues::kDuplicateMessage) && payloadHeader.IsInitiator())
     {
-        // Search for an unsolicited message handler that can handle the message. Prefer handlers that can explicitly
-        // handle the message type over handlers that handle all messages for a profile.
-        matchingUMH = nullptr;
-
-        for (auto & umh : UMHandlerPool)
-        {
-            if (umh.IsInUse() && payloadHeader.HasProtocol(umh.ProtocolId))
-            {
-                if (umh.MessageType == payloadHeader.GetMessageType())
-                {
-                    matchingUMH = &umh;
-                    break;
-                }
-
-                if (umh.MessageType == kAnyMessageType)
-                    matchingUMH = &umh;
-            }
-        }
+        // Search for an unsolicited message handler that can handle the message.
+        matchingUMH = FindMatchingUMH(payloadHeader);
     }
     // Discard the message if it isn't marked as being sent by an initiator and the message does not need to send
     // an ack to the peer.
@@ -230,6 +230,9 @@ private:
         UnsolicitedMessageHandler * Handler;
     };
 
+    static constexpr size_t kExchangeIndexBuckets = CHIP_CONFIG_EXCHANGE_INDEX_BUCKETS;
+    static_assert(kExchangeIndexBuckets > 0, "The exchange index needs at least one bucket");
+
     uint16_t mNextExchangeId;
     uint16_t mNextKeyId;
     State mState;
@@ -241,10 +244,24 @@ private:
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
 
+    // The in-use handlers are the first mUMHandlerCount slots, sorted by protocol and then message type, with the handler for
+    // any message type of a protocol first.
     UnsolicitedMessageHandlerSlot UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
+    size_t mUMHandlerCount = 0;
+
+    // Active exchange contexts, chained through ExchangeContext::mNextInIndex in the bucket of their exchange ID and role.
+    ExchangeContext * mExchangeIndex[kExchangeIndexBuckets] = {};
 
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType);
+    size_t FindUMH(Protocols::Id protocolId, int16_t msgType) const;
+    UnsolicitedMessageHandlerSlot * FindMatchingUMH(const PayloadHeader & payloadHeader);
+
+    ExchangeContext *& ExchangeIndexBucket(uint16_t exchangeId, bool isInitiator);
+    void AddToExchangeIndex(ExchangeContext * ec);
+    void RemoveFromExchangeIndex(ExchangeContext * ec);
+    ExchangeContext * FindExchange(const SessionHandle & session, const PacketHeader & packetHeader,
+                                   const PayloadHeader & payloadHeader);
 
     void OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader, const SessionHandle & session,
                            DuplicateMessage isDuplicate, System::PacketBufferHandle && msgBuf) override;
@@ -23,6 +23,7 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <utility>
 
 #include <app/icd/server/ICDServerConfig.h>
 #include <lib/support/BitFlags.h>
@@ -78,7 +79,7 @@ void ReliableMessageMgr::Shutdown()
 
     // Clear the retransmit table
     mRetransTable.ForEachActiveObject([&](auto * entry) {
-        mRetransTable.ReleaseObject(entry);
+        ReleaseRetransEntry(*entry);
         return Loop::Continue;
     });
 
@@ -157,11 +158,13 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
-
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired.  Entries are taken from the deadline
+    // queue in order; the ones scheduled while processing get a newer sequence number, so each entry is handled at most once.
+    const uint32_t endSequence = mNextQueueSequence;
+    RetransTableEntry * entry  = nullptr;
+    while ((entry = mRetransQueue) != nullptr && entry->nextRetransTime <= now &&
+           static_cast<int32_t>(entry->queueSequence - endSequence) < 0)
+    {
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
         // Don't check whether the session in the exchange is valid, because when the session is released, the retrans entry is
@@ -207,9 +210,9 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
+            ReleaseRetransEntry(*entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -223,9 +226,7 @@ void ReliableMessageMgr::ExecuteActions()
 
         CalculateNextRetransTime(*entry);
         SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -258,6 +259,10 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
 
+    RetransTableEntry *& head = IndexBucketFor((*rEntry)->ec.Get());
+    (*rEntry)->nextInIndex    = head;
+    head                      = *rEntry;
+
     return CHIP_NO_ERROR;
 }
 
@@ -333,29 +338,25 @@ void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
 {
-    bool removed = false;
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
-        {
+    RetransTableEntry * entry = FindRetransEntry(rc);
+    if (entry == nullptr || entry->retainedBuf.GetMessageCounter() != ackMessageCounter)
+    {
+        return false;
+    }
+
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-            auto session = entry->ec->GetSessionHandle();
-            NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
+    auto session = entry->ec->GetSessionHandle();
+    NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
 
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-
-    return removed;
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -418,19 +419,16 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    RetransTableEntry * entry = FindRetransEntry(rc);
+    if (entry != nullptr)
+    {
+        ClearRetransTable(*entry);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseRetransEntry(entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
@@ -448,13 +446,10 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (mRetransQueue != nullptr && mRetransQueue->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mRetransQueue->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -550,7 +545,9 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
     }
 
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
-    entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    Unschedule(entry);
+    entry.nextRetransTime = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    Schedule(entry);
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
@@ -580,6 +577,145 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 #endif // CHIP_PROGRESS_LOGGING
 }
 
+void ReliableMessageMgr::ReleaseRetransEntry(RetransTableEntry & entry)
+{
+    Unschedule(entry);
+
+    RetransTableEntry ** link = &IndexBucketFor(entry.ec.Get());
+    while (*link != &entry)
+    {
+        link = &(*link)->nextInIndex;
+    }
+    *link = entry.nextInIndex;
+
+    mRetransTable.ReleaseObject(&entry);
+}
+
+ReliableMessageMgr::RetransTableEntry *& ReliableMessageMgr::IndexBucketFor(const ExchangeContext & ec)
+{
+    const uint32_t key = (static_cast<uint32_t>(ec.GetExchangeId()) << 1) | (ec.IsInitiator() ? 1u : 0u);
+    return mRetransIndex[key % kRetransIndexBuckets];
+}
+
+ReliableMessageMgr::RetransTableEntry * ReliableMessageMgr::FindRetransEntry(ReliableMessageContext * rc)
+{
+    if (!rc->IsWaitingForAck())
+    {
+        return nullptr;
+    }
+
+    RetransTableEntry * entry = IndexBucketFor(*rc->GetExchangeContext());
+    while (entry != nullptr && entry->ec->GetReliableMessageContext() != rc)
+    {
+        entry = entry->nextInIndex;
+    }
+    return entry;
+}
+
+bool ReliableMessageMgr::RetransmitsBefore(const RetransTableEntry & a, const RetransTableEntry & b)
+{
+    if (a.nextRetransTime != b.nextRetransTime)
+    {
+        return a.nextRetransTime < b.nextRetransTime;
+    }
+    return static_cast<int32_t>(a.queueSequence - b.queueSequence) < 0;
+}
+
+ReliableMessageMgr::RetransTableEntry * ReliableMessageMgr::MeldQueues(RetransTableEntry * a, RetransTableEntry * b)
+{
+    if (a == nullptr)
+    {
+        return b;
+    }
+    if (b == nullptr)
+    {
+        return a;
+    }
+    if (RetransmitsBefore(*b, *a))
+    {
+        std::swap(a, b);
+    }
+
+    // b becomes the first child of a.
+    b->queuePrev    = a;
+    b->queueSibling = a->queueChild;
+    if (a->queueChild != nullptr)
+    {
+        a->queueChild->queuePrev = b;
+    }
+    a->queueChild = b;
+    return a;
+}
+
+ReliableMessageMgr::RetransTableEntry * ReliableMessageMgr::MergeQueuePairs(RetransTableEntry * first)
+{
+    // Meld the siblings two by two from left to right, stacking the results through queueSibling, then meld the stack.
+    RetransTableEntry * pairs = nullptr;
+    while (first != nullptr)
+    {
+        RetransTableEntry * a = first;
+        RetransTableEntry * b = a->queueSibling;
+        first                 = (b != nullptr) ? b->queueSibling : nullptr;
+
+        a->queuePrev = a->queueSibling = nullptr;
+        if (b != nullptr)
+        {
+            b->queuePrev = b->queueSibling = nullptr;
+        }
+
+        RetransTableEntry * melded = MeldQueues(a, b);
+        melded->queueSibling       = pairs;
+        pairs                      = melded;
+    }
+
+    RetransTableEntry * root = nullptr;
+    while (pairs != nullptr)
+    {
+        RetransTableEntry * next = pairs->queueSibling;
+        pairs->queueSibling      = nullptr;
+        root                     = MeldQueues(root, pairs);
+        pairs                    = next;
+    }
+    return root;
+}
+
+void ReliableMessageMgr::Schedule(RetransTableEntry & entry)
+{
+    entry.queueSequence = mNextQueueSequence++;
+    mRetransQueue       = MeldQueues(mRetransQueue, &entry);
+}
+
+void ReliableMessageMgr::Unschedule(RetransTableEntry & entry)
+{
+    VerifyOrReturn(IsScheduled(entry));
+
+    if (&entry == mRetransQueue)
+    {
+        mRetransQueue = MergeQueuePairs(entry.queueChild);
+    }
+    else
+    {
+        // Detach the subtree rooted at the entry, then put its children back into the queue.
+        if (entry.queuePrev->queueChild == &entry)
+        {
+            entry.queuePrev->queueChild = entry.queueSibling;
+        }
+        else
+        {
+            entry.queuePrev->queueSibling = entry.queueSibling;
+        }
+        if (entry.queueSibling != nullptr)
+        {
+            entry.queueSibling->queuePrev = entry.queuePrev;
+        }
+        mRetransQueue = MeldQueues(mRetransQueue, MergeQueuePairs(entry.queueChild));
+    }
+
+    entry.queueChild   = nullptr;
+    entry.queueSibling = nullptr;
+    entry.queuePrev    = nullptr;
+}
+
 #if CHIP_CONFIG_TEST
 int ReliableMessageMgr::TestGetCountRetransTable()
 {
@@ -67,6 +67,17 @@ public:
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
+
+    private:
+        friend class ReliableMessageMgr;
+
+        // Links of the pairing heap ordering the scheduled entries by nextRetransTime. queuePrev is the parent of a first
+        // child, or the previous sibling otherwise, and is only null for the root and for unscheduled entries.
+        RetransTableEntry * queueChild   = nullptr;
+        RetransTableEntry * queueSibling = nullptr;
+        RetransTableEntry * queuePrev    = nullptr;
+        uint32_t queueSequence           = 0; /**< Keeps entries with the same nextRetransTime in scheduling order. */
+        RetransTableEntry * nextInIndex  = nullptr; /**< Next entry in the same bucket of the per-exchange index. */
     };
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
@@ -76,7 +87,7 @@ public:
     void Shutdown();
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.  If an
+     * Iterate through active exchange contexts and the due retrans table entries.  If an
      * action needs to be triggered by ReliableMessageProtocol time facilities,
      * execute that action.
      */
@@ -126,8 +137,7 @@ public:
     void StartRetransmision(RetransTableEntry * entry);
 
     /**
-     *  Iterate through active exchange contexts and retrans table entries. Clear the entry matching
-     *  the specified ExchangeContext and the message ID from the retransmision table.
+     *  Clear the entry matching the specified ExchangeContext and the message ID from the retransmision table.
      *
      *  @param[in]    rc                 A pointer to the ExchangeContext object.
      *  @param[in]    ackMessageCounter  The acknowledged message counter of the received packet.
@@ -162,7 +172,7 @@ public:
     void ClearRetransTable(RetransTableEntry & rEntry);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
+     * Iterate through active exchange contexts and look at the earliest retrans table entry.
      * Determine how many ReliableMessageProtocol ticks we need to sleep before we
      * need to physically wake the CPU to perform an action.  Set a timer to go off
      * when we next need to wake the system.
@@ -240,6 +250,21 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    /**
+     * Remove the entry from the deadline queue and from the exchange index, then release it. This does not restart the timer.
+     */
+    void ReleaseRetransEntry(RetransTableEntry & entry);
+
+    RetransTableEntry *& IndexBucketFor(const ExchangeContext & ec);
+    RetransTableEntry * FindRetransEntry(ReliableMessageContext * rc);
+
+    static bool RetransmitsBefore(const RetransTableEntry & a, const RetransTableEntry & b);
+    static RetransTableEntry * MeldQueues(RetransTableEntry * a, RetransTableEntry * b);
+    static RetransTableEntry * MergeQueuePairs(RetransTableEntry * first);
+    bool IsScheduled(const RetransTableEntry & entry) const { return &entry == mRetransQueue || entry.queuePrev != nullptr; }
+    void Schedule(RetransTableEntry & entry);
+    void Unschedule(RetransTableEntry & entry);
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -263,6 +288,16 @@ private:
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+    // Root of the pairing heap of the entries waiting for a retransmission, earliest nextRetransTime first. Entries are only
+    // queued once StartRetransmision has computed their first retransmission time.
+    RetransTableEntry * mRetransQueue = nullptr;
+    uint32_t mNextQueueSequence       = 0;
+
+    // An exchange has at most one message waiting for an acknowledgment, so the table is indexed by exchange in order to
+    // handle acknowledgments without scanning it.
+    static constexpr size_t kRetransIndexBuckets = CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE;
+    RetransTableEntry * mRetransIndex[kRetransIndexBuckets] = {};
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     ReliableMessageAnalyticsDelegate * mAnalyticsDelegate = nullptr;
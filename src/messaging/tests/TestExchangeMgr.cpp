@@ -22,6 +22,7 @@
  */
 #include <errno.h>
 #include <utility>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -100,6 +101,23 @@ public:
     bool IsOnResponseTimeoutCalled = false;
 };
 
+// Records the exchange each message is delivered on, and keeps that exchange open.
+class RecordingDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        LastExchange = ec;
+        ec->WillSendMessage();
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    ExchangeContext * LastExchange = nullptr;
+};
+
 class ExpireSessionFromTimeoutDelegate : public WaitForTimeoutDelegate
 {
     void OnResponseTimeout(ExchangeContext * ec) override
@@ -226,6 +244,132 @@ TEST_F(TestExchangeMgr, CheckUmhRegistrationTest)
     EXPECT_NE(err, CHIP_NO_ERROR);
 }
 
+TEST_F(TestExchangeMgr, CheckUmhPrefersMessageTypeHandler)
+{
+    MockAppDelegate protocolDelegate;
+    MockAppDelegate typeDelegate;
+
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &typeDelegate),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id, &protocolDelegate),
+              CHIP_NO_ERROR);
+
+    ExchangeContext * ec = NewExchangeToAlice(nullptr);
+    ASSERT_NE(ec, nullptr);
+    ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                    SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    DrainAndServiceIO();
+    EXPECT_TRUE(typeDelegate.IsOnMessageReceivedCalled);
+    EXPECT_FALSE(protocolDelegate.IsOnMessageReceivedCalled);
+
+    typeDelegate.IsOnMessageReceivedCalled = false;
+    ec                                     = NewExchangeToAlice(nullptr);
+    ASSERT_NE(ec, nullptr);
+    ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST2, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                    SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    DrainAndServiceIO();
+    EXPECT_FALSE(typeDelegate.IsOnMessageReceivedCalled);
+    EXPECT_TRUE(protocolDelegate.IsOnMessageReceivedCalled);
+
+    // Once the message type handler is gone, the protocol handler gets every message type.
+    EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1), CHIP_NO_ERROR);
+    protocolDelegate.IsOnMessageReceivedCalled = false;
+    ec                                         = NewExchangeToAlice(nullptr);
+    ASSERT_NE(ec, nullptr);
+    ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                    SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    DrainAndServiceIO();
+    EXPECT_FALSE(typeDelegate.IsOnMessageReceivedCalled);
+    EXPECT_TRUE(protocolDelegate.IsOnMessageReceivedCalled);
+
+    EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id), CHIP_NO_ERROR);
+}
+
+TEST_F(TestExchangeMgr, CheckUmhTableCapacity)
+{
+    MockAppDelegate mockAppDelegate;
+    ExchangeManager & exchangeManager = GetExchangeManager();
+
+    // Fill the table, registering in descending order so that every handler is inserted before the existing ones.
+    uint8_t registered = 0;
+    while (exchangeManager.RegisterUnsolicitedMessageHandlerForType(Protocols::Echo::Id, static_cast<uint8_t>(200 - registered),
+                                                                    &mockAppDelegate) == CHIP_NO_ERROR)
+    {
+        registered++;
+        ASSERT_LE(registered, CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS);
+    }
+    EXPECT_GT(registered, 0);
+
+    // Registering an existing handler again replaces it and needs no new slot.
+    EXPECT_EQ(exchangeManager.RegisterUnsolicitedMessageHandlerForType(Protocols::Echo::Id, 200, &mockAppDelegate), CHIP_NO_ERROR);
+    EXPECT_EQ(exchangeManager.RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Echo::Id, &mockAppDelegate),
+              CHIP_ERROR_TOO_MANY_UNSOLICITED_MESSAGE_HANDLERS);
+
+    for (uint8_t i = 0; i < registered; i++)
+    {
+        EXPECT_EQ(exchangeManager.UnregisterUnsolicitedMessageHandlerForType(Protocols::Echo::Id, static_cast<uint8_t>(200 - i)),
+                  CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(exchangeManager.UnregisterUnsolicitedMessageHandlerForType(Protocols::Echo::Id, 200),
+              CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER);
+}
+
+// Deliver a response on the given exchange directly through the message delegate of the exchange manager.
+void DeliverResponse(ExchangeManager & exchangeManager, ExchangeContext * ec)
+{
+    PacketHeader packetHeader;
+    packetHeader.SetSessionId(1);
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(ec->GetExchangeId()).SetInitiator(false).SetMessageType(Protocols::BDX::Id, kMsgType_TEST1);
+
+    static_cast<SessionMessageDelegate &>(exchangeManager)
+        .OnMessageReceived(packetHeader, payloadHeader, ec->GetSessionHandle(), SessionMessageDelegate::DuplicateMessage::No,
+                           System::PacketBufferHandle::New(0));
+}
+
+TEST_F(TestExchangeMgr, CheckDispatchWithManyExchanges)
+{
+    constexpr size_t kExchanges = 64;
+
+    RecordingDelegate delegate;
+    std::vector<ExchangeContext *> exchanges;
+    for (size_t i = 0; i < kExchanges; i++)
+    {
+        ExchangeContext * ec = NewExchangeToBob(&delegate);
+        if (ec == nullptr)
+        {
+            break;
+        }
+        exchanges.push_back(ec);
+    }
+    ASSERT_GT(exchanges.size(), 1u);
+
+    // Close every other exchange, so that the index has to handle removals from the middle of its buckets.
+    for (size_t i = 0; i < exchanges.size(); i += 2)
+    {
+        exchanges[i]->Close();
+        exchanges[i] = nullptr;
+    }
+
+    for (ExchangeContext * ec : exchanges)
+    {
+        if (ec != nullptr)
+        {
+            delegate.LastExchange = nullptr;
+            DeliverResponse(GetExchangeManager(), ec);
+            EXPECT_EQ(delegate.LastExchange, ec);
+        }
+    }
+
+    for (ExchangeContext * ec : exchanges)
+    {
+        if (ec != nullptr)
+        {
+            ec->Close();
+        }
+    }
+}
+
 TEST_F(TestExchangeMgr, CheckExchangeMessages)
 {
     CHIP_ERROR err;
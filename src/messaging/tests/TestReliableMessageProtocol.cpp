@@ -21,7 +21,9 @@
  *      This file implements unit tests for the ReliableMessageProtocol
  *      implementation.
  */
+#include <algorithm>
 #include <queue>
+#include <vector>
 
 #include <errno.h>
 
@@ -372,6 +374,128 @@ TEST_F(TestReliableMessageProtocol, CheckAddClearRetrans)
     exchange->Close();
 }
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP && !CHIP_SYSTEM_CONFIG_USE_LWIP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE == 0
+// Exchanges, retransmission entries and packet buffers are all allocated from the heap.
+constexpr size_t kInFlightMessages = 2000;
+#else
+// Half of the exchanges send, the other half is left for the ephemeral exchanges acknowledging them.
+constexpr size_t kInFlightMessages = std::min<size_t>(CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE) / 2;
+#endif
+
+TEST_F(TestReliableMessageProtocol, CheckManyInFlightMessages)
+{
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    // Leave enough time to send every message before the first retransmission.
+    GetSessionBobToAlice()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        1000_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        1000_ms32, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+
+    // Drop the initial transmission of every message.
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = kInFlightMessages;
+    loopback.mDroppedMessageCount = 0;
+
+    std::vector<ExchangeContext *> exchanges(kInFlightMessages);
+    for (auto *& exchange : exchanges)
+    {
+        exchange = NewExchangeToAlice(&mockSender);
+        ASSERT_NE(exchange, nullptr);
+
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(buffer.IsNull());
+        EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendMessageFlags::kExpectResponse),
+                  CHIP_NO_ERROR);
+    }
+    DrainAndServiceIO();
+
+    EXPECT_EQ(loopback.mDroppedMessageCount, kInFlightMessages);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kInFlightMessages));
+
+    // Acknowledgments only match the pending message of their own exchange.
+    uint32_t firstMessageCounter = 0;
+    rm->EnumerateRetransTable([&](auto * entry) {
+        if (&entry->ec.Get() == exchanges[0])
+        {
+            firstMessageCounter = entry->retainedBuf.GetMessageCounter();
+        }
+        return Loop::Continue;
+    });
+    EXPECT_FALSE(rm->CheckAndRemRetransTable(exchanges[0], firstMessageCounter + 1));
+    EXPECT_FALSE(rm->CheckAndRemRetransTable(exchanges[1], firstMessageCounter));
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kInFlightMessages));
+
+    // Clearing one exchange leaves the other messages scheduled.
+    rm->ClearRetransTable(exchanges[kInFlightMessages / 2]);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kInFlightMessages - 1));
+
+    // The retransmissions go through and get acknowledged.
+    GetIOContext().DriveIOUntil(5000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    DrainAndServiceIO();
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_EQ(loopback.mDroppedMessageCount, kInFlightMessages);
+
+    for (auto * exchange : exchanges)
+    {
+        exchange->Close();
+    }
+}
+
+TEST_F(TestReliableMessageProtocol, CheckAckWithManyInFlightMessages)
+{
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    // Park all but one of the in-flight messages on a lossy link, with a retry interval long enough for them to stay in the
+    // retransmission table while the remaining exchange sends and gets acknowledgments.
+    GetSessionBobToAlice()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        System::Clock::Milliseconds32(60000), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        System::Clock::Milliseconds32(60000), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+
+    auto & loopback               = GetLoopback();
+    loopback.mNumMessagesToDrop   = kInFlightMessages - 1;
+    loopback.mDroppedMessageCount = 0;
+
+    for (size_t i = 0; i + 1 < kInFlightMessages; i++)
+    {
+        ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+        ASSERT_NE(exchange, nullptr);
+
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(buffer.IsNull());
+        EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    }
+    DrainAndServiceIO();
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kInFlightMessages - 1));
+
+    // Messages sent meanwhile are acknowledged without disturbing the parked ones.
+    for (int i = 0; i < 8; i++)
+    {
+        ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+        ASSERT_NE(exchange, nullptr);
+
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(buffer.IsNull());
+        EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+        EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kInFlightMessages - 1));
+    }
+    EXPECT_EQ(loopback.mDroppedMessageCount, kInFlightMessages - 1);
+
+    rm->EnumerateRetransTable([&](auto * entry) {
+        rm->ClearRetransTable(*entry);
+        return Loop::Continue;
+    });
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+}
+
 /**
  * Tests MRP retransmission logic with the following scenario:
  *
@@ -19,33 +19,70 @@
 /**
  *    @file
  *      This file defines the CHIP device event queue which operates in a FIFO context (first-in first-out),
- *      and provides a specific set of member functions to access its elements wth thread safety.
+ *      and lets any thread post events to the CHIP event loop without locking.
  */
 
 #include <platform/DeviceSafeQueue.h>
 
+#include <lib/support/CodeUtils.h>
+
+#include <new>
+
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
-void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
+DeviceSafeQueue::~DeviceSafeQueue()
+{
+    while (!Empty())
+    {
+        PopFront();
+    }
+}
+
+CHIP_ERROR DeviceSafeQueue::Push(const ChipDeviceEvent & event, bool & wasEmpty)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    Node * node = new (std::nothrow) Node{ event, nullptr };
+    VerifyOrReturnError(node != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // Once the exchange succeeds the event loop may take, pop and free node at any time, so
+    // only the local copy of the previous head may be looked at afterwards.
+    Node * head = mPushed.load(std::memory_order_relaxed);
+    do
+    {
+        node->mNext = head;
+    } while (!mPushed.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+
+    wasEmpty = (head == nullptr);
+    return CHIP_NO_ERROR;
 }
 
 bool DeviceSafeQueue::Empty()
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    if (mPopped == nullptr)
+    {
+        // Take everything pushed so far and reverse it into dispatch order.
+        Node * node = mPushed.exchange(nullptr, std::memory_order_acquire);
+        while (node != nullptr)
+        {
+            Node * next = node->mNext;
+            node->mNext = mPopped;
+            mPopped     = node;
+            node        = next;
+        }
+    }
+
+    return mPopped == nullptr;
 }
 
 ChipDeviceEvent DeviceSafeQueue::PopFront()
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
+    VerifyOrDie(!Empty());
 
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
+    Node * node                 = mPopped;
+    const ChipDeviceEvent event = node->mEvent;
+    mPopped                     = node->mNext;
+    delete node;
 
     return event;
 }
@@ -19,13 +19,12 @@
 /**
  *    @file
  *      This file declares the CHIP device event queue which operates in a FIFO context (first-in first-out),
- *      and provides a specific set of member functions to access its elements wth thread safety.
+ *      and lets any thread post events to the CHIP event loop without locking.
  */
 
 #pragma once
 
-#include <mutex>
-#include <queue>
+#include <atomic>
 
 #include <lib/core/CHIPCore.h>
 #include <platform/CHIPDeviceConfig.h>
@@ -39,24 +38,43 @@ namespace Internal {
  *  @class DeviceSafeQueue
  *
  *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
- *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
- *      and then an action is performed.
+ *      This class represents the message queue used by the CHIP event loop to hold incoming messages. Any number of
+ *      threads may Push() concurrently without blocking each other or the event loop; only the event loop thread may
+ *      call Empty() and PopFront().
+ *
+ *      Pushed events are linked into a lock-free stack. When the event loop runs out of events it takes the whole
+ *      stack in one atomic exchange and reverses it, so events are dispatched in batches, and the events pushed by
+ *      any one thread are dispatched in the order they were pushed.
  *
  */
 class DeviceSafeQueue
 {
 public:
-    DeviceSafeQueue()  = default;
-    ~DeviceSafeQueue() = default;
+    DeviceSafeQueue() = default;
+    ~DeviceSafeQueue();
 
-    void Push(const ChipDeviceEvent & event);
+    /**
+     * Queue a copy of @p event. May be called from any thread.
+     *
+     * @param[out] wasEmpty  Set to true if the event loop had already taken every event pushed before this one,
+     *                       in which case it may have to be woken up to see it. Otherwise, whoever pushed the
+     *                       oldest event still queued got true and is responsible for the wake up.
+     */
+    CHIP_ERROR Push(const ChipDeviceEvent & event, bool & wasEmpty);
     bool Empty();
     ChipDeviceEvent PopFront();
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    struct Node
+    {
+        ChipDeviceEvent mEvent;
+        Node * mNext;
+    };
+
+    // Pushed and not yet taken by the event loop, newest first.
+    std::atomic<Node *> mPushed{ nullptr };
+    // Taken by the event loop and not yet popped, oldest first. Only accessed by the event loop.
+    Node * mPopped = nullptr;
 
     DeviceSafeQueue(const DeviceSafeQueue &)             = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
@@ -54,6 +54,37 @@
 // These are configuration options that are unique to Linux platforms.
 // These can be overridden by the application as needed.
 
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+ *
+ * Keep the KeyValueStoreManager data in an append-only log (see ChipLinuxStorageLog) instead of an
+ * INI file. An INI store found at the KVS path is converted to a log by KeyValueStoreManagerImpl::Init().
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_SYNC_INTERVAL_MS
+ *
+ * Minimum interval between two syncs of the KVS log to the storage device. With the default of 0,
+ * every write is synced before it completes. Larger values batch the syncs of frequent writes, at
+ * the cost of losing the writes of the last interval on power loss.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_SYNC_INTERVAL_MS
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_SYNC_INTERVAL_MS 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_SYNC_INTERVAL_MS
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_MIN_SIZE
+ *
+ * Size in bytes the KVS log must reach before it is compacted. Above that size, the log is compacted
+ * once stale records take more than half of it.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_MIN_SIZE
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_MIN_SIZE (64 * 1024)
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_MIN_SIZE
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
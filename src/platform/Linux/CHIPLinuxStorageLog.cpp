@@ -0,0 +1,575 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides a key-value store kept in an append-only log file on Linux platforms.
+ *
+ *          The log starts with an 8-byte file identifier, followed by records made of the
+ *          following little-endian fields:
+ *
+ *            uint32_t  CRC-32 of the rest of the record
+ *            uint8_t   record type: 1 to set a value, 2 to delete it
+ *            uint16_t  key length
+ *            uint32_t  value length, 0 for deletions
+ *            key bytes, followed by value bytes
+ *
+ */
+
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <inipp/inipp.h>
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/IniEscaping.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceConfig.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <fstream>
+#include <limits>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr uint8_t kFileIdentifier[8] = { 'C', 'H', 'I', 'P', 'K', 'V', 'L', '1' };
+
+constexpr uint8_t kRecordTypePut    = 1;
+constexpr uint8_t kRecordTypeDelete = 2;
+
+// CRC, type, key length and value length
+constexpr size_t kRecordHeaderSize = 4 + 1 + 2 + 4;
+constexpr size_t kRecordCrcSize    = 4;
+
+uint32_t Crc32(const uint8_t * data, size_t length)
+{
+    // Nibble-wise CRC-32 (IEEE 802.3), to keep the table small
+    static constexpr uint32_t kTable[16] = { 0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4,
+                                             0x4db26158, 0x5005713c, 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+                                             0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c };
+
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc = (crc >> 4) ^ kTable[(crc ^ data[i]) & 0x0f];
+        crc = (crc >> 4) ^ kTable[(crc ^ (static_cast<uint32_t>(data[i]) >> 4)) & 0x0f];
+    }
+    return ~crc;
+}
+
+size_t RecordSize(size_t key_size, size_t value_size)
+{
+    return kRecordHeaderSize + key_size + value_size;
+}
+
+// Appends a record to the buffer
+void EncodeRecord(std::vector<uint8_t> & buffer, uint8_t type, const std::string & key, const uint8_t * value, size_t value_size)
+{
+    const size_t start = buffer.size();
+    buffer.resize(start + RecordSize(key.size(), value_size));
+
+    uint8_t * record = buffer.data() + start;
+    Encoding::LittleEndian::BufferWriter writer(record + kRecordCrcSize, buffer.size() - start - kRecordCrcSize);
+    writer.Put8(type).Put16(static_cast<uint16_t>(key.size())).Put32(static_cast<uint32_t>(value_size));
+    writer.Put(key.data(), key.size());
+    if (value_size > 0)
+    {
+        writer.Put(value, value_size);
+    }
+    VerifyOrDie(writer.Fit());
+
+    Encoding::LittleEndian::Put32(record, Crc32(record + kRecordCrcSize, writer.Needed()));
+}
+
+CHIP_ERROR WriteAll(int fd, const uint8_t * data, size_t length, off_t offset)
+{
+    while (length > 0)
+    {
+        ssize_t written = pwrite(fd, data, length, offset);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(written > 0, CHIP_ERROR_POSIX(written < 0 ? errno : EIO));
+        data += written;
+        length -= static_cast<size_t>(written);
+        offset += written;
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Makes a rename into the directory holding the given path durable
+void SyncParentDirectory(const std::string & path)
+{
+    const size_t slash    = path.rfind('/');
+    const std::string dir = (slash == std::string::npos) ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+
+    FileDescriptor fd(open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (fd.Get() == -1 || fsync(fd.Get()) != 0)
+    {
+        // The file is complete either way: if the rename is lost, the file it replaced is found again.
+        ChipLogError(DeviceLayer, "Failed to sync directory %s: %s", dir.c_str(), strerror(errno));
+    }
+}
+
+CHIP_ERROR ReadAll(int fd, std::vector<uint8_t> & data)
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(fd, &st) == 0, CHIP_ERROR_POSIX(errno));
+    data.resize(static_cast<size_t>(st.st_size));
+
+    size_t offset = 0;
+    while (offset < data.size())
+    {
+        ssize_t read = pread(fd, data.data() + offset, data.size() - offset, static_cast<off_t>(offset));
+        if (read < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(read >= 0, CHIP_ERROR_POSIX(errno));
+        if (read == 0)
+        {
+            break;
+        }
+        offset += static_cast<size_t>(read);
+    }
+    data.resize(offset);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR ChipLinuxStorageLog::Init(const char * path, System::Clock::Milliseconds32 syncInterval, System::Layer * systemLayer)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Shutdown();
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    mFd = FileDescriptor(open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600));
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to open KVS log %s: %s", path, strerror(errno)));
+
+    mPath         = path;
+    mSyncInterval = syncInterval;
+    mSyncPending  = false;
+    mLastSync     = System::SystemClock().GetMonotonicTimestamp();
+    mSystemLayer  = systemLayer;
+
+    CHIP_ERROR err = Load();
+    if (err != CHIP_NO_ERROR)
+    {
+        mFd.Close();
+        mValues.clear();
+    }
+    return err;
+}
+
+void ChipLinuxStorageLog::Shutdown()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturn(mFd.Get() != -1);
+
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleSyncTimer, this);
+        mSystemLayer = nullptr;
+    }
+
+    if (mSyncPending && fdatasync(mFd.Get()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to sync KVS log %s: %s", mPath.c_str(), strerror(errno));
+    }
+    mFd.Close();
+    mValues.clear();
+    mSyncPending = false;
+    mLogSize     = 0;
+    mLiveSize    = 0;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Load()
+{
+    std::vector<uint8_t> data;
+    ReturnErrorOnFailure(ReadAll(mFd.Get(), data));
+
+    mValues.clear();
+
+    if (data.empty())
+    {
+        ReturnErrorOnFailure(WriteAll(mFd.Get(), kFileIdentifier, sizeof(kFileIdentifier), 0));
+        VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_POSIX(errno));
+        mLogSize  = sizeof(kFileIdentifier);
+        mLiveSize = mLogSize;
+        return CHIP_NO_ERROR;
+    }
+
+    bool isLog = data.size() >= sizeof(kFileIdentifier) && memcmp(data.data(), kFileIdentifier, sizeof(kFileIdentifier)) == 0;
+    VerifyOrReturnError(isLog, CHIP_ERROR_INVALID_FILE_IDENTIFIER, ChipLogError(DeviceLayer, "%s is not a KVS log", mPath.c_str()));
+
+    size_t offset = sizeof(kFileIdentifier);
+    while (data.size() - offset >= kRecordHeaderSize)
+    {
+        const uint8_t * record = data.data() + offset;
+        Encoding::LittleEndian::Reader reader(record, kRecordHeaderSize);
+        uint32_t crc;
+        uint8_t type;
+        uint16_t key_size;
+        uint32_t value_size;
+        VerifyOrDie(reader.Read32(&crc).Read8(&type).Read16(&key_size).Read32(&value_size).IsSuccess());
+
+        if (static_cast<size_t>(key_size) + value_size > data.size() - offset - kRecordHeaderSize)
+        {
+            break;
+        }
+        const size_t record_size = RecordSize(key_size, value_size);
+        if (crc != Crc32(record + kRecordCrcSize, record_size - kRecordCrcSize))
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(record + kRecordHeaderSize), key_size);
+        const uint8_t * value = record + kRecordHeaderSize + key_size;
+        if (type == kRecordTypePut)
+        {
+            mValues[std::move(key)].assign(value, value + value_size);
+        }
+        else if (type == kRecordTypeDelete)
+        {
+            mValues.erase(key);
+        }
+        else
+        {
+            break;
+        }
+        offset += record_size;
+    }
+
+    if (offset < data.size())
+    {
+        // Incomplete or corrupted records are dropped, so that new records are not appended after them
+        ChipLogError(DeviceLayer, "Discarding %u bytes at the end of KVS log %s", static_cast<unsigned>(data.size() - offset),
+                     mPath.c_str());
+        VerifyOrReturnError(ftruncate(mFd.Get(), static_cast<off_t>(offset)) == 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_POSIX(errno));
+    }
+
+    mLogSize  = offset;
+    mLiveSize = sizeof(kFileIdentifier);
+    for (const auto & entry : mValues)
+    {
+        mLiveSize += RecordSize(entry.first.size(), entry.second.size());
+    }
+
+    ChipLogDetail(DeviceLayer, "Loaded %u values from KVS log %s", static_cast<unsigned>(mValues.size()), mPath.c_str());
+
+    CompactIfNeeded();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size, size_t offset)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(value != nullptr || value_size == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = mValues.find(key);
+    VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    const std::vector<uint8_t> & stored = it->second;
+    VerifyOrReturnError(offset <= stored.size(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t total_size_to_read = stored.size() - offset;
+    size_t copy_size          = std::min(value_size, total_size_to_read);
+    if (read_bytes_size != nullptr)
+    {
+        *read_bytes_size = copy_size;
+    }
+    if (copy_size > 0)
+    {
+        memcpy(value, stored.data() + offset, copy_size);
+    }
+
+    return (value_size < total_size_to_read) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Put(const char * key, const void * value, size_t value_size)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(value != nullptr || value_size == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(value_size <= std::numeric_limits<uint32_t>::max(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::string keyString(key);
+    VerifyOrReturnError(keyString.size() <= std::numeric_limits<uint16_t>::max(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+
+    const uint8_t * bytes = static_cast<const uint8_t *>(value);
+    auto it               = mValues.find(keyString);
+    if (it != mValues.end())
+    {
+        if (it->second.size() == value_size && (value_size == 0 || memcmp(it->second.data(), bytes, value_size) == 0))
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    ReturnErrorOnFailure(Append(kRecordTypePut, keyString, bytes, value_size));
+
+    if (it != mValues.end())
+    {
+        mLiveSize -= RecordSize(keyString.size(), it->second.size());
+        it->second.assign(bytes, bytes + value_size);
+    }
+    else
+    {
+        mValues.emplace(keyString, std::vector<uint8_t>(bytes, bytes + value_size));
+    }
+    mLiveSize += RecordSize(keyString.size(), value_size);
+
+    CompactIfNeeded();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Delete(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = mValues.find(key);
+    VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    ReturnErrorOnFailure(Append(kRecordTypeDelete, it->first, nullptr, 0));
+
+    mLiveSize -= RecordSize(it->first.size(), it->second.size());
+    mValues.erase(it);
+
+    CompactIfNeeded();
+    return CHIP_NO_ERROR;
+}
+
+bool ChipLinuxStorageLog::HasValue(const char * key)
+{
+    VerifyOrReturnValue(key != nullptr, false);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    return mValues.find(key) != mValues.end();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Append(uint8_t type, const std::string & key, const uint8_t * value, size_t value_size)
+{
+    mRecord.clear();
+    EncodeRecord(mRecord, type, key, value, value_size);
+
+    CHIP_ERROR err = WriteAll(mFd.Get(), mRecord.data(), mRecord.size(), static_cast<off_t>(mLogSize));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to write KVS log %s: %" CHIP_ERROR_FORMAT, mPath.c_str(), err.Format());
+        // Drop any partially written record
+        if (ftruncate(mFd.Get(), static_cast<off_t>(mLogSize)) != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to truncate KVS log %s: %s", mPath.c_str(), strerror(errno));
+        }
+        return err;
+    }
+    mLogSize += mRecord.size();
+
+    const bool syncWasPending = mSyncPending;
+    mSyncPending              = true;
+    ReturnErrorOnFailure(SyncIfDue());
+
+    // Later writes within the interval are covered by the timer started for the first one
+    if (mSyncPending && !syncWasPending)
+    {
+        StartSyncTimer();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::SyncIfDue()
+{
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    VerifyOrReturnError(mSyncInterval == System::Clock::kZero || now - mLastSync >= mSyncInterval, CHIP_NO_ERROR);
+
+    VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_POSIX(errno),
+                        ChipLogError(DeviceLayer, "Failed to sync KVS log %s: %s", mPath.c_str(), strerror(errno)));
+    mSyncPending = false;
+    mLastSync    = now;
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageLog::StartSyncTimer()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    const System::Clock::Timestamp elapsed = System::SystemClock().GetMonotonicTimestamp() - mLastSync;
+    System::Clock::Timeout delay           = System::Clock::kZero;
+    if (elapsed < mSyncInterval)
+    {
+        delay = std::chrono::duration_cast<System::Clock::Timeout>(mSyncInterval - elapsed);
+    }
+
+    // E.g. before the stack is initialized; the next write after the interval will sync instead
+    CHIP_ERROR err = mSystemLayer->StartTimer(delay, HandleSyncTimer, this);
+    VerifyOrReturn(err == CHIP_NO_ERROR,
+                   ChipLogDetail(DeviceLayer, "Cannot schedule sync of KVS log %s: %" CHIP_ERROR_FORMAT, mPath.c_str(),
+                                 err.Format()));
+}
+
+void ChipLinuxStorageLog::HandleSyncTimer(System::Layer * systemLayer, void * appState)
+{
+    // Sync() logs its failures, and a log that was closed meanwhile has nothing left to sync
+    static_cast<ChipLinuxStorageLog *>(appState)->Sync();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Sync()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mSyncPending, CHIP_NO_ERROR);
+
+    VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_POSIX(errno),
+                        ChipLogError(DeviceLayer, "Failed to sync KVS log %s: %s", mPath.c_str(), strerror(errno)));
+    mSyncPending = false;
+    mLastSync    = System::SystemClock().GetMonotonicTimestamp();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+
+    ReturnErrorOnFailure(WriteSnapshot(mPath, mValues, &mFd));
+
+    // The snapshot was synced, along with anything pending in the replaced log
+    mLogSize     = mLiveSize;
+    mSyncPending = false;
+    mLastSync    = System::SystemClock().GetMonotonicTimestamp();
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageLog::CompactIfNeeded()
+{
+    VerifyOrReturn(mLogSize >= CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_MIN_SIZE && mLogSize / 2 > mLiveSize);
+
+    CHIP_ERROR err = WriteSnapshot(mPath, mValues, &mFd);
+    VerifyOrReturn(err == CHIP_NO_ERROR,
+                   ChipLogError(DeviceLayer, "Failed to compact KVS log %s: %" CHIP_ERROR_FORMAT, mPath.c_str(), err.Format()));
+
+    ChipLogDetail(DeviceLayer, "Compacted KVS log %s from %u to %u bytes", mPath.c_str(), static_cast<unsigned>(mLogSize),
+                  static_cast<unsigned>(mLiveSize));
+    mLogSize     = mLiveSize;
+    mSyncPending = false;
+    mLastSync    = System::SystemClock().GetMonotonicTimestamp();
+}
+
+// Writes a log holding the given values to a temporary file, then atomically replaces the file at the given path with it.
+// On success, the file descriptor of the new log is returned in fdOut if it is not null.
+CHIP_ERROR ChipLinuxStorageLog::WriteSnapshot(const std::string & path, const ValueMap & values, FileDescriptor * fdOut)
+{
+    std::string tmpPath = path + "-XXXXXX";
+    FileDescriptor fd(mkostemp(tmpPath.data(), O_CLOEXEC));
+    VerifyOrReturnError(fd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", tmpPath.c_str(), strerror(errno)));
+
+    std::vector<uint8_t> data(kFileIdentifier, kFileIdentifier + sizeof(kFileIdentifier));
+    for (const auto & entry : values)
+    {
+        EncodeRecord(data, kRecordTypePut, entry.first, entry.second.data(), entry.second.size());
+    }
+
+    CHIP_ERROR err = WriteAll(fd.Get(), data.data(), data.size(), 0);
+    if (err == CHIP_NO_ERROR && fdatasync(fd.Get()) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    if (err == CHIP_NO_ERROR && rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to write %s: %" CHIP_ERROR_FORMAT, tmpPath.c_str(), err.Format());
+        unlink(tmpPath.c_str());
+        return err;
+    }
+    SyncParentDirectory(path);
+
+    if (fdOut != nullptr)
+    {
+        *fdOut = std::move(fd);
+    }
+    return CHIP_NO_ERROR;
+}
+
+bool ChipLinuxStorageLog::IsLogFile(const char * path)
+{
+    FileDescriptor fd(open(path, O_RDONLY | O_CLOEXEC));
+    VerifyOrReturnValue(fd.Get() != -1, false);
+
+    uint8_t identifier[sizeof(kFileIdentifier)];
+    ssize_t read = pread(fd.Get(), identifier, sizeof(identifier), 0);
+    return read == static_cast<ssize_t>(sizeof(identifier)) && memcmp(identifier, kFileIdentifier, sizeof(identifier)) == 0;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::MigrateFromIni(const char * iniPath, const char * logPath)
+{
+    VerifyOrReturnError(iniPath != nullptr && logPath != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::ifstream ifs(iniPath, std::ifstream::in);
+    VerifyOrReturnError(ifs.is_open(), CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to open config file: %s", iniPath));
+
+    inipp::Ini<char> ini;
+    ini.parse(ifs);
+
+    // Values of the KVS are stored base64-encoded under escaped keys in the default section
+    ValueMap values;
+    for (const auto & entry : ini.sections["DEFAULT"])
+    {
+        std::string value = IniEscaping::Base64ToString(entry.second);
+        VerifyOrReturnError(value.size() <= std::numeric_limits<uint32_t>::max(), CHIP_ERROR_INVALID_ARGUMENT);
+        values.emplace(IniEscaping::UnescapeKey(entry.first), std::vector<uint8_t>(value.begin(), value.end()));
+    }
+
+    ReturnErrorOnFailure(WriteSnapshot(logPath, values, nullptr));
+    ChipLogProgress(DeviceLayer, "Migrated %u values from %s to KVS log %s", static_cast<unsigned>(values.size()), iniPath,
+                    logPath);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,143 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides a key-value store kept in an append-only log file, used as the
+ *          backend of the KeyValueStoreManager on Linux platforms.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/FileDescriptor.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+/**
+ * Key-value store kept in an append-only log file.
+ *
+ * Every change appends a single record to the log, so the cost of a write does not depend on the
+ * size of the store. Values are stored in binary form, and reads are served from an in-memory
+ * index of the live values without accessing the file. Writes that would not change the stored
+ * value are skipped.
+ *
+ * Each record carries a CRC-32, so a record that was only partially written, e.g. because of a
+ * crash or power loss, is detected on Init() and discarded along with anything following it.
+ * Once stale records make up most of the log, the live values are rewritten to a temporary file
+ * that atomically replaces the log.
+ *
+ * Writes are synced to the storage device before returning unless a sync interval is set, in
+ * which case writes following a sync within the interval are only synced once the interval has
+ * passed: by a timer if Init() was given a System::Layer, otherwise by the next write. Sync() and
+ * Shutdown() also sync them. They may be lost on power loss, but the log stays consistent.
+ */
+class ChipLinuxStorageLog
+{
+public:
+    ChipLinuxStorageLog() = default;
+    ~ChipLinuxStorageLog() { Shutdown(); }
+
+    ChipLinuxStorageLog(const ChipLinuxStorageLog &)             = delete;
+    ChipLinuxStorageLog & operator=(const ChipLinuxStorageLog &) = delete;
+
+    /**
+     * @brief Open the log at the given path, creating an empty one if the file does not exist.
+     *
+     * If systemLayer is not null, writes deferred by the sync interval are synced by a timer on it,
+     * so Put() and Delete() must then be called with the Matter stack lock held.
+     *
+     * @retval CHIP_ERROR_INVALID_FILE_IDENTIFIER if the file exists but is not a log (see MigrateFromIni()).
+     */
+    CHIP_ERROR Init(const char * path, System::Clock::Milliseconds32 syncInterval = System::Clock::kZero,
+                    System::Layer * systemLayer = nullptr);
+
+    /// Sync any pending writes and close the log.
+    void Shutdown();
+
+    /// Read a value, with the same semantics as KeyValueStoreManager::Get().
+    CHIP_ERROR Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size = nullptr, size_t offset = 0);
+    CHIP_ERROR Put(const char * key, const void * value, size_t value_size);
+    CHIP_ERROR Delete(const char * key);
+    bool HasValue(const char * key);
+
+    /// Sync writes that were deferred by the sync interval to the storage device.
+    CHIP_ERROR Sync();
+
+    /// Rewrite the log with only the live values.
+    CHIP_ERROR Compact();
+
+    /// Size of the log file in bytes, including stale records.
+    size_t GetLogSize() const { return mLogSize; }
+
+    /// Check whether the file at the given path exists and is a log.
+    static bool IsLogFile(const char * path);
+
+    /**
+     * @brief Write the values of the INI store used by the default Linux KeyValueStoreManager backend
+     *        to a new log.
+     *
+     * The log is written to a temporary file that then replaces logPath, which may be the same as
+     * iniPath to convert a store in place.
+     */
+    static CHIP_ERROR MigrateFromIni(const char * iniPath, const char * logPath);
+
+private:
+    using ValueMap = std::unordered_map<std::string, std::vector<uint8_t>>;
+
+    CHIP_ERROR Load();
+    CHIP_ERROR Append(uint8_t type, const std::string & key, const uint8_t * value, size_t value_size);
+    CHIP_ERROR SyncIfDue();
+    void StartSyncTimer();
+    void CompactIfNeeded();
+
+    static void HandleSyncTimer(System::Layer * systemLayer, void * appState);
+
+    static CHIP_ERROR WriteSnapshot(const std::string & path, const ValueMap & values, FileDescriptor * fdOut);
+
+    std::mutex mLock;
+    FileDescriptor mFd;
+    std::string mPath;
+    ValueMap mValues;
+
+    // Size of the log, and the part of it holding the records of the live values
+    size_t mLogSize  = 0;
+    size_t mLiveSize = 0;
+
+    System::Clock::Milliseconds32 mSyncInterval = System::Clock::kZero;
+    System::Clock::Timestamp mLastSync          = System::Clock::kZero;
+    bool mSyncPending                           = false;
+    System::Layer * mSystemLayer                = nullptr;
+
+    // Scratch buffer for encoding records
+    std::vector<uint8_t> mRecord;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -46,3 +46,8 @@
 
 // On linux platform, we have sys/socket.h, so HAVE_SO_BINDTODEVICE should be set to 1
 #define HAVE_SO_BINDTODEVICE 1
+
+// Drain several datagrams per wakeup with recvmmsg().
+#ifndef INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE 8
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
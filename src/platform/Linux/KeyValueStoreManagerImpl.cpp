@@ -25,9 +25,11 @@
 
 #include <algorithm>
 #include <string.h>
+#include <unistd.h>
 
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <platform/Linux/CHIPLinuxStorage.h>
 
 namespace chip {
@@ -36,6 +38,46 @@ namespace PersistedStorage {
 
 KeyValueStoreManagerImpl KeyValueStoreManagerImpl::sInstance;
 
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+
+CHIP_ERROR KeyValueStoreManagerImpl::Init(const char * file)
+{
+    VerifyOrReturnError(file != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Convert a store previously written by the INI backend
+    if (access(file, F_OK) == 0 && !Internal::ChipLinuxStorageLog::IsLogFile(file))
+    {
+        ReturnErrorOnFailure(Internal::ChipLinuxStorageLog::MigrateFromIni(file, file));
+    }
+
+    return mStorage.Init(file, System::Clock::Milliseconds32(CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_SYNC_INTERVAL_MS),
+                         &DeviceLayer::SystemLayer());
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
+                                          size_t offset_bytes)
+{
+    VerifyOrReturnError(value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    return mStorage.Get(key, value, value_size, read_bytes_size, offset_bytes);
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value, size_t value_size)
+{
+    return mStorage.Put(key, value, value_size);
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
+{
+    return mStorage.Delete(key);
+}
+
+#else
+
+CHIP_ERROR KeyValueStoreManagerImpl::Init(const char * file)
+{
+    return mStorage.Init(file);
+}
+
 CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
                                           size_t offset_bytes)
 {
@@ -110,6 +152,8 @@ exit:
     return err;
 }
 
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
@@ -23,7 +23,11 @@
 
 #pragma once
 
+#include <platform/CHIPDeviceConfig.h>
 #include <platform/Linux/CHIPLinuxStorage.h>
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+#endif
 
 namespace chip {
 namespace DeviceLayer {
@@ -36,14 +40,18 @@ public:
      * @brief
      * Initalize the KVS, must be called before using.
      */
-    CHIP_ERROR Init(const char * file) { return mStorage.Init(file); }
+    CHIP_ERROR Init(const char * file);
 
     CHIP_ERROR _Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size = nullptr, size_t offset = 0);
     CHIP_ERROR _Delete(const char * key);
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
 private:
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_STRUCTURED
+    DeviceLayer::Internal::ChipLinuxStorageLog mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+#endif
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
@@ -0,0 +1,260 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the log-structured key-value store of
+ *      the Linux platform.
+ */
+
+#include <stdio.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+class TestLinuxStorageLog : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mPath    = "/tmp/TestLinuxStorageLog-" + std::to_string(getpid());
+        mIniPath = mPath + ".ini";
+        unlink(mPath.c_str());
+        unlink(mIniPath.c_str());
+    }
+
+    void TearDown() override
+    {
+        mStore.Shutdown();
+        unlink(mPath.c_str());
+        unlink(mIniPath.c_str());
+    }
+
+    size_t FileSize(const std::string & path)
+    {
+        struct stat st;
+        return (stat(path.c_str(), &st) == 0) ? static_cast<size_t>(st.st_size) : 0;
+    }
+
+    std::string GetString(const char * key)
+    {
+        char value[64];
+        size_t size = 0;
+        VerifyOrReturnValue(mStore.Get(key, value, sizeof(value), &size) == CHIP_NO_ERROR, std::string());
+        return std::string(value, size);
+    }
+
+    CHIP_ERROR PutString(const char * key, const std::string & value) { return mStore.Put(key, value.data(), value.size()); }
+
+    std::string mPath;
+    std::string mIniPath;
+    ChipLinuxStorageLog mStore;
+};
+
+TEST_F(TestLinuxStorageLog, TestPutGetDelete)
+{
+    ASSERT_EQ(mStore.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_TRUE(ChipLinuxStorageLog::IsLogFile(mPath.c_str()));
+
+    uint8_t value[8];
+    size_t size = 0;
+    EXPECT_EQ(mStore.Get("a", value, sizeof(value), &size), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(mStore.Delete("a"), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    const uint8_t kValue[] = { 1, 2, 3, 4, 5 };
+    EXPECT_EQ(mStore.Put("a", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+    EXPECT_TRUE(mStore.HasValue("a"));
+    EXPECT_EQ(mStore.Get("a", value, sizeof(value), &size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, sizeof(kValue));
+    EXPECT_EQ(memcmp(value, kValue, sizeof(kValue)), 0);
+
+    // Partial and offset reads
+    EXPECT_EQ(mStore.Get("a", value, 2, &size, 1), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(size, 2u);
+    EXPECT_EQ(value[0], 2);
+    EXPECT_EQ(value[1], 3);
+    EXPECT_EQ(mStore.Get("a", value, sizeof(value), &size, 3), CHIP_NO_ERROR);
+    EXPECT_EQ(size, 2u);
+    EXPECT_EQ(value[0], 4);
+    EXPECT_EQ(mStore.Get("a", value, sizeof(value), &size, sizeof(kValue) + 1), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Empty values
+    EXPECT_EQ(mStore.Put("empty", nullptr, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(mStore.Get("empty", value, sizeof(value), &size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, 0u);
+
+    EXPECT_EQ(mStore.Delete("a"), CHIP_NO_ERROR);
+    EXPECT_FALSE(mStore.HasValue("a"));
+    EXPECT_EQ(mStore.Get("a", value, sizeof(value), &size), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+TEST_F(TestLinuxStorageLog, TestValuesPersist)
+{
+    ASSERT_EQ(mStore.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("a", "first"), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("b", "second"), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("a", "updated"), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("c", "deleted"), CHIP_NO_ERROR);
+    EXPECT_EQ(mStore.Delete("c"), CHIP_NO_ERROR);
+
+    // Writing the same value again does not grow the log
+    size_t logSize = mStore.GetLogSize();
+    EXPECT_EQ(logSize, FileSize(mPath));
+    EXPECT_EQ(PutString("b", "second"), CHIP_NO_ERROR);
+    EXPECT_EQ(mStore.GetLogSize(), logSize);
+    mStore.Shutdown();
+
+    ASSERT_EQ(mStore.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString("a"), "updated");
+    EXPECT_EQ(GetString("b"), "second");
+    EXPECT_FALSE(mStore.HasValue("c"));
+}
+
+TEST_F(TestLinuxStorageLog, TestIncompleteRecordsAreDiscarded)
+{
+    ASSERT_EQ(mStore.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("a", "first"), CHIP_NO_ERROR);
+    size_t logSize = mStore.GetLogSize();
+    EXPECT_EQ(PutString("b", "second"), CHIP_NO_ERROR);
+    mStore.Shutdown();
+
+    // Simulate a crash in the middle of writing the last record
+    ASSERT_EQ(truncate(mPath.c_str(), static_cast<off_t>(FileSize(mPath) - 3)), 0);
+
+    ASSERT_EQ(mStore.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString("a"), "first");
+    EXPECT_FALSE(mStore.HasValue("b"));
+    EXPECT_EQ(FileSize(mPath), logSize);
+
+    // New records follow the last complete one
+    EXPECT_EQ(PutString("b", "again"), CHIP_NO_ERROR);
+    mStore.Shutdown();
+
+    ASSERT_EQ(mStore.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString("a"), "first");
+    EXPECT_EQ(GetString("b"), "again");
+}
+
+TEST_F(TestLinuxStorageLog, TestCorruptedRecordsAreDiscarded)
+{
+    ASSERT_EQ(mStore.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("a", "first"), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("b", "second"), CHIP_NO_ERROR);
+    mStore.Shutdown();
+
+    // Flip a bit in the value of the last record
+    FILE * file = fopen(mPath.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fseek(file, -1, SEEK_END), 0);
+    int c = fgetc(file);
+    ASSERT_EQ(fseek(file, -1, SEEK_END), 0);
+    fputc(c ^ 0x01, file);
+    fclose(file);
+
+    ASSERT_EQ(mStore.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString("a"), "first");
+    EXPECT_FALSE(mStore.HasValue("b"));
+}
+
+TEST_F(TestLinuxStorageLog, TestCompaction)
+{
+    ASSERT_EQ(mStore.Init(mPath.c_str(), System::Clock::Milliseconds32(60000)), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("constant", "value"), CHIP_NO_ERROR);
+
+    uint8_t value[256];
+    for (uint32_t i = 0; i < 2000; i++)
+    {
+        memset(value, static_cast<int>(i), sizeof(value));
+        ASSERT_EQ(mStore.Put("counter", value, sizeof(value)), CHIP_NO_ERROR);
+    }
+
+    // The stale records are dropped once they make up most of the log
+    EXPECT_LE(mStore.GetLogSize(), static_cast<size_t>(CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_MIN_SIZE));
+    EXPECT_EQ(mStore.GetLogSize(), FileSize(mPath));
+
+    EXPECT_EQ(mStore.Compact(), CHIP_NO_ERROR);
+    EXPECT_LT(mStore.GetLogSize(), 2 * sizeof(value));
+    mStore.Shutdown();
+
+    ASSERT_EQ(mStore.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString("constant"), "value");
+    size_t size = 0;
+    EXPECT_EQ(mStore.Get("counter", value, sizeof(value), &size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, sizeof(value));
+    EXPECT_EQ(value[0], static_cast<uint8_t>(1999));
+}
+
+TEST_F(TestLinuxStorageLog, TestSyncInterval)
+{
+    ASSERT_EQ(mStore.Init(mPath.c_str(), System::Clock::Milliseconds32(60000)), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("a", "first"), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("b", "second"), CHIP_NO_ERROR);
+    EXPECT_EQ(mStore.Sync(), CHIP_NO_ERROR);
+    EXPECT_EQ(PutString("c", "third"), CHIP_NO_ERROR);
+    mStore.Shutdown();
+
+    ASSERT_EQ(mStore.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(GetString("a"), "first");
+    EXPECT_EQ(GetString("b"), "second");
+    EXPECT_EQ(GetString("c"), "third");
+}
+
+TEST_F(TestLinuxStorageLog, TestMigrateFromIni)
+{
+    const uint8_t kBinary[] = { 0x00, 0xff, '=', '\n', 0x80 };
+    {
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(mIniPath.c_str()), CHIP_NO_ERROR);
+        ASSERT_EQ(ini.WriteValueBin("g/fidx", kBinary, sizeof(kBinary)), CHIP_NO_ERROR);
+        ASSERT_EQ(ini.WriteValueBin("key with spaces=", reinterpret_cast<const uint8_t *>("text"), 4), CHIP_NO_ERROR);
+        ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+    }
+
+    EXPECT_FALSE(ChipLinuxStorageLog::IsLogFile(mIniPath.c_str()));
+    EXPECT_EQ(mStore.Init(mIniPath.c_str()), CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+
+    // Convert in place
+    ASSERT_EQ(ChipLinuxStorageLog::MigrateFromIni(mIniPath.c_str(), mIniPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_TRUE(ChipLinuxStorageLog::IsLogFile(mIniPath.c_str()));
+
+    ASSERT_EQ(mStore.Init(mIniPath.c_str()), CHIP_NO_ERROR);
+    uint8_t value[16];
+    size_t size = 0;
+    EXPECT_EQ(mStore.Get("g/fidx", value, sizeof(value), &size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, sizeof(kBinary));
+    EXPECT_EQ(memcmp(value, kBinary, sizeof(kBinary)), 0);
+    EXPECT_EQ(GetString("key with spaces="), "text");
+}
+
+} // namespace
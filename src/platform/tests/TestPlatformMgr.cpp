@@ -29,6 +29,7 @@
 #include <string.h>
 
 #include <atomic>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -40,6 +41,10 @@
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/TestOnlyCommissionableDataProvider.h>
 
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <thread>
+#endif
+
 using namespace chip;
 using namespace chip::Logging;
 using namespace chip::Inet;
@@ -205,6 +210,69 @@ TEST_F(TestPlatformMgr, RunEventLoopStopBeforeSleep)
     PlatformMgr().Shutdown();
 }
 
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+static constexpr size_t kWorkThreads   = 4;
+static constexpr size_t kWorkPerThread = 2000;
+
+static size_t sNextWork[kWorkThreads];
+static bool sWorkInOrder;
+static std::atomic<size_t> sWorkRan{ 0 };
+
+static void RecordWork(intptr_t arg)
+{
+    const size_t thread = static_cast<size_t>(arg) / kWorkPerThread;
+    const size_t work   = static_cast<size_t>(arg) % kWorkPerThread;
+
+    sWorkInOrder      = sWorkInOrder && sNextWork[thread] == work;
+    sNextWork[thread] = work + 1;
+    sWorkRan++;
+}
+
+TEST_F(TestPlatformMgr, ScheduleWorkFromManyThreads)
+{
+    sWorkInOrder = true;
+    sWorkRan     = 0;
+    memset(sNextWork, 0, sizeof(sNextWork));
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+
+    // None of these threads take the stack lock.
+    std::atomic<bool> scheduled{ true };
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < kWorkThreads; thread++)
+    {
+        threads.emplace_back([thread, &scheduled]() {
+            for (size_t work = 0; work < kWorkPerThread; work++)
+            {
+                if (PlatformMgr().ScheduleWork(RecordWork, static_cast<intptr_t>(thread * kWorkPerThread + work)) != CHIP_NO_ERROR)
+                {
+                    scheduled = false;
+                }
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_TRUE(scheduled);
+
+    for (size_t t = 0; sWorkRan != kWorkThreads * kWorkPerThread && t < 1000; t++)
+        chip::test_utils::SleepMillis(1);
+
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+
+    // Every work item ran, and the ones scheduled by any one thread ran in the order they were scheduled.
+    EXPECT_EQ(sWorkRan, kWorkThreads * kWorkPerThread);
+    EXPECT_TRUE(sWorkInOrder);
+
+    PlatformMgr().Shutdown();
+}
+
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
 TEST_F(TestPlatformMgr, TryLockChipStack)
 {
     EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
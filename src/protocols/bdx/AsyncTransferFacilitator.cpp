@@ -17,12 +17,17 @@
 #include "AsyncTransferFacilitator.h"
 
 #include <protocols/bdx/StatusCode.h>
+#include <protocols/bdx/TransferFacilitator.h>
 #include <system/SystemClock.h>
 
 namespace chip {
 namespace bdx {
 
-AsyncTransferFacilitator::~AsyncTransferFacilitator() {}
+AsyncTransferFacilitator::~AsyncTransferFacilitator()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+    mSystemLayer->CancelTimer(HandleRetransmitTimer, this);
+}
 
 CHIP_ERROR AsyncTransferFacilitator::Init(System::Layer * layer, Messaging::ExchangeContext * exchangeCtx,
                                           System::Clock::Timeout timeout)
@@ -105,6 +110,14 @@ void AsyncTransferFacilitator::ProcessOutputEvents()
 
     mProcessingOutputEvents = false;
 
+#if CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+    if (mTransfer.IsWindowed() && !mDestroySelfAfterProcessingEvents)
+    {
+        LogErrorOnFailure(mSystemLayer->StartTimer(System::Clock::Milliseconds32(CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS),
+                                                   HandleRetransmitTimer, this));
+    }
+#endif // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+
     // If mDestroySelfAfterProcessingEvents is set (by our code above or by NotifyEventHandled), we need
     // to call DestroySelf() after processing all pending output events.
     if (mDestroySelfAfterProcessingEvents)
@@ -118,16 +131,12 @@ CHIP_ERROR AsyncTransferFacilitator::SendMessage(const TransferSession::MessageT
 {
     VerifyOrReturnError(mExchange, CHIP_ERROR_INCORRECT_STATE);
 
-    Messaging::SendFlags sendFlags;
+    Messaging::ExchangeContext * ec = mExchange.Get();
 
     // All messages that are sent expect a response, except for a StatusReport which would indicate an error and
     // the end of the transfer.
-    if (!msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
-    {
-        sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse);
-    }
-
-    Messaging::ExchangeContext * ec = mExchange.Get();
+    const bool expectResponse            = !msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport);
+    const Messaging::SendFlags sendFlags = GetTransferMessageSendFlags(*ec, msgTypeData, expectResponse);
 
     // Set the response timeout on the exchange before sending the message.
     ec->SetResponseTimeout(mTimeout);
@@ -161,6 +170,12 @@ CHIP_ERROR AsyncTransferFacilitator::OnMessageReceived(Messaging::ExchangeContex
     return err;
 }
 
+void AsyncTransferFacilitator::HandleRetransmitTimer(System::Layer * systemLayer, void * appState)
+{
+    VerifyOrReturn(appState != nullptr);
+    static_cast<AsyncTransferFacilitator *>(appState)->ProcessOutputEvents();
+}
+
 void AsyncTransferFacilitator::OnResponseTimeout(Messaging::ExchangeContext * ec)
 {
     ChipLogDetail(BDX, "OnResponseTimeout, ec: " ChipLogFormatExchange, ChipLogValueExchange(ec));
@@ -91,9 +91,12 @@ private:
     // The timeout for the BDX transfer session.
     System::Clock::Timeout mTimeout;
 
-    System::Layer * mSystemLayer;
+    System::Layer * mSystemLayer = nullptr;
 
     CHIP_ERROR SendMessage(const TransferSession::MessageTypeData msgTypeData, System::PacketBufferHandle & msgBuf);
+
+    // Polls a windowed transfer so that the TransferSession can retransmit Blocks that were not acknowledged in time.
+    static void HandleRetransmitTimer(System::Layer * systemLayer, void * appState);
 };
 
 /**
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/BufferWriter.h>
 #include <lib/support/CodeUtils.h>
@@ -58,6 +59,10 @@ enum class TransferControlFlags : uint8_t
     kSenderDrive   = (1U << 4),
     kReceiverDrive = (1U << 5),
     kAsync         = (1U << 6),
+#if CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+    // Reserved by the spec. Used to negotiate the windowed mode of TransferSession, which peers that do not support it ignore.
+    kWindowed = (1U << 7),
+#endif // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
 };
 
 enum class RangeControlFlags : uint8_t
@@ -131,8 +131,7 @@ CHIP_ERROR BdxTransferDiagnosticLog::OnMessageToSend(TransferSession::OutputEven
 
     // All messages sent from the Sender expect a response, except for a StatusReport which would indicate an error and
     // the end of the transfer.
-    Messaging::SendFlags sendFlags;
-    VerifyOrDo(isStatusReport, sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse));
+    auto sendFlags = GetTransferMessageSendFlags(*mExchangeCtx, msgTypeData, !isStatusReport);
 
     // If there's an error sending the message, close the exchange by calling Reset.
     auto err = mExchangeCtx->SendMessage(msgTypeData.ProtocolId, msgTypeData.MessageType, std::move(event.MsgData), sendFlags);
@@ -28,12 +28,12 @@ constexpr uint8_t kBdxVersion = 0; ///< The version of this implementation of th
  */
 CHIP_ERROR WriteToPacketBuffer(const ::chip::bdx::BdxMessage & msgStruct, ::chip::System::PacketBufferHandle & msgBuf)
 {
-    size_t msgDataSize = msgStruct.MessageSize();
-    ::chip::Encoding::LittleEndian::PacketBufferWriter bbuf(chip::MessagePacketBuffer::New(msgDataSize), msgDataSize);
-    if (bbuf.IsNull())
-    {
-        return CHIP_ERROR_NO_MEMORY;
-    }
+    size_t msgDataSize                        = msgStruct.MessageSize();
+    ::chip::System::PacketBufferHandle packet = chip::MessagePacketBuffer::New(msgDataSize);
+    // PacketBufferWriter dereferences the buffer it is given, so check for an exhausted pool first
+    VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    ::chip::Encoding::LittleEndian::PacketBufferWriter bbuf(std::move(packet), msgDataSize);
     msgStruct.WriteToBuffer(bbuf);
     msgBuf = bbuf.Finalize();
     if (msgBuf.IsNull())
@@ -45,13 +45,23 @@ CHIP_ERROR WriteToPacketBuffer(const ::chip::bdx::BdxMessage & msgStruct, ::chip
 
 template <typename MessageType>
 void PrepareOutgoingMessageEvent(MessageType messageType, chip::bdx::TransferSession::OutputEventType & pendingOutput,
-                                 chip::bdx::TransferSession::MessageTypeData & outputMsgType)
+                                 chip::bdx::TransferSession::MessageTypeData & outputMsgType, bool isWindowed = false)
 {
     static_assert(std::is_same<std::underlying_type_t<decltype(messageType)>, uint8_t>::value, "Cast is not safe");
 
     pendingOutput             = chip::bdx::TransferSession::OutputEventType::kMsgToSend;
     outputMsgType.ProtocolId  = chip::Protocols::MessageTypeTraits<MessageType>::ProtocolId();
     outputMsgType.MessageType = static_cast<uint8_t>(messageType);
+    outputMsgType.IsWindowed  = isWindowed;
+}
+
+chip::bdx::TransferSession::MessageTypeData WindowedMessageTypeData(chip::bdx::MessageType messageType)
+{
+    chip::bdx::TransferSession::MessageTypeData typeData;
+    typeData.ProtocolId  = chip::Protocols::BDX::Id;
+    typeData.MessageType = chip::to_underlying(messageType);
+    typeData.IsWindowed  = true;
+    return typeData;
 }
 
 } // anonymous namespace
@@ -82,6 +92,12 @@ void TransferSession::PollOutput(OutputEvent & event, System::Clock::Timestamp c
         return;
     }
 
+    // Output generated by the window itself only goes out once everything the application asked for has been emitted
+    if (mWindowed && (mPendingOutput == OutputEventType::kNone) && PollWindowedOutput(event, curTime))
+    {
+        return;
+    }
+
     switch (mPendingOutput)
     {
     case OutputEventType::kNone:
@@ -94,8 +110,9 @@ void TransferSession::PollOutput(OutputEvent & event, System::Clock::Timestamp c
         event = OutputEvent::StatusReportEvent(OutputEventType::kStatusReceived, mStatusReportData);
         break;
     case OutputEventType::kMsgToSend:
-        event             = OutputEvent::MsgToSendEvent(mMsgTypeData, std::move(mPendingMsgHandle));
-        mTimeoutStartTime = curTime;
+        event                = OutputEvent::MsgToSendEvent(mMsgTypeData, std::move(mPendingMsgHandle));
+        mTimeoutStartTime    = curTime;
+        mRetransmitStartTime = curTime;
         break;
     case OutputEventType::kInitReceived:
         event = OutputEvent::TransferInitEvent(mTransferRequestData, std::move(mPendingMsgHandle));
@@ -151,10 +168,13 @@ CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitD
     mMaxSupportedBlockSize = initData.MaxBlockSize;
     mStartOffset           = initData.StartOffset;
     mTransferLength        = initData.Length;
+#if CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+    mSuppportedXferOpts.Set(TransferControlFlags::kWindowed, initData.Windowed);
+#endif // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
 
     // Prepare TransferInit message
     TransferInit initMsg;
-    initMsg.TransferCtlOptions = initData.TransferCtlFlags;
+    initMsg.TransferCtlOptions = mSuppportedXferOpts;
     initMsg.Version            = kBdxVersion;
     initMsg.MaxBlockSize       = mMaxSupportedBlockSize;
     initMsg.StartOffset        = mStartOffset;
@@ -210,8 +230,10 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     // MaxBlockSize can't be larger than the proposed value
     VerifyOrReturnError(proposedControlOpts.Has(acceptData.ControlMode), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(acceptData.MaxBlockSize <= mTransferRequestData.MaxBlockSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!acceptData.Windowed || mTransferRequestData.Windowed, CHIP_ERROR_INVALID_ARGUMENT);
 
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
+    mWindowed             = acceptData.Windowed;
 
     if (mRole == TransferRole::kSender)
     {
@@ -220,6 +242,9 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
         ReceiveAccept acceptMsg;
         acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
+#if CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+        acceptMsg.TransferCtlFlags.Set(TransferControlFlags::kWindowed, mWindowed);
+#endif // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
         acceptMsg.Version        = mTransferVersion;
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.StartOffset    = acceptData.StartOffset;
@@ -239,6 +264,9 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     {
         SendAccept acceptMsg;
         acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
+#if CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+        acceptMsg.TransferCtlFlags.Set(TransferControlFlags::kWindowed, mWindowed);
+#endif // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
         acceptMsg.Version        = mTransferVersion;
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.Metadata       = acceptData.Metadata;
@@ -261,6 +289,10 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         mAwaitingResponse = true;
     }
 
+    // In Sender Drive, the first Block may be sent right away
+    mWindowOpen     = (mRole == TransferRole::kSender && mControlMode == TransferControlFlags::kSenderDrive);
+    mBlockRequested = (mRole == TransferRole::kReceiver && mControlMode == TransferControlFlags::kSenderDrive);
+
     PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
 
     return CHIP_NO_ERROR;
@@ -291,10 +323,15 @@ CHIP_ERROR TransferSession::PrepareBlockQuery()
 
     ReturnErrorOnFailure(WriteToPacketBuffer(queryMsg, mPendingMsgHandle));
 
+    // In a windowed transfer, the first BlockQuery is left to the message layer to deliver reliably since no Block is in flight
+    // yet. Later ones are repeated if the sender retransmits a Block that was already received.
+    const bool isWindowed = mWindowed && (mNextQueryNum > 0);
+
     mAwaitingResponse = true;
+    mBlockRequested   = true;
     mLastQueryNum     = mNextQueryNum++;
 
-    PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
+    PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData, isWindowed);
 
     return CHIP_NO_ERROR;
 }
@@ -303,6 +340,8 @@ CHIP_ERROR TransferSession::PrepareBlockQueryWithSkip(const uint64_t & bytesToSk
 {
     const MessageType msgType = MessageType::BlockQueryWithSkip;
 
+    // Blocks following the skipped data may already be in flight in a windowed transfer
+    VerifyOrReturnError(!mWindowed, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
@@ -327,7 +366,14 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    if (mWindowed)
+    {
+        VerifyOrReturnError(mWindowOpen && (mNextBlockNum - mWindowStartNum < kSendWindowSize), CHIP_ERROR_INCORRECT_STATE);
+    }
+    else
+    {
+        VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    }
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
@@ -339,6 +385,19 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 
     ReturnErrorOnFailure(WriteToPacketBuffer(blockMsg, mPendingMsgHandle));
 
+    if (mWindowed)
+    {
+        // Keep a copy until the Block is acknowledged, since the message layer will not retransmit it
+        System::PacketBufferHandle & windowSlot = mWindow[mNextBlockNum % kMaxWindowSize];
+        windowSlot                              = mPendingMsgHandle.CloneData();
+        if (windowSlot.IsNull())
+        {
+            mPendingMsgHandle = nullptr;
+            return CHIP_ERROR_NO_MEMORY;
+        }
+        mWindowOpenNotified = false;
+    }
+
     const MessageType msgType = inData.IsEof ? MessageType::BlockEOF : MessageType::Block;
 
     if (msgType == MessageType::BlockEOF)
@@ -353,7 +412,7 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     mAwaitingResponse = true;
     mLastBlockNum     = mNextBlockNum++;
 
-    PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
+    PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData, mWindowed);
 
     return CHIP_NO_ERROR;
 }
@@ -371,6 +430,8 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
 
     ReturnErrorOnFailure(WriteToPacketBuffer(ackMsg, mPendingMsgHandle));
 
+    bool isWindowed = false;
+
     if (mState == TransferState::kTransferInProgress)
     {
         if (mControlMode == TransferControlFlags::kSenderDrive)
@@ -379,7 +440,9 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
             // message.
             mLastQueryNum     = ackMsg.BlockCounter + 1;
             mAwaitingResponse = true;
+            mBlockRequested   = true;
         }
+        isWindowed = mWindowed;
     }
     else if (mState == TransferState::kReceivedEOF)
     {
@@ -389,9 +452,10 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
 #endif // CHIP_AUTOMATION_LOGGING
         mState            = TransferState::kTransferDone;
         mAwaitingResponse = false;
+        ReleaseWindow();
     }
 
-    PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
+    PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData, isWindowed);
 
     return CHIP_NO_ERROR;
 }
@@ -430,6 +494,20 @@ void TransferSession::Reset()
     mTimeoutStartTime       = System::Clock::kZero;
     mShouldInitTimeoutStart = true;
     mAwaitingResponse       = false;
+
+    ReleaseWindow();
+    mWindowStartNum      = 0;
+    mEOFBlockNum         = 0;
+    mWindowed            = false;
+    mWindowOpen          = false;
+    mWindowOpenNotified  = false;
+    mRetransmitPending   = false;
+    mFastRetransmitted   = false;
+    mBlockRequested      = false;
+    mWindowAckNeeded     = false;
+    mGapAcknowledged     = false;
+    mEOFBlockBuffered    = false;
+    mRetransmitStartTime = System::Clock::kZero;
 }
 
 CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadHeader, System::PacketBufferHandle msg,
@@ -441,7 +519,8 @@ CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadH
     {
         ReturnErrorOnFailure(HandleBdxMessage(payloadHeader, std::move(msg)));
 
-        mTimeoutStartTime = curTime;
+        mTimeoutStartTime    = curTime;
+        mRetransmitStartTime = curTime;
     }
     else if (payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
     {
@@ -459,10 +538,25 @@ CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadH
 CHIP_ERROR TransferSession::HandleBdxMessage(const PayloadHeader & header, System::PacketBufferHandle msg)
 {
     VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
 
     const MessageType msgType = static_cast<MessageType>(header.GetMessageType());
 
+    // In a windowed transfer, Blocks and their acknowledgements may arrive while earlier output is still pending
+    if (mWindowed && IsWindowedDataMessage(msgType))
+    {
+        if (mRole == TransferRole::kSender)
+        {
+            HandleWindowedAck(msgType, std::move(msg));
+        }
+        else
+        {
+            HandleWindowedBlock(msgType, std::move(msg));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
+
     switch (msgType)
     {
     case MessageType::SendInit:
@@ -551,7 +645,15 @@ void TransferSession::HandleTransferInit(MessageType msgType, System::PacketBuff
     const CHIP_ERROR err = transferInit.Parse(msgData.Retain());
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
-    ResolveTransferControlOptions(transferInit.TransferCtlOptions);
+    BitFlags<TransferControlFlags> proposedControlOpts(transferInit.TransferCtlOptions);
+    bool windowedProposed = false;
+#if CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+    // The windowed mode is negotiated separately from the control mode
+    windowedProposed = proposedControlOpts.Has(TransferControlFlags::kWindowed);
+    proposedControlOpts.Clear(TransferControlFlags::kWindowed);
+#endif // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+
+    ResolveTransferControlOptions(proposedControlOpts);
     mTransferVersion      = std::min(kBdxVersion, transferInit.Version);
     mTransferMaxBlockSize = std::min(mMaxSupportedBlockSize, transferInit.MaxBlockSize);
 
@@ -560,7 +662,7 @@ void TransferSession::HandleTransferInit(MessageType msgType, System::PacketBuff
     mTransferLength = transferInit.MaxLength;
 
     // Store the Request data to share with the caller for verification
-    mTransferRequestData.TransferCtlFlags = transferInit.TransferCtlOptions;
+    mTransferRequestData.TransferCtlFlags = proposedControlOpts;
     mTransferRequestData.MaxBlockSize     = transferInit.MaxBlockSize;
     mTransferRequestData.StartOffset      = transferInit.StartOffset;
     mTransferRequestData.Length           = transferInit.MaxLength;
@@ -568,6 +670,7 @@ void TransferSession::HandleTransferInit(MessageType msgType, System::PacketBuff
     mTransferRequestData.FileDesLength    = transferInit.FileDesLength;
     mTransferRequestData.Metadata         = transferInit.Metadata;
     mTransferRequestData.MetadataLength   = transferInit.MetadataLength;
+    mTransferRequestData.Windowed         = windowedProposed;
 
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kInitReceived;
@@ -603,11 +706,13 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mTransferAcceptData.Length         = rcvAcceptMsg.Length;
     mTransferAcceptData.Metadata       = rcvAcceptMsg.Metadata;
     mTransferAcceptData.MetadataLength = rcvAcceptMsg.MetadataLength;
+    mTransferAcceptData.Windowed       = mWindowed;
 
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kAcceptReceived;
 
     mAwaitingResponse = (mControlMode == TransferControlFlags::kSenderDrive);
+    mBlockRequested   = (mControlMode == TransferControlFlags::kSenderDrive);
     mState            = TransferState::kTransferInProgress;
 
 #if CHIP_AUTOMATION_LOGGING
@@ -637,11 +742,13 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
     mTransferAcceptData.Length         = mTransferLength; // Not included in SendAccept msg, so use member
     mTransferAcceptData.Metadata       = sendAcceptMsg.Metadata;
     mTransferAcceptData.MetadataLength = sendAcceptMsg.MetadataLength;
+    mTransferAcceptData.Windowed       = mWindowed;
 
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kAcceptReceived;
 
     mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+    mWindowOpen       = (mControlMode == TransferControlFlags::kSenderDrive);
     mState            = TransferState::kTransferInProgress;
 
 #if CHIP_AUTOMATION_LOGGING
@@ -672,6 +779,7 @@ void TransferSession::HandleBlockQueryWithSkip(System::PacketBufferHandle msgDat
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(!mWindowed, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockQueryWithSkip query;
     const CHIP_ERROR err = query.Parse(std::move(msgData));
@@ -786,12 +894,254 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
     mAwaitingResponse = false;
 
     mState = TransferState::kTransferDone;
+    ReleaseWindow();
 
 #if CHIP_AUTOMATION_LOGGING
     ackMsg.LogMessage(MessageType::BlockAckEOF);
 #endif // CHIP_AUTOMATION_LOGGING
 }
 
+bool TransferSession::IsWindowedDataMessage(MessageType msgType) const
+{
+    if (mRole == TransferRole::kSender)
+    {
+        return (msgType == MessageType::BlockQuery) || (msgType == MessageType::BlockAck);
+    }
+
+    return (msgType == MessageType::Block) || (msgType == MessageType::BlockEOF);
+}
+
+/**
+ * @brief
+ *   Buffer a Block received in a windowed transfer until the application is ready for it.
+ *
+ *   Blocks that were already given to the application, or that do not fit in the window, are dropped. A repeated Block means
+ *   that an acknowledgement was lost, and a Block that arrives ahead of the one the application is waiting for means that a Block
+ *   was lost, so in all of these cases the last query or acknowledgement is repeated to the sender rather than leaving it to wait
+ *   for its retransmit timeout.
+ */
+void TransferSession::HandleWindowedBlock(MessageType msgType, System::PacketBufferHandle msgData)
+{
+    // Retransmissions may still arrive after the BlockEOF was received
+    VerifyOrReturn((mState != TransferState::kReceivedEOF) && (mState != TransferState::kTransferDone));
+    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    DataBlock blockMsg;
+    const CHIP_ERROR err = blockMsg.Parse(msgData.Retain());
+    VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+    VerifyOrReturn((blockMsg.DataLength > 0 || msgType == MessageType::BlockEOF) && (blockMsg.DataLength <= mTransferMaxBlockSize),
+                   PrepareStatusReport(StatusCode::kBadMessageContents));
+    VerifyOrReturn(!mEOFBlockBuffered || (blockMsg.BlockCounter <= mEOFBlockNum),
+                   PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    if ((blockMsg.BlockCounter < mWindowStartNum) || (blockMsg.BlockCounter - mWindowStartNum >= kMaxWindowSize))
+    {
+        mWindowAckNeeded = true;
+        return;
+    }
+
+    System::PacketBufferHandle & windowSlot = mWindow[blockMsg.BlockCounter % kMaxWindowSize];
+    VerifyOrReturn(windowSlot.IsNull());
+    windowSlot = std::move(msgData);
+
+    if (msgType == MessageType::BlockEOF)
+    {
+        mEOFBlockBuffered = true;
+        mEOFBlockNum      = blockMsg.BlockCounter;
+    }
+
+    if (mWindow[mWindowStartNum % kMaxWindowSize].IsNull() && !mGapAcknowledged)
+    {
+        mWindowAckNeeded = true;
+        mGapAcknowledged = true;
+    }
+}
+
+/**
+ * @brief
+ *   Process a BlockQuery or BlockAck received in a windowed transfer.
+ *
+ *   Either message means that the receiver has every Block before the one it queries or after the one it acknowledges, so those
+ *   are released. An acknowledgement that does not release anything means the receiver is missing the first unacknowledged
+ *   Block, which is then retransmitted.
+ */
+void TransferSession::HandleWindowedAck(MessageType msgType, System::PacketBufferHandle msgData)
+{
+    VerifyOrReturn((mState == TransferState::kTransferInProgress) || (mState == TransferState::kAwaitingEOFAck),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    CounterMessage ackMsg;
+    const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
+    VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    const uint64_t ackedNum = (msgType == MessageType::BlockQuery) ? ackMsg.BlockCounter : ackMsg.BlockCounter + uint64_t(1);
+    VerifyOrReturn(ackedNum <= mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    // Stale acknowledgement overtaken by a later one
+    VerifyOrReturn(ackedNum >= mWindowStartNum);
+
+    if (msgType == MessageType::BlockQuery)
+    {
+        mWindowOpen   = true;
+        mLastQueryNum = ackMsg.BlockCounter;
+    }
+
+    if (ackedNum == mWindowStartNum)
+    {
+        // Only retransmit once per Block here, since every Block that arrives after a lost one repeats the acknowledgement.
+        // Further losses are recovered by the retransmit timeout.
+        if ((mWindowStartNum != mNextBlockNum) && !mFastRetransmitted)
+        {
+            mRetransmitPending = true;
+            mFastRetransmitted = true;
+        }
+    }
+    else
+    {
+        while (mWindowStartNum != ackedNum)
+        {
+            mWindow[mWindowStartNum++ % kMaxWindowSize] = nullptr;
+        }
+        mRetransmitPending  = false;
+        mFastRetransmitted  = false;
+        mWindowOpenNotified = false;
+    }
+
+    // In Receiver Drive, the sender always waits for the next BlockQuery
+    mAwaitingResponse = (mWindowStartNum != mNextBlockNum) || (mControlMode == TransferControlFlags::kReceiverDrive);
+}
+
+bool TransferSession::PollWindowedOutput(OutputEvent & event, System::Clock::Timestamp curTime)
+{
+    VerifyOrReturnValue((mState == TransferState::kTransferInProgress) || (mState == TransferState::kAwaitingEOFAck), false);
+
+    return (mRole == TransferRole::kSender) ? PollWindowedSender(event, curTime) : PollWindowedReceiver(event);
+}
+
+bool TransferSession::PollWindowedSender(OutputEvent & event, System::Clock::Timestamp curTime)
+{
+    if (mWindowStartNum != mNextBlockNum)
+    {
+        if ((curTime - mRetransmitStartTime) >= System::Clock::Milliseconds32(CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS))
+        {
+            mRetransmitPending = true;
+        }
+
+        if (mRetransmitPending)
+        {
+            // Give up for now if there is no memory for a copy, the retransmit is attempted again on the next poll
+            System::PacketBufferHandle msg = mWindow[mWindowStartNum % kMaxWindowSize].CloneData();
+            VerifyOrReturnValue(!msg.IsNull(), false);
+
+            const bool isEof = (mState == TransferState::kAwaitingEOFAck) && (mWindowStartNum == mLastBlockNum);
+
+            const MessageType msgType = isEof ? MessageType::BlockEOF : MessageType::Block;
+            ChipLogDetail(BDX, "Retransmitting block %" PRIu32, mWindowStartNum);
+
+            event                = OutputEvent::MsgToSendEvent(WindowedMessageTypeData(msgType), std::move(msg));
+            mRetransmitPending   = false;
+            mRetransmitStartTime = curTime;
+            return true;
+        }
+    }
+
+    // Let the application know that another Block may be sent. In Sender Drive, the first Block is sent in response to the
+    // Accept message instead.
+    VerifyOrReturnValue((mState == TransferState::kTransferInProgress) && mWindowOpen && !mWindowOpenNotified &&
+                            (mNextBlockNum - mWindowStartNum < kSendWindowSize) &&
+                            (mControlMode == TransferControlFlags::kReceiverDrive || mNextBlockNum > 0),
+                        false);
+
+    mWindowOpenNotified = true;
+    event = OutputEvent(mControlMode == TransferControlFlags::kReceiverDrive ? OutputEventType::kQueryReceived
+                                                                              : OutputEventType::kAckReceived);
+    return true;
+}
+
+bool TransferSession::PollWindowedReceiver(OutputEvent & event)
+{
+    VerifyOrReturnValue((mState == TransferState::kTransferInProgress) && mBlockRequested, false);
+
+    System::PacketBufferHandle & windowSlot = mWindow[mWindowStartNum % kMaxWindowSize];
+    if (!windowSlot.IsNull())
+    {
+        DataBlock blockMsg;
+        const CHIP_ERROR err = blockMsg.Parse(windowSlot.Retain());
+        VerifyOrReturnValue(err == CHIP_NO_ERROR, false, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+        if (IsTransferLengthDefinite())
+        {
+            VerifyOrReturnValue(mNumBytesProcessed + blockMsg.DataLength <= mTransferLength, false,
+                                PrepareStatusReport(StatusCode::kLengthMismatch));
+        }
+
+        const bool isEof = mEOFBlockBuffered && (blockMsg.BlockCounter == mEOFBlockNum);
+
+        mBlockEventData.Data         = blockMsg.Data;
+        mBlockEventData.Length       = blockMsg.DataLength;
+        mBlockEventData.IsEof        = isEof;
+        mBlockEventData.BlockCounter = blockMsg.BlockCounter;
+
+        event = OutputEvent::BlockDataEvent(mBlockEventData, std::move(windowSlot));
+
+        mNumBytesProcessed += blockMsg.DataLength;
+        mLastBlockNum = mWindowStartNum++;
+
+        mAwaitingResponse = false;
+        mBlockRequested   = false;
+        mWindowAckNeeded  = false;
+        mGapAcknowledged  = false;
+
+        if (isEof)
+        {
+            mState = TransferState::kReceivedEOF;
+#if CHIP_AUTOMATION_LOGGING
+            blockMsg.LogMessage(MessageType::BlockEOF);
+#endif // CHIP_AUTOMATION_LOGGING
+            return true;
+        }
+
+        // Report a missing Block right away if later ones are already buffered
+        if (mWindow[mWindowStartNum % kMaxWindowSize].IsNull())
+        {
+            for (uint32_t i = 1; i < kMaxWindowSize; i++)
+            {
+                if (!mWindow[(mWindowStartNum + i) % kMaxWindowSize].IsNull())
+                {
+                    mWindowAckNeeded = true;
+                    mGapAcknowledged = true;
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    // In Sender Drive, there is nothing to repeat until the first Block was acknowledged
+    VerifyOrReturnValue(mWindowAckNeeded && (mControlMode == TransferControlFlags::kReceiverDrive || mWindowStartNum > 0), false);
+
+    const MessageType msgType =
+        (mControlMode == TransferControlFlags::kReceiverDrive) ? MessageType::BlockQuery : MessageType::BlockAck;
+
+    CounterMessage ackMsg;
+    ackMsg.BlockCounter = (msgType == MessageType::BlockQuery) ? mWindowStartNum : mWindowStartNum - 1;
+
+    System::PacketBufferHandle msg;
+    VerifyOrReturnValue(WriteToPacketBuffer(ackMsg, msg) == CHIP_NO_ERROR, false);
+
+    mWindowAckNeeded = false;
+    event            = OutputEvent::MsgToSendEvent(WindowedMessageTypeData(msgType), std::move(msg));
+    return true;
+}
+
+void TransferSession::ReleaseWindow()
+{
+    for (auto & windowSlot : mWindow)
+    {
+        windowSlot = nullptr;
+    }
+}
+
 void TransferSession::ResolveTransferControlOptions(const BitFlags<TransferControlFlags> & proposed)
 {
     // Must specify at least one synchronous option
@@ -823,10 +1173,23 @@ void TransferSession::ResolveTransferControlOptions(const BitFlags<TransferContr
     }
 }
 
-CHIP_ERROR TransferSession::VerifyProposedMode(const BitFlags<TransferControlFlags> & proposed)
+CHIP_ERROR TransferSession::VerifyProposedMode(const BitFlags<TransferControlFlags> & proposedOpts)
 {
     TransferControlFlags mode;
 
+    BitFlags<TransferControlFlags> proposed(proposedOpts);
+    bool windowed = false;
+#if CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+    // The windowed mode may only be chosen if it was proposed
+    windowed = proposed.Has(TransferControlFlags::kWindowed);
+    proposed.Clear(TransferControlFlags::kWindowed);
+    if (windowed && !mSuppportedXferOpts.Has(TransferControlFlags::kWindowed))
+    {
+        PrepareStatusReport(StatusCode::kTransferMethodNotSupported);
+        return CHIP_ERROR_INTERNAL;
+    }
+#endif // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+
     // Must specify only one mode in Accept messages
     if (proposed.HasOnly(TransferControlFlags::kAsync))
     {
@@ -850,6 +1213,7 @@ CHIP_ERROR TransferSession::VerifyProposedMode(const BitFlags<TransferControlFla
     if (mSuppportedXferOpts.Has(mode))
     {
         mControlMode = mode;
+        mWindowed    = windowed;
     }
     else
     {
@@ -866,12 +1230,15 @@ void TransferSession::PrepareStatusReport(StatusCode code)
 
     Protocols::SecureChannel::StatusReport report(Protocols::SecureChannel::GeneralStatusCode::kFailure, Protocols::BDX::Id,
                                                   to_underlying(code));
-    size_t msgSize = report.Size();
-    Encoding::LittleEndian::PacketBufferWriter bbuf(chip::MessagePacketBuffer::New(msgSize), msgSize);
-    VerifyOrExit(!bbuf.IsNull(), mPendingOutput = OutputEventType::kInternalError);
+    size_t msgSize                    = report.Size();
+    System::PacketBufferHandle packet = chip::MessagePacketBuffer::New(msgSize);
+    VerifyOrExit(!packet.IsNull(), mPendingOutput = OutputEventType::kInternalError);
 
-    report.WriteToBuffer(bbuf);
-    mPendingMsgHandle = bbuf.Finalize();
+    {
+        Encoding::LittleEndian::PacketBufferWriter bbuf(std::move(packet), msgSize);
+        report.WriteToBuffer(bbuf);
+        mPendingMsgHandle = bbuf.Finalize();
+    }
     if (mPendingMsgHandle.IsNull())
     {
         ChipLogError(BDX, "%s: error preparing message: %" CHIP_ERROR_FORMAT, __FUNCTION__, CHIP_ERROR_NO_MEMORY.Format());
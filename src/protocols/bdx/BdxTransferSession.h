@@ -3,16 +3,28 @@
  *      This file defines a TransferSession state machine that contains the main logic governing a Bulk Data Transfer session. It
  *      provides APIs for starting a transfer or preparing to receive a transfer request, providing input to be processed, and
  *      accessing output data (including messages to be sent, message data received by the TransferSession, or state information).
+ *
+ *      By default a transfer is stop-and-wait: only one Block is in flight at a time. If CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+ *      is set and both peers agree on the windowed mode (see TransferInitData::Windowed), the sender may have up to
+ *      CHIP_CONFIG_BDX_WINDOW_SIZE Blocks in flight. BlockQuery and
+ *      BlockAck messages then acknowledge all Blocks up to their counter, the receiver buffers Blocks that arrive out of order,
+ *      and the sender retransmits the first missing Block when the receiver repeats an acknowledgement or when no progress has
+ *      been made for CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS. The application still handles one Block at a time: the
+ *      receiver is given the next Block after it calls PrepareBlockQuery() or PrepareBlockAck() for the previous one, and the
+ *      sender is given a kQueryReceived (Receiver Drive) or kAckReceived (Sender Drive) event whenever the window has room for
+ *      another Block.
  */
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 #include <transport/raw/MessageHeader.h>
 
+#include <algorithm>
 #include <type_traits>
 
 namespace chip {
@@ -27,6 +39,12 @@ enum class TransferRole : uint8_t
 class DLL_EXPORT TransferSession
 {
 public:
+    // The window size of the windowed mode is not negotiated: every windowed receiver can buffer kMaxWindowSize Blocks, and a
+    // sender never has more than kSendWindowSize of them in flight.
+    static constexpr uint32_t kMaxWindowSize  = 8;
+    static constexpr uint32_t kSendWindowSize = std::min<uint32_t>(CHIP_CONFIG_BDX_WINDOW_SIZE, kMaxWindowSize);
+    static_assert(CHIP_CONFIG_BDX_WINDOW_SIZE > 0, "CHIP_CONFIG_BDX_WINDOW_SIZE must be at least 1");
+
     enum class OutputEventType : uint16_t
     {
         kNone = 0,
@@ -57,6 +75,10 @@ public:
         // Additional metadata (optional, TLV format)
         const uint8_t * Metadata = nullptr;
         size_t MetadataLength    = 0;
+
+        // Propose the windowed mode. The transfer falls back to stop-and-wait if the peer does not accept it. Ignored unless
+        // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER is set.
+        bool Windowed = false;
     };
 
     struct TransferAcceptData
@@ -70,6 +92,9 @@ public:
         // Additional metadata (optional, TLV format)
         const uint8_t * Metadata = nullptr;
         size_t MetadataLength    = 0;
+
+        // Use the windowed mode. May only be set if the TransferInit message proposed it.
+        bool Windowed = false;
     };
 
     struct StatusReportData
@@ -90,6 +115,11 @@ public:
         Protocols::Id ProtocolId; // Should only ever be SecureChannel or BDX
         uint8_t MessageType;
 
+        // True if the message belongs to the window of a windowed transfer. The TransferSession retransmits such messages
+        // itself, so they should be sent without requesting a message layer acknowledgement, and several of them may be sent
+        // while a response is already expected on the exchange.
+        bool IsWindowed = false;
+
         MessageTypeData() : ProtocolId(Protocols::NotSpecified), MessageType(0) {}
 
         bool HasProtocol(Protocols::Id protocol) const { return ProtocolId == protocol; }
@@ -252,7 +282,8 @@ public:
 
     /**
      * @brief
-     *   Prepare a BlockQueryWithSkip message. The Block counter will be populated automatically.
+     *   Prepare a BlockQueryWithSkip message. The Block counter will be populated automatically. Not supported in a windowed
+     *   transfer.
      *
      * @param bytesToSkip Number of bytes to seek skip
      *
@@ -315,6 +346,8 @@ public:
                                      System::Clock::Timestamp curTime);
 
     TransferControlFlags GetControlMode() const { return mControlMode; }
+    bool IsWindowed() const { return mWindowed; }
+    bool IsWindowedProposed() const { return mTransferRequestData.Windowed; } ///< Only valid once a TransferInit was received
     uint64_t GetStartOffset() const { return mStartOffset; }
     uint64_t GetTransferLength() const { return mTransferLength; }
     uint16_t GetTransferBlockSize() const { return mTransferMaxBlockSize; }
@@ -369,6 +402,15 @@ private:
      */
     CHIP_ERROR VerifyProposedMode(const BitFlags<TransferControlFlags> & proposed);
 
+    // Windowed mode helpers
+    bool IsWindowedDataMessage(MessageType msgType) const;
+    void HandleWindowedBlock(MessageType msgType, System::PacketBufferHandle msgData);
+    void HandleWindowedAck(MessageType msgType, System::PacketBufferHandle msgData);
+    bool PollWindowedOutput(OutputEvent & event, System::Clock::Timestamp curTime);
+    bool PollWindowedSender(OutputEvent & event, System::Clock::Timestamp curTime);
+    bool PollWindowedReceiver(OutputEvent & event);
+    void ReleaseWindow();
+
     void PrepareStatusReport(StatusCode code);
     bool IsTransferLengthDefinite() const;
 
@@ -407,6 +449,24 @@ private:
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
     bool mShouldInitTimeoutStart               = true;
     bool mAwaitingResponse                     = false;
+
+    // Used to govern a windowed transfer
+
+    // Sender: unacknowledged Blocks, indexed by counter modulo kMaxWindowSize.
+    // Receiver: Blocks that have not been given to the application yet, indexed the same way.
+    System::PacketBufferHandle mWindow[kMaxWindowSize];
+    uint32_t mWindowStartNum = 0; ///< Sender: first unacknowledged Block. Receiver: next Block for the application.
+    uint32_t mEOFBlockNum    = 0; ///< Receiver: counter of the BlockEOF, valid if mEOFBlockBuffered is set
+    bool mWindowed           = false;
+    bool mWindowOpen         = false; ///< Sender: the receiver is ready for Blocks (always the case in Sender Drive)
+    bool mWindowOpenNotified = false; ///< Sender: the application was told that the window has room
+    bool mRetransmitPending  = false; ///< Sender: the first unacknowledged Block must be retransmitted
+    bool mFastRetransmitted  = false; ///< Sender: a repeated acknowledgement already caused a retransmit of that Block
+    bool mBlockRequested     = false; ///< Receiver: the application is ready for the next Block
+    bool mWindowAckNeeded    = false; ///< Receiver: the last query or acknowledgement should be repeated
+    bool mGapAcknowledged    = false; ///< Receiver: a missing Block was already reported to the sender
+    bool mEOFBlockBuffered   = false;
+    System::Clock::Timestamp mRetransmitStartTime = System::Clock::kZero;
 };
 
 } // namespace bdx
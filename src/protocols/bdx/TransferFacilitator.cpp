@@ -29,6 +29,21 @@
 namespace chip {
 namespace bdx {
 
+Messaging::SendFlags GetTransferMessageSendFlags(const Messaging::ExchangeContext & ec,
+                                                 const TransferSession::MessageTypeData & msgTypeData, bool expectResponse)
+{
+    Messaging::SendFlags sendFlags;
+
+    if (msgTypeData.IsWindowed)
+    {
+        sendFlags.Set(Messaging::SendMessageFlags::kNoAutoRequestAck);
+        expectResponse = expectResponse && !ec.IsResponseExpected();
+    }
+
+    sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse, expectResponse);
+    return sendFlags;
+}
+
 constexpr System::Clock::Timeout TransferFacilitator::kDefaultPollFreq;
 constexpr System::Clock::Timeout TransferFacilitator::kImmediatePollDelay;
 
@@ -70,6 +85,12 @@ CHIP_ERROR TransferFacilitator::OnMessageReceived(chip::Messaging::ExchangeConte
     // transfer is finished.
     mExchangeCtx->WillSendMessage();
 
+    // A windowed transfer can usually send or deliver another Block right away, so do not wait for the poll timer.
+    if (mTransfer.IsWindowed())
+    {
+        ScheduleImmediatePoll();
+    }
+
     return err;
 }
 
@@ -89,8 +110,15 @@ void TransferFacilitator::PollTimerHandler(chip::System::Layer * systemLayer, vo
 void TransferFacilitator::PollForOutput()
 {
     TransferSession::OutputEvent outEvent;
-    mTransfer.PollOutput(outEvent, System::SystemClock().GetMonotonicTimestamp());
-    HandleTransferSessionOutput(outEvent);
+
+    // A windowed transfer may have several Blocks to send or deliver, so drain its output rather than handling one event per
+    // poll. Errors keep being reported until the application resets the transfer, so stop at the first one.
+    do
+    {
+        mTransfer.PollOutput(outEvent, System::SystemClock().GetMonotonicTimestamp());
+        HandleTransferSessionOutput(outEvent);
+    } while (mTransfer.IsWindowed() && (outEvent.EventType != TransferSession::OutputEventType::kNone) &&
+             (outEvent.EventType != TransferSession::OutputEventType::kInternalError));
 
     VerifyOrReturn(mSystemLayer != nullptr, ChipLogError(BDX, "%s mSystemLayer is null", __FUNCTION__));
     mSystemLayer->StartTimer(mPollFreq, PollTimerHandler, this);
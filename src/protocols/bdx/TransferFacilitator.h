@@ -33,6 +33,20 @@
 namespace chip {
 namespace bdx {
 
+/**
+ * Returns the flags for sending a message emitted by a TransferSession on an exchange.
+ *
+ * Messages that belong to the window of a windowed transfer are retransmitted by the TransferSession itself, so they are sent
+ * without requesting an acknowledgement from the message layer. Several of them may be in flight at once, so a response is only
+ * expected if the exchange is not already waiting for one.
+ *
+ * @param[in] ec             The exchange the message is sent on
+ * @param[in] msgTypeData    The type data of the kMsgToSend output event
+ * @param[in] expectResponse Whether the message expects a response in a stop-and-wait transfer
+ */
+Messaging::SendFlags GetTransferMessageSendFlags(const Messaging::ExchangeContext & ec,
+                                                 const TransferSession::MessageTypeData & msgTypeData, bool expectResponse);
+
 /**
  * An abstract class with methods for handling BDX messages from an ExchangeContext and polling a TransferSession state machine.
  *
@@ -86,7 +100,8 @@ protected:
     static void PollTimerHandler(chip::System::Layer * systemLayer, void * appState);
 
     /**
-     * Polls the TransferSession object and calls HandleTransferSessionOutput.
+     * Polls the TransferSession object and calls HandleTransferSessionOutput. For a windowed transfer, this is repeated until
+     * there is no more output.
      */
     void PollForOutput();
 
@@ -354,6 +354,39 @@ void SendAndVerifyBlockAck(TransferSession & ackReceiver, TransferSession & ackS
     VerifyNoMoreOutput(ackReceiver);
 }
 
+#if CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+// Helper method for preparing a Block in a windowed transfer. The Block message is left in outEvent so that the caller can decide
+// when, or whether, it reaches the receiver.
+void PrepareWindowedBlock(TransferSession & sender, TransferSession::OutputEvent & outEvent, uint32_t blockCounter, bool isEof)
+{
+    uint8_t fakeBlockData[8];
+    memset(fakeBlockData, static_cast<uint8_t>(blockCounter), sizeof(fakeBlockData));
+
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeBlockData;
+    blockData.Length = sizeof(fakeBlockData);
+    blockData.IsEof  = isEof;
+
+    CHIP_ERROR err = sender.PrepareBlock(blockData);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    sender.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+    VerifyBdxMessageToSend(outEvent, isEof ? MessageType::BlockEOF : MessageType::Block);
+    EXPECT_TRUE(outEvent.msgTypeData.IsWindowed);
+}
+
+// Helper method for verifying that a Block given to the application in a windowed transfer matches the one sent by
+// PrepareWindowedBlock().
+void VerifyWindowedBlockReceived(const TransferSession::OutputEvent & outEvent, uint32_t blockCounter, bool isEof)
+{
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kBlockReceived);
+    EXPECT_EQ(outEvent.blockdata.BlockCounter, blockCounter);
+    EXPECT_EQ(outEvent.blockdata.IsEof, isEof);
+    ASSERT_NE(outEvent.blockdata.Data, nullptr);
+    EXPECT_EQ(outEvent.blockdata.Data[0], static_cast<uint8_t>(blockCounter));
+}
+#endif // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+
 struct TestBdxTransferSession : public ::testing::Test
 {
     static void SetUpTestSuite() { EXPECT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
@@ -759,3 +792,409 @@ TEST_F(TestBdxTransferSession, TestRejectTransfer)
     // Reject the transfer with a status
     SendAndVerifyRejectMsg(outEvent, respondingSender, StatusCode::kResponderBusy, initiatingReceiver);
 }
+
+#if CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
+// Test a windowed transfer using an initiating receiver and a responding sender, receiver drive. A full window of Blocks is sent
+// before any of them is queried, and the first one is lost and recovered from the repeated BlockQuery.
+TEST_F(TestBdxTransferSession, TestWindowedReceiverDrive)
+{
+    static_assert(TransferSession::kSendWindowSize >= 2, "Test requires at least two Blocks in flight");
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    // Chosen arbitrarily for this test
+    constexpr uint32_t numBlockSends = TransferSession::kSendWindowSize;
+    uint16_t proposedBlockSize       = 64;
+    System::Clock::Timeout timeout   = System::Clock::Seconds16(24);
+    TransferControlFlags driveMode   = TransferControlFlags::kReceiverDrive;
+
+    // ReceiveInit parameters
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = proposedBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+    initOptions.Windowed         = true;
+
+    // Initialize respondingSender and pass ReceiveInit message
+    BitFlags<TransferControlFlags> senderOpts;
+    senderOpts.Set(driveMode);
+
+    SendAndVerifyTransferInit(outEvent, timeout, initiatingReceiver, TransferRole::kReceiver, initOptions, respondingSender,
+                              senderOpts, proposedBlockSize);
+    EXPECT_TRUE(outEvent.transferInitData.Windowed);
+    EXPECT_TRUE(respondingSender.IsWindowedProposed());
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = respondingSender.GetControlMode();
+    acceptData.MaxBlockSize = proposedBlockSize;
+    acceptData.Windowed     = true;
+
+    SendAndVerifyAcceptMsg(outEvent, respondingSender, TransferRole::kSender, acceptData, initiatingReceiver, initOptions);
+    EXPECT_TRUE(outEvent.transferAcceptData.Windowed);
+    EXPECT_TRUE(respondingSender.IsWindowed());
+    EXPECT_TRUE(initiatingReceiver.IsWindowed());
+
+    // The first BlockQuery opens the window
+    SendAndVerifyQuery(respondingSender, initiatingReceiver, outEvent);
+
+    // Verify that the sender asks for another Block after each one until the window is full
+    System::PacketBufferHandle blockMsgs[numBlockSends];
+    TransferSession::MessageTypeData blockMsgTypes[numBlockSends];
+    for (uint32_t i = 0; i < numBlockSends; i++)
+    {
+        bool isEof = (i == numBlockSends - 1);
+
+        PrepareWindowedBlock(respondingSender, outEvent, i, isEof);
+        blockMsgs[i]     = std::move(outEvent.MsgData);
+        blockMsgTypes[i] = outEvent.msgTypeData;
+
+        if (!isEof)
+        {
+            respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+            EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kQueryReceived);
+        }
+        VerifyNoMoreOutput(respondingSender);
+    }
+
+    // Lose Block 0. The next Block reveals the gap, so the receiver repeats its BlockQuery right away.
+    blockMsgs[0] = nullptr;
+    err          = AttachHeaderAndSend(blockMsgTypes[1], std::move(blockMsgs[1]), initiatingReceiver);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+    VerifyBdxMessageToSend(outEvent, MessageType::BlockQuery);
+    EXPECT_TRUE(outEvent.msgTypeData.IsWindowed);
+    VerifyNoMoreOutput(initiatingReceiver);
+    TransferSession::MessageTypeData repeatedQueryType = outEvent.msgTypeData;
+    System::PacketBufferHandle repeatedQuery           = std::move(outEvent.MsgData);
+
+    // The gap is only reported once, and later Blocks are buffered until the missing one arrives
+    for (uint32_t i = 2; i < numBlockSends; i++)
+    {
+        err = AttachHeaderAndSend(blockMsgTypes[i], std::move(blockMsgs[i]), initiatingReceiver);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        VerifyNoMoreOutput(initiatingReceiver);
+    }
+
+    // The repeated BlockQuery makes the sender retransmit Block 0
+    err = AttachHeaderAndSend(repeatedQueryType, std::move(repeatedQuery), respondingSender);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+    VerifyBdxMessageToSend(outEvent, MessageType::Block);
+    VerifyNoMoreOutput(respondingSender);
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingReceiver);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    // Verify that the Blocks are given to the application in order, one per BlockQuery
+    for (uint32_t i = 0; i < numBlockSends; i++)
+    {
+        bool isEof = (i == numBlockSends - 1);
+
+        if (i > 0)
+        {
+            err = initiatingReceiver.PrepareBlockQuery();
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+            initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+            EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+            VerifyBdxMessageToSend(outEvent, MessageType::BlockQuery);
+            EXPECT_TRUE(outEvent.msgTypeData.IsWindowed);
+
+            // The BlockEOF was already sent, so the sender has nothing more to ask for
+            err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingSender);
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+            VerifyNoMoreOutput(respondingSender);
+        }
+
+        initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+        VerifyWindowedBlockReceived(outEvent, i, isEof);
+        VerifyNoMoreOutput(initiatingReceiver);
+    }
+
+    SendAndVerifyBlockAck(respondingSender, initiatingReceiver, outEvent, true);
+}
+
+// Test that a windowed transfer retransmits the first unacknowledged Block once the retransmit timeout expires, using an initiating
+// sender and a responding receiver, sender drive.
+TEST_F(TestBdxTransferSession, TestWindowedRetransmitTimeout)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingSender;
+    TransferSession respondingReceiver;
+
+    // Chosen arbitrarily for this test
+    uint16_t proposedBlockSize     = 64;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+    TransferControlFlags driveMode = TransferControlFlags::kSenderDrive;
+
+    System::Clock::Timestamp retransmitTime =
+        kNoAdvanceTime + System::Clock::Milliseconds32(CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT_MS);
+
+    // SendInit parameters
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = proposedBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+    initOptions.Windowed         = true;
+
+    // Initialize respondingReceiver and pass SendInit message
+    BitFlags<TransferControlFlags> receiverOpts;
+    receiverOpts.Set(driveMode);
+
+    SendAndVerifyTransferInit(outEvent, timeout, initiatingSender, TransferRole::kSender, initOptions, respondingReceiver,
+                              receiverOpts, proposedBlockSize);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = respondingReceiver.GetControlMode();
+    acceptData.MaxBlockSize = proposedBlockSize;
+    acceptData.Windowed     = true;
+
+    SendAndVerifyAcceptMsg(outEvent, respondingReceiver, TransferRole::kReceiver, acceptData, initiatingSender, initOptions);
+    EXPECT_TRUE(initiatingSender.IsWindowed());
+    EXPECT_TRUE(respondingReceiver.IsWindowed());
+
+    // Send Block 0 and the BlockEOF without waiting for a BlockAck, and lose Block 0
+    PrepareWindowedBlock(initiatingSender, outEvent, 0, false);
+    initiatingSender.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kAckReceived);
+
+    PrepareWindowedBlock(initiatingSender, outEvent, 1, true);
+    VerifyNoMoreOutput(initiatingSender);
+
+    // In Sender Drive, the receiver has nothing to acknowledge until Block 0 arrives
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingReceiver);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    VerifyNoMoreOutput(respondingReceiver);
+
+    // Verify that Block 0 is retransmitted once, when the retransmit timeout expires
+    initiatingSender.PollOutput(outEvent, retransmitTime - System::Clock::Milliseconds32(1));
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kNone);
+    initiatingSender.PollOutput(outEvent, retransmitTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+    VerifyBdxMessageToSend(outEvent, MessageType::Block);
+    EXPECT_TRUE(outEvent.msgTypeData.IsWindowed);
+    TransferSession::OutputEvent noMoreOutput;
+    initiatingSender.PollOutput(noMoreOutput, retransmitTime);
+    EXPECT_EQ(noMoreOutput.EventType, TransferSession::OutputEventType::kNone);
+
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingReceiver);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyWindowedBlockReceived(outEvent, 0, false);
+    VerifyNoMoreOutput(respondingReceiver);
+
+    // Acknowledging Block 0 gives the buffered BlockEOF to the application
+    err = respondingReceiver.PrepareBlockAck();
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+    VerifyBdxMessageToSend(outEvent, MessageType::BlockAck);
+    EXPECT_TRUE(outEvent.msgTypeData.IsWindowed);
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingSender);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    VerifyNoMoreOutput(initiatingSender);
+
+    respondingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyWindowedBlockReceived(outEvent, 1, true);
+    VerifyNoMoreOutput(respondingReceiver);
+
+    SendAndVerifyBlockAck(initiatingSender, respondingReceiver, outEvent, true);
+}
+
+// Test that a transfer falls back to one Block at a time when the responder does not accept the windowed mode, and that the
+// windowed mode cannot be accepted when it was not proposed.
+TEST_F(TestBdxTransferSession, TestWindowedNotAccepted)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    // Chosen arbitrarily for this test
+    uint16_t proposedBlockSize     = 64;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+    TransferControlFlags driveMode = TransferControlFlags::kReceiverDrive;
+
+    // ReceiveInit parameters
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = proposedBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+    initOptions.Windowed         = true;
+
+    BitFlags<TransferControlFlags> senderOpts;
+    senderOpts.Set(driveMode);
+
+    SendAndVerifyTransferInit(outEvent, timeout, initiatingReceiver, TransferRole::kReceiver, initOptions, respondingSender,
+                              senderOpts, proposedBlockSize);
+    EXPECT_TRUE(respondingSender.IsWindowedProposed());
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = respondingSender.GetControlMode();
+    acceptData.MaxBlockSize = proposedBlockSize;
+
+    SendAndVerifyAcceptMsg(outEvent, respondingSender, TransferRole::kSender, acceptData, initiatingReceiver, initOptions);
+    EXPECT_FALSE(outEvent.transferAcceptData.Windowed);
+    EXPECT_FALSE(respondingSender.IsWindowed());
+    EXPECT_FALSE(initiatingReceiver.IsWindowed());
+
+    // Verify that the transfer proceeds one Block at a time
+    SendAndVerifyQuery(respondingSender, initiatingReceiver, outEvent);
+    SendAndVerifyArbitraryBlock(respondingSender, initiatingReceiver, outEvent, true, 0);
+    SendAndVerifyBlockAck(respondingSender, initiatingReceiver, outEvent, true);
+
+    // A responder cannot accept the windowed mode when the initiator did not propose it
+    TransferSession otherReceiver;
+    TransferSession otherSender;
+    initOptions.Windowed = false;
+
+    SendAndVerifyTransferInit(outEvent, timeout, otherReceiver, TransferRole::kReceiver, initOptions, otherSender, senderOpts,
+                              proposedBlockSize);
+    EXPECT_FALSE(otherSender.IsWindowedProposed());
+
+    acceptData.Windowed = true;
+    EXPECT_EQ(otherSender.AcceptTransfer(acceptData), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+// Test that a Block that arrives too far ahead of the window makes the receiver repeat its BlockQuery right away, so that the
+// sender retransmits the first missing Block without waiting for the retransmit timeout.
+TEST_F(TestBdxTransferSession, TestWindowedOutOfWindowBlock)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    // Chosen arbitrarily for this test
+    uint16_t proposedBlockSize     = 64;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+    TransferControlFlags driveMode = TransferControlFlags::kReceiverDrive;
+
+    // ReceiveInit parameters
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = proposedBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+    initOptions.Windowed         = true;
+
+    BitFlags<TransferControlFlags> senderOpts;
+    senderOpts.Set(driveMode);
+
+    SendAndVerifyTransferInit(outEvent, timeout, initiatingReceiver, TransferRole::kReceiver, initOptions, respondingSender,
+                              senderOpts, proposedBlockSize);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = respondingSender.GetControlMode();
+    acceptData.MaxBlockSize = proposedBlockSize;
+    acceptData.Windowed     = true;
+
+    SendAndVerifyAcceptMsg(outEvent, respondingSender, TransferRole::kSender, acceptData, initiatingReceiver, initOptions);
+    EXPECT_TRUE(initiatingReceiver.IsWindowed());
+
+    SendAndVerifyQuery(respondingSender, initiatingReceiver, outEvent);
+
+    // Send Block 0 and lose it
+    PrepareWindowedBlock(respondingSender, outEvent, 0, false);
+    respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kQueryReceived);
+    VerifyNoMoreOutput(respondingSender);
+
+    // A Block beyond the window of the receiver cannot be buffered
+    uint8_t fakeBlockData[8] = { 0 };
+    DataBlock outOfWindowBlock;
+    outOfWindowBlock.BlockCounter = TransferSession::kMaxWindowSize;
+    outOfWindowBlock.Data         = fakeBlockData;
+    outOfWindowBlock.DataLength   = sizeof(fakeBlockData);
+
+    System::PacketBufferHandle outOfWindowMsg = System::PacketBufferHandle::New(outOfWindowBlock.MessageSize());
+    ASSERT_FALSE(outOfWindowMsg.IsNull());
+    Encoding::LittleEndian::PacketBufferWriter bbuf(std::move(outOfWindowMsg), outOfWindowBlock.MessageSize());
+    outOfWindowBlock.WriteToBuffer(bbuf);
+    outOfWindowMsg = bbuf.Finalize();
+    ASSERT_FALSE(outOfWindowMsg.IsNull());
+
+    TransferSession::MessageTypeData blockMsgType;
+    blockMsgType.ProtocolId  = Protocols::BDX::Id;
+    blockMsgType.MessageType = static_cast<uint8_t>(MessageType::Block);
+    blockMsgType.IsWindowed  = true;
+
+    // Verify that the receiver repeats its BlockQuery instead of dropping the Block silently
+    err = AttachHeaderAndSend(blockMsgType, std::move(outOfWindowMsg), initiatingReceiver);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+    VerifyBdxMessageToSend(outEvent, MessageType::BlockQuery);
+    EXPECT_TRUE(outEvent.msgTypeData.IsWindowed);
+    VerifyNoMoreOutput(initiatingReceiver);
+
+    // The repeated BlockQuery makes the sender retransmit Block 0 right away
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingSender);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kMsgToSend);
+    VerifyBdxMessageToSend(outEvent, MessageType::Block);
+    VerifyNoMoreOutput(respondingSender);
+
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingReceiver);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyWindowedBlockReceived(outEvent, 0, false);
+    VerifyNoMoreOutput(initiatingReceiver);
+}
+#else
+// Test that a proposal of the windowed mode is ignored when it is disabled, so the transfer proceeds one Block at a time.
+TEST_F(TestBdxTransferSession, TestWindowedDisabled)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    // Chosen arbitrarily for this test
+    uint16_t proposedBlockSize     = 64;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+    TransferControlFlags driveMode = TransferControlFlags::kReceiverDrive;
+
+    // ReceiveInit parameters
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = proposedBlockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+    initOptions.Windowed         = true;
+
+    BitFlags<TransferControlFlags> senderOpts;
+    senderOpts.Set(driveMode);
+
+    SendAndVerifyTransferInit(outEvent, timeout, initiatingReceiver, TransferRole::kReceiver, initOptions, respondingSender,
+                              senderOpts, proposedBlockSize);
+    EXPECT_FALSE(outEvent.transferInitData.Windowed);
+    EXPECT_FALSE(respondingSender.IsWindowedProposed());
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = respondingSender.GetControlMode();
+    acceptData.MaxBlockSize = proposedBlockSize;
+    acceptData.Windowed     = true;
+    EXPECT_EQ(respondingSender.AcceptTransfer(acceptData), CHIP_ERROR_INVALID_ARGUMENT);
+
+    acceptData.Windowed = false;
+    SendAndVerifyAcceptMsg(outEvent, respondingSender, TransferRole::kSender, acceptData, initiatingReceiver, initOptions);
+    EXPECT_FALSE(respondingSender.IsWindowed());
+    EXPECT_FALSE(initiatingReceiver.IsWindowed());
+
+    SendAndVerifyQuery(respondingSender, initiatingReceiver, outEvent);
+    SendAndVerifyArbitraryBlock(respondingSender, initiatingReceiver, outEvent, true, 0);
+    SendAndVerifyBlockAck(respondingSender, initiatingReceiver, outEvent, true);
+}
+#endif // CHIP_CONFIG_BDX_ENABLE_WINDOWED_TRANSFER
@@ -48,23 +48,40 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     mGroupDataProvider         = responderGroupDataProvider;
 
     // Set up the group state provider that persists across all handshakes.
-    GetSession().SetGroupDataProvider(mGroupDataProvider);
+    for (auto & responder : mResponders)
+    {
+        responder.mSession.SetGroupDataProvider(mGroupDataProvider);
+    }
 
     ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
     mExchangeManager->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
 
-    PrepareForSessionEstablishment();
+    mReadyResponder = nullptr;
+    OnHandshakeDone(mResponders[0]);
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec)
+size_t CASEServer::ActiveHandshakeCount() const
+{
+    size_t count = 0;
+    for (const auto & responder : mResponders)
+    {
+        if (!responder.IsIdle() && &responder != mReadyResponder)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+CHIP_ERROR CASEServer::InitCASEHandshake(Responder & responder, Messaging::ExchangeContext * ec)
 {
     MATTER_TRACE_SCOPE("InitCASEHandshake", "CASEServer");
     VerifyOrReturnError(ec != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
     // Hand over the exchange context to the CASE session.
-    ec->SetDelegate(&GetSession());
+    ec->SetDelegate(&responder.mSession);
 
     return CHIP_NO_ERROR;
 }
@@ -81,44 +98,29 @@ CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const
 {
     MATTER_TRACE_SCOPE("OnMessageReceived", "CASEServer");
 
-    bool busy = GetSession().GetState() != CASESession::State::kInitialized;
+    // The ready responder is already running a handshake, bring up an idle one for this Sigma1.
+    PrepareNextResponder();
+
+    bool busy = mReadyResponder == nullptr;
     CHIP_FAULT_INJECT(FaultInjection::kFault_CASEServerBusy, busy = true);
     if (busy)
     {
-        // We are in the middle of CASE handshake
+        // Every responder is in the middle of a CASE handshake
 
         // Invoke watchdog to fix any stuck handshakes
-        bool watchdogFired = GetSession().InvokeBackgroundWorkWatchdog();
-        if (!watchdogFired)
+        bool watchdogFired = false;
+        for (auto & responder : mResponders)
         {
-            // Handshake wasn't stuck, send the busy status report and let the existing handshake continue.
-
-            // A successful CASE handshake can take several seconds and some may time out (30 seconds or more).
-
-            System::Clock::Milliseconds16 delay = System::Clock::kZero;
-            if (GetSession().GetState() == CASESession::State::kSentSigma2)
+            if (!responder.IsIdle() && &responder != mReadyResponder)
             {
-                // The delay should be however long we think it will take for
-                // that to time out.
-                auto sigma2Timeout = CASESession::ComputeSigma2ResponseTimeout(GetSession().GetRemoteMRPConfig());
-                if (sigma2Timeout < System::Clock::Milliseconds16::max())
-                {
-                    delay = std::chrono::duration_cast<System::Clock::Milliseconds16>(sigma2Timeout);
-                }
-                else
-                {
-                    // Avoid overflow issues, just wait for as long as we can to
-                    // get close to our expected Sigma2 timeout.
-                    delay = System::Clock::Milliseconds16::max();
-                }
+                watchdogFired = responder.mSession.InvokeBackgroundWorkWatchdog() || watchdogFired;
             }
-            else
-            {
-                // For now, setting minimum wait time to 5000 milliseconds if we
-                // have no other information.
-                delay = System::Clock::Milliseconds16(5000);
-            }
-            CHIP_ERROR err = SendBusyStatusReport(ec, delay);
+        }
+
+        if (!watchdogFired || mReadyResponder == nullptr)
+        {
+            // No handshake was stuck, send the busy status report and let the existing handshakes continue.
+            CHIP_ERROR err = SendBusyStatusReport(ec, ComputeBusyDelay());
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
@@ -135,13 +137,15 @@ CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const
 
     ChipLogProgress(Inet, "CASE Server received Sigma1 message %s EC %p", ". Starting handshake.", ec);
 
-    CHIP_ERROR err = InitCASEHandshake(ec);
+    Responder & responder = *mReadyResponder;
+
+    CHIP_ERROR err = InitCASEHandshake(responder, ec);
     SuccessOrExit(err);
 
-    // TODO - Enable multiple concurrent CASE session establishment
-    // https://github.com/project-chip/connectedhomeip/issues/8342
+    // The responder now belongs to this handshake until it reports its outcome.
+    mReadyResponder = nullptr;
 
-    err = GetSession().OnMessageReceived(ec, payloadHeader, std::move(payload));
+    err = responder.mSession.OnMessageReceived(ec, payloadHeader, std::move(payload));
     SuccessOrExit(err);
 
 exit:
@@ -150,9 +154,9 @@ exit:
     return err;
 }
 
-void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer)
+CHIP_ERROR CASEServer::PrepareForSessionEstablishment(Responder & responder, const ScopedNodeId & previouslyEstablishedPeer)
 {
-    GetSession().Clear();
+    responder.mSession.Clear();
 
     //
     // This releases our reference to a previously pinned session. If that was a successfully established session and is now
@@ -163,7 +167,7 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // de-allocated since no one else is holding onto this session. This will mean that when we get to allocating a session below,
     // we'll at least have one free session available in the session table, and won't need to evict an arbitrary session.
     //
-    mPinnedSecureSession.ClearValue();
+    responder.mPinnedSecureSession.ClearValue();
 
     //
     // Indicate to the underlying CASE session to prepare for session establishment requests coming its way. This will
@@ -174,16 +178,9 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // slot (and thereby free'ing up the slot for the next session attempt). However, this transfer isn't necessary - just
     // evicting a session will ensure it is available for the next attempt.
     //
-    // This call can fail if we have run out memory to allocate SecureSessions. Continuing without taking any action
-    // however will render this node deaf to future handshake requests, so it's better to die here to raise attention to the problem
-    // / facilitate recovery.
-    //
-    // TODO(#17568): Once session eviction is actually in place, this call should NEVER fail and if so, is a logic bug.
-    // Dying here on failure is even more appropriate then.
-    //
-    VerifyOrDie(GetSession().PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
-                                                            mCertificateValidityPolicy, this, previouslyEstablishedPeer,
-                                                            GetLocalMRPConfig()) == CHIP_NO_ERROR);
+    ReturnErrorOnFailure(responder.mSession.PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
+                                                                           mCertificateValidityPolicy, &responder,
+                                                                           previouslyEstablishedPeer, GetLocalMRPConfig()));
 
     //
     // PairingSession::mSecureSessionHolder is a weak-reference. If MarkForEviction is called on this session, the session is
@@ -195,36 +192,121 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     //
     // Let's create a SessionHandle strong-reference to it to keep it resident.
     //
-    mPinnedSecureSession = GetSession().CopySecureSession();
+    responder.mPinnedSecureSession = responder.mSession.CopySecureSession();
+    VerifyOrReturnError(responder.mPinnedSecureSession.HasValue(), CHIP_ERROR_INCORRECT_STATE);
 
+    return CHIP_NO_ERROR;
+}
+
+void CASEServer::OnHandshakeDone(Responder & responder, const ScopedNodeId & previouslyEstablishedPeer)
+{
+    if (mReadyResponder != nullptr && mReadyResponder != &responder)
+    {
+        // Another responder is already waiting for the next Sigma1, return this one to the pool.
+        responder.Release();
+        return;
+    }
+
+    //
+    // This call can fail if we have run out memory to allocate SecureSessions. Continuing without taking any action
+    // however will render this node deaf to future handshake requests, so it's better to die here to raise attention to the problem
+    // / facilitate recovery.
     //
-    // If we've gotten this far, it means we have successfully allocated a SecureSession to back our next attempt. If we haven't,
-    // there is a bug somewhere and we should raise attention to it by dying.
+    // TODO(#17568): Once session eviction is actually in place, this call should NEVER fail and if so, is a logic bug.
+    // Dying here on failure is even more appropriate then.
     //
-    VerifyOrDie(mPinnedSecureSession.HasValue());
+    VerifyOrDie(PrepareForSessionEstablishment(responder, previouslyEstablishedPeer) == CHIP_NO_ERROR);
+    mReadyResponder = &responder;
+}
+
+void CASEServer::PrepareNextResponder()
+{
+    VerifyOrReturn(mReadyResponder == nullptr);
+
+    for (auto & responder : mResponders)
+    {
+        if (!responder.IsIdle())
+        {
+            continue;
+        }
+
+        CHIP_ERROR err = PrepareForSessionEstablishment(responder);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "CASE Server could not allocate a session for another handshake: %" CHIP_ERROR_FORMAT, err.Format());
+            responder.Release();
+            return;
+        }
+
+        mReadyResponder = &responder;
+        return;
+    }
+}
+
+System::Clock::Milliseconds16 CASEServer::ComputeBusyDelay()
+{
+    // A successful CASE handshake can take several seconds and some may time out (30 seconds or more). Report how long we
+    // think it will take for the first of the ongoing handshakes to be done.
+    bool haveDelay                      = false;
+    System::Clock::Milliseconds16 delay = System::Clock::kZero;
+    for (auto & responder : mResponders)
+    {
+        if (responder.IsIdle() || &responder == mReadyResponder)
+        {
+            continue;
+        }
+
+        // For now, setting minimum wait time to 5000 milliseconds if we
+        // have no other information.
+        System::Clock::Milliseconds16 responderDelay = System::Clock::Milliseconds16(5000);
+        if (responder.mSession.GetState() == CASESession::State::kSentSigma2)
+        {
+            // The delay should be however long we think it will take for
+            // that to time out.
+            auto sigma2Timeout = CASESession::ComputeSigma2ResponseTimeout(responder.mSession.GetRemoteMRPConfig());
+            if (sigma2Timeout < System::Clock::Milliseconds16::max())
+            {
+                responderDelay = std::chrono::duration_cast<System::Clock::Milliseconds16>(sigma2Timeout);
+            }
+            else
+            {
+                // Avoid overflow issues, just wait for as long as we can to
+                // get close to our expected Sigma2 timeout.
+                responderDelay = System::Clock::Milliseconds16::max();
+            }
+        }
+
+        if (!haveDelay || responderDelay < delay)
+        {
+            delay     = responderDelay;
+            haveDelay = true;
+        }
+    }
+
+    return haveDelay ? delay : System::Clock::Milliseconds16(5000);
 }
 
-void CASEServer::OnSessionEstablishmentError(CHIP_ERROR err)
+void CASEServer::Responder::OnSessionEstablishmentError(CHIP_ERROR err)
 {
     MATTER_TRACE_SCOPE("OnSessionEstablishmentError", "CASEServer");
     ChipLogError(Inet, "CASE Session establishment failed: %" CHIP_ERROR_FORMAT, err.Format());
 
     MATTER_TRACE_SCOPE("CASEFail", "CASESession");
-    PrepareForSessionEstablishment();
+    mServer->OnHandshakeDone(*this);
 }
 
-void CASEServer::OnSessionEstablished(const SessionHandle & session)
+void CASEServer::Responder::OnSessionEstablished(const SessionHandle & session)
 {
     MATTER_TRACE_SCOPE("OnSessionEstablished", "CASEServer");
     ChipLogProgress(Inet, "CASE Session established to peer: " ChipLogFormatScopedNodeId,
                     ChipLogValueScopedNodeId(session->GetPeer()));
-    PrepareForSessionEstablishment(session->GetPeer());
+    mServer->OnHandshakeDone(*this, session->GetPeer());
 }
 
 CHIP_ERROR CASEServer::SendBusyStatusReport(Messaging::ExchangeContext * ec, System::Clock::Milliseconds16 minimumWaitTime)
 {
     MATTER_TRACE_SCOPE("SendBusyStatusReport", "CASEServer");
-    ChipLogProgress(Inet, "Already in the middle of CASE handshake, sending busy status report");
+    ChipLogProgress(Inet, "Already in the middle of CASE handshakes, sending busy status report");
 
     System::PacketBufferHandle handle = Protocols::SecureChannel::StatusReport::MakeBusyStatusReportMessage(minimumWaitTime);
     VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
@@ -19,6 +19,7 @@
 
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/GroupDataProvider.h>
+#include <lib/core/CHIPConfig.h>
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/secure_channel/CASESession.h>
@@ -26,18 +27,22 @@
 
 namespace chip {
 
-class CASEServer : public SessionEstablishmentDelegate,
-                   public Messaging::UnsolicitedMessageHandler,
-                   public Messaging::ExchangeDelegate
+class CASEServer : public Messaging::UnsolicitedMessageHandler, public Messaging::ExchangeDelegate
 {
 public:
-    CASEServer() {}
+    CASEServer()
+    {
+        for (auto & responder : mResponders)
+        {
+            responder.mServer = this;
+        }
+    }
     ~CASEServer() override { Shutdown(); }
 
     /*
-     * This method will shutdown this object, releasing the strong reference to the pinned SecureSession object.
-     * It will also unregister the unsolicited handler and clear out the session object (which will release the weak
-     * reference through the underlying SessionHolder).
+     * This method will shutdown this object, releasing the strong references to the pinned SecureSession objects.
+     * It will also unregister the unsolicited handler and clear out the session objects (which will release the weak
+     * references through the underlying SessionHolders).
      *
      */
     void Shutdown()
@@ -48,8 +53,11 @@ public:
             mExchangeManager = nullptr;
         }
 
-        GetSession().Clear();
-        mPinnedSecureSession.ClearValue();
+        for (auto & responder : mResponders)
+        {
+            responder.Release();
+        }
+        mReadyResponder = nullptr;
     }
 
     CHIP_ERROR ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, SessionManager * sessionManager,
@@ -57,10 +65,6 @@ public:
                                              Credentials::CertificateValidityPolicy * policy,
                                              Credentials::GroupDataProvider * responderGroupDataProvider);
 
-    //////////// SessionEstablishmentDelegate Implementation ///////////////
-    void OnSessionEstablishmentError(CHIP_ERROR error) override;
-    void OnSessionEstablished(const SessionHandle & session) override;
-
     //// UnsolicitedMessageHandler Implementation ////
     CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override;
 
@@ -68,53 +72,96 @@ public:
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
     void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
-    Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return GetSession().GetMessageDispatch(); }
+    Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return SessionEstablishmentExchangeDispatch::Instance(); }
 
-    CASESession & GetSession() { return mPairingSession; }
+    /*
+     * Returns the number of handshakes currently in progress.
+     */
+    size_t ActiveHandshakeCount() const;
 
 private:
+    //
+    // One responder side of a CASE handshake. Each responder is the establishment delegate of its own session, so that the
+    // outcome of a handshake can be tied back to the responder that ran it.
+    //
+    class Responder : public SessionEstablishmentDelegate
+    {
+    public:
+        void OnSessionEstablishmentError(CHIP_ERROR error) override;
+        void OnSessionEstablished(const SessionHandle & session) override;
+
+        // A responder is idle when it holds no SecureSession; it is either ready for a Sigma1 or running a handshake otherwise.
+        bool IsIdle() const { return !mPinnedSecureSession.HasValue(); }
+
+        void Release()
+        {
+            mSession.Clear();
+            mPinnedSecureSession.ClearValue();
+        }
+
+        CASEServer * mServer = nullptr;
+        CASESession mSession;
+
+        //
+        // While this responder is establishing a session, this is used to maintain an additional, strong reference to the
+        // underlying SecureSession. This is because the existing reference in PairingSession is a weak one (i.e a SessionHolder)
+        // and can lose its reference if the session is evicted for any reason.
+        //
+        // This initially points to a session that is not yet active. Upon activation, it transfers ownership of the session to
+        // the SecureSessionManager and this reference is released before simultaneously acquiring ownership of a new
+        // SecureSession.
+        //
+        Optional<SessionHandle> mPinnedSecureSession;
+    };
+
     Messaging::ExchangeManager * mExchangeManager                       = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage                = nullptr;
     Credentials::CertificateValidityPolicy * mCertificateValidityPolicy = nullptr;
 
-    //
-    // When we're in the process of establishing a session, this is used
-    // to maintain an additional, strong reference to the underlying SecureSession.
-    // This is because the existing reference in PairingSession is a weak one
-    // (i.e a SessionHolder) and can lose its reference if the session is evicted
-    // for any reason.
-    //
-    // This initially points to a session that is not yet active. Upon activation, it
-    // transfers ownership of the session to the SecureSessionManager and this reference
-    // is released before simultaneously acquiring ownership of a new SecureSession.
-    //
-    Optional<SessionHandle> mPinnedSecureSession;
+    Responder mResponders[CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES];
 
-    CASESession mPairingSession;
+    // The responder waiting for the next Sigma1, or nullptr if every responder is running a handshake.
+    Responder * mReadyResponder      = nullptr;
     SessionManager * mSessionManager = nullptr;
 
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
 
-    CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
+    CHIP_ERROR InitCASEHandshake(Responder & responder, Messaging::ExchangeContext * ec);
 
     /*
      * This will clean up any state from a previous session establishment
-     * attempt (if any) and setup the machinery to listen for and handle
-     * any session handshakes there-after.
+     * attempt (if any) on the responder and setup the machinery to listen for
+     * and handle any session handshakes there-after.
      *
      * If a session had previously been established successfully, previouslyEstablishedPeer
      * should be set to the scoped node-id of the peer associated with that session.
      *
      */
-    void PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
+    CHIP_ERROR PrepareForSessionEstablishment(Responder & responder,
+                                              const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
 
-    // If we are in the middle of handshake and receive a Sigma1 then respond with Busy status code.
+    /*
+     * Called when a responder is done with its handshake. The responder goes back to waiting for a Sigma1 if no other responder
+     * does, which must succeed for this node to keep accepting handshakes; it is returned to the pool otherwise.
+     */
+    void OnHandshakeDone(Responder & responder, const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
+
+    /*
+     * Once the ready responder started a handshake, prepare an idle responder, if any, for the next Sigma1. Failing to allocate a
+     * SecureSession for it is not fatal: the Sigma1 will get a busy response until a handshake completes.
+     */
+    void PrepareNextResponder();
+
+    // If all the responders are in the middle of a handshake and we receive a Sigma1 then respond with Busy status code.
     // @param[in] ec              Exchange Context
     // @param[in] minimumWaitTime Minimum wait time reported to client before it can attempt to resend sigma1
     //
     // @return CHIP_NO_ERROR on success, error code otherwise
     CHIP_ERROR SendBusyStatusReport(Messaging::ExchangeContext * ec, System::Clock::Milliseconds16 minimumWaitTime);
+
+    // Returns how long a Sigma1 initiator should wait before a busy responder may become available.
+    System::Clock::Milliseconds16 ComputeBusyDelay();
 };
 
 } // namespace chip
@@ -368,6 +368,11 @@ void CASESession::Clear()
 {
     MATTER_TRACE_SCOPE("Clear", "CASESession");
     // Cancel any outstanding work.
+    if (mSendSigma2Helper)
+    {
+        mSendSigma2Helper->CancelWork();
+        mSendSigma2Helper.reset();
+    }
     if (mSendSigma3Helper)
     {
         mSendSigma3Helper->CancelWork();
@@ -912,17 +917,9 @@ CHIP_ERROR CASESession::HandleSigma1_and_SendSigma2(System::PacketBufferHandle &
     switch (nextStep.Get<Step>())
     {
     case Step::kSendSigma2: {
-
-        System::PacketBufferHandle msgR2;
-        EncodeSigma2Inputs encodeSigma2;
-
-        SuccessOrExit(err = PrepareSigma2(encodeSigma2));
-        SuccessOrExit(err = EncodeSigma2(msgR2, encodeSigma2));
-
-        MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
-        SuccessOrExitAction(err = SendSigma2(std::move(msgR2)), MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err));
-
-        mDelegate->OnSessionEstablishmentStarted();
+        // Sigma2 is sent, and the delegate notified, once the ephemeral key exchange and the signature are done, which may
+        // happen in the background.
+        SuccessOrExit(err = SendSigma2a());
         break;
     }
     case Step::kSendSigma2Resume: {
@@ -1178,49 +1175,89 @@ CHIP_ERROR CASESession::SendSigma2Resume(System::PacketBufferHandle && msgR2Resu
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
+CASESession::SendSigma2Data::~SendSigma2Data()
 {
+    if (ephemeralKey != nullptr)
+    {
+        ephemeralKeyAllocator->ReleaseEphemeralKeypair(ephemeralKey);
+    }
+}
 
+CHIP_ERROR CASESession::SendSigma2a()
+{
     MATTER_TRACE_SCOPE("PrepareSigma2", "CASESession");
 
-    VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mLocalMRPConfig.HasValue(), CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(GetLocalSessionId().HasValue(), CHIP_ERROR_INCORRECT_STATE);
-    outSigma2Data.responderSessionId = GetLocalSessionId().Value();
+    auto helper = WorkHelper<SendSigma2Data>::Create(*this, &SendSigma2b, &CASESession::SendSigma2c);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+    {
+        auto & data = helper->mData;
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> icacBuf;
-    VerifyOrReturnError(icacBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(mLocalMRPConfig.HasValue(), CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(GetLocalSessionId().HasValue(), CHIP_ERROR_INCORRECT_STATE);
+        data.fabricIndex = mFabricIndex;
+        data.fabricTable = nullptr;
+        data.keystore    = nullptr;
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> nocBuf;
-    VerifyOrReturnError(nocBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        {
+            const FabricInfo * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
+            VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+            auto * keystore = mFabricsTable->GetOperationalKeystore();
+            if (!fabricInfo->HasOperationalKey() && keystore != nullptr && keystore->SupportsSignWithOpKeypairInBackground())
+            {
+                // NOTE: used to sign in background.
+                data.keystore = keystore;
+            }
+            else
+            {
+                // NOTE: used to sign in foreground.
+                data.fabricTable = mFabricsTable;
+            }
+        }
 
-    MutableByteSpan icaCert{ icacBuf.Get(), kMaxCHIPCertLength };
-    ReturnErrorOnFailure(mFabricsTable->FetchICACert(mFabricIndex, icaCert));
+        VerifyOrReturnError(data.icacBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        data.icaCert = MutableByteSpan{ data.icacBuf.Get(), kMaxCHIPCertLength };
 
-    MutableByteSpan nocCert{ nocBuf.Get(), kMaxCHIPCertLength };
-    ReturnErrorOnFailure(mFabricsTable->FetchNOCCert(mFabricIndex, nocCert));
+        VerifyOrReturnError(data.nocBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        data.nocCert = MutableByteSpan{ data.nocBuf.Get(), kMaxCHIPCertLength };
 
-    // Fill in the random value
-    ReturnErrorOnFailure(DRBG_get_bytes(&outSigma2Data.responderRandom[0], sizeof(outSigma2Data.responderRandom)));
+        ReturnErrorOnFailure(mFabricsTable->FetchICACert(mFabricIndex, data.icaCert));
+        ReturnErrorOnFailure(mFabricsTable->FetchNOCCert(mFabricIndex, data.nocCert));
 
-    // Generate an ephemeral keypair
-    mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
-    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
-    ReturnErrorOnFailure(mEphemeralKey->Initialize(ECPKeyTarget::ECDH));
-    outSigma2Data.responderEphPubKey = &mEphemeralKey->Pubkey();
+        // Fill in the random value
+        ReturnErrorOnFailure(DRBG_get_bytes(&data.responderRandom[0], sizeof(data.responderRandom)));
 
-    // Generate a Shared Secret
-    ReturnErrorOnFailure(mEphemeralKey->ECDH_derive_secret(mRemotePubKey, mSharedSecret));
+        // Generate a new resumption ID
+        ReturnErrorOnFailure(DRBG_get_bytes(mNewResumptionId.data(), mNewResumptionId.size()));
+        data.resumptionId = mNewResumptionId;
 
-    uint8_t msgSalt[kIPKSize + kSigmaParamRandomNumberSize + kP256_PublicKey_Length + kSHA256_Hash_Length];
+        // Generate an ephemeral keypair and a Shared Secret. The keystore only promises that SignWithOpKeypair may run in
+        // the background, so the key exchange stays on the event loop.
+        data.ephemeralKeyAllocator = mFabricsTable;
+        data.ephemeralKey          = mFabricsTable->AllocateEphemeralKeypairForCASE();
+        VerifyOrReturnError(data.ephemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
+        ReturnErrorOnFailure(data.ephemeralKey->Initialize(ECPKeyTarget::ECDH));
+        ReturnErrorOnFailure(data.ephemeralKey->ECDH_derive_secret(mRemotePubKey, data.sharedSecret));
+        data.remotePubKey = mRemotePubKey;
 
-    MutableByteSpan saltSpan(msgSalt);
-    ReturnErrorOnFailure(
-        ConstructSaltSigma2(ByteSpan(outSigma2Data.responderRandom), mEphemeralKey->Pubkey(), ByteSpan(mIPK), saltSpan));
+        if (data.keystore != nullptr)
+        {
+            ReturnErrorOnFailure(helper->ScheduleWork());
+            mSendSigma2Helper = helper;
+            mExchangeCtxt.Value()->WillSendMessage();
+            mState = State::kSendSigma2Pending;
+        }
+        else
+        {
+            ReturnErrorOnFailure(helper->DoWork());
+        }
+    }
 
-    AutoReleaseSessionKey sr2k(*mSessionManager->GetSessionKeystore());
-    ReturnErrorOnFailure(DeriveSigmaKey(saltSpan, ByteSpan(kKDFSR2Info), sr2k));
+    return CHIP_NO_ERROR;
+}
 
+CHIP_ERROR CASESession::SendSigma2b(SendSigma2Data & data, bool & cancel)
+{
     // Construct Sigma2 TBS Data
     P256ECDSASignature tbsData2Signature;
     {
@@ -1234,63 +1271,126 @@ CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
         VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
         MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
 
-        ReturnErrorOnFailure(ConstructTBSData(nocCert, icaCert, ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
-                                              ByteSpan(mRemotePubKey, mRemotePubKey.Length()), msgR2SignedSpan));
+        const P256PublicKey & ephemeralPubKey = data.ephemeralKey->Pubkey();
+        ReturnErrorOnFailure(ConstructTBSData(data.nocCert, data.icaCert, ByteSpan(ephemeralPubKey, ephemeralPubKey.Length()),
+                                              ByteSpan(data.remotePubKey, data.remotePubKey.Length()), msgR2SignedSpan));
 
         // Generate a Signature
-        ReturnErrorOnFailure(mFabricsTable->SignWithOpKeypair(mFabricIndex, msgR2SignedSpan, tbsData2Signature));
+        if (data.keystore != nullptr)
+        {
+            // Recommended case: delegate to operational keystore
+            ReturnErrorOnFailure(data.keystore->SignWithOpKeypair(data.fabricIndex, msgR2SignedSpan, tbsData2Signature));
+        }
+        else
+        {
+            // Legacy case: delegate to fabric table fabric info
+            ReturnErrorOnFailure(data.fabricTable->SignWithOpKeypair(data.fabricIndex, msgR2SignedSpan, tbsData2Signature));
+        }
     }
+
     // Construct Sigma2 TBE Data
-    size_t msgR2SignedEncLen = EstimateStructOverhead(nocCert.size(),                             // responderNoc
-                                                      icaCert.size(),                             // responderICAC
-                                                      tbsData2Signature.Length(),                 // signature
-                                                      SessionResumptionStorage::kResumptionIdSize // resumptionID
+    data.msgR2EncryptedLen = EstimateStructOverhead(data.nocCert.size(),                        // responderNoc
+                                                    data.icaCert.size(),                        // responderICAC
+                                                    tbsData2Signature.Length(),                 // signature
+                                                    SessionResumptionStorage::kResumptionIdSize // resumptionID
     );
 
-    VerifyOrReturnError(outSigma2Data.msgR2Encrypted.Alloc(msgR2SignedEncLen + CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES),
+    VerifyOrReturnError(data.msgR2Encrypted.Alloc(data.msgR2EncryptedLen + CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES),
                         CHIP_ERROR_NO_MEMORY);
 
-    TLVWriter tlvWriter;
-    tlvWriter.Init(outSigma2Data.msgR2Encrypted.Get(), msgR2SignedEncLen);
+    {
+        TLVWriter tlvWriter;
+        TLVType outerContainerType = kTLVType_NotSpecified;
 
-    TLVType outerContainerType = kTLVType_NotSpecified;
+        tlvWriter.Init(data.msgR2Encrypted.Get(), data.msgR2EncryptedLen);
+        ReturnErrorOnFailure(tlvWriter.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType));
+        ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderNOC), data.nocCert));
+        if (!data.icaCert.empty())
+        {
+            ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderICAC), data.icaCert));
+        }
 
-    ReturnErrorOnFailure(tlvWriter.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType));
-    ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderNOC), nocCert));
-    if (!icaCert.empty())
-    {
-        ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderICAC), icaCert));
-    }
+        // We are now done with ICAC and NOC certs so we can release the memory.
+        {
+            data.icacBuf.Free();
+            data.icaCert = MutableByteSpan{};
 
-    // We are now done with ICAC and NOC certs so we can release the memory.
-    {
-        icacBuf.Free();
-        icaCert = MutableByteSpan{};
+            data.nocBuf.Free();
+            data.nocCert = MutableByteSpan{};
+        }
 
-        nocBuf.Free();
-        nocCert = MutableByteSpan{};
+        ReturnErrorOnFailure(tlvWriter.PutBytes(AsTlvContextTag(TBEDataTags::kSignature), tbsData2Signature.ConstBytes(),
+                                                static_cast<uint32_t>(tbsData2Signature.Length())));
+        ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kResumptionID), data.resumptionId));
+        ReturnErrorOnFailure(tlvWriter.EndContainer(outerContainerType));
+        ReturnErrorOnFailure(tlvWriter.Finalize());
+        data.msgR2EncryptedLen = static_cast<size_t>(tlvWriter.GetLengthWritten());
     }
 
-    ReturnErrorOnFailure(tlvWriter.PutBytes(AsTlvContextTag(TBEDataTags::kSignature), tbsData2Signature.ConstBytes(),
-                                            static_cast<uint32_t>(tbsData2Signature.Length())));
+    return CHIP_NO_ERROR;
+}
 
-    // Generate a new resumption ID
-    ReturnErrorOnFailure(DRBG_get_bytes(mNewResumptionId.data(), mNewResumptionId.size()));
-    ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kResumptionID), mNewResumptionId));
+CHIP_ERROR CASESession::SendSigma2c(SendSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    System::PacketBufferHandle msgR2;
+    EncodeSigma2Inputs encodeSigma2;
+
+    uint8_t msgSalt[kIPKSize + kSigmaParamRandomNumberSize + kP256_PublicKey_Length + kSHA256_Hash_Length];
+
+    AutoReleaseSessionKey sr2k(*mSessionManager->GetSessionKeystore());
+
+    VerifyOrDieWithMsg(data.keystore == nullptr || mState == State::kSendSigma2Pending, SecureChannel, "Bad internal state.");
+
+    SuccessOrExit(err = status);
+    VerifyOrExit(mLocalMRPConfig.HasValue() && GetLocalSessionId().HasValue(), err = CHIP_ERROR_INCORRECT_STATE);
+
+    // The session owns the ephemeral keypair and the shared secret from now on.
+    mEphemeralKey     = data.ephemeralKey;
+    data.ephemeralKey = nullptr;
+    mSharedSecret     = data.sharedSecret;
+
+    // Generate S2K key
+    {
+        MutableByteSpan saltSpan(msgSalt);
+        SuccessOrExit(err = ConstructSaltSigma2(ByteSpan(data.responderRandom), mEphemeralKey->Pubkey(), ByteSpan(mIPK), saltSpan));
+        SuccessOrExit(err = DeriveSigmaKey(saltSpan, ByteSpan(kKDFSR2Info), sr2k));
+    }
 
-    ReturnErrorOnFailure(tlvWriter.EndContainer(outerContainerType));
-    ReturnErrorOnFailure(tlvWriter.Finalize());
-    msgR2SignedEncLen              = static_cast<size_t>(tlvWriter.GetLengthWritten());
-    outSigma2Data.encrypted2Length = msgR2SignedEncLen + CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
     // Generate the encrypted data blob
-    ReturnErrorOnFailure(AES_CCM_encrypt(outSigma2Data.msgR2Encrypted.Get(), msgR2SignedEncLen, nullptr, 0, sr2k.KeyHandle(),
-                                         kTBEData2_Nonce, kTBEDataNonceLength, outSigma2Data.msgR2Encrypted.Get(),
-                                         outSigma2Data.msgR2Encrypted.Get() + msgR2SignedEncLen,
-                                         CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES));
+    SuccessOrExit(err = AES_CCM_encrypt(data.msgR2Encrypted.Get(), data.msgR2EncryptedLen, nullptr, 0, sr2k.KeyHandle(),
+                                        kTBEData2_Nonce, kTBEDataNonceLength, data.msgR2Encrypted.Get(),
+                                        data.msgR2Encrypted.Get() + data.msgR2EncryptedLen, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES));
 
-    outSigma2Data.responderMrpConfig = &mLocalMRPConfig.Value();
+    memcpy(encodeSigma2.responderRandom, data.responderRandom, sizeof(encodeSigma2.responderRandom));
+    encodeSigma2.responderSessionId = GetLocalSessionId().Value();
+    encodeSigma2.responderEphPubKey = &mEphemeralKey->Pubkey();
+    encodeSigma2.msgR2Encrypted     = std::move(data.msgR2Encrypted);
+    encodeSigma2.encrypted2Length   = data.msgR2EncryptedLen + CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
+    encodeSigma2.responderMrpConfig = &mLocalMRPConfig.Value();
 
-    return CHIP_NO_ERROR;
+    SuccessOrExit(err = EncodeSigma2(msgR2, encodeSigma2));
+
+    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
+    SuccessOrExitAction(err = SendSigma2(std::move(msgR2)), MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err));
+
+    mDelegate->OnSessionEstablishmentStarted();
+
+exit:
+    mSendSigma2Helper.reset();
+
+    // If data.keystore is set, processing occurred in the background, so if an error occurred,
+    // need to send status report (normally occurs in HandleSigma1_and_SendSigma2), and discard
+    // exchange and abort pending establish (normally occurs in OnMessageReceived).
+    if (data.keystore != nullptr && err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+
+    return err;
 }
 
 CHIP_ERROR CASESession::EncodeSigma2(System::PacketBufferHandle & msgR2, EncodeSigma2Inputs & input)
@@ -2648,6 +2748,13 @@ bool CASESession::InvokeBackgroundWorkWatchdog()
 {
     bool watchdogFired = false;
 
+    if (mSendSigma2Helper && mSendSigma2Helper->UnableToScheduleAfterWorkCallback())
+    {
+        ChipLogError(SecureChannel, "SendSigma2Helper was unable to schedule the AfterWorkCallback");
+        mSendSigma2Helper->DoAfterWork();
+        watchdogFired = true;
+    }
+
     if (mSendSigma3Helper && mSendSigma3Helper->UnableToScheduleAfterWorkCallback())
     {
         ChipLogError(SecureChannel, "SendSigma3Helper was unable to schedule the AfterWorkCallback");
@@ -2675,6 +2782,8 @@ SessionEstablishmentStage CASESession::MapCASEStateToSessionEstablishmentStage(S
     case State::kSentSigma1:
     case State::kSentSigma1Resume:
         return SessionEstablishmentStage::kSentSigma1;
+    case State::kSendSigma2Pending:
+        return SessionEstablishmentStage::kReceivedSigma1;
     case State::kSentSigma2:
     case State::kSentSigma2Resume:
         return SessionEstablishmentStage::kSentSigma2;
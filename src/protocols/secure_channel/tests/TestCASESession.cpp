@@ -235,13 +235,31 @@ public:
         return mKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
     }
 
-    Crypto::P256Keypair * AllocateEphemeralKeypairForCASE() override { return Platform::New<Crypto::P256Keypair>(); }
+    bool SupportsSignWithOpKeypairInBackground() const override { return mSignInBackground; }
 
-    void ReleaseEphemeralKeypair(Crypto::P256Keypair * keypair) override { Platform::Delete<Crypto::P256Keypair>(keypair); }
+    Crypto::P256Keypair * AllocateEphemeralKeypairForCASE() override
+    {
+        mEphemeralKeypairCount++;
+        return Platform::New<Crypto::P256Keypair>();
+    }
+
+    void ReleaseEphemeralKeypair(Crypto::P256Keypair * keypair) override
+    {
+        if (keypair != nullptr)
+        {
+            mEphemeralKeypairCount--;
+        }
+        Platform::Delete<Crypto::P256Keypair>(keypair);
+    }
+
+    void SetSignInBackground(bool signInBackground) { mSignInBackground = signInBackground; }
+    size_t GetEphemeralKeypairCount() const { return mEphemeralKeypairCount; }
 
 protected:
     Platform::UniquePtr<P256Keypair> mKeypair;
     FabricIndex mSingleFabricIndex = kUndefinedFabricIndex;
+    bool mSignInBackground         = false;
+    size_t mEphemeralKeypairCount  = 0;
 };
 
 #if CHIP_CONFIG_SLOW_CRYPTO
@@ -537,6 +555,62 @@ TEST_F(TestCASESession, SecurePairingHandshakeTest)
     SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, delegateCommissioner);
 }
 
+TEST_F(TestCASESession, SecurePairingHandshakeBackgroundCryptoTest)
+{
+    // The accessory signs Sigma2 as background work, its key exchange staying on the event loop.
+    gDeviceOperationalKeystore.SetSignInBackground(true);
+
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, delegateCommissioner);
+
+    gDeviceOperationalKeystore.SetSignInBackground(false);
+}
+
+TEST_F(TestCASESession, CancelPendingSigma2Test)
+{
+    gDeviceOperationalKeystore.SetSignInBackground(true);
+
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner;
+    TestCASESecurePairingDelegate delegateAccessory;
+    CASESession pairingCommissioner;
+    CASESession pairingAccessory;
+
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                            &pairingAccessory),
+              CHIP_NO_ERROR);
+
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    pairingAccessory.SetGroupDataProvider(&gDeviceGroupDataProvider);
+    EXPECT_EQ(pairingAccessory.PrepareForSessionEstablishment(sessionManager, &gDeviceFabrics, nullptr, nullptr, &delegateAccessory,
+                                                              ScopedNodeId(), NullOptional),
+              CHIP_NO_ERROR);
+
+    ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+    EXPECT_EQ(pairingCommissioner.EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                   ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner,
+                                                   nullptr, nullptr, &delegateCommissioner, NullOptional),
+              CHIP_NO_ERROR);
+
+    // Deliver Sigma1 without running the scheduled work: Sigma2 is pending and holds the ephemeral keypair.
+    DrainAndServiceIO();
+    EXPECT_EQ(pairingAccessory.GetState(), CASESession::State::kSendSigma2Pending);
+    EXPECT_EQ(gDeviceOperationalKeystore.GetEphemeralKeypairCount(), 1u);
+
+    // Clearing the session cancels the work, which then releases the keypair instead of sending Sigma2.
+    pairingAccessory.Clear();
+    ServiceEvents();
+    EXPECT_EQ(gDeviceOperationalKeystore.GetEphemeralKeypairCount(), 0u);
+    EXPECT_EQ(delegateAccessory.mNumPairingComplete, 0u);
+    EXPECT_EQ(delegateCommissioner.mNumPairingComplete, 0u);
+
+    GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+    gDeviceOperationalKeystore.SetSignInBackground(false);
+}
+
 TEST_F(TestCASESession, SecurePairingHandshakeServerTest)
 {
     // TODO: Add cases for mismatching IPK config between initiator/responder
@@ -590,14 +664,27 @@ TEST_F(TestCASESession, SecurePairingHandshakeServerTest)
     gPairingServer.Shutdown();
 }
 
+// Opens an exchange to Bob on the unauthenticated session of the first exchange opened with the same session holder.
+ExchangeContext * NewSharedUnauthenticatedExchangeToBob(TestCASESession & ctx, CASESession & initiator,
+                                                        Optional<SessionHandle> & unauthenticatedSession)
+{
+    if (!unauthenticatedSession.HasValue())
+    {
+        ExchangeContext * exchange = ctx.NewUnauthenticatedExchangeToBob(&initiator);
+        unauthenticatedSession.SetValue(exchange->GetSessionHandle());
+        return exchange;
+    }
+    return ctx.GetExchangeManager().NewContext(unauthenticatedSession.Value(), &initiator);
+}
+
 TEST_F(TestCASESession, ClientReceivesBusyTest)
 {
-    TemporarySessionManager sessionManager(*this);
-    TestCASESecurePairingDelegate delegateCommissioner1, delegateCommissioner2;
-    CASESession pairingCommissioner1, pairingCommissioner2;
+    // One more initiator than the server has responders, so that the last Sigma1 finds all of them busy.
+    constexpr size_t kInitiatorCount = CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES + 1;
 
-    pairingCommissioner1.SetGroupDataProvider(&gCommissionerGroupDataProvider);
-    pairingCommissioner2.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioners[kInitiatorCount];
+    CASESession pairingCommissioners[kInitiatorCount];
 
     auto & loopback            = GetLoopback();
     loopback.mSentMessageCount = 0;
@@ -606,33 +693,84 @@ TEST_F(TestCASESession, ClientReceivesBusyTest)
                                                            nullptr, nullptr, &gDeviceGroupDataProvider),
               CHIP_NO_ERROR);
 
-    ExchangeContext * contextCommissioner1 = NewUnauthenticatedExchangeToBob(&pairingCommissioner1);
-    ExchangeContext * contextCommissioner2 = NewUnauthenticatedExchangeToBob(&pairingCommissioner2);
+    // The initiators share one unauthenticated session, so that both sides fit in a fixed-size unauthenticated session pool.
+    Optional<SessionHandle> unauthenticatedSession;
+    for (size_t i = 0; i < kInitiatorCount; i++)
+    {
+        pairingCommissioners[i].SetGroupDataProvider(&gCommissionerGroupDataProvider);
+        ExchangeContext * contextCommissioner =
+            NewSharedUnauthenticatedExchangeToBob(*this, pairingCommissioners[i], unauthenticatedSession);
+        EXPECT_EQ(pairingCommissioners[i].EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                           ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner,
+                                                           nullptr, nullptr, &delegateCommissioners[i], NullOptional),
+                  CHIP_NO_ERROR);
+    }
 
-    EXPECT_EQ(pairingCommissioner1.EstablishSession(sessionManager, &gCommissionerFabrics,
-                                                    ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner1,
-                                                    nullptr, nullptr, &delegateCommissioner1, NullOptional),
-              CHIP_NO_ERROR);
-    EXPECT_EQ(pairingCommissioner2.EstablishSession(sessionManager, &gCommissionerFabrics,
-                                                    ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner2,
-                                                    nullptr, nullptr, &delegateCommissioner2, NullOptional),
+    ServiceEvents();
+
+    // We should have one full handshake per responder and one Sigma1 + Busy + ack.
+    EXPECT_EQ(loopback.mSentMessageCount, CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES * sTestCaseMessageCount + 3);
+    for (size_t i = 0; i + 1 < kInitiatorCount; i++)
+    {
+        EXPECT_EQ(delegateCommissioners[i].mNumPairingComplete, 1u);
+        EXPECT_EQ(delegateCommissioners[i].mNumPairingErrors, 0u);
+        EXPECT_EQ(delegateCommissioners[i].mNumBusyResponses, 0u);
+    }
+
+    EXPECT_EQ(delegateCommissioners[kInitiatorCount - 1].mNumPairingComplete, 0u);
+    EXPECT_EQ(delegateCommissioners[kInitiatorCount - 1].mNumPairingErrors, 1u);
+    EXPECT_EQ(delegateCommissioners[kInitiatorCount - 1].mNumBusyResponses, 1u);
+
+    gPairingServer.Shutdown();
+}
+
+TEST_F(TestCASESession, ConcurrentHandshakesServerTest)
+{
+    constexpr size_t kInitiatorCount = CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES;
+    constexpr size_t kRounds         = 3;
+
+    TemporarySessionManager sessionManager(*this);
+
+    EXPECT_EQ(gPairingServer.ListenForSessionEstablishment(&GetExchangeManager(), &GetSecureSessionManager(), &gDeviceFabrics,
+                                                           nullptr, nullptr, &gDeviceGroupDataProvider),
               CHIP_NO_ERROR);
 
-    ServiceEvents();
+    // Every round opens as many handshakes as the server has responders, all of their Sigma1 arriving before any handshake
+    // completes. The responders must all be returned to the pool for the next round.
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        TestCASESecurePairingDelegate delegateCommissioners[kInitiatorCount];
+        CASESession pairingCommissioners[kInitiatorCount];
+
+        auto & loopback            = GetLoopback();
+        loopback.mSentMessageCount = 0;
+
+        Optional<SessionHandle> unauthenticatedSession;
+        for (size_t i = 0; i < kInitiatorCount; i++)
+        {
+            pairingCommissioners[i].SetGroupDataProvider(&gCommissionerGroupDataProvider);
+            ExchangeContext * contextCommissioner =
+                NewSharedUnauthenticatedExchangeToBob(*this, pairingCommissioners[i], unauthenticatedSession);
+            EXPECT_EQ(pairingCommissioners[i].EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                               ScopedNodeId{ Node01_01, gCommissionerFabricIndex },
+                                                               contextCommissioner, nullptr, nullptr, &delegateCommissioners[i],
+                                                               NullOptional),
+                      CHIP_NO_ERROR);
+        }
 
-    // We should have one full handshake and one Sigma1 + Busy + ack.  If that
-    // ever changes (e.g. because our server starts supporting multiple parallel
-    // handshakes), this test needs to be fixed so that the server is still
-    // responding BUSY to the client.
-    EXPECT_EQ(loopback.mSentMessageCount, sTestCaseMessageCount + 3);
-    EXPECT_EQ(delegateCommissioner1.mNumPairingComplete, 1u);
-    EXPECT_EQ(delegateCommissioner2.mNumPairingComplete, 0u);
+        ServiceEvents();
 
-    EXPECT_EQ(delegateCommissioner1.mNumPairingErrors, 0u);
-    EXPECT_EQ(delegateCommissioner2.mNumPairingErrors, 1u);
+        EXPECT_EQ(loopback.mSentMessageCount, kInitiatorCount * sTestCaseMessageCount);
+        for (size_t i = 0; i < kInitiatorCount; i++)
+        {
+            EXPECT_EQ(delegateCommissioners[i].mNumPairingComplete, 1u);
+            EXPECT_EQ(delegateCommissioners[i].mNumPairingErrors, 0u);
 
-    EXPECT_EQ(delegateCommissioner1.mNumBusyResponses, 0u);
-    EXPECT_EQ(delegateCommissioner2.mNumBusyResponses, 1u);
+            SessionHolder & holder = delegateCommissioners[i].GetSessionHolder();
+            EXPECT_TRUE(bool(holder));
+        }
+        EXPECT_EQ(gPairingServer.ActiveHandshakeCount(), 0u);
+    }
 
     gPairingServer.Shutdown();
 }
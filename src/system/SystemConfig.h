@@ -516,6 +516,27 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+ *
+ *  @brief
+ *      Use a hierarchical timer wheel instead of a sorted list to hold the pending timers of the select based system layer.
+ *      Starting and cancelling a timer then take constant time on average, regardless of the number of pending timers.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL 0
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKETS
+ *
+ *  @brief
+ *      This is the number of buckets of the index used by a timer wheel to find timers by callback and application state.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKETS
+#define CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKETS 64
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKETS */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
  *
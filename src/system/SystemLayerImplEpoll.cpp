@@ -0,0 +1,623 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using epoll(7).
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TimeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+namespace {
+
+constexpr Clock::Seconds64 kDefaultMinSleepPeriod = Clock::Seconds64(60 * 60 * 24 * 30); // Month [sec]
+
+// Sentinel epoll_data pointers for the internal file descriptors; socket watches use their SocketWatch address.
+int gWakeFdTag;
+int gTimerFdTag;
+
+#if defined(HAVE_DECL_CLOCK_BOOTTIME) && HAVE_DECL_CLOCK_BOOTTIME
+// Must match the clock used by SystemClock().GetMonotonicTimestamp(), see SystemClock.cpp.
+constexpr clockid_t kTimerFdClockId = CLOCK_BOOTTIME;
+#else
+constexpr clockid_t kTimerFdClockId = CLOCK_MONOTONIC;
+#endif
+
+uint32_t EpollEventsFromSocketEvents(SocketEvents events)
+{
+    uint32_t result = 0;
+    if (events.Has(SocketEventFlags::kRead))
+    {
+        result |= EPOLLIN;
+    }
+    if (events.Has(SocketEventFlags::kWrite))
+    {
+        result |= EPOLLOUT;
+    }
+    return result;
+}
+
+SocketEvents SocketEventsFromEpollEvents(uint32_t epollEvents, SocketEvents requested)
+{
+    SocketEvents res;
+
+    if (epollEvents & EPOLLIN)
+    {
+        res.Set(SocketEventFlags::kRead);
+    }
+    if (epollEvents & EPOLLOUT)
+    {
+        res.Set(SocketEventFlags::kWrite);
+    }
+    if (epollEvents & EPOLLPRI)
+    {
+        res.Set(SocketEventFlags::kExcept);
+    }
+    if (epollEvents & (EPOLLERR | EPOLLHUP))
+    {
+        // select() reports a socket with a pending error or hang-up as both readable and writable, and the
+        // socket callbacks rely on the subsequent read()/write() to surface the error; preserve that.
+        res.Set(requested);
+    }
+
+    return res;
+}
+
+enum : intptr_t
+{
+    kLoopHandlerInactive = 0, // default value for EventLoopHandler::mState
+    kLoopHandlerPending,
+    kLoopHandlerActive,
+};
+
+} // anonymous namespace
+
+CHIP_ERROR LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    struct epoll_event event;
+
+    mEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    // The eventfd allows an arbitrary thread to wake the thread blocked in epoll_wait().
+    mWakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrExit(mWakeFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    event          = {};
+    event.events   = EPOLLIN;
+    event.data.ptr = &gWakeFdTag;
+    VerifyOrExit(::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mWakeFd, &event) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    mTimerFd = ::timerfd_create(kTimerFdClockId, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrExit(mTimerFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    event          = {};
+    event.events   = EPOLLIN;
+    event.data.ptr = &gTimerFdTag;
+    VerifyOrExit(::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mTimerFd, &event) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    mArmedAwakenTime = Clock::Timestamp::max();
+    mEventCount      = 0;
+
+    VerifyOrReturnError(mLayerState.SetInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+
+exit:
+    for (int * fd : { &mTimerFd, &mWakeFd, &mEpollFd })
+    {
+        if (*fd >= 0)
+        {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+    return err;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturn(mLayerState.SetShuttingDown());
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+
+    VerifyOrDie(::close(mTimerFd) == 0);
+    VerifyOrDie(::close(mWakeFd) == 0);
+    VerifyOrDie(::close(mEpollFd) == 0);
+    mTimerFd    = -1;
+    mWakeFd     = -1;
+    mEpollFd    = -1;
+    mEventCount = 0;
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by incrementing the wake eventfd.
+     *
+     * If this is being called from within an I/O event callback, then the write can be skipped,
+     * since the I/O thread is already awake.
+     *
+     * Furthermore, we don't care if this write fails as the only reasonably likely failure is that the counter
+     * would overflow, in which case the epoll_wait calling thread is going to wake up anyway.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    uint64_t value = 1;
+    if (::write(mWakeFd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+    }
+}
+
+CHIP_ERROR LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(delay.count() > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    assertChipStackLockedByCurrentThread();
+
+    Clock::Timeout remainingTime = mTimerList.GetRemainingTime(onComplete, appState);
+    if (remainingTime.count() < delay.count())
+    {
+        if (remainingTime == Clock::kZero)
+        {
+            // If remaining time is Clock::kZero, it might possible that our timer is in
+            // the mExpiredTimers list and about to be fired. Remove it from that list, since we are extending it.
+            mExpiredTimers.Remove(onComplete, appState);
+        }
+        return StartTimer(delay, onComplete, appState);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool LayerImplEpoll::IsTimerActive(TimerCompleteCallback onComplete, void * appState)
+{
+    bool timerIsActive = (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
+
+    if (!timerIsActive)
+    {
+        // check if the timer is in the mExpiredTimers list about to be fired.
+        for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer)
+        {
+            if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState)
+            {
+                return true;
+            }
+        }
+    }
+
+    return timerIsActive;
+}
+
+Clock::Timeout LayerImplEpoll::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
+{
+    return mTimerList.GetRemainingTime(onComplete, appState);
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    if (timer == nullptr)
+    {
+        // The timer was not in our "will fire in the future" list, but it might
+        // be in the "we're about to fire these" chunk we already grabbed from
+        // that list.  Check for it there too, and if found there we still want
+        // to cancel it.
+        timer = mExpiredTimers.Remove(onComplete, appState);
+    }
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CHIP_ERROR LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // As in LayerImplSelect, schedule an expires-ASAP timer that does not cancel existing timers with the
+    // same callback and appState, so ScheduleWork invocations don't stomp on each other.
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    // Find a free slot.
+    SocketWatch * watch = nullptr;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == fd)
+        {
+            // Already registered, return the existing token
+            *tokenOut = reinterpret_cast<SocketWatchToken>(&w);
+            return CHIP_NO_ERROR;
+        }
+        if ((w.mFD == kInvalidFd) && (watch == nullptr))
+        {
+            watch = &w;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateWatchRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateWatchRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateWatchRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateWatchRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (watch->mRegisteredEvents != 0)
+    {
+        // The file descriptor is still open at this point (callers must stop watching before closing it).
+        // Failure is not fatal: closing the descriptor removes it from the epoll set anyway.
+        (void) ::epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+    }
+
+    // Drop any events for this watch that were returned by the last epoll_wait() and not dispatched yet,
+    // so that they are not delivered to a different socket that reuses the slot during this HandleEvents().
+    for (int i = 0; i < mEventCount; i++)
+    {
+        if (mEvents[i].data.ptr == watch)
+        {
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+
+    watch->Clear();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::UpdateWatchRegistration(SocketWatch & watch)
+{
+    VerifyOrReturnError(watch.mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    const uint32_t events = EpollEventsFromSocketEvents(watch.mPendingIO);
+    VerifyOrReturnError(events != watch.mRegisteredEvents, CHIP_NO_ERROR);
+
+    int op;
+    if (events == 0)
+    {
+        // epoll always reports EPOLLERR and EPOLLHUP for registered descriptors, so remove the descriptor
+        // entirely rather than registering it with an empty mask.
+        op = EPOLL_CTL_DEL;
+    }
+    else
+    {
+        op = (watch.mRegisteredEvents == 0) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD;
+    }
+
+    // Level-triggered: the socket callbacks consume a single datagram or a bounded amount of data per
+    // notification, so readiness must be reported again while data remains.
+    struct epoll_event event = {};
+    event.events             = events;
+    event.data.ptr           = &watch;
+    VerifyOrReturnError(::epoll_ctl(mEpollFd, op, watch.mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+
+    watch.mRegisteredEvents = events;
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::AddLoopHandler(EventLoopHandler & handler)
+{
+    // Add the handler as pending because this method can be called at any point
+    // in a PrepareEvents() / WaitForEvents() / HandleEvents() sequence.
+    // It will be marked active when we call PrepareEvents() on it for the first time.
+    auto & state = LoopHandlerState(handler);
+    VerifyOrDie(state == kLoopHandlerInactive);
+    state = kLoopHandlerPending;
+    mLoopHandlers.PushBack(&handler);
+}
+
+void LayerImplEpoll::RemoveLoopHandler(EventLoopHandler & handler)
+{
+    mLoopHandlers.Remove(&handler);
+    LoopHandlerState(handler) = kLoopHandlerInactive;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
+
+    TimerList::Node * timer = mTimerList.Earliest();
+    if (timer)
+    {
+        awakenTime = std::min(awakenTime, timer->AwakenTime());
+    }
+
+    // Activate added EventLoopHandlers and call PrepareEvents on active handlers.
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        switch (auto & state = LoopHandlerState(loop))
+        {
+        case kLoopHandlerPending:
+            state = kLoopHandlerActive;
+            [[fallthrough]];
+        case kLoopHandlerActive:
+            awakenTime = std::min(awakenTime, loop.PrepareEvents(currentTime));
+            break;
+        }
+    }
+
+    if (awakenTime <= currentTime)
+    {
+        // Something is already due; poll without blocking and leave the timerfd alone.
+        mWaitTimeoutMs = 0;
+        return;
+    }
+
+    mWaitTimeoutMs = -1;
+    ArmTimerFd(awakenTime, currentTime);
+}
+
+void LayerImplEpoll::ArmTimerFd(Clock::Timestamp awakenTime, Clock::Timestamp currentTime)
+{
+    // The timerfd stays armed across loop iterations. Keep it as is if it is already due to fire by the new deadline: an
+    // early wakeup is harmless, as the next PrepareEvents() re-arms it. This avoids a timerfd_settime() on every iteration
+    // when only the default sleep period, which moves with the current time, sets the deadline.
+    VerifyOrReturn(mArmedAwakenTime <= currentTime || mArmedAwakenTime > awakenTime);
+
+    // Arm relative to the timestamp the deadline was computed against, rounding up so we never wake early.
+    const Clock::Microseconds64 sleepTime = std::chrono::ceil<Clock::Microseconds64>(awakenTime - currentTime);
+
+    const uint64_t sleepUs = sleepTime.count();
+    struct itimerspec spec = {};
+    spec.it_value.tv_sec   = static_cast<time_t>(sleepUs / chip::kMicrosecondsPerSecond);
+    spec.it_value.tv_nsec  = static_cast<long>((sleepUs % chip::kMicrosecondsPerSecond) * chip::kNanosecondsPerMicrosecond);
+
+    if (::timerfd_settime(mTimerFd, 0, &spec, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "timerfd_settime failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        mArmedAwakenTime = Clock::Timestamp::max();
+        // Fall back to a bounded epoll_wait() timeout so timers still fire.
+        mWaitTimeoutMs = static_cast<int>(std::min<uint64_t>(
+            std::chrono::ceil<Clock::Milliseconds64>(sleepTime).count(), static_cast<uint64_t>(std::numeric_limits<int>::max())));
+        return;
+    }
+
+    mArmedAwakenTime = awakenTime;
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mEventCount = ::epoll_wait(mEpollFd, mEvents, kMaxEventsPerWait, mWaitTimeoutMs);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsSelectResultValid())
+    {
+        if (errno != EINTR)
+        {
+            ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        }
+        mEventCount = 0;
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Consume the internal wakeup sources first so that a Signal() or timer expiry that happens while the
+    // callbacks below run is observed by the next epoll_wait().
+    for (int i = 0; i < mEventCount; i++)
+    {
+        uint64_t value;
+        if (mEvents[i].data.ptr == &gWakeFdTag)
+        {
+            (void) ::read(mWakeFd, &value, sizeof(value));
+            mEvents[i].data.ptr = nullptr;
+        }
+        else if (mEvents[i].data.ptr == &gTimerFdTag)
+        {
+            (void) ::read(mTimerFd, &value, sizeof(value));
+            // An expired timerfd is disarmed; make sure PrepareEvents() arms it again.
+            mArmedAwakenTime    = Clock::Timestamp::max();
+            mEvents[i].data.ptr = nullptr;
+        }
+    }
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+
+    // Process socket events, if any. Entries may be cleared by StopWatchingSocket() while we iterate.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        auto * watch = static_cast<SocketWatch *>(mEvents[i].data.ptr);
+        if (watch != nullptr && watch->mFD != kInvalidFd && watch->mCallback != nullptr)
+        {
+            SocketEvents events = SocketEventsFromEpollEvents(mEvents[i].events, watch->mPendingIO);
+            if (events.HasAny())
+            {
+                watch->mCallback(events, watch->mCallbackData);
+            }
+        }
+    }
+    mEventCount = 0;
+
+    // Call HandleEvents for active loop handlers
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        if (LoopHandlerState(loop) == kLoopHandlerActive)
+        {
+            loop.HandleEvents();
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mCallback         = nullptr;
+    mCallbackData     = 0;
+    mRegisteredEvents = 0;
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,148 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using Linux epoll(7).
+ *
+ *      Unlike the select() based implementation, the cost of waiting for events does not
+ *      depend on the number of watched sockets, and file descriptors are not limited to
+ *      FD_SETSIZE. The timer deadline is armed on a timerfd and cross-thread wakeups go
+ *      through an eventfd, both of which are registered with the epoll instance.
+ */
+
+#pragma once
+
+#include "system/SystemConfig.h"
+
+#if !CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS
+#error "LayerImplEpoll requires CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS"
+#endif
+
+#if CHIP_SYSTEM_CONFIG_USE_DISPATCH || CHIP_SYSTEM_CONFIG_USE_LIBEV
+#error "LayerImplEpoll is mutually exclusive with CHIP_SYSTEM_CONFIG_USE_DISPATCH and CHIP_SYSTEM_CONFIG_USE_LIBEV"
+#endif
+
+#include <sys/epoll.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/ObjectLifeCycle.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+
+namespace chip {
+namespace System {
+
+class LayerImplEpoll : public LayerSocketsLoop
+{
+public:
+    LayerImplEpoll() = default;
+    ~LayerImplEpoll() override { VerifyOrDie(mLayerState.Destroy()); }
+
+    // Layer overrides.
+    CHIP_ERROR Init() override;
+    void Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CHIP_ERROR StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    bool IsTimerActive(TimerCompleteCallback onComplete, void * appState) override;
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+
+    // LayerSocketLoop overrides.
+    void Signal() override;
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+    void AddLoopHandler(EventLoopHandler & handler) override;
+    void RemoveLoopHandler(EventLoopHandler & handler) override;
+
+    // Expose the result of WaitForEvents() for non-blocking socket implementations.
+    bool IsSelectResultValid() const { return mEventCount >= 0; }
+
+protected:
+    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0);
+
+    // Every watched socket can be reported at most once per epoll_wait(), plus the wake eventfd and the timerfd.
+    static constexpr int kMaxEventsPerWait = kSocketWatchMax + 2;
+
+    struct SocketWatch
+    {
+        void Clear();
+        int mFD;
+        SocketEvents mPendingIO;
+        SocketWatchCallback mCallback;
+        intptr_t mCallbackData;
+        // The event mask the file descriptor is currently registered with in the epoll set, or 0 if it is not registered.
+        uint32_t mRegisteredEvents;
+    };
+    SocketWatch mSocketWatchPool[kSocketWatchMax];
+
+    CHIP_ERROR UpdateWatchRegistration(SocketWatch & watch);
+    void ArmTimerFd(Clock::Timestamp awakenTime, Clock::Timestamp currentTime);
+
+    TimerPool<TimerList::Node> mTimerPool;
+    TimerList mTimerList;
+    // List of expired timers being processed right now.  Stored in a member so
+    // we can cancel them.
+    TimerList mExpiredTimers;
+
+    IntrusiveList<EventLoopHandler> mLoopHandlers;
+
+    int mEpollFd = -1;
+    int mTimerFd = -1;
+    int mWakeFd  = -1;
+
+    // The deadline the timerfd is currently armed for, or Clock::Timestamp::max() if it is disarmed.
+    Clock::Timestamp mArmedAwakenTime = Clock::Timestamp::max();
+    // Timeout passed to epoll_wait(): 0 when something is already due, -1 to rely on the timerfd.
+    int mWaitTimeoutMs = -1;
+
+    // Results of epoll_wait(), carried between WaitForEvents() and HandleEvents().
+    struct epoll_event mEvents[kMaxEventsPerWait];
+    int mEventCount = 0;
+
+    ObjectLifeCycle mLayerState;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleSelectThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
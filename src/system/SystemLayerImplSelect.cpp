@@ -81,7 +81,7 @@ void LayerImplSelect::Shutdown()
     VerifyOrReturn(mLayerState.SetShuttingDown());
 
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
-    TimerList::Node * timer;
+    TimerQueue::Node * timer;
     while ((timer = mTimerList.PopEarliest()) != nullptr)
     {
         if (timer->mTimerSource != nullptr)
@@ -97,7 +97,7 @@ void LayerImplSelect::Shutdown()
         w.DisableAndClear();
     }
 #elif CHIP_SYSTEM_CONFIG_USE_LIBEV
-    TimerList::Node * timer;
+    TimerQueue::Node * timer;
     while ((timer = mTimerList.PopEarliest()) != nullptr)
     {
         if (ev_is_active(&timer->mLibEvTimer))
@@ -166,7 +166,7 @@ CHIP_ERROR LayerImplSelect::StartTimer(Clock::Timeout delay, TimerCompleteCallba
 
     CancelTimer(onComplete, appState);
 
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
@@ -275,14 +275,14 @@ void LayerImplSelect::CancelTimer(TimerCompleteCallback onComplete, void * appSt
 
     VerifyOrReturn(mLayerState.IsInitialized());
 
-    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    TimerQueue::Node * timer = mTimerList.Remove(onComplete, appState);
     if (timer == nullptr)
     {
         // The timer was not in our "will fire in the future" list, but it might
         // be in the "we're about to fire these" chunk we already grabbed from
         // that list.  Check for it there too, and if found there we still want
         // to cancel it.
-        timer = mExpiredTimers.Remove(onComplete, appState);
+        timer = static_cast<TimerQueue::Node *>(mExpiredTimers.Remove(onComplete, appState));
     }
     VerifyOrReturn(timer != nullptr);
 
@@ -324,7 +324,7 @@ CHIP_ERROR LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete, void
 #endif // CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
 #elif CHIP_SYSTEM_CONFIG_USE_LIBEV
     // schedule as timer with no delay, but do NOT cancel previous timers with same onComplete/appState!
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
     VerifyOrDie(mLibEvLoopP != nullptr);
     ev_timer_init(&timer->mLibEvTimer, &LayerImplSelect::HandleLibEvTimer, 1, 0);
@@ -365,7 +365,7 @@ CHIP_ERROR LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete, void
     // timer, but just make sure we don't cancel existing timers with the same
     // callback and appState, so ScheduleWork invocations don't stomp on each
     // other.
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
     if (mTimerList.Add(timer) == timer)
@@ -657,7 +657,7 @@ void LayerImplSelect::PrepareEvents()
     const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
     Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
 
-    TimerList::Node * timer = mTimerList.Earliest();
+    TimerQueue::Node * timer = mTimerList.Earliest();
     if (timer)
     {
         awakenTime = std::min(awakenTime, timer->AwakenTime());
@@ -736,9 +736,9 @@ void LayerImplSelect::HandleEvents()
     // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
     // since that could result in infinite handling of new timers blocking any other progress.
     VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
-    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
-    TimerList::Node * timer = nullptr;
-    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    mExpiredTimers           = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerQueue::Node * timer = nullptr;
+    while ((timer = static_cast<TimerQueue::Node *>(mExpiredTimers.PopEarliest())) != nullptr)
     {
         mTimerPool.Invoke(timer);
     }
@@ -779,7 +779,7 @@ void LayerImplSelect::HandleEvents()
 
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
 
-void LayerImplSelect::HandleTimerComplete(TimerList::Node * timer)
+void LayerImplSelect::HandleTimerComplete(TimerQueue::Node * timer)
 {
     mTimerList.Remove(timer);
     mTimerPool.Invoke(timer);
@@ -789,7 +789,7 @@ void LayerImplSelect::HandleTimerComplete(TimerList::Node * timer)
 
 void LayerImplSelect::HandleLibEvTimer(EV_P_ struct ev_timer * t, int revents)
 {
-    TimerList::Node * timer = static_cast<TimerList::Node *>(t->data);
+    TimerQueue::Node * timer = static_cast<TimerQueue::Node *>(t->data);
     VerifyOrDie(timer != nullptr);
     LayerImplSelect * layerP = dynamic_cast<LayerImplSelect *>(timer->mCallback.mSystemLayer);
     VerifyOrDie(layerP != nullptr);
@@ -55,6 +55,12 @@ namespace System {
 class LayerImplSelect : public LayerSocketsLoop
 {
 public:
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    using TimerQueue = TimerWheel;
+#else
+    using TimerQueue = TimerList;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
     LayerImplSelect() = default;
     ~LayerImplSelect() override { VerifyOrDie(mLayerState.Destroy()); }
 
@@ -95,7 +101,7 @@ public:
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
     void SetDispatchQueue(dispatch_queue_t dispatchQueue) override { mDispatchQueue = dispatchQueue; };
     dispatch_queue_t GetDispatchQueue() override { return mDispatchQueue; };
-    void HandleTimerComplete(TimerList::Node * timer);
+    void HandleTimerComplete(TimerQueue::Node * timer);
 #elif CHIP_SYSTEM_CONFIG_USE_LIBEV
     virtual void SetLibEvLoop(struct ev_loop * aLibEvLoopP) override { mLibEvLoopP = aLibEvLoopP; };
     virtual struct ev_loop * GetLibEvLoop() override { return mLibEvLoopP; };
@@ -133,8 +139,8 @@ protected:
     };
     SocketWatch mSocketWatchPool[kSocketWatchMax];
 
-    TimerPool<TimerList::Node> mTimerPool;
-    TimerList mTimerList;
+    TimerPool<TimerQueue::Node> mTimerPool;
+    TimerQueue mTimerList;
     // List of expired timers being processed right now.  Stored in a member so
     // we can cancel them.
     TimerList mExpiredTimers;
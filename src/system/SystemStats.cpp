@@ -51,6 +51,9 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #endif
 #if INET_CONFIG_NUM_UDP_ENDPOINTS
     "UDP endpoints",
+#endif
+#if INET_CONFIG_NUM_UDP_ENDPOINTS && INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+    "UDP receive batch size",
 #endif
     "Exchange contexts",
     "Unsolicited message handlers",
@@ -61,6 +61,9 @@ enum
 #endif
 #if INET_CONFIG_NUM_UDP_ENDPOINTS
     kInetLayer_NumUDPEps,
+#endif
+#if INET_CONFIG_NUM_UDP_ENDPOINTS && INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+    kInetLayer_UDPRecvBatchSize, // datagrams received by the last batch; the high watermark is the largest batch
 #endif
     kExchangeMgr_NumContexts,
     kExchangeMgr_NumUMHandlers,
@@ -164,6 +167,8 @@ const Label * GetStrings();
 
 #define SYSTEM_STATS_DECREMENT_BY_N(entry, count)
 
+#define SYSTEM_STATS_SET(entry, count)
+
 #define SYSTEM_STATS_RESET(entry)
 
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
@@ -178,5 +178,458 @@ Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, vo
     return Clock::kZero;
 }
 
+namespace {
+
+unsigned LowestSetBit(uint64_t bits)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(bits));
+#else
+    unsigned index = 0;
+    while ((bits & 1) == 0)
+    {
+        bits >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+uint64_t ToMilliseconds(Clock::Timestamp t)
+{
+    return static_cast<uint64_t>(t.count());
+}
+
+} // namespace
+
+bool TimerWheel::IsEarlier(const Node * a, const Node * b)
+{
+    return (a->AwakenTime() < b->AwakenTime()) || ((a->AwakenTime() == b->AwakenTime()) && (a->mSequence < b->mSequence));
+}
+
+void TimerWheel::Append(Node *& head, Node * timer)
+{
+    if (head == nullptr)
+    {
+        head         = timer;
+        timer->mPrev = timer;
+        timer->mNext = timer;
+        return;
+    }
+    Node * tail  = head->mPrev;
+    timer->mPrev = tail;
+    timer->mNext = head;
+    tail->mNext  = timer;
+    head->mPrev  = timer;
+}
+
+void TimerWheel::InsertSorted(Node *& head, Node * timer)
+{
+    if (head == nullptr)
+    {
+        Append(head, timer);
+        return;
+    }
+
+    // Timers are mostly added in order, so look for the insert location from the tail.
+    Node * previous = head->mPrev;
+    while (IsEarlier(timer, previous))
+    {
+        if (previous == head)
+        {
+            Append(head, timer);
+            head = timer;
+            return;
+        }
+        previous = previous->mPrev;
+    }
+    timer->mPrev           = previous;
+    timer->mNext           = previous->mNext;
+    previous->mNext->mPrev = timer;
+    previous->mNext        = timer;
+}
+
+void TimerWheel::Detach(Node *& head, Node * timer)
+{
+    if (timer->mNext == timer)
+    {
+        head = nullptr;
+    }
+    else
+    {
+        timer->mPrev->mNext = timer->mNext;
+        timer->mNext->mPrev = timer->mPrev;
+        if (head == timer)
+        {
+            head = timer->mNext;
+        }
+    }
+    timer->mPrev = nullptr;
+    timer->mNext = nullptr;
+}
+
+size_t TimerWheel::BucketIndex(TimerCompleteCallback onComplete, void * appState)
+{
+    uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(appState));
+    hash ^= static_cast<uint64_t>(reinterpret_cast<uintptr_t>(onComplete)) * 0x9E3779B97F4A7C15ull;
+    hash ^= hash >> 29;
+    hash *= 0xBF58476D1CE4E5B9ull;
+    hash ^= hash >> 32;
+    return static_cast<size_t>(hash % kBucketCount);
+}
+
+void TimerWheel::Place(Node * timer)
+{
+    const uint64_t awakenTime = ToMilliseconds(timer->AwakenTime());
+
+    if (awakenTime < mNow)
+    {
+        timer->mLevel = kOverdue;
+        InsertSorted(mOverdue, timer);
+        return;
+    }
+
+    for (uint8_t level = 0; level < kLevels; level++)
+    {
+        const unsigned rangeShift = kBitsPerLevel * (level + 1u);
+        if ((awakenTime >> rangeShift) != (mNow >> rangeShift))
+        {
+            continue;
+        }
+
+        const uint8_t slot = static_cast<uint8_t>((awakenTime >> (kBitsPerLevel * level)) & (kSlotsPerLevel - 1));
+        timer->mLevel      = level;
+        timer->mSlot       = slot;
+        // A level 0 slot only holds timers with the same awaken time, which must stay in the order they were added.
+        if (level == 0)
+        {
+            InsertSorted(mSlots[level][slot], timer);
+        }
+        else
+        {
+            Append(mSlots[level][slot], timer);
+        }
+        mOccupied[level] |= (1ull << slot);
+        return;
+    }
+
+    timer->mLevel = kFar;
+    InsertSorted(mFar, timer);
+}
+
+void TimerWheel::Unlink(Node * timer)
+{
+    if (timer->mLevel == kOverdue)
+    {
+        Detach(mOverdue, timer);
+    }
+    else if (timer->mLevel == kFar)
+    {
+        Detach(mFar, timer);
+    }
+    else
+    {
+        Node *& head = mSlots[timer->mLevel][timer->mSlot];
+        Detach(head, timer);
+        if (head == nullptr)
+        {
+            mOccupied[timer->mLevel] &= ~(1ull << timer->mSlot);
+        }
+    }
+    timer->mLevel = kNotQueued;
+}
+
+void TimerWheel::Advance(uint64_t now)
+{
+    // Callers guarantee that no timer in the levels expires before `now`, so only the timers in the slots which `now` falls
+    // into need to move to a lower level.
+    mNow = now;
+
+    while ((mFar != nullptr) && ((ToMilliseconds(mFar->AwakenTime()) >> kWheelBits) == (mNow >> kWheelBits)))
+    {
+        Node * timer = mFar;
+        Detach(mFar, timer);
+        Place(timer);
+    }
+
+    for (uint8_t level = kLevels - 1; level > 0; level--)
+    {
+        const uint8_t slot = static_cast<uint8_t>((mNow >> (kBitsPerLevel * level)) & (kSlotsPerLevel - 1));
+        Node * list        = mSlots[level][slot];
+        if (list == nullptr)
+        {
+            continue;
+        }
+        mSlots[level][slot] = nullptr;
+        mOccupied[level] &= ~(1ull << slot);
+        while (list != nullptr)
+        {
+            Node * timer = list;
+            Detach(list, timer);
+            Place(timer);
+        }
+    }
+}
+
+void TimerWheel::AdvanceToEarliestBefore(Clock::Timestamp t)
+{
+    if (t == Clock::kZero)
+    {
+        return;
+    }
+    const uint64_t limit = ToMilliseconds(t) - 1;
+
+    // Move the wheel forward one occupied slot at a time, until the earliest timer is either overdue or in level 0, or is
+    // known not to expire before `t`.
+    while ((mOverdue == nullptr) && (mOccupied[0] == 0))
+    {
+        uint64_t next = 0;
+        uint8_t level = 1;
+        while ((level < kLevels) && (mOccupied[level] == 0))
+        {
+            level++;
+        }
+        if (level < kLevels)
+        {
+            const unsigned rangeShift = kBitsPerLevel * (level + 1u);
+            const uint64_t slot       = LowestSetBit(mOccupied[level]);
+            next                      = ((mNow >> rangeShift) << rangeShift) | (slot << (kBitsPerLevel * level));
+        }
+        else if (mFar != nullptr)
+        {
+            next = ToMilliseconds(mFar->AwakenTime());
+        }
+        else
+        {
+            return;
+        }
+
+        if (next > limit)
+        {
+            return;
+        }
+        Advance(next);
+    }
+}
+
+TimerWheel::Node * TimerWheel::FindEarliest() const
+{
+    if (mOverdue != nullptr)
+    {
+        return mOverdue;
+    }
+
+    // Every timer in a level expires before any timer of a higher level, and the occupied slots of a level are ahead of the
+    // current time, so the earliest timer is in the first occupied slot of the lowest occupied level.
+    for (uint8_t level = 0; level < kLevels; level++)
+    {
+        if (mOccupied[level] == 0)
+        {
+            continue;
+        }
+        Node * head = mSlots[level][LowestSetBit(mOccupied[level])];
+        if (level == 0)
+        {
+            return head;
+        }
+        Node * earliest = head;
+        for (Node * timer = head->mNext; timer != head; timer = timer->mNext)
+        {
+            if (IsEarlier(timer, earliest))
+            {
+                earliest = timer;
+            }
+        }
+        return earliest;
+    }
+
+    return mFar;
+}
+
+TimerWheel::Node * TimerWheel::Find(TimerCompleteCallback onComplete, void * appState) const
+{
+    Node * found = nullptr;
+    for (Node * timer = mBuckets[BucketIndex(onComplete, appState)]; timer != nullptr; timer = timer->mBucketNext)
+    {
+        if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState &&
+            (found == nullptr || IsEarlier(timer, found)))
+        {
+            found = timer;
+        }
+    }
+    return found;
+}
+
+TimerWheel::Node * TimerWheel::Add(Node * add)
+{
+    VerifyOrDie(add->mLevel == kNotQueued);
+
+    add->mSequence = mNextSequence++;
+    Place(add);
+
+    Node *& bucket   = mBuckets[BucketIndex(add->GetCallback().GetOnComplete(), add->GetCallback().GetAppState())];
+    add->mBucketPrev = nullptr;
+    add->mBucketNext = bucket;
+    if (bucket != nullptr)
+    {
+        bucket->mBucketPrev = add;
+    }
+    bucket = add;
+    mCount++;
+
+    if (mEarliestValid && (mEarliest == nullptr || IsEarlier(add, mEarliest)))
+    {
+        mEarliest = add;
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::Remove(Node * remove)
+{
+    if (remove == nullptr || remove->mLevel == kNotQueued)
+    {
+        return Earliest();
+    }
+
+    Unlink(remove);
+
+    if (remove->mBucketPrev != nullptr)
+    {
+        remove->mBucketPrev->mBucketNext = remove->mBucketNext;
+    }
+    else
+    {
+        mBuckets[BucketIndex(remove->GetCallback().GetOnComplete(), remove->GetCallback().GetAppState())] = remove->mBucketNext;
+    }
+    if (remove->mBucketNext != nullptr)
+    {
+        remove->mBucketNext->mBucketPrev = remove->mBucketPrev;
+    }
+    remove->mBucketPrev = nullptr;
+    remove->mBucketNext = nullptr;
+    remove->mNextTimer  = nullptr;
+    mCount--;
+
+    if (remove == mEarliest)
+    {
+        mEarliest      = nullptr;
+        mEarliestValid = (mCount == 0);
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = Find(aOnComplete, aAppState);
+    if (timer != nullptr)
+    {
+        Remove(timer);
+    }
+    return timer;
+}
+
+TimerWheel::Node * TimerWheel::Earliest()
+{
+    if (!mEarliestValid)
+    {
+        mEarliest      = FindEarliest();
+        mEarliestValid = true;
+    }
+    return mEarliest;
+}
+
+TimerWheel::Node * TimerWheel::PopEarliest()
+{
+    Node * earliest = Earliest();
+    Remove(earliest);
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::PopIfEarlier(Clock::Timestamp t)
+{
+    AdvanceToEarliestBefore(t);
+
+    Node * earliest = Earliest();
+    if ((earliest == nullptr) || !(earliest->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    Remove(earliest);
+    return earliest;
+}
+
+TimerList TimerWheel::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+    TimerList::Node * last = nullptr;
+
+    for (Node * timer = PopIfEarlier(t); timer != nullptr; timer = PopIfEarlier(t))
+    {
+        if (last == nullptr)
+        {
+            out.mEarliestTimer = timer;
+        }
+        else
+        {
+            last->mNextTimer = timer;
+        }
+        last = timer;
+    }
+
+    // Every remaining timer expires at or after `t`, so timers added from now on can be placed relative to it.
+    if ((t != Clock::kZero) && (ToMilliseconds(t) - 1 > mNow))
+    {
+        Advance(ToMilliseconds(t) - 1);
+    }
+    return out;
+}
+
+void TimerWheel::Clear()
+{
+    auto release = [](Node *& head) {
+        while (head != nullptr)
+        {
+            Node * timer = head;
+            Detach(head, timer);
+            timer->mLevel      = kNotQueued;
+            timer->mBucketPrev = nullptr;
+            timer->mBucketNext = nullptr;
+        }
+    };
+
+    release(mOverdue);
+    release(mFar);
+    for (uint8_t level = 0; level < kLevels; level++)
+    {
+        for (auto & slot : mSlots[level])
+        {
+            release(slot);
+        }
+        mOccupied[level] = 0;
+    }
+    for (auto & bucket : mBuckets)
+    {
+        bucket = nullptr;
+    }
+    mCount         = 0;
+    mEarliest      = nullptr;
+    mEarliestValid = true;
+}
+
+Clock::Timeout TimerWheel::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = Find(aOnComplete, aAppState);
+    if (timer != nullptr)
+    {
+        Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+
+        if (currentTime < timer->AwakenTime())
+        {
+            return Clock::Timeout(timer->AwakenTime() - currentTime);
+        }
+    }
+    return Clock::kZero;
+}
+
 } // namespace System
 } // namespace chip
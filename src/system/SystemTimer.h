@@ -186,9 +186,163 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
+    friend class TimerWheel;
+
     Node * mEarliestTimer;
 };
 
+/**
+ * A hashed hierarchical timer wheel, providing the same operations and ordering as TimerList for many concurrent timers.
+ *
+ * Timers are held in kLevels levels of kSlotsPerLevel slots, where a level 0 slot spans one millisecond and a slot of any
+ * other level spans all the slots of the level below. A timer is placed in the lowest level whose current range contains its
+ * awaken time, and is moved down to a lower level, at most once per level, as the wheel advances. Timers are also indexed by
+ * callback and application state, so that adding a timer and removing it, directly or by those properties, take constant time
+ * on average instead of a list walk.
+ *
+ * Like in TimerList, timers expire in awaken time order, and timers with the same awaken time expire in the order they were
+ * added.
+ */
+class TimerWheel
+{
+private:
+    static constexpr uint8_t kNotQueued = UINT8_MAX;
+
+public:
+    class Node : public TimerList::Node
+    {
+    public:
+        Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
+            TimerList::Node(systemLayer, awakenTime, onComplete, appState)
+        {}
+
+    private:
+        friend class TimerWheel;
+
+        // Links in the circular list holding the timer.
+        Node * mPrev = nullptr;
+        Node * mNext = nullptr;
+        // Links in the index bucket holding the timer.
+        Node * mBucketPrev = nullptr;
+        Node * mBucketNext = nullptr;
+        // Orders timers having the same awaken time.
+        uint64_t mSequence = 0;
+        uint8_t mLevel     = kNotQueued;
+        uint8_t mSlot      = 0;
+    };
+
+    TimerWheel() = default;
+
+    TimerWheel(const TimerWheel &)             = delete;
+    TimerWheel & operator=(const TimerWheel &) = delete;
+
+    /**
+     * Add a timer to the wheel
+     *
+     * @return  The new earliest timer in the wheel. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the wheel, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer in the wheel, or nullptr if the wheel is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the first timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the wheel contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the wheel.
+     *
+     * @return  The earliest timer, or nullptr if the wheel is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer in the wheel, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer in the wheel.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest();
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mCount == 0; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, in expiration order.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+    /**
+     * Find the timer with the given properties, if present, and return its remaining time
+     *
+     * @return The remaining time on this particular timer or 0 if not found.
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
+
+private:
+    static constexpr unsigned kBitsPerLevel  = 6;
+    static constexpr unsigned kSlotsPerLevel = 1u << kBitsPerLevel;
+    static constexpr uint8_t kLevels         = 6;
+    static constexpr unsigned kWheelBits     = kBitsPerLevel * kLevels;
+    // Lists for timers expiring before the current time, and after the range of the top level.
+    static constexpr uint8_t kOverdue = kLevels;
+    static constexpr uint8_t kFar     = kLevels + 1;
+
+    static constexpr size_t kBucketCount = CHIP_SYSTEM_CONFIG_TIMER_WHEEL_BUCKETS;
+
+    static_assert(kSlotsPerLevel <= 64, "Slot occupancy must fit in 64 bits");
+
+    static bool IsEarlier(const Node * a, const Node * b);
+    static void Append(Node *& head, Node * timer);
+    static void InsertSorted(Node *& head, Node * timer);
+    static void Detach(Node *& head, Node * timer);
+    static size_t BucketIndex(TimerCompleteCallback onComplete, void * appState);
+
+    void Place(Node * timer);
+    void Unlink(Node * timer);
+    void Advance(uint64_t now);
+    void AdvanceToEarliestBefore(Clock::Timestamp t);
+    Node * FindEarliest() const;
+    Node * Find(TimerCompleteCallback onComplete, void * appState) const;
+
+    Node * mSlots[kLevels][kSlotsPerLevel] = {};
+    uint64_t mOccupied[kLevels]            = {};
+    Node * mOverdue                        = nullptr;
+    Node * mFar                            = nullptr;
+    Node * mBuckets[kBucketCount]          = {};
+
+    // Every timer in the levels expires at or after mNow, in milliseconds.
+    uint64_t mNow          = 0;
+    uint64_t mNextSequence = 0;
+    size_t mCount          = 0;
+
+    // The earliest timer only changes when it is removed, or when an earlier timer is added.
+    Node * mEarliest    = nullptr;
+    bool mEarliestValid = true;
+};
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
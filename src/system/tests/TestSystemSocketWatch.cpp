@@ -0,0 +1,183 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file exercises the socket watch API of the configured LayerSocketsLoop
+ *      implementation (select() or epoll()) by driving its event loop by hand.
+ */
+
+#include <pw_unit_test/framework.h>
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemLayerImpl.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::System;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+struct WatchedSocket
+{
+    int mFd                         = kInvalidFd;
+    SocketWatchToken mToken         = 0;
+    int mReadCallbacks              = 0;
+    int mWriteCallbacks             = 0;
+    LayerImpl * mLayer              = nullptr;
+    WatchedSocket * mStopOnReadable = nullptr;
+
+    static void HandleEvents(SocketEvents events, intptr_t data)
+    {
+        auto * self = reinterpret_cast<WatchedSocket *>(data);
+        if (events.Has(SocketEventFlags::kRead))
+        {
+            self->mReadCallbacks++;
+
+            // Consume a single byte per callback, like the UDP endpoint consumes a single datagram.
+            char byte;
+            (void) read(self->mFd, &byte, 1);
+
+            if (self->mStopOnReadable != nullptr)
+            {
+                EXPECT_EQ(self->mLayer->StopWatchingSocket(&self->mStopOnReadable->mToken), CHIP_NO_ERROR);
+                self->mStopOnReadable = nullptr;
+            }
+        }
+        if (events.Has(SocketEventFlags::kWrite))
+        {
+            self->mWriteCallbacks++;
+        }
+    }
+};
+
+class TestSystemSocketWatch : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_EQ(mLayer.Init(), CHIP_NO_ERROR);
+        for (int i = 0; i < 2; i++)
+        {
+            int fds[2];
+            ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+            mSockets[i].mFd    = fds[0];
+            mSockets[i].mLayer = &mLayer;
+            mPeers[i]          = fds[1];
+            ASSERT_EQ(mLayer.StartWatchingSocket(mSockets[i].mFd, &mSockets[i].mToken), CHIP_NO_ERROR);
+            ASSERT_EQ(mLayer.SetCallback(mSockets[i].mToken, WatchedSocket::HandleEvents, reinterpret_cast<intptr_t>(&mSockets[i])),
+                      CHIP_NO_ERROR);
+        }
+    }
+
+    void TearDown() override
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            if (mSockets[i].mToken != mLayer.InvalidSocketWatchToken())
+            {
+                EXPECT_EQ(mLayer.StopWatchingSocket(&mSockets[i].mToken), CHIP_NO_ERROR);
+            }
+            close(mSockets[i].mFd);
+            close(mPeers[i]);
+        }
+        mLayer.Shutdown();
+    }
+
+    // Runs one iteration of the event loop. A short timer bounds the wait so that
+    // iterations where no socket is ready do not block the test.
+    void ServiceEvents()
+    {
+        EXPECT_EQ(mLayer.StartTimer(10_ms32, [](Layer *, void *) {}, nullptr), CHIP_NO_ERROR);
+        mLayer.PrepareEvents();
+        mLayer.WaitForEvents();
+        mLayer.HandleEvents();
+    }
+
+    LayerImpl mLayer;
+    WatchedSocket mSockets[2];
+    int mPeers[2];
+};
+
+TEST_F(TestSystemSocketWatch, ReadableIsReportedUntilDrained)
+{
+    ASSERT_EQ(mLayer.RequestCallbackOnPendingRead(mSockets[0].mToken), CHIP_NO_ERROR);
+
+    ServiceEvents();
+    EXPECT_EQ(mSockets[0].mReadCallbacks, 0);
+
+    ASSERT_EQ(write(mPeers[0], "ab", 2), 2);
+
+    // Each callback consumes one byte; the socket must be reported again while data remains.
+    ServiceEvents();
+    EXPECT_EQ(mSockets[0].mReadCallbacks, 1);
+    ServiceEvents();
+    EXPECT_EQ(mSockets[0].mReadCallbacks, 2);
+    ServiceEvents();
+    EXPECT_EQ(mSockets[0].mReadCallbacks, 2);
+    EXPECT_EQ(mSockets[1].mReadCallbacks, 0);
+}
+
+TEST_F(TestSystemSocketWatch, ClearedInterestIsNotReported)
+{
+    ASSERT_EQ(mLayer.RequestCallbackOnPendingRead(mSockets[0].mToken), CHIP_NO_ERROR);
+    ASSERT_EQ(mLayer.ClearCallbackOnPendingRead(mSockets[0].mToken), CHIP_NO_ERROR);
+    ASSERT_EQ(write(mPeers[0], "a", 1), 1);
+
+    ServiceEvents();
+    EXPECT_EQ(mSockets[0].mReadCallbacks, 0);
+
+    ASSERT_EQ(mLayer.RequestCallbackOnPendingRead(mSockets[0].mToken), CHIP_NO_ERROR);
+    ServiceEvents();
+    EXPECT_EQ(mSockets[0].mReadCallbacks, 1);
+}
+
+TEST_F(TestSystemSocketWatch, WritableIsReported)
+{
+    ASSERT_EQ(mLayer.RequestCallbackOnPendingWrite(mSockets[1].mToken), CHIP_NO_ERROR);
+    ServiceEvents();
+    EXPECT_EQ(mSockets[1].mWriteCallbacks, 1);
+    EXPECT_EQ(mSockets[1].mReadCallbacks, 0);
+
+    ASSERT_EQ(mLayer.ClearCallbackOnPendingWrite(mSockets[1].mToken), CHIP_NO_ERROR);
+    ServiceEvents();
+    EXPECT_EQ(mSockets[1].mWriteCallbacks, 1);
+}
+
+TEST_F(TestSystemSocketWatch, StopWatchingFromCallback)
+{
+    // Make both sockets ready in the same wait, and have whichever callback runs first stop the other watch.
+    mSockets[0].mStopOnReadable = &mSockets[1];
+    mSockets[1].mStopOnReadable = &mSockets[0];
+    ASSERT_EQ(mLayer.RequestCallbackOnPendingRead(mSockets[0].mToken), CHIP_NO_ERROR);
+    ASSERT_EQ(mLayer.RequestCallbackOnPendingRead(mSockets[1].mToken), CHIP_NO_ERROR);
+    ASSERT_EQ(write(mPeers[0], "a", 1), 1);
+    ASSERT_EQ(write(mPeers[1], "a", 1), 1);
+
+    ServiceEvents();
+    EXPECT_EQ(mSockets[0].mReadCallbacks + mSockets[1].mReadCallbacks, 1);
+}
+
+} // namespace
+
+#endif // CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH && !CHIP_SYSTEM_CONFIG_USE_LIBEV
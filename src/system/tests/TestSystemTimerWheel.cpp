@@ -0,0 +1,297 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemTimer.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System;
+using namespace chip::System::Clock::Literals;
+
+void CallbackA(Layer *, void *) {}
+void CallbackB(Layer *, void *) {}
+
+class TestSystemTimerWheel : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(sLayer.Init(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sLayer.Shutdown();
+        Platform::MemoryShutdown();
+    }
+
+    template <typename Timer>
+    static std::unique_ptr<Timer> MakeTimer(Clock::Timestamp awakenTime, TimerCompleteCallback onComplete = CallbackA,
+                                            void * appState = nullptr)
+    {
+        return std::make_unique<Timer>(sLayer, awakenTime, onComplete, appState);
+    }
+
+    static LayerImpl sLayer;
+};
+
+LayerImpl TestSystemTimerWheel::sLayer;
+
+uint32_t NextRandom(uint32_t & seed)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+// Mirrors the TimerList checks of TestSystemTimer.CheckTimerPool.
+TEST_F(TestSystemTimerWheel, CheckTimerWheel)
+{
+    using Timer = TimerWheel::Node;
+    int state   = 0;
+
+    std::unique_ptr<Timer> timers[] = {
+        MakeTimer<Timer>(111_ms, CallbackA, &state), // 0
+        MakeTimer<Timer>(100_ms, CallbackA, &state), // 1
+        MakeTimer<Timer>(202_ms, CallbackB, &state), // 2
+        MakeTimer<Timer>(303_ms, CallbackA, &state), // 3
+    };
+
+    TimerWheel wheel;
+    EXPECT_EQ(wheel.Remove(nullptr), nullptr);
+    EXPECT_EQ(wheel.Remove(nullptr, nullptr), nullptr);
+    EXPECT_EQ(wheel.PopEarliest(), nullptr);
+    EXPECT_EQ(wheel.PopIfEarlier(500_ms), nullptr);
+    EXPECT_EQ(wheel.Earliest(), nullptr);
+    EXPECT_TRUE(wheel.Empty());
+
+    EXPECT_EQ(wheel.Add(timers[0].get()), timers[0].get());
+    EXPECT_EQ(wheel.PopIfEarlier(10_ms), nullptr);
+    EXPECT_EQ(wheel.Earliest(), timers[0].get());
+    EXPECT_FALSE(wheel.Empty());
+
+    EXPECT_EQ(wheel.Add(timers[1].get()), timers[1].get());
+    EXPECT_EQ(wheel.Add(timers[2].get()), timers[1].get());
+    EXPECT_EQ(wheel.Add(timers[3].get()), timers[1].get());
+
+    EXPECT_EQ(wheel.Remove(timers[1].get()), timers[0].get());
+    EXPECT_EQ(wheel.Remove(timers[1].get()), timers[0].get());
+    EXPECT_EQ(wheel.Remove(CallbackB, &state), timers[2].get());
+    EXPECT_EQ(wheel.Remove(CallbackB, &state), nullptr);
+    EXPECT_EQ(wheel.Earliest(), timers[0].get());
+
+    EXPECT_EQ(wheel.PopEarliest(), timers[0].get());
+    EXPECT_EQ(wheel.Earliest(), timers[3].get());
+    EXPECT_EQ(wheel.PopIfEarlier(10_ms), nullptr);
+    EXPECT_EQ(wheel.PopIfEarlier(500_ms), timers[3].get());
+    EXPECT_TRUE(wheel.Empty());
+
+    EXPECT_EQ(wheel.Add(timers[3].get()), timers[3].get());
+    wheel.Clear();
+    EXPECT_TRUE(wheel.Empty());
+    EXPECT_EQ(wheel.Earliest(), nullptr);
+
+    for (auto & timer : timers)
+    {
+        wheel.Add(timer.get());
+    }
+    TimerList early = wheel.ExtractEarlier(200_ms);
+    EXPECT_EQ(wheel.PopEarliest(), timers[2].get());
+    EXPECT_EQ(wheel.PopEarliest(), timers[3].get());
+    EXPECT_EQ(wheel.PopEarliest(), nullptr);
+    EXPECT_EQ(early.PopEarliest(), timers[1].get());
+    EXPECT_EQ(early.PopEarliest(), timers[0].get());
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+}
+
+TEST_F(TestSystemTimerWheel, CheckSameAwakenTimeKeepsAddOrder)
+{
+    using Timer = TimerWheel::Node;
+    TimerWheel wheel;
+
+    // Timers for the same time added while the wheel is further and further ahead are first held in different levels.
+    auto first  = MakeTimer<Timer>(300000_ms);
+    auto second = MakeTimer<Timer>(300000_ms);
+    auto third  = MakeTimer<Timer>(300000_ms);
+    auto fourth = MakeTimer<Timer>(300000_ms);
+
+    wheel.Add(first.get());
+    EXPECT_TRUE(wheel.ExtractEarlier(250000_ms).Empty());
+    wheel.Add(second.get());
+    EXPECT_TRUE(wheel.ExtractEarlier(299000_ms).Empty());
+    wheel.Add(third.get());
+    EXPECT_TRUE(wheel.ExtractEarlier(299990_ms).Empty());
+    wheel.Add(fourth.get());
+
+    TimerList expired = wheel.ExtractEarlier(300001_ms);
+    EXPECT_TRUE(wheel.Empty());
+    EXPECT_EQ(expired.PopEarliest(), first.get());
+    EXPECT_EQ(expired.PopEarliest(), second.get());
+    EXPECT_EQ(expired.PopEarliest(), third.get());
+    EXPECT_EQ(expired.PopEarliest(), fourth.get());
+    EXPECT_EQ(expired.PopEarliest(), nullptr);
+}
+
+TEST_F(TestSystemTimerWheel, CheckOverdueAndFarTimers)
+{
+    using Timer = TimerWheel::Node;
+    TimerWheel wheel;
+
+    EXPECT_TRUE(wheel.ExtractEarlier(10000_ms).Empty());
+
+    // Earlier than the time the wheel was last advanced to, and beyond the range of its top level.
+    auto overdue = MakeTimer<Timer>(5_ms);
+    auto near    = MakeTimer<Timer>(10005_ms);
+    auto far     = MakeTimer<Timer>(Clock::Timestamp(uint64_t(1) << 40));
+    auto farther = MakeTimer<Timer>(Clock::Timestamp((uint64_t(1) << 40) + 1));
+
+    EXPECT_EQ(wheel.Add(farther.get()), farther.get());
+    EXPECT_EQ(wheel.Add(far.get()), far.get());
+    EXPECT_EQ(wheel.Add(near.get()), near.get());
+    EXPECT_EQ(wheel.Add(overdue.get()), overdue.get());
+
+    EXPECT_EQ(wheel.PopIfEarlier(10000_ms), overdue.get());
+    EXPECT_EQ(wheel.PopIfEarlier(10000_ms), nullptr);
+    EXPECT_EQ(wheel.PopIfEarlier(Clock::Timestamp(uint64_t(1) << 40)), near.get());
+    EXPECT_EQ(wheel.PopIfEarlier(Clock::Timestamp(uint64_t(1) << 40)), nullptr);
+    EXPECT_EQ(wheel.Earliest(), far.get());
+
+    TimerList expired = wheel.ExtractEarlier(Clock::Timestamp((uint64_t(1) << 40) + 2));
+    EXPECT_TRUE(wheel.Empty());
+    EXPECT_EQ(expired.PopEarliest(), far.get());
+    EXPECT_EQ(expired.PopEarliest(), farther.get());
+    EXPECT_EQ(expired.PopEarliest(), nullptr);
+}
+
+TEST_F(TestSystemTimerWheel, CheckMatchesTimerList)
+{
+    constexpr size_t kTimers  = 200;
+    constexpr size_t kStates  = 16;
+    constexpr int kOperations = 20000;
+
+    int states[kStates];
+    std::vector<std::unique_ptr<TimerList::Node>> listTimers;
+    std::vector<std::unique_ptr<TimerWheel::Node>> wheelTimers;
+    std::vector<bool> queued(kTimers, false);
+    TimerList list;
+    TimerWheel wheel;
+
+    listTimers.resize(kTimers);
+    wheelTimers.resize(kTimers);
+
+    auto indexOf = [&](TimerList::Node * timer) -> int {
+        VerifyOrReturnValue(timer != nullptr, -1);
+        for (size_t i = 0; i < kTimers; i++)
+        {
+            if (listTimers[i].get() == timer || wheelTimers[i].get() == timer)
+            {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    };
+
+    uint32_t seed  = 7;
+    uint64_t nowMs = 1000;
+    for (int operation = 0; operation < kOperations; operation++)
+    {
+        const size_t i = NextRandom(seed) % kTimers;
+        switch (NextRandom(seed) % 5)
+        {
+        case 0:
+        case 1: {
+            if (queued[i])
+            {
+                break;
+            }
+            // Mix delays resolved by several levels of the wheel, as well as overdue timers.
+            const uint32_t delayRanges[] = { 4, 100, 10000, 5000000 };
+            uint64_t awakenMs            = nowMs + NextRandom(seed) % delayRanges[NextRandom(seed) % 4];
+            if (NextRandom(seed) % 16 == 0)
+            {
+                awakenMs = nowMs - NextRandom(seed) % 500;
+            }
+            TimerCompleteCallback onComplete = (NextRandom(seed) % 2) ? CallbackA : CallbackB;
+            void * appState                  = &states[NextRandom(seed) % kStates];
+            Clock::Timestamp awakenTime      = Clock::Timestamp(awakenMs);
+
+            listTimers[i]  = MakeTimer<TimerList::Node>(awakenTime, onComplete, appState);
+            wheelTimers[i] = MakeTimer<TimerWheel::Node>(awakenTime, onComplete, appState);
+            EXPECT_EQ(indexOf(list.Add(listTimers[i].get())), indexOf(wheel.Add(wheelTimers[i].get())));
+            queued[i] = true;
+            break;
+        }
+        case 2: {
+            if (!queued[i])
+            {
+                break;
+            }
+            EXPECT_EQ(indexOf(list.Remove(listTimers[i].get())), indexOf(wheel.Remove(wheelTimers[i].get())));
+            queued[i] = false;
+            break;
+        }
+        case 3: {
+            TimerCompleteCallback onComplete = (NextRandom(seed) % 2) ? CallbackA : CallbackB;
+            void * appState                  = &states[NextRandom(seed) % kStates];
+            const int removed                = indexOf(list.Remove(onComplete, appState));
+            EXPECT_EQ(removed, indexOf(wheel.Remove(onComplete, appState)));
+            if (removed >= 0)
+            {
+                queued[static_cast<size_t>(removed)] = false;
+            }
+            break;
+        }
+        default: {
+            nowMs += NextRandom(seed) % ((NextRandom(seed) % 8 == 0) ? 100000u : 50u);
+            TimerList listExpired  = list.ExtractEarlier(Clock::Timestamp(nowMs));
+            TimerList wheelExpired = wheel.ExtractEarlier(Clock::Timestamp(nowMs));
+            for (TimerList::Node * timer = listExpired.PopEarliest(); timer != nullptr; timer = listExpired.PopEarliest())
+            {
+                const int expired = indexOf(timer);
+                EXPECT_EQ(expired, indexOf(wheelExpired.PopEarliest()));
+                queued[static_cast<size_t>(expired)] = false;
+            }
+            EXPECT_TRUE(wheelExpired.Empty());
+            break;
+        }
+        }
+        EXPECT_EQ(indexOf(list.Earliest()), indexOf(wheel.Earliest()));
+        EXPECT_EQ(list.Empty(), wheel.Empty());
+    }
+
+    // Drain both in order, which takes the wheel through its far timers.
+    for (TimerList::Node * timer = list.PopEarliest(); timer != nullptr; timer = list.PopEarliest())
+    {
+        EXPECT_EQ(indexOf(timer), indexOf(wheel.PopEarliest()));
+    }
+    EXPECT_TRUE(wheel.Empty());
+}
+
+} // namespace
@@ -0,0 +1,76 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the 'chip-kvs-migrate' command line tool, which converts
+ *      a key-value store written by the INI backend of the Linux platform to the
+ *      log-structured format.
+ */
+
+#include <lib/core/ErrorStr.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <stdio.h>
+#include <string.h>
+
+using chip::DeviceLayer::Internal::ChipLinuxStorageLog;
+
+namespace {
+
+const char * const sHelp = "Usage: chip-kvs-migrate <ini-store> [<log-store>]\n"
+                           "\n"
+                           "Converts a KVS file written by the INI backend of the Linux platform to the\n"
+                           "log-structured format. The file is converted in place if <log-store> is omitted.\n";
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    if (argc < 2 || argc > 3 || strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-h") == 0)
+    {
+        fputs(sHelp, (argc == 2) ? stdout : stderr);
+        return (argc == 2) ? 0 : 1;
+    }
+
+    const char * iniPath = argv[1];
+    const char * logPath = (argc == 3) ? argv[2] : argv[1];
+
+    if (ChipLinuxStorageLog::IsLogFile(iniPath))
+    {
+        fprintf(stderr, "%s is already a log-structured store\n", iniPath);
+        return (argc == 2) ? 0 : 1;
+    }
+
+    CHIP_ERROR err = chip::Platform::MemoryInit();
+    if (err == CHIP_NO_ERROR)
+    {
+        err = ChipLinuxStorageLog::MigrateFromIni(iniPath, logPath);
+    }
+    chip::Platform::MemoryShutdown();
+
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to convert %s: %s\n", iniPath, chip::ErrorStr(err));
+        return 1;
+    }
+
+    printf("Converted %s to %s\n", iniPath, logPath);
+    return 0;
+}
@@ -0,0 +1,249 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/binary/binary_trace_converter.h>
+
+#include <tracing/binary/binary_trace_format.h>
+
+#include <inttypes.h>
+#include <string.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+namespace {
+
+using Format::RecordType;
+
+class Converter
+{
+public:
+    Converter(FILE * input, FILE * output) : mInput(input), mOutput(output) {}
+
+    bool Convert()
+    {
+        Format::FileHeader header;
+        if (fread(&header, sizeof(header), 1, mInput) != 1 || memcmp(header.magic, Format::kMagic, sizeof(header.magic)) != 0)
+        {
+            fprintf(stderr, "Not a binary trace file\n");
+            return false;
+        }
+        if (header.byteOrderMark != Format::kByteOrderMark)
+        {
+            fprintf(stderr, "Trace was recorded with a different byte order\n");
+            return false;
+        }
+        if (header.version != Format::kVersion || header.recordSize != sizeof(Format::Record))
+        {
+            fprintf(stderr, "Unsupported trace version %u\n", header.version);
+            return false;
+        }
+
+        // Records are flushed one thread at a time, so the earliest event is not necessarily the first one in the file
+        const long firstRecord = ftell(mInput);
+        if (firstRecord < 0 || !FindStartTime() || fseek(mInput, firstRecord, SEEK_SET) != 0)
+        {
+            fprintf(stderr, "Cannot read the trace twice, it must be a regular file\n");
+            return false;
+        }
+
+        fprintf(mOutput, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+        Format::Record record;
+        size_t count = 0;
+        while (fread(&record, sizeof(record), 1, mInput) == 1)
+        {
+            if (!ConvertRecord(record))
+            {
+                fprintf(stderr, "Trace is truncated after %zu records\n", count);
+                break;
+            }
+            count++;
+        }
+
+        fprintf(mOutput, "\n]}\n");
+        fprintf(stderr, "Converted %zu records\n", count);
+        return true;
+    }
+
+private:
+    // Sets mStartNs to the earliest timestamp in the trace, leaving the input at an unspecified position
+    bool FindStartTime()
+    {
+        Format::Record record;
+        bool found = false;
+        while (fread(&record, sizeof(record), 1, mInput) == 1)
+        {
+            if (static_cast<RecordType>(record.type) == RecordType::kString)
+            {
+                if (fseek(mInput, static_cast<long>(record.value), SEEK_CUR) != 0)
+                {
+                    return false;
+                }
+                continue;
+            }
+            if (!found || record.timestampNs < mStartNs)
+            {
+                mStartNs = record.timestampNs;
+                found    = true;
+            }
+        }
+        return ferror(mInput) == 0;
+    }
+
+    bool ConvertRecord(const Format::Record & record)
+    {
+        const RecordType type = static_cast<RecordType>(record.type);
+
+        if (type == RecordType::kString)
+        {
+            std::string & string = mStrings[record.label];
+            string.resize(record.value);
+            return record.value == 0 || fread(&string[0], 1, record.value, mInput) == record.value;
+        }
+
+        const char * label = String(record.label);
+        const char * group = String(record.group);
+
+        switch (type)
+        {
+        case RecordType::kBegin:
+            BeginEvent(record, "B", label, group);
+            break;
+        case RecordType::kEnd:
+            BeginEvent(record, "E", label, group);
+            break;
+        case RecordType::kInstant:
+            BeginEvent(record, "i", label, group);
+            fprintf(mOutput, ",\"s\":\"t\"");
+            break;
+        case RecordType::kCounter:
+            BeginEvent(record, "C", label, "Counter");
+            fprintf(mOutput, ",\"args\":{\"count\":%" PRIu32 "}", ++mCounters[record.label]);
+            break;
+        case RecordType::kMetricBegin:
+        case RecordType::kMetricEnd:
+        case RecordType::kMetricInstant:
+            BeginEvent(record, type == RecordType::kMetricBegin ? "B" : (type == RecordType::kMetricEnd ? "E" : "i"), label,
+                       "Metric");
+            MetricValue(record);
+            break;
+        case RecordType::kDropped:
+            BeginEvent(record, "i", "Dropped events", "BinaryBackend");
+            fprintf(mOutput, ",\"s\":\"t\",\"args\":{\"count\":%" PRIu32 "}", record.value);
+            break;
+        default:
+            // Unknown record types are skipped so that newer writers can add them
+            return true;
+        }
+
+        fprintf(mOutput, "}");
+        return true;
+    }
+
+    // Writes the fields shared by all events, leaving the object open for more
+    void BeginEvent(const Format::Record & record, const char * phase, const char * name, const char * category)
+    {
+        const uint64_t ns = record.timestampNs - mStartNs;
+
+        fprintf(mOutput, "%s\n{\"ph\":\"%s\",\"name\":", mFirstEvent ? "" : ",", phase);
+        WriteJsonString(name);
+        fprintf(mOutput, ",\"cat\":");
+        WriteJsonString(category);
+        fprintf(mOutput, ",\"ts\":%" PRIu64 ".%03u,\"pid\":1,\"tid\":%" PRIu32, ns / 1000, static_cast<unsigned>(ns % 1000),
+                record.threadId);
+        mFirstEvent = false;
+    }
+
+    void MetricValue(const Format::Record & record)
+    {
+        switch (static_cast<Format::MetricValueType>(record.valueType))
+        {
+        case Format::MetricValueType::kInt32:
+            fprintf(mOutput, ",\"args\":{\"value\":%" PRId32 "}", static_cast<int32_t>(record.value));
+            break;
+        case Format::MetricValueType::kUInt32:
+            fprintf(mOutput, ",\"args\":{\"value\":%" PRIu32 "}", record.value);
+            break;
+        case Format::MetricValueType::kChipErrorCode:
+            fprintf(mOutput, ",\"args\":{\"error\":\"0x%" PRIx32 "\"}", record.value);
+            break;
+        default:
+            break;
+        }
+        if (record.type == static_cast<uint8_t>(RecordType::kMetricInstant))
+        {
+            fprintf(mOutput, ",\"s\":\"t\"");
+        }
+    }
+
+    const char * String(uint16_t id)
+    {
+        if (id == Format::kNoString)
+        {
+            return "";
+        }
+
+        auto it = mStrings.find(id);
+        return it != mStrings.end() ? it->second.c_str() : "<unknown>";
+    }
+
+    void WriteJsonString(const char * string)
+    {
+        fputc('"', mOutput);
+        for (const char * c = string; *c != '\0'; c++)
+        {
+            const unsigned char ch = static_cast<unsigned char>(*c);
+            if (ch == '"' || ch == '\\')
+            {
+                fputc('\\', mOutput);
+                fputc(ch, mOutput);
+            }
+            else if (ch < 0x20)
+            {
+                fprintf(mOutput, "\\u%04x", ch);
+            }
+            else
+            {
+                fputc(ch, mOutput);
+            }
+        }
+        fputc('"', mOutput);
+    }
+
+    FILE * mInput;
+    FILE * mOutput;
+    bool mFirstEvent  = true;
+    uint64_t mStartNs = 0;
+    std::unordered_map<uint16_t, std::string> mStrings;
+    std::unordered_map<uint16_t, uint32_t> mCounters;
+};
+
+} // namespace
+
+bool ConvertToChromeJson(FILE * input, FILE * output)
+{
+    return Converter(input, output).Convert();
+}
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
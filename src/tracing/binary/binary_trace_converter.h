@@ -0,0 +1,38 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <stdio.h>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+/// Converts a trace recorded by BinaryBackend to the Chrome trace event JSON format, which can be
+/// loaded by https://ui.perfetto.dev or chrome://tracing.
+///
+/// Timestamps are written relative to the earliest event in the trace. The input is read twice,
+/// so it must be seekable. Progress and errors are reported on stderr.
+///
+/// Returns false if the input is not a binary trace this converter understands. A truncated trace
+/// is converted up to the truncation.
+bool ConvertToChromeJson(FILE * input, FILE * output);
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
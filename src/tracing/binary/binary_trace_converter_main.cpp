@@ -0,0 +1,64 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Converts a trace recorded by BinaryBackend to the Chrome trace event JSON format, which can be
+ *      loaded by https://ui.perfetto.dev or chrome://tracing.
+ *
+ *      Usage: chip-binary-trace-converter <input> [<output>]
+ *
+ *      The JSON is written to stdout if no output file is given.
+ */
+
+#include <tracing/binary/binary_trace_converter.h>
+
+#include <stdio.h>
+
+int main(int argc, char * argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        fprintf(stderr, "Usage: %s <input> [<output>]\n", argv[0]);
+        return 1;
+    }
+
+    FILE * input = fopen(argv[1], "rb");
+    if (input == nullptr)
+    {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    FILE * output = (argc == 3) ? fopen(argv[2], "w") : stdout;
+    if (output == nullptr)
+    {
+        fprintf(stderr, "Cannot open %s\n", argv[2]);
+        fclose(input);
+        return 1;
+    }
+
+    const bool converted = chip::Tracing::Binary::ConvertToChromeJson(input, output);
+
+    fclose(input);
+    if (output != stdout)
+    {
+        fclose(output);
+    }
+    return converted ? 0 : 1;
+}
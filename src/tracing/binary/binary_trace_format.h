@@ -0,0 +1,90 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+namespace Format {
+
+/// Layout of the files written by BinaryBackend.
+///
+/// A file starts with a FileHeader followed by a sequence of Records. Every value is stored in the byte order of the
+/// device that wrote the file, which readers detect through FileHeader::byteOrderMark.
+///
+/// Labels, groups and metric keys are referenced by an interned string ID. The text of a string is given once per
+/// file by a RecordType::kString record, which is followed by Record::value bytes of text (not NUL terminated) and
+/// always appears before the first record that references it.
+
+constexpr char kMagic[8]          = { 'M', 'T', 'R', 'T', 'R', 'A', 'C', 'E' };
+constexpr uint32_t kByteOrderMark = 0x01020304;
+constexpr uint16_t kVersion       = 1;
+constexpr uint16_t kMaxStrings    = 4096;
+constexpr uint16_t kNoString      = 0xFFFF;
+static_assert(kMaxStrings < kNoString, "String IDs must not collide with kNoString");
+
+struct FileHeader
+{
+    char magic[8];
+    uint32_t byteOrderMark;
+    uint16_t version;
+    uint16_t recordSize;
+};
+
+enum class RecordType : uint8_t
+{
+    kString        = 0, // Defines the string with ID `label`, see above.
+    kBegin         = 1, // Backend::TraceBegin
+    kEnd           = 2, // Backend::TraceEnd
+    kInstant       = 3, // Backend::TraceInstant
+    kCounter       = 4, // Backend::TraceCounter, readers count the occurrences of each label.
+    kMetricBegin   = 5, // Backend::LogMetricEvent, `label` is the metric key and `valueType` a MetricValueType.
+    kMetricEnd     = 6,
+    kMetricInstant = 7,
+    kDropped       = 8, // `value` events of `threadId` were dropped because its ring buffer was full.
+};
+
+enum class MetricValueType : uint8_t
+{
+    kUndefined     = 0,
+    kInt32         = 1,
+    kUInt32        = 2,
+    kChipErrorCode = 3,
+};
+
+struct Record
+{
+    uint64_t timestampNs; // Monotonic clock
+    uint32_t threadId;    // Assigned in the order threads first trace an event, starting at 1.
+    uint32_t value;
+    uint16_t label;
+    uint16_t group;
+    uint8_t type; // RecordType
+    uint8_t valueType; // MetricValueType
+    uint8_t reserved[2];
+};
+
+static_assert(sizeof(FileHeader) == 16, "FileHeader layout must not depend on the compiler");
+static_assert(sizeof(Record) == 24, "Record layout must not depend on the compiler");
+
+} // namespace Format
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,389 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/binary/binary_tracing.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+#include <tracing/metric_event.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include <new>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+namespace {
+
+using Format::RecordType;
+
+constexpr std::chrono::milliseconds kFlushInterval(100);
+
+// Avoid false sharing between the recording thread and the flush thread
+constexpr size_t kCacheLineSize = 64;
+
+std::atomic<uint64_t> sNextInstanceId{ 1 };
+
+struct ThreadCache
+{
+    uint64_t instanceId = 0;
+    void * buffer       = nullptr;
+};
+
+thread_local ThreadCache tCache;
+
+uint64_t MonotonicNanoseconds()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+static_assert((BinaryBackend::kRecordsPerThread & (BinaryBackend::kRecordsPerThread - 1)) == 0,
+              "kRecordsPerThread must be a power of two");
+
+/// Single producer (the owning thread), single consumer (the flush) ring of records.
+struct BinaryBackend::ThreadBuffer
+{
+    ThreadBuffer(std::thread::id owner, uint32_t id) : ownerThread(owner), threadId(id) {}
+
+    const std::thread::id ownerThread;
+    const uint32_t threadId;
+    ThreadBuffer * next = nullptr;
+
+    alignas(kCacheLineSize) std::atomic<uint32_t> writeIndex{ 0 };
+    std::atomic<uint32_t> dropped{ 0 };
+
+    alignas(kCacheLineSize) std::atomic<uint32_t> readIndex{ 0 };
+    uint32_t droppedReported = 0; // Only used by the flush
+
+    Format::Record records[kRecordsPerThread];
+};
+
+BinaryBackend::BinaryBackend() : mInstanceId(sNextInstanceId.fetch_add(1, std::memory_order_relaxed)) {}
+
+BinaryBackend::~BinaryBackend()
+{
+    CloseFile();
+
+    ThreadBuffer * buffer = mThreadBuffers.exchange(nullptr);
+    while (buffer != nullptr)
+    {
+        ThreadBuffer * next = buffer->next;
+        delete buffer;
+        buffer = next;
+    }
+}
+
+CHIP_ERROR BinaryBackend::OpenFile(const char * path)
+{
+    CloseFile();
+
+    mOutputFile = fopen(path, "wb");
+    VerifyOrReturnError(mOutputFile != nullptr, CHIP_ERROR_POSIX(errno));
+
+    Format::FileHeader header;
+    memcpy(header.magic, Format::kMagic, sizeof(header.magic));
+    header.byteOrderMark = Format::kByteOrderMark;
+    header.version       = Format::kVersion;
+    header.recordSize    = sizeof(Format::Record);
+    if (fwrite(&header, sizeof(header), 1, mOutputFile) != 1)
+    {
+        fclose(mOutputFile);
+        mOutputFile = nullptr;
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    // Strings have to be defined again in every file
+    memset(mStringWritten, 0, sizeof(mStringWritten));
+
+    mStopFlushing = false;
+    mRecording.store(true, std::memory_order_release);
+    if (mFlushInBackground)
+    {
+        mFlushThread = std::thread(&BinaryBackend::FlushThreadMain, this);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void BinaryBackend::CloseFile()
+{
+    VerifyOrReturn(mOutputFile != nullptr);
+
+    mRecording.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(mFlushMutex);
+        mStopFlushing = true;
+    }
+    mFlushCondition.notify_one();
+    if (mFlushThread.joinable())
+    {
+        mFlushThread.join();
+    }
+
+    // Events recorded after the last flush of the flush thread
+    Flush();
+
+    fclose(mOutputFile);
+    mOutputFile = nullptr;
+}
+
+void BinaryBackend::TraceBegin(const char * label, const char * group)
+{
+    Record(RecordType::kBegin, label, group);
+}
+
+void BinaryBackend::TraceEnd(const char * label, const char * group)
+{
+    Record(RecordType::kEnd, label, group);
+}
+
+void BinaryBackend::TraceInstant(const char * label, const char * group)
+{
+    Record(RecordType::kInstant, label, group);
+}
+
+void BinaryBackend::TraceCounter(const char * label)
+{
+    Record(RecordType::kCounter, label, nullptr);
+}
+
+void BinaryBackend::LogMetricEvent(const MetricEvent & event)
+{
+    RecordType type = RecordType::kMetricInstant;
+    switch (event.type())
+    {
+    case MetricEvent::Type::kBeginEvent:
+        type = RecordType::kMetricBegin;
+        break;
+    case MetricEvent::Type::kEndEvent:
+        type = RecordType::kMetricEnd;
+        break;
+    case MetricEvent::Type::kInstantEvent:
+        type = RecordType::kMetricInstant;
+        break;
+    }
+
+    uint32_t value                    = 0;
+    Format::MetricValueType valueType = Format::MetricValueType::kUndefined;
+    switch (event.ValueType())
+    {
+    case MetricEvent::Value::Type::kInt32:
+        value     = static_cast<uint32_t>(event.ValueInt32());
+        valueType = Format::MetricValueType::kInt32;
+        break;
+    case MetricEvent::Value::Type::kUInt32:
+        value     = event.ValueUInt32();
+        valueType = Format::MetricValueType::kUInt32;
+        break;
+    case MetricEvent::Value::Type::kChipErrorCode:
+        value     = event.ValueErrorCode();
+        valueType = Format::MetricValueType::kChipErrorCode;
+        break;
+    case MetricEvent::Value::Type::kUndefined:
+        break;
+    }
+
+    Record(type, event.key(), nullptr, value, valueType);
+}
+
+void BinaryBackend::Record(RecordType type, const char * label, const char * group, uint32_t value,
+                           Format::MetricValueType valueType)
+{
+    VerifyOrReturn(mRecording.load(std::memory_order_relaxed));
+
+    ThreadBuffer * buffer = GetThreadBuffer();
+    VerifyOrReturn(buffer != nullptr);
+
+    const uint32_t writeIndex = buffer->writeIndex.load(std::memory_order_relaxed);
+    const uint32_t used       = writeIndex - buffer->readIndex.load(std::memory_order_acquire);
+    if (used >= kRecordsPerThread)
+    {
+        buffer->dropped.store(buffer->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+    }
+
+    Format::Record & record = buffer->records[writeIndex & (kRecordsPerThread - 1)];
+    record.timestampNs      = MonotonicNanoseconds();
+    record.threadId         = buffer->threadId;
+    record.value            = value;
+    record.label            = Intern(label);
+    record.group            = Intern(group);
+    record.type             = to_underlying(type);
+    record.valueType        = to_underlying(valueType);
+    record.reserved[0]      = 0;
+    record.reserved[1]      = 0;
+
+    buffer->writeIndex.store(writeIndex + 1, std::memory_order_release);
+
+    // Flush early rather than drop events when a thread traces faster than the flush interval allows for
+    if (used + 1 == kRecordsPerThread / 2)
+    {
+        mFlushCondition.notify_one();
+    }
+}
+
+BinaryBackend::ThreadBuffer * BinaryBackend::GetThreadBuffer()
+{
+    if (tCache.instanceId == mInstanceId)
+    {
+        return static_cast<ThreadBuffer *>(tCache.buffer);
+    }
+
+    // The cache belongs to another backend, so look for the buffer of this thread before creating one
+    const std::thread::id self = std::this_thread::get_id();
+    ThreadBuffer * buffer      = mThreadBuffers.load(std::memory_order_acquire);
+    while (buffer != nullptr && buffer->ownerThread != self)
+    {
+        buffer = buffer->next;
+    }
+
+    if (buffer == nullptr)
+    {
+        buffer = new (std::nothrow) ThreadBuffer(self, mNextThreadId.fetch_add(1, std::memory_order_relaxed));
+        VerifyOrReturnValue(buffer != nullptr, nullptr);
+
+        buffer->next = mThreadBuffers.load(std::memory_order_relaxed);
+        while (!mThreadBuffers.compare_exchange_weak(buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    tCache.instanceId = mInstanceId;
+    tCache.buffer     = buffer;
+    return buffer;
+}
+
+uint16_t BinaryBackend::Intern(const char * string)
+{
+    VerifyOrReturnValue(string != nullptr, Format::kNoString);
+
+    // Open addressing on the address of the string, which is constant for a given label
+    const uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(string)) * 0x9E3779B97F4A7C15ull;
+    uint16_t index      = static_cast<uint16_t>((hash >> 32) % Format::kMaxStrings);
+
+    for (uint16_t probes = 0; probes < Format::kMaxStrings; probes++)
+    {
+        const char * current = mStrings[index].load(std::memory_order_acquire);
+        if (current == nullptr)
+        {
+            if (mStrings[index].compare_exchange_strong(current, string, std::memory_order_release, std::memory_order_acquire) ||
+                current == string)
+            {
+                return index;
+            }
+        }
+        else if (current == string)
+        {
+            return index;
+        }
+
+        index = static_cast<uint16_t>((index + 1) % Format::kMaxStrings);
+    }
+
+    return Format::kNoString;
+}
+
+void BinaryBackend::FlushThreadMain()
+{
+    std::unique_lock<std::mutex> lock(mFlushMutex);
+    while (!mStopFlushing)
+    {
+        mFlushCondition.wait_for(lock, kFlushInterval);
+
+        lock.unlock();
+        Flush();
+        lock.lock();
+    }
+}
+
+void BinaryBackend::Flush()
+{
+    mFlushRecords.clear();
+
+    for (ThreadBuffer * buffer = mThreadBuffers.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->next)
+    {
+        const uint32_t readIndex  = buffer->readIndex.load(std::memory_order_relaxed);
+        const uint32_t writeIndex = buffer->writeIndex.load(std::memory_order_acquire);
+
+        for (uint32_t i = readIndex; i != writeIndex; i++)
+        {
+            mFlushRecords.push_back(buffer->records[i & (kRecordsPerThread - 1)]);
+        }
+        buffer->readIndex.store(writeIndex, std::memory_order_release);
+
+        const uint32_t dropped = buffer->dropped.load(std::memory_order_relaxed);
+        if (dropped != buffer->droppedReported)
+        {
+            Format::Record record = {};
+            record.timestampNs    = MonotonicNanoseconds();
+            record.threadId       = buffer->threadId;
+            record.value          = dropped - buffer->droppedReported;
+            record.label          = Format::kNoString;
+            record.group          = Format::kNoString;
+            record.type           = to_underlying(RecordType::kDropped);
+            mFlushRecords.push_back(record);
+
+            buffer->droppedReported = dropped;
+        }
+    }
+
+    VerifyOrReturn(!mFlushRecords.empty());
+
+    // Every string referenced by the records above was interned before they were recorded
+    WriteNewStrings();
+
+    if (fwrite(mFlushRecords.data(), sizeof(Format::Record), mFlushRecords.size(), mOutputFile) != mFlushRecords.size())
+    {
+        ChipLogError(Automation, "Failed to write %u binary trace records", static_cast<unsigned>(mFlushRecords.size()));
+    }
+    fflush(mOutputFile);
+}
+
+void BinaryBackend::WriteNewStrings()
+{
+    for (uint16_t id = 0; id < Format::kMaxStrings; id++)
+    {
+        const char * string = mStrings[id].load(std::memory_order_acquire);
+        if (string == nullptr || mStringWritten[id])
+        {
+            continue;
+        }
+
+        Format::Record record = {};
+        record.value          = static_cast<uint32_t>(strlen(string));
+        record.label          = id;
+        record.group          = Format::kNoString;
+        record.type           = to_underlying(RecordType::kString);
+
+        fwrite(&record, sizeof(record), 1, mOutputFile);
+        fwrite(string, 1, record.value, mOutputFile);
+        mStringWritten[id] = true;
+    }
+}
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,113 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <tracing/backend.h>
+#include <tracing/binary/binary_trace_format.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+/// A Backend that records trace events to a file as fixed-size binary records.
+///
+/// Every thread that traces gets its own ring buffer, so recording an event takes no lock and
+/// does not allocate (except for the first event of each thread). Labels and groups are interned
+/// by address, which relies on them being constant strings. A background thread moves the
+/// records from the ring buffers to the output file. Use chip-binary-trace-converter to turn the
+/// file into JSON that Perfetto and chrome://tracing can load.
+///
+/// Events are dropped, and the number dropped is recorded, if a thread fills its ring buffer
+/// faster than it is flushed.
+///
+/// The ring buffer of a thread (kRecordsPerThread records, about 196 KB) is only freed when the
+/// backend is destroyed, not when the thread exits: nothing tells the backend that a thread has
+/// gone. Applications that trace from many short-lived threads should use a thread pool, or
+/// destroy the backend from time to time.
+///
+/// THREAD SAFETY:
+///    Trace* and Log* may be called from any thread. OpenFile and CloseFile must not be
+///    called concurrently with each other.
+class BinaryBackend : public ::chip::Tracing::Backend
+{
+public:
+    // Records buffered per thread between flushes. A power of two.
+    static constexpr uint32_t kRecordsPerThread = 8192;
+
+    BinaryBackend();
+    ~BinaryBackend();
+
+    // Start tracing output to the given file
+    CHIP_ERROR OpenFile(const char * path);
+
+    // Flush recorded events and close the output file, if one is open
+    void CloseFile();
+
+    void TraceBegin(const char * label, const char * group) override;
+    void TraceEnd(const char * label, const char * group) override;
+    void TraceInstant(const char * label, const char * group) override;
+    void TraceCounter(const char * label) override;
+    void LogMetricEvent(const MetricEvent &) override;
+    void Close() override { CloseFile(); }
+
+private:
+    friend class TestBinaryTracing;
+
+    struct ThreadBuffer;
+
+    void Record(Format::RecordType type, const char * label, const char * group, uint32_t value = 0,
+                Format::MetricValueType valueType = Format::MetricValueType::kUndefined);
+    ThreadBuffer * GetThreadBuffer();
+    uint16_t Intern(const char * string);
+
+    void FlushThreadMain();
+    void Flush();
+    void WriteNewStrings();
+
+    // Distinguishes this backend from previous ones at the same address in the per-thread cache
+    const uint64_t mInstanceId;
+
+    std::atomic<bool> mRecording{ false };
+    std::atomic<ThreadBuffer *> mThreadBuffers{ nullptr };
+    std::atomic<uint32_t> mNextThreadId{ 1 };
+    std::atomic<const char *> mStrings[Format::kMaxStrings] = {};
+
+    // Only used by whichever thread is flushing
+    bool mStringWritten[Format::kMaxStrings] = {};
+    std::vector<Format::Record> mFlushRecords;
+    FILE * mOutputFile = nullptr;
+
+    std::thread mFlushThread;
+    std::mutex mFlushMutex;
+    std::condition_variable mFlushCondition;
+    bool mStopFlushing      = false;
+    bool mFlushInBackground = true; // Tests turn this off to decide when records are flushed
+};
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
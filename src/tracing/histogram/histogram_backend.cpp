@@ -0,0 +1,260 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <tracing/histogram/histogram_backend.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+namespace {
+
+// Scopes deeper than this on a single thread are not timed
+constexpr size_t kMaxScopeDepth = 32;
+
+// Slot::metricState packs the open operations of a metric key so that begin and end can update
+// it with a single compare-exchange: the begin time of the first open operation (microseconds,
+// wrapping after ~9 years, which only matters for differences), how many operations are open, and
+// whether more than one was open at some point since the count was last zero.
+constexpr uint64_t kBeginTimeMask  = (1ull << 48) - 1;
+constexpr unsigned kOpenCountShift = 48;
+constexpr uint64_t kOpenCountOne   = 1ull << kOpenCountShift;
+constexpr uint64_t kOpenCountMask  = ((1ull << 14) - 1) << kOpenCountShift;
+constexpr uint64_t kOverlappedFlag = 1ull << 62;
+
+std::atomic<uint64_t> sNextInstanceId{ 1 };
+
+struct OpenScope
+{
+    uint64_t instanceId;
+    const char * label;
+    uint64_t beginTimeUs;
+};
+
+struct ScopeStack
+{
+    OpenScope scopes[kMaxScopeDepth];
+    size_t depth = 0;
+};
+
+thread_local ScopeStack tScopes;
+
+uint64_t NowMicroseconds()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64().count();
+}
+
+} // namespace
+
+HistogramBackend::HistogramBackend() : mInstanceId(sNextInstanceId.fetch_add(1, std::memory_order_relaxed)) {}
+
+HistogramBackend::~HistogramBackend()
+{
+    for (auto & slot : mMetrics)
+    {
+        Platform::Delete(slot.histogram.exchange(nullptr));
+    }
+    for (auto & slot : mScopes)
+    {
+        Platform::Delete(slot.histogram.exchange(nullptr));
+    }
+}
+
+template <size_t N>
+HistogramBackend::Slot * HistogramBackend::FindSlot(Slot (&slots)[N], const char * key, const char * group)
+{
+    VerifyOrReturnValue(key != nullptr, nullptr);
+
+    // Open addressing on the address of the key, which is constant for a given label
+    const uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)) * 0x9E3779B97F4A7C15ull;
+    size_t index        = static_cast<size_t>((hash >> 32) % N);
+
+    for (size_t probes = 0; probes < N; probes++)
+    {
+        Slot & slot          = slots[index];
+        const char * current = slot.key.load(std::memory_order_acquire);
+        if (current == key)
+        {
+            return &slot;
+        }
+
+        if (current == nullptr)
+        {
+            if (slot.key.compare_exchange_strong(current, key, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                // This thread claimed the slot, so it is the only one to allocate its histogram.
+                // Others that find the slot before the histogram is published skip their sample.
+                slot.group.store(group, std::memory_order_relaxed);
+                slot.histogram.store(Platform::New<LatencyHistogram>(), std::memory_order_release);
+                return &slot;
+            }
+            if (current == key)
+            {
+                return &slot;
+            }
+        }
+
+        index = (index + 1) % N;
+    }
+
+    return nullptr;
+}
+
+void HistogramBackend::TraceBegin(const char * label, const char * group)
+{
+    ScopeStack & stack = tScopes;
+    VerifyOrReturn(stack.depth < kMaxScopeDepth);
+
+    stack.scopes[stack.depth++] = { mInstanceId, label, NowMicroseconds() };
+}
+
+void HistogramBackend::TraceEnd(const char * label, const char * group)
+{
+    const uint64_t now = NowMicroseconds();
+    ScopeStack & stack = tScopes;
+
+    // Scopes are expected to nest, so the match is normally on top. Anything above the match was
+    // never ended (or begun on another backend's behalf) and is dropped.
+    for (size_t i = stack.depth; i > 0; i--)
+    {
+        const OpenScope & scope = stack.scopes[i - 1];
+        if (scope.instanceId != mInstanceId || scope.label != label)
+        {
+            continue;
+        }
+
+        stack.depth = i - 1;
+
+        Slot * slot = FindSlot(mScopes, label, group);
+        VerifyOrReturn(slot != nullptr);
+
+        LatencyHistogram * histogram = slot->histogram.load(std::memory_order_acquire);
+        VerifyOrReturn(histogram != nullptr);
+        histogram->Record(now - scope.beginTimeUs);
+        return;
+    }
+}
+
+void HistogramBackend::LogMetricEvent(const MetricEvent & event)
+{
+    VerifyOrReturn(event.type() != MetricEvent::Type::kInstantEvent);
+
+    const uint64_t now = NowMicroseconds();
+    Slot * slot        = FindSlot(mMetrics, event.key(), nullptr);
+    VerifyOrReturn(slot != nullptr);
+
+    if (event.type() == MetricEvent::Type::kBeginEvent)
+    {
+        uint64_t state = slot->metricState.load(std::memory_order_relaxed);
+        uint64_t next;
+        do
+        {
+            if ((state & kOpenCountMask) == 0)
+            {
+                next = (now & kBeginTimeMask) | kOpenCountOne;
+            }
+            else if ((state & kOpenCountMask) == kOpenCountMask)
+            {
+                // Too many open operations to count; the eventual durations are discarded anyway
+                next = state | kOverlappedFlag;
+            }
+            else
+            {
+                next = (state + kOpenCountOne) | kOverlappedFlag;
+            }
+        } while (!slot->metricState.compare_exchange_weak(state, next, std::memory_order_relaxed));
+
+        if (state & kOpenCountMask)
+        {
+            slot->overlapped.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    uint64_t state = slot->metricState.load(std::memory_order_relaxed);
+    uint64_t next;
+    do
+    {
+        // An end without a matching begin has no duration
+        VerifyOrReturn(state & kOpenCountMask);
+        next = ((state & kOpenCountMask) == kOpenCountOne) ? 0 : state - kOpenCountOne;
+    } while (!slot->metricState.compare_exchange_weak(state, next, std::memory_order_relaxed));
+
+    if (event.ValueType() == MetricEvent::Value::Type::kChipErrorCode && event.ValueErrorCode() != CHIP_NO_ERROR.AsInteger())
+    {
+        slot->errors.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // While operations overlap there is no telling which begin an end belongs to, so only an
+    // operation that ran on its own is timed.
+    VerifyOrReturn(next == 0 && !(state & kOverlappedFlag));
+
+    LatencyHistogram * histogram = slot->histogram.load(std::memory_order_acquire);
+    VerifyOrReturn(histogram != nullptr);
+    histogram->Record((now - state) & kBeginTimeMask);
+}
+
+void HistogramBackend::LogSnapshots() const
+{
+    ForEachSnapshot([](const HistogramInfo & info) {
+        if (info.latency.count == 0 && info.errors == 0 && info.overlapped == 0)
+        {
+            return;
+        }
+
+        ChipLogProgress(Automation,
+                        "%s %s: count=%" PRIu32 " errors=%" PRIu32 " overlapped=%" PRIu32 " min=%" PRIu32 " p50=%" PRIu32
+                        " p90=%" PRIu32 " p99=%" PRIu32 " max=%" PRIu32 " (us)",
+                        info.source == Source::kMetric ? "metric" : "scope", info.name, info.latency.count, info.errors,
+                        info.overlapped, info.latency.min, info.latency.p50, info.latency.p90, info.latency.p99, info.latency.max);
+    });
+}
+
+void HistogramBackend::Reset()
+{
+    for (auto & slot : mMetrics)
+    {
+        // Operations still open are forgotten, so that one that never ends cannot keep its key overlapped forever
+        slot.metricState.store(0, std::memory_order_relaxed);
+        slot.errors.store(0, std::memory_order_relaxed);
+        slot.overlapped.store(0, std::memory_order_relaxed);
+        LatencyHistogram * histogram = slot.histogram.load(std::memory_order_acquire);
+        if (histogram != nullptr)
+        {
+            histogram->Reset();
+        }
+    }
+    for (auto & slot : mScopes)
+    {
+        LatencyHistogram * histogram = slot.histogram.load(std::memory_order_acquire);
+        if (histogram != nullptr)
+        {
+            histogram->Reset();
+        }
+    }
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <tracing/backend.h>
+#include <tracing/histogram/latency_histogram.h>
+#include <tracing/metric_event.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+/// A Backend that keeps a latency histogram for every metric key and every trace scope label.
+///
+/// Metric keys are timed from MATTER_LOG_METRIC_BEGIN to MATTER_LOG_METRIC_END. An end event
+/// carrying a failure error code is counted as an error rather than recorded as a latency.
+/// Trace scopes (MATTER_TRACE_SCOPE, MATTER_TRACE_BEGIN/END) are timed per thread.
+///
+/// Histograms are found by the address of the key or label, which relies on these being constant
+/// strings (as all tracing macros require). A histogram is allocated the first time its key is
+/// seen; after that, recording takes no lock and does not allocate. At most kMaxMetrics metric
+/// keys and kMaxScopes scope labels are tracked, later ones are ignored.
+///
+/// Metric events carry no identifier of the operation they belong to, so operations of the same
+/// kind that overlap cannot be told apart. When a metric begins while an earlier begin of the same
+/// key is still open, every operation of that key is counted as overlapped until all of them have
+/// ended, and none of them is recorded as a latency.
+///
+/// THREAD SAFETY:
+///    Trace* and Log* may be called from any thread, as may ForEachSnapshot, LogSnapshots and
+///    Reset.
+class HistogramBackend : public ::chip::Tracing::Backend
+{
+public:
+    static constexpr size_t kMaxMetrics = 64;
+    static constexpr size_t kMaxScopes  = 128;
+
+    enum class Source : uint8_t
+    {
+        kMetric,
+        kScope,
+    };
+
+    struct HistogramInfo
+    {
+        Source source;
+        const char * name;
+        const char * group;  // only set for scopes
+        uint32_t errors;     // only set for metrics
+        uint32_t overlapped; // only set for metrics: begins that arrived while another was open
+        LatencyHistogram::Snapshot latency;
+    };
+
+    HistogramBackend();
+    ~HistogramBackend();
+
+    void TraceBegin(const char * label, const char * group) override;
+    void TraceEnd(const char * label, const char * group) override;
+    void LogMetricEvent(const MetricEvent & event) override;
+
+    /// Calls `callback(const HistogramInfo &)` for every metric key and scope label seen so far.
+    template <typename F>
+    void ForEachSnapshot(F && callback) const
+    {
+        for (auto & slot : mMetrics)
+        {
+            VisitSlot(slot, Source::kMetric, callback);
+        }
+        for (auto & slot : mScopes)
+        {
+            VisitSlot(slot, Source::kScope, callback);
+        }
+    }
+
+    /// Logs a one line summary of every histogram that has recorded values or errors.
+    void LogSnapshots() const;
+
+    /// Forget all recorded values and open metric operations. Keys that were seen stay tracked.
+    void Reset();
+
+private:
+    struct Slot
+    {
+        std::atomic<const char *> key{ nullptr };
+        std::atomic<const char *> group{ nullptr };
+        std::atomic<LatencyHistogram *> histogram{ nullptr };
+        // Open metric operations, see kBeginTimeMask and friends in the .cpp
+        std::atomic<uint64_t> metricState{ 0 };
+        std::atomic<uint32_t> errors{ 0 };
+        std::atomic<uint32_t> overlapped{ 0 };
+    };
+
+    template <size_t N>
+    static Slot * FindSlot(Slot (&slots)[N], const char * key, const char * group);
+
+    template <typename F>
+    static void VisitSlot(const Slot & slot, Source source, F & callback)
+    {
+        const char * key = slot.key.load(std::memory_order_acquire);
+        if (key == nullptr)
+        {
+            return;
+        }
+
+        const LatencyHistogram * histogram = slot.histogram.load(std::memory_order_acquire);
+
+        HistogramInfo info;
+        info.source     = source;
+        info.name       = key;
+        info.group      = slot.group.load(std::memory_order_relaxed);
+        info.errors     = slot.errors.load(std::memory_order_relaxed);
+        info.overlapped = slot.overlapped.load(std::memory_order_relaxed);
+        if (histogram != nullptr)
+        {
+            info.latency = histogram->GetSnapshot();
+        }
+        callback(static_cast<const HistogramInfo &>(info));
+    }
+
+    // Distinguishes this backend from previous ones at the same address in the per-thread scope stack
+    const uint64_t mInstanceId;
+
+    Slot mMetrics[kMaxMetrics];
+    Slot mScopes[kMaxScopes];
+};
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,90 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <tracing/histogram/histogram_shell_commands.h>
+
+#include <lib/shell/Engine.h>
+#include <lib/shell/SubShellCommand.h>
+#include <lib/shell/streamer.h>
+
+#include <inttypes.h>
+
+using namespace chip::Shell;
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+namespace {
+
+HistogramBackend * sBackend = nullptr;
+
+CHIP_ERROR MetricsDumpHandler(int argc, char ** argv)
+{
+    VerifyOrReturnError(sBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    if (!sBackend->IsInList())
+    {
+        streamer_printf(streamer_get(), "Latency histograms are not being recorded (is tracing to 'histogram' enabled?)\r\n");
+    }
+
+    streamer_printf(streamer_get(), "%-6s %-40s %8s %6s %10s %10s %10s %10s %10s %10s\r\n", "source", "name", "count", "errors",
+                    "overlapped", "min(us)", "p50(us)", "p90(us)", "p99(us)", "max(us)");
+
+    sBackend->ForEachSnapshot([](const HistogramBackend::HistogramInfo & info) {
+        if (info.latency.count == 0 && info.errors == 0 && info.overlapped == 0)
+        {
+            return;
+        }
+
+        streamer_printf(streamer_get(),
+                        "%-6s %-40s %8" PRIu32 " %6" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32
+                        " %10" PRIu32 "\r\n",
+                        info.source == HistogramBackend::Source::kMetric ? "metric" : "scope", info.name, info.latency.count,
+                        info.errors, info.overlapped, info.latency.min, info.latency.p50, info.latency.p90, info.latency.p99,
+                        info.latency.max);
+    });
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MetricsResetHandler(int argc, char ** argv)
+{
+    VerifyOrReturnError(sBackend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    sBackend->Reset();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+void RegisterShellCommands(HistogramBackend & backend)
+{
+    static constexpr Command subCommands[] = {
+        { &MetricsDumpHandler, "dump", "Print latency percentiles of metrics and trace scopes" },
+        { &MetricsResetHandler, "reset", "Clear recorded latencies" },
+    };
+
+    static constexpr Command metricsCommand = { &SubShellCommand<MATTER_ARRAY_SIZE(subCommands), subCommands>, "metrics",
+                                                "Latency metrics commands" };
+
+    sBackend = &backend;
+    Engine::Root().RegisterCommands(&metricsCommand, 1);
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <tracing/histogram/latency_histogram.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+size_t LatencyHistogram::BucketIndex(uint32_t value)
+{
+    if (value < kSubBuckets)
+    {
+        return value;
+    }
+
+    // Position of the most significant bit, at least kSubBucketBits here
+    unsigned msb = kSubBucketBits;
+    while ((value >> msb) > 1)
+    {
+        msb++;
+    }
+
+    unsigned shift = msb - kSubBucketBits;
+    return (shift + 1) * kSubBuckets + ((value >> shift) - kSubBuckets);
+}
+
+uint32_t LatencyHistogram::BucketUpperBound(size_t index)
+{
+    if (index < kSubBuckets)
+    {
+        return static_cast<uint32_t>(index);
+    }
+
+    unsigned shift = static_cast<unsigned>(index / kSubBuckets) - 1;
+    uint64_t lower = static_cast<uint64_t>(kSubBuckets + index % kSubBuckets) << shift;
+    return static_cast<uint32_t>(std::min<uint64_t>(lower + (uint64_t(1) << shift) - 1, UINT32_MAX));
+}
+
+void LatencyHistogram::Record(uint64_t valueUs)
+{
+    const uint32_t value = static_cast<uint32_t>(std::min<uint64_t>(valueUs, UINT32_MAX));
+
+    mBuckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    mSum.fetch_add(value, std::memory_order_relaxed);
+
+    uint32_t current = mMin.load(std::memory_order_relaxed);
+    while (value < current && !mMin.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+
+    current = mMax.load(std::memory_order_relaxed);
+    while (value > current && !mMax.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+
+    // Counted last, so that a snapshot never sees a count without the corresponding bucket
+    mCount.fetch_add(1, std::memory_order_release);
+}
+
+void LatencyHistogram::Reset()
+{
+    mCount.store(0, std::memory_order_relaxed);
+    for (auto & bucket : mBuckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    mSum.store(0, std::memory_order_relaxed);
+    mMin.store(UINT32_MAX, std::memory_order_relaxed);
+    mMax.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::CopyBuckets(uint32_t (&buckets)[kBucketCount]) const
+{
+    uint64_t total = 0;
+    for (size_t i = 0; i < kBucketCount; i++)
+    {
+        buckets[i] = mBuckets[i].load(std::memory_order_relaxed);
+        total += buckets[i];
+    }
+    return total;
+}
+
+uint32_t LatencyHistogram::ValueAtPercentile(const uint32_t (&buckets)[kBucketCount], uint64_t total, double percentile) const
+{
+    VerifyOrReturnValue(total > 0, 0);
+
+    percentile      = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t target = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(total) + 0.5);
+    target          = std::max<uint64_t>(target, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; i++)
+    {
+        seen += buckets[i];
+        if (seen >= target)
+        {
+            return std::min(BucketUpperBound(i), mMax.load(std::memory_order_relaxed));
+        }
+    }
+
+    return mMax.load(std::memory_order_relaxed);
+}
+
+uint32_t LatencyHistogram::ValueAtPercentile(double percentile) const
+{
+    uint32_t buckets[kBucketCount];
+    uint64_t total = CopyBuckets(buckets);
+    return ValueAtPercentile(buckets, total, percentile);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::GetSnapshot() const
+{
+    Snapshot snapshot;
+
+    VerifyOrReturnValue(mCount.load(std::memory_order_acquire) > 0, snapshot);
+
+    uint32_t buckets[kBucketCount];
+    uint64_t total = CopyBuckets(buckets);
+    VerifyOrReturnValue(total > 0, snapshot);
+
+    snapshot.count = static_cast<uint32_t>(std::min<uint64_t>(total, UINT32_MAX));
+    snapshot.min   = std::min(mMin.load(std::memory_order_relaxed), mMax.load(std::memory_order_relaxed));
+    snapshot.max   = mMax.load(std::memory_order_relaxed);
+    snapshot.mean  = static_cast<uint32_t>(mSum.load(std::memory_order_relaxed) / total);
+    snapshot.p50   = ValueAtPercentile(buckets, total, 50.0);
+    snapshot.p90   = ValueAtPercentile(buckets, total, 90.0);
+    snapshot.p99   = ValueAtPercentile(buckets, total, 99.0);
+    snapshot.p999  = ValueAtPercentile(buckets, total, 99.9);
+
+    return snapshot;
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,90 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+/// A log-linear latency histogram in the style of HdrHistogram.
+///
+/// Values are durations in microseconds. Every power of two range is split into kSubBuckets
+/// linear buckets, so a recorded value is reported with a relative error of at most
+/// 1/kSubBuckets (6.25%). Values that do not fit in 32 bits are clamped.
+///
+/// Recording is lock-free and does not allocate. Snapshots may be taken while other threads
+/// record; a snapshot taken that way may miss samples recorded concurrently with it.
+class LatencyHistogram
+{
+public:
+    static constexpr unsigned kSubBucketBits = 4;
+    static constexpr unsigned kSubBuckets    = 1u << kSubBucketBits;
+    static constexpr unsigned kMaxValueBits  = 32;
+    static constexpr size_t kBucketCount     = (kMaxValueBits - kSubBucketBits + 1) * kSubBuckets;
+
+    struct Snapshot
+    {
+        uint32_t count = 0;
+        uint32_t min   = 0;
+        uint32_t max   = 0;
+        uint32_t mean  = 0;
+        uint32_t p50   = 0;
+        uint32_t p90   = 0;
+        uint32_t p99   = 0;
+        uint32_t p999  = 0;
+    };
+
+    LatencyHistogram() = default;
+
+    LatencyHistogram(const LatencyHistogram &)             = delete;
+    LatencyHistogram & operator=(const LatencyHistogram &) = delete;
+
+    void Record(uint64_t valueUs);
+
+    /// Forget all recorded values.
+    void Reset();
+
+    uint32_t Count() const { return mCount.load(std::memory_order_relaxed); }
+
+    Snapshot GetSnapshot() const;
+
+    /// Returns the highest value that is equivalent to the value at the given percentile
+    /// (0 to 100), clamped to the maximum recorded value. Returns 0 if nothing was recorded.
+    uint32_t ValueAtPercentile(double percentile) const;
+
+    static size_t BucketIndex(uint32_t value);
+    static uint32_t BucketUpperBound(size_t index);
+
+private:
+    uint32_t ValueAtPercentile(const uint32_t (&buckets)[kBucketCount], uint64_t total, double percentile) const;
+    uint64_t CopyBuckets(uint32_t (&buckets)[kBucketCount]) const;
+
+    std::atomic<uint32_t> mBuckets[kBucketCount] = {};
+    std::atomic<uint32_t> mCount{ 0 };
+    std::atomic<uint64_t> mSum{ 0 };
+    std::atomic<uint32_t> mMin{ UINT32_MAX };
+    std::atomic<uint32_t> mMax{ 0 };
+};
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
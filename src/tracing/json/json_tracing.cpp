@@ -466,7 +466,7 @@ CHIP_ERROR JsonBackend::OpenFile(const char * path)
     std::error_code ec;
     std::filesystem::path filePath(path);
     // Create directories if they don't exist
-    if (!std::filesystem::create_directories(filePath.remove_filename(), ec))
+    if (!std::filesystem::create_directories(filePath.remove_filename(), ec) && ec)
     {
         return CHIP_ERROR_POSIX(ec.value());
     }
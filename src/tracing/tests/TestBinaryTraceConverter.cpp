@@ -0,0 +1,184 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <lib/support/TypeTraits.h>
+#include <tracing/binary/binary_trace_converter.h>
+#include <tracing/binary/binary_trace_format.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+using namespace chip;
+using namespace chip::Tracing::Binary;
+using Format::RecordType;
+
+namespace {
+
+class TestBinaryTraceConverter : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        mInput  = tmpfile();
+        mOutput = tmpfile();
+        ASSERT_NE(mInput, nullptr);
+        ASSERT_NE(mOutput, nullptr);
+    }
+
+    void TearDown() override
+    {
+        fclose(mInput);
+        fclose(mOutput);
+    }
+
+protected:
+    void WriteHeader(uint16_t version = Format::kVersion)
+    {
+        Format::FileHeader header;
+        memcpy(header.magic, Format::kMagic, sizeof(header.magic));
+        header.byteOrderMark = Format::kByteOrderMark;
+        header.version       = version;
+        header.recordSize    = sizeof(Format::Record);
+        fwrite(&header, sizeof(header), 1, mInput);
+    }
+
+    void WriteString(uint16_t id, const char * text)
+    {
+        Format::Record record = {};
+        record.value          = static_cast<uint32_t>(strlen(text));
+        record.label          = id;
+        record.group          = Format::kNoString;
+        record.type           = to_underlying(RecordType::kString);
+        fwrite(&record, sizeof(record), 1, mInput);
+        fwrite(text, 1, record.value, mInput);
+    }
+
+    void WriteRecord(RecordType type, uint64_t timestampNs, uint32_t threadId, uint16_t label)
+    {
+        Format::Record record = {};
+        record.timestampNs    = timestampNs;
+        record.threadId       = threadId;
+        record.label          = label;
+        record.group          = Format::kNoString;
+        record.type           = to_underlying(type);
+        fwrite(&record, sizeof(record), 1, mInput);
+    }
+
+    bool Convert()
+    {
+        rewind(mInput);
+        return ConvertToChromeJson(mInput, mOutput);
+    }
+
+    std::string Output()
+    {
+        std::string output;
+        rewind(mOutput);
+        char buffer[256];
+        size_t read;
+        while ((read = fread(buffer, 1, sizeof(buffer), mOutput)) > 0)
+        {
+            output.append(buffer, read);
+        }
+        return output;
+    }
+
+    FILE * mInput  = nullptr;
+    FILE * mOutput = nullptr;
+};
+
+TEST_F(TestBinaryTraceConverter, TestTimestampsStartAtEarliestEvent)
+{
+    // Each thread's records are flushed together, so thread 2 started before the first record in the file
+    WriteHeader();
+    WriteString(0, "Event");
+    WriteRecord(RecordType::kBegin, 5000, 1, 0);
+    WriteRecord(RecordType::kEnd, 7500, 1, 0);
+    WriteRecord(RecordType::kBegin, 1000, 2, 0);
+    WriteRecord(RecordType::kEnd, 2000, 2, 0);
+
+    ASSERT_TRUE(Convert());
+
+    const std::string output = Output();
+    EXPECT_NE(output.find("\"ts\":4.000,\"pid\":1,\"tid\":1"), std::string::npos);
+    EXPECT_NE(output.find("\"ts\":6.500,\"pid\":1,\"tid\":1"), std::string::npos);
+    EXPECT_NE(output.find("\"ts\":0.000,\"pid\":1,\"tid\":2"), std::string::npos);
+    EXPECT_NE(output.find("\"ts\":1.000,\"pid\":1,\"tid\":2"), std::string::npos);
+    EXPECT_EQ(output.find("\"ts\":18446744"), std::string::npos);
+}
+
+TEST_F(TestBinaryTraceConverter, TestStringsAndUnknownRecords)
+{
+    WriteHeader();
+    WriteString(3, "Quote\"Line\n");
+    WriteRecord(static_cast<RecordType>(200), 100, 1, 3);
+    WriteRecord(RecordType::kInstant, 100, 1, 3);
+    WriteRecord(RecordType::kInstant, 100, 1, 4);
+
+    ASSERT_TRUE(Convert());
+
+    const std::string output = Output();
+    EXPECT_NE(output.find("\"name\":\"Quote\\\"Line\\u000a\""), std::string::npos);
+    EXPECT_NE(output.find("\"name\":\"<unknown>\""), std::string::npos);
+
+    // The unknown record type is skipped
+    size_t events = 0;
+    for (size_t pos = output.find("\"ph\":"); pos != std::string::npos; pos = output.find("\"ph\":", pos + 1))
+    {
+        events++;
+    }
+    EXPECT_EQ(events, 2u);
+}
+
+TEST_F(TestBinaryTraceConverter, TestTruncatedTrace)
+{
+    WriteHeader();
+    WriteString(0, "Event");
+    WriteRecord(RecordType::kInstant, 100, 1, 0);
+
+    // A string definition cut short by the end of the file
+    Format::Record record = {};
+    record.value          = 64;
+    record.label          = 1;
+    record.type           = to_underlying(RecordType::kString);
+    fwrite(&record, sizeof(record), 1, mInput);
+    fwrite("Cut", 1, 3, mInput);
+
+    ASSERT_TRUE(Convert());
+
+    const std::string output = Output();
+    EXPECT_NE(output.find("\"name\":\"Event\""), std::string::npos);
+    EXPECT_EQ(output.substr(output.size() - 4), "\n]}\n");
+}
+
+TEST_F(TestBinaryTraceConverter, TestRejectsOtherFiles)
+{
+    fputs("{\"traceEvents\":[]}", mInput);
+    EXPECT_FALSE(Convert());
+}
+
+TEST_F(TestBinaryTraceConverter, TestRejectsOtherVersions)
+{
+    WriteHeader(Format::kVersion + 1);
+    EXPECT_FALSE(Convert());
+}
+
+} // namespace
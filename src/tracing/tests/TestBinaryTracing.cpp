@@ -0,0 +1,296 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+#include <tracing/binary/binary_trace_format.h>
+#include <tracing/binary/binary_tracing.h>
+#include <tracing/metric_event.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+namespace {
+
+using Format::RecordType;
+
+constexpr char kLabel[]   = "TestLabel";
+constexpr char kGroup[]   = "TestGroup";
+constexpr char kInstant[] = "TestInstant";
+constexpr char kCounter[] = "TestCounter";
+constexpr char kMetric[]  = "test_metric";
+
+constexpr uint32_t kRecordsPerThread = BinaryBackend::kRecordsPerThread;
+
+struct ParsedTrace
+{
+    bool valid = false;
+    std::map<uint16_t, std::string> strings;
+    size_t stringDefinitions = 0;
+    std::vector<Format::Record> records; // Everything but the string definitions
+
+    std::string String(uint16_t id) const
+    {
+        auto it = strings.find(id);
+        return it != strings.end() ? it->second : std::string();
+    }
+};
+
+ParsedTrace ReadTrace(const char * path)
+{
+    ParsedTrace trace;
+
+    FILE * file = fopen(path, "rb");
+    VerifyOrReturnValue(file != nullptr, trace);
+
+    Format::FileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, Format::kMagic, sizeof(header.magic)) != 0 ||
+        header.version != Format::kVersion || header.recordSize != sizeof(Format::Record))
+    {
+        fclose(file);
+        return trace;
+    }
+
+    trace.valid = true;
+    Format::Record record;
+    while (fread(&record, sizeof(record), 1, file) == 1)
+    {
+        if (static_cast<RecordType>(record.type) != RecordType::kString)
+        {
+            trace.records.push_back(record);
+            continue;
+        }
+
+        std::string text(record.value, '\0');
+        if (record.value != 0 && fread(&text[0], 1, record.value, file) != record.value)
+        {
+            trace.valid = false;
+            break;
+        }
+        trace.strings[record.label] = text;
+        trace.stringDefinitions++;
+    }
+
+    fclose(file);
+    return trace;
+}
+
+} // namespace
+
+class TestBinaryTracing : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        for (auto & path : mPaths)
+        {
+            strcpy(path, "/tmp/chip-binary-trace-XXXXXX");
+            const int fd = mkstemp(path);
+            ASSERT_GE(fd, 0);
+            close(fd);
+        }
+    }
+
+    void TearDown() override
+    {
+        for (auto & path : mPaths)
+        {
+            unlink(path);
+        }
+    }
+
+protected:
+    // Leaves flushing to the test, so that what is in the ring buffers does not depend on timing
+    static void StopBackgroundFlush(BinaryBackend & backend) { backend.mFlushInBackground = false; }
+    static void Flush(BinaryBackend & backend) { backend.Flush(); }
+
+    static void RecordMetricValues(BinaryBackend & backend, uint32_t first, uint32_t count)
+    {
+        for (uint32_t value = first; value < first + count; value++)
+        {
+            backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetric, value));
+        }
+    }
+
+    char mPaths[2][32];
+};
+
+TEST_F(TestBinaryTracing, TestRecordsAndInterning)
+{
+    BinaryBackend backend;
+    ASSERT_EQ(backend.OpenFile(mPaths[0]), CHIP_NO_ERROR);
+
+    backend.TraceBegin(kLabel, kGroup);
+    backend.TraceInstant(kInstant, kGroup);
+    backend.TraceEnd(kLabel, kGroup);
+    backend.TraceCounter(kCounter);
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kMetric, CHIP_ERROR_TIMEOUT));
+    backend.CloseFile();
+
+    ParsedTrace trace = ReadTrace(mPaths[0]);
+    ASSERT_TRUE(trace.valid);
+    ASSERT_EQ(trace.records.size(), 5u);
+
+    // Strings are defined once per file, however often they are used
+    EXPECT_EQ(trace.stringDefinitions, 5u);
+    EXPECT_EQ(trace.strings.size(), 5u);
+
+    const Format::Record & begin = trace.records[0];
+    EXPECT_EQ(begin.type, to_underlying(RecordType::kBegin));
+    EXPECT_EQ(trace.String(begin.label), kLabel);
+    EXPECT_EQ(trace.String(begin.group), kGroup);
+    EXPECT_NE(begin.threadId, 0u);
+
+    const Format::Record & instant = trace.records[1];
+    EXPECT_EQ(instant.type, to_underlying(RecordType::kInstant));
+    EXPECT_EQ(trace.String(instant.label), kInstant);
+    EXPECT_EQ(instant.group, begin.group);
+
+    const Format::Record & end = trace.records[2];
+    EXPECT_EQ(end.type, to_underlying(RecordType::kEnd));
+    EXPECT_EQ(end.label, begin.label);
+    EXPECT_GE(end.timestampNs, begin.timestampNs);
+
+    const Format::Record & counter = trace.records[3];
+    EXPECT_EQ(counter.type, to_underlying(RecordType::kCounter));
+    EXPECT_EQ(trace.String(counter.label), kCounter);
+    EXPECT_EQ(counter.group, Format::kNoString);
+
+    const Format::Record & metric = trace.records[4];
+    EXPECT_EQ(metric.type, to_underlying(RecordType::kMetricEnd));
+    EXPECT_EQ(trace.String(metric.label), kMetric);
+    EXPECT_EQ(metric.valueType, to_underlying(Format::MetricValueType::kChipErrorCode));
+    EXPECT_EQ(metric.value, CHIP_ERROR_TIMEOUT.AsInteger());
+
+    for (const auto & record : trace.records)
+    {
+        EXPECT_EQ(record.threadId, begin.threadId);
+    }
+}
+
+TEST_F(TestBinaryTracing, TestRingBufferWraparound)
+{
+    BinaryBackend backend;
+    StopBackgroundFlush(backend);
+    ASSERT_EQ(backend.OpenFile(mPaths[0]), CHIP_NO_ERROR);
+
+    // Batches of 3/4 of the ring, so that the second one wraps around its end
+    constexpr uint32_t kBatch   = kRecordsPerThread / 4 * 3;
+    constexpr uint32_t kBatches = 3;
+    for (uint32_t batch = 0; batch < kBatches; batch++)
+    {
+        RecordMetricValues(backend, batch * kBatch, kBatch);
+        Flush(backend);
+    }
+    backend.CloseFile();
+
+    ParsedTrace trace = ReadTrace(mPaths[0]);
+    ASSERT_TRUE(trace.valid);
+    ASSERT_EQ(trace.records.size(), kBatch * kBatches);
+    for (uint32_t i = 0; i < trace.records.size(); i++)
+    {
+        EXPECT_EQ(trace.records[i].type, to_underlying(RecordType::kMetricInstant));
+        EXPECT_EQ(trace.records[i].value, i);
+    }
+}
+
+TEST_F(TestBinaryTracing, TestDropAccounting)
+{
+    BinaryBackend backend;
+    StopBackgroundFlush(backend);
+    ASSERT_EQ(backend.OpenFile(mPaths[0]), CHIP_NO_ERROR);
+
+    constexpr uint32_t kDropped = 5;
+    RecordMetricValues(backend, 0, kRecordsPerThread + kDropped);
+    Flush(backend);
+
+    // Drops are reported once, by the flush that follows them
+    RecordMetricValues(backend, kRecordsPerThread + kDropped, 1);
+    backend.CloseFile();
+
+    ParsedTrace trace = ReadTrace(mPaths[0]);
+    ASSERT_TRUE(trace.valid);
+    ASSERT_EQ(trace.records.size(), kRecordsPerThread + 2);
+
+    // The oldest records are kept and the newest dropped
+    for (uint32_t i = 0; i < kRecordsPerThread; i++)
+    {
+        EXPECT_EQ(trace.records[i].value, i);
+    }
+
+    const Format::Record & dropped = trace.records[kRecordsPerThread];
+    EXPECT_EQ(dropped.type, to_underlying(RecordType::kDropped));
+    EXPECT_EQ(dropped.value, kDropped);
+    EXPECT_EQ(dropped.threadId, trace.records[0].threadId);
+
+    const Format::Record & last = trace.records[kRecordsPerThread + 1];
+    EXPECT_EQ(last.type, to_underlying(RecordType::kMetricInstant));
+    EXPECT_EQ(last.value, kRecordsPerThread + kDropped);
+}
+
+TEST_F(TestBinaryTracing, TestReopen)
+{
+    BinaryBackend backend;
+
+    ASSERT_EQ(backend.OpenFile(mPaths[0]), CHIP_NO_ERROR);
+    backend.TraceInstant(kInstant, kGroup);
+    backend.CloseFile();
+
+    // Nothing is recorded while no file is open
+    backend.TraceInstant(kLabel, kGroup);
+
+    ASSERT_EQ(backend.OpenFile(mPaths[1]), CHIP_NO_ERROR);
+    backend.TraceInstant(kInstant, kGroup);
+    backend.TraceCounter(kCounter);
+    backend.CloseFile();
+
+    ParsedTrace first = ReadTrace(mPaths[0]);
+    ASSERT_TRUE(first.valid);
+    ASSERT_EQ(first.records.size(), 1u);
+    EXPECT_EQ(first.String(first.records[0].label), kInstant);
+
+    // Every file defines the strings it uses, including those already defined in an earlier file
+    ParsedTrace second = ReadTrace(mPaths[1]);
+    ASSERT_TRUE(second.valid);
+    ASSERT_EQ(second.records.size(), 2u);
+    EXPECT_EQ(second.String(second.records[0].label), kInstant);
+    EXPECT_EQ(second.String(second.records[0].group), kGroup);
+    EXPECT_EQ(second.String(second.records[1].label), kCounter);
+    EXPECT_EQ(second.records[0].threadId, first.records[0].threadId);
+}
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,242 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemClock.h>
+#include <tracing/histogram/histogram_backend.h>
+#include <tracing/histogram/latency_histogram.h>
+#include <tracing/macros.h>
+#include <tracing/metric_event.h>
+#include <tracing/registry.h>
+
+#include <cstring>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Histogram;
+
+namespace {
+
+constexpr char kMetricKey[]  = "test_metric";
+constexpr char kScopeLabel[] = "TestScope";
+constexpr char kScopeGroup[] = "Test";
+
+class TestLatencyHistogram : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+    }
+
+    void TearDown() override { System::Clock::Internal::SetSystemClockForTesting(mRealClock); }
+
+protected:
+    void AdvanceMicroseconds(uint64_t us) { mMockClock.mSystemTime += System::Clock::Microseconds64(us); }
+
+    static HistogramBackend::HistogramInfo FindInfo(const HistogramBackend & backend, const char * name)
+    {
+        HistogramBackend::HistogramInfo result = {};
+        backend.ForEachSnapshot([&](const HistogramBackend::HistogramInfo & info) {
+            if (strcmp(info.name, name) == 0)
+            {
+                result = info;
+            }
+        });
+        return result;
+    }
+
+    System::Clock::Internal::MockClock mMockClock;
+    System::Clock::ClockBase * mRealClock;
+};
+
+TEST_F(TestLatencyHistogram, TestBucketBoundaries)
+{
+    // Small values have exact buckets
+    for (uint32_t value = 0; value < LatencyHistogram::kSubBuckets; value++)
+    {
+        EXPECT_EQ(LatencyHistogram::BucketIndex(value), value);
+        EXPECT_EQ(LatencyHistogram::BucketUpperBound(value), value);
+    }
+
+    // Every value lies within its bucket and within 1/16 of its upper bound
+    for (uint32_t value : { 16u, 17u, 31u, 32u, 33u, 1000u, 65535u, 65536u, 123456789u, UINT32_MAX })
+    {
+        size_t index   = LatencyHistogram::BucketIndex(value);
+        uint32_t upper = LatencyHistogram::BucketUpperBound(index);
+        ASSERT_LT(index, LatencyHistogram::kBucketCount);
+        EXPECT_GE(upper, value);
+        EXPECT_LE(upper - value, value / LatencyHistogram::kSubBuckets);
+        EXPECT_LT(LatencyHistogram::BucketUpperBound(index - 1), value);
+    }
+
+    EXPECT_EQ(LatencyHistogram::BucketIndex(UINT32_MAX), LatencyHistogram::kBucketCount - 1);
+}
+
+TEST_F(TestLatencyHistogram, TestPercentiles)
+{
+    LatencyHistogram histogram;
+
+    EXPECT_EQ(histogram.GetSnapshot().count, 0u);
+    EXPECT_EQ(histogram.ValueAtPercentile(50), 0u);
+
+    for (uint32_t value = 1; value <= 1000; value++)
+    {
+        histogram.Record(value);
+    }
+
+    LatencyHistogram::Snapshot snapshot = histogram.GetSnapshot();
+    EXPECT_EQ(snapshot.count, 1000u);
+    EXPECT_EQ(snapshot.min, 1u);
+    EXPECT_EQ(snapshot.max, 1000u);
+    EXPECT_EQ(snapshot.mean, 500u);
+
+    // Percentiles are accurate to a bucket, i.e. 1/16 of the value
+    EXPECT_GE(snapshot.p50, 500u);
+    EXPECT_LE(snapshot.p50, 500u + 500u / 16);
+    EXPECT_GE(snapshot.p99, 990u);
+    EXPECT_LE(snapshot.p99, 1000u);
+    EXPECT_EQ(snapshot.p999, 1000u);
+
+    // Values that do not fit 32 bits are clamped
+    histogram.Record(uint64_t(1) << 40);
+    EXPECT_EQ(histogram.GetSnapshot().max, UINT32_MAX);
+
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetSnapshot().count, 0u);
+    EXPECT_EQ(histogram.GetSnapshot().max, 0u);
+}
+
+TEST_F(TestLatencyHistogram, TestMetricLatency)
+{
+    HistogramBackend backend;
+    ScopedRegistration registration(backend);
+
+    for (uint64_t duration : { 100u, 200u, 300u })
+    {
+        MATTER_LOG_METRIC_BEGIN(kMetricKey);
+        AdvanceMicroseconds(duration);
+        MATTER_LOG_METRIC_END(kMetricKey, CHIP_NO_ERROR);
+    }
+
+    // Failures are counted, not timed
+    MATTER_LOG_METRIC_BEGIN(kMetricKey);
+    AdvanceMicroseconds(5000);
+    MATTER_LOG_METRIC_END(kMetricKey, CHIP_ERROR_TIMEOUT);
+
+    // An end without a begin is ignored
+    MATTER_LOG_METRIC_END(kMetricKey);
+
+    HistogramBackend::HistogramInfo info = FindInfo(backend, kMetricKey);
+    EXPECT_EQ(info.source, HistogramBackend::Source::kMetric);
+    EXPECT_EQ(info.errors, 1u);
+    EXPECT_EQ(info.latency.count, 3u);
+    EXPECT_EQ(info.latency.min, 100u);
+    EXPECT_EQ(info.latency.max, 300u);
+
+    backend.Reset();
+    info = FindInfo(backend, kMetricKey);
+    EXPECT_EQ(info.errors, 0u);
+    EXPECT_EQ(info.latency.count, 0u);
+}
+
+TEST_F(TestLatencyHistogram, TestOverlappingMetrics)
+{
+    HistogramBackend backend;
+    ScopedRegistration registration(backend);
+
+    // Neither duration can be attributed to its begin, so both are counted as overlapped
+    MATTER_LOG_METRIC_BEGIN(kMetricKey);
+    AdvanceMicroseconds(100);
+    MATTER_LOG_METRIC_BEGIN(kMetricKey);
+    AdvanceMicroseconds(10);
+    MATTER_LOG_METRIC_END(kMetricKey, CHIP_NO_ERROR);
+    AdvanceMicroseconds(10);
+    MATTER_LOG_METRIC_END(kMetricKey, CHIP_ERROR_TIMEOUT);
+
+    HistogramBackend::HistogramInfo info = FindInfo(backend, kMetricKey);
+    EXPECT_EQ(info.overlapped, 1u);
+    EXPECT_EQ(info.errors, 1u);
+    EXPECT_EQ(info.latency.count, 0u);
+
+    // Once all have ended, timing resumes
+    MATTER_LOG_METRIC_BEGIN(kMetricKey);
+    AdvanceMicroseconds(40);
+    MATTER_LOG_METRIC_END(kMetricKey, CHIP_NO_ERROR);
+
+    info = FindInfo(backend, kMetricKey);
+    EXPECT_EQ(info.overlapped, 1u);
+    EXPECT_EQ(info.latency.count, 1u);
+    EXPECT_EQ(info.latency.max, 40u);
+
+    backend.Reset();
+    EXPECT_EQ(FindInfo(backend, kMetricKey).overlapped, 0u);
+
+    // An operation that never ends is forgotten by Reset, so the next one is timed
+    MATTER_LOG_METRIC_BEGIN(kMetricKey);
+    backend.Reset();
+    MATTER_LOG_METRIC_BEGIN(kMetricKey);
+    AdvanceMicroseconds(70);
+    MATTER_LOG_METRIC_END(kMetricKey, CHIP_NO_ERROR);
+
+    info = FindInfo(backend, kMetricKey);
+    EXPECT_EQ(info.overlapped, 0u);
+    EXPECT_EQ(info.latency.count, 1u);
+    EXPECT_EQ(info.latency.max, 70u);
+}
+
+TEST_F(TestLatencyHistogram, TestScopeLatency)
+{
+    HistogramBackend backend;
+    ScopedRegistration registration(backend);
+
+    {
+        MATTER_TRACE_SCOPE(kScopeLabel, kScopeGroup);
+        AdvanceMicroseconds(50);
+        {
+            MATTER_TRACE_SCOPE(kMetricKey, kScopeGroup);
+            AdvanceMicroseconds(25);
+        }
+    }
+
+    HistogramBackend::HistogramInfo outer = FindInfo(backend, kScopeLabel);
+    EXPECT_EQ(outer.source, HistogramBackend::Source::kScope);
+    EXPECT_STREQ(outer.group, kScopeGroup);
+    EXPECT_EQ(outer.latency.count, 1u);
+    EXPECT_EQ(outer.latency.max, 75u);
+
+    // Scopes are tracked apart from metrics with the same name
+    bool foundInnerScope = false;
+    backend.ForEachSnapshot([&](const HistogramBackend::HistogramInfo & info) {
+        if (info.source == HistogramBackend::Source::kScope && strcmp(info.name, kMetricKey) == 0)
+        {
+            foundInnerScope = true;
+            EXPECT_EQ(info.latency.max, 25u);
+        }
+    });
+    EXPECT_TRUE(foundInnerScope);
+}
+
+} // namespace
@@ -228,16 +228,7 @@ public:
 
     // Called when AddNOC has gone through sufficient success that we need to switch the
     // session to reflect a new fabric if it was a PASE session
-    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex)
-    {
-        // It's not legal to augment session type for non-PASE
-        if (mSecureSessionType != Type::kPASE)
-        {
-            return CHIP_ERROR_INVALID_ARGUMENT;
-        }
-        SetFabricIndex(fabricIndex);
-        return CHIP_NO_ERROR;
-    }
+    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex);
 
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     System::Clock::Timestamp GetLastPeerActivityTime() const { return mLastPeerActivityTime; }
@@ -332,6 +323,7 @@ private:
     void MoveToState(State targetState);
 
     friend class SecureSessionDeleter;
+    friend class SecureSessionTable;
     friend class TestSecureSessionTable;
 
     SecureSessionTable & mTable;
@@ -355,6 +347,10 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+
+    // Links for the SecureSessionTable local session ID and peer indexes.
+    SecureSession * mNextInLocalIdBucket = nullptr;
+    SecureSession * mNextInPeerBucket    = nullptr;
 };
 
 } // namespace Transport
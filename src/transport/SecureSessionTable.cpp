@@ -52,8 +52,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = AllocateSession(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs, peerSessionId,
+                                             fabricIndex, config);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,7 +73,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = AllocateSession(secureSessionType, sessionId.Value());
     }
     else
     {
@@ -216,7 +216,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = AllocateSession(secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -339,20 +339,82 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
+    SecureSession * result = FindSessionByLocalId(localSessionId);
+    return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
+}
+
+SecureSession * SecureSessionTable::FindSessionByLocalId(uint16_t localSessionId) const
+{
+    for (SecureSession * session = mLocalIdIndex[LocalIdBucketFor(localSessionId)]; session != nullptr;
+         session                 = session->mNextInLocalIdBucket)
+    {
         if (session->GetLocalSessionId() == localSessionId)
         {
-            result = session;
-            return Loop::Break;
+            return session;
         }
-        return Loop::Continue;
-    });
-    return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
+    }
+    return nullptr;
+}
+
+void SecureSessionTable::AddToLocalIdIndex(SecureSession * session)
+{
+    SecureSession *& head         = mLocalIdIndex[LocalIdBucketFor(session->GetLocalSessionId())];
+    session->mNextInLocalIdBucket = head;
+    head                          = session;
+}
+
+void SecureSessionTable::RemoveFromLocalIdIndex(SecureSession * session)
+{
+    for (SecureSession ** link = &mLocalIdIndex[LocalIdBucketFor(session->GetLocalSessionId())]; *link != nullptr;
+         link                  = &(*link)->mNextInLocalIdBucket)
+    {
+        if (*link == session)
+        {
+            *link                         = session->mNextInLocalIdBucket;
+            session->mNextInLocalIdBucket = nullptr;
+            return;
+        }
+    }
+}
+
+void SecureSessionTable::AddToPeerIndex(SecureSession * session)
+{
+    SecureSession *& head      = mPeerIndex[PeerBucketFor(session->GetPeer())];
+    session->mNextInPeerBucket = head;
+    head                       = session;
+}
+
+void SecureSessionTable::RemoveFromPeerIndex(SecureSession * session)
+{
+    for (SecureSession ** link = &mPeerIndex[PeerBucketFor(session->GetPeer())]; *link != nullptr;
+         link                  = &(*link)->mNextInPeerBucket)
+    {
+        if (*link == session)
+        {
+            *link                      = session->mNextInPeerBucket;
+            session->mNextInPeerBucket = nullptr;
+            return;
+        }
+    }
+}
+
+void SecureSessionTable::ClearIndex()
+{
+    for (size_t i = 0; i < kIndexBucketCount; i++)
+    {
+        mLocalIdIndex[i] = nullptr;
+        mPeerIndex[i]    = nullptr;
+    }
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
+    // Fast path: session IDs are handed out sequentially, so the hint is almost always free.
+    if (mNextSessionId != kUnsecuredSessionId && FindSessionByLocalId(mNextSessionId) == nullptr)
+    {
+        return MakeOptional<uint16_t>(mNextSessionId);
+    }
+
     uint16_t candidate_base = 0;
     uint64_t candidate_mask = 0;
     for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
@@ -29,6 +29,19 @@ namespace Transport {
 inline constexpr uint16_t kMaxSessionID       = UINT16_MAX;
 inline constexpr uint16_t kUnsecuredSessionId = 0;
 
+namespace detail {
+constexpr size_t RoundUpToPowerOfTwo(size_t value, size_t result = 1)
+{
+    return result >= value ? result : RoundUpToPowerOfTwo(value, result * 2);
+}
+} // namespace detail
+
+/**
+ * Number of buckets in each of the SecureSessionTable indexes: the smallest power of two that is at least
+ * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, so that a bucket holds about one session on average.
+ */
+inline constexpr size_t kSecureSessionIndexBucketCount = detail::RoundUpToPowerOfTwo(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+
 /**
  * Handles a set of sessions.
  *
@@ -39,7 +52,11 @@ inline constexpr uint16_t kUnsecuredSessionId = 0;
 class SecureSessionTable
 {
 public:
-    ~SecureSessionTable() { mEntries.ReleaseAll(); }
+    ~SecureSessionTable()
+    {
+        mEntries.ReleaseAll();
+        ClearIndex();
+    }
 
     void Init() { mNextSessionId = chip::Crypto::GetRandU16(); }
 
@@ -76,7 +93,12 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        RemoveFromLocalIdIndex(session);
+        RemoveFromPeerIndex(session);
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +106,34 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Iterate over the sessions whose peer (as returned by SecureSession::GetPeer) matches the given one.
+     *
+     * Only the sessions in the peer index bucket for `peer` are visited, so the cost is independent of the
+     * total number of sessions in the table. The callback may release the session it is given.
+     *
+     * The callback must not change the peer of any session.
+     *
+     * @returns Loop::Break if the callback returned Loop::Break, Loop::Finish otherwise.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+        SecureSession * session = mPeerIndex[PeerBucketFor(peer)];
+        while (session != nullptr)
+        {
+            // Hold a reference while the callback runs so that the session stays linked into its bucket
+            // (and its successor link stays valid) even if the callback releases it.
+            SessionHandle ref(*session);
+            if (session->GetPeer() == peer && function(session) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+            session = session->mNextInPeerBucket;
+        }
+        return Loop::Finish;
+    }
+
     /**
      * Get a secure session given its session ID.
      *
@@ -100,17 +150,15 @@ public:
     void NewerSessionAvailable(SecureSession * session)
     {
         VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
-        mEntries.ForEachActiveObject([&](SecureSession * oldSession) {
+        ForEachSessionWithPeer(session->GetPeer(), [&](SecureSession * oldSession) {
             if (session == oldSession)
                 return Loop::Continue;
 
-            SessionHandle ref(*oldSession);
-
             // This will give all SessionHolders pointing to oldSession a chance to switch to the provided session
             //
             // See documentation for SessionDelegate::GetNewSessionHandlingPolicy about how session auto-shifting works, and how
             // to disable it for a specific SessionHolder in a specific scenario.
-            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE && oldSession->GetPeer() == session->GetPeer() &&
+            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE &&
                 oldSession->GetPeerCATs() == session->GetPeerCATs())
             {
                 oldSession->NewerSessionAvailable(SessionHandle(*session));
@@ -120,9 +168,56 @@ public:
         });
     }
 
+    /**
+     * Must be called by a session before its peer (node ID and/or fabric index) changes, together with
+     * OnSessionPeerChanged once the change has been made, so that the peer index stays consistent.
+     */
+    void OnSessionPeerChanging(SecureSession * session) { RemoveFromPeerIndex(session); }
+    void OnSessionPeerChanged(SecureSession * session) { AddToPeerIndex(session); }
+
 private:
     friend class TestSecureSessionTable;
 
+    static constexpr size_t kIndexBucketCount = kSecureSessionIndexBucketCount;
+
+    static size_t LocalIdBucketFor(uint16_t localSessionId)
+    {
+        // Local session IDs are handed out sequentially, so the low bits alone spread them evenly.
+        return localSessionId & (kIndexBucketCount - 1);
+    }
+
+    static size_t PeerBucketFor(const ScopedNodeId & peer)
+    {
+        uint64_t hash = peer.GetNodeId() ^ (static_cast<uint64_t>(peer.GetFabricIndex()) << 56);
+        // 64-bit finalizer from MurmurHash3, so that node IDs differing only in their high bits still spread.
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 33;
+        return static_cast<size_t>(hash) & (kIndexBucketCount - 1);
+    }
+
+    /**
+     * Allocate a session out of the pool and insert it into the session indexes.
+     */
+    template <typename... Args>
+    SecureSession * AllocateSession(Args &&... args)
+    {
+        SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+        if (session != nullptr)
+        {
+            AddToLocalIdIndex(session);
+            AddToPeerIndex(session);
+        }
+        return session;
+    }
+
+    SecureSession * FindSessionByLocalId(uint16_t localSessionId) const;
+    void AddToLocalIdIndex(SecureSession * session);
+    void RemoveFromLocalIdIndex(SecureSession * session);
+    void AddToPeerIndex(SecureSession * session);
+    void RemoveFromPeerIndex(SecureSession * session);
+    void ClearIndex();
+
     /**
      * This provides a sortable wrapper for a SecureSession object. A SecureSession
      * isn't directly sortable since it is not swappable (i.e meet criteria for ValueSwappable).
@@ -248,8 +343,9 @@ private:
      * from the starting mNextSessionId clue.
      *
      * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64) in the worst case.
+     * In the common case the session ID following mNextSessionId is free, which is detected
+     * with a single local session ID index lookup.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
@@ -274,6 +370,11 @@ private:
 #endif
 
     uint16_t mNextSessionId = 0;
+
+    // Heads of the intrusive bucket lists (linked through SecureSession::mNextInLocalIdBucket and
+    // SecureSession::mNextInPeerBucket) indexing the live sessions by local session ID and by peer.
+    SecureSession * mLocalIdIndex[kIndexBucketCount] = {};
+    SecureSession * mPeerIndex[kIndexBucketCount]    = {};
 };
 
 } // namespace Transport
@@ -581,9 +581,8 @@ void SessionManager::ExpireAllSecureSessions()
 
 void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Optional<Transport::SecureSession::Type> & type)
 {
-    mSecureSessions.ForEachSession([&node, &type](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == node &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+    mSecureSessions.ForEachSessionWithPeer(node, [&type](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             session->MarkAsDefunct();
         }
@@ -593,10 +592,10 @@ void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Opti
 
 void SessionManager::UpdateAllSessionsPeerAddress(const ScopedNodeId & node, const Transport::PeerAddress & addr)
 {
-    mSecureSessions.ForEachSession([&node, &addr](auto session) {
+    mSecureSessions.ForEachSessionWithPeer(node, [&addr](auto session) {
         // Arguably we should only be updating active and defunct sessions, but there is no harm
         // in updating evicted sessions.
-        if (session->GetPeer() == node && Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
+        if (Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
         {
             session->SetPeerAddress(addr);
         }
@@ -1110,6 +1109,37 @@ static bool GroupKeyDecryptAttempt(const PacketHeader & partialPacketHeader, Pac
     return decrypted;
 }
 
+/**
+ * Helper function to prepare the scratch copy of a groupcast message for a decryption attempt.
+ *
+ * Each attempt decodes and decrypts the copy in place, so it has to be restored from the received
+ * message before the next one. The buffer of the copy is reused across attempts whenever possible.
+ *
+ * @param[in] msg The received message
+ * @param[in,out] msgCopy The scratch copy, null before the first attempt
+ *
+ * @return false if a buffer for the copy could not be allocated
+ */
+static bool PrepareGroupMessageCopy(const System::PacketBufferHandle & msg, System::PacketBufferHandle & msgCopy)
+{
+    const size_t length = msg->DataLength();
+
+    if (!msgCopy.IsNull() && !msg->HasChainedBuffer() && !msgCopy->HasChainedBuffer())
+    {
+        // Keep the same reserved space in front of the data as the received message.
+        msgCopy->SetStart(msgCopy->Start() - msgCopy->ReservedSize() + msg->ReservedSize());
+        if (msgCopy->ReservedSize() == msg->ReservedSize() && msgCopy->MaxDataLength() >= length)
+        {
+            memcpy(msgCopy->Start(), msg->Start(), length);
+            msgCopy->SetDataLength(length);
+            return true;
+        }
+    }
+
+    msgCopy = msg.CloneData();
+    return !msgCopy.IsNull();
+}
+
 void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPacketHeader,
                                                 const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg)
 {
@@ -1160,9 +1190,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
     bool decrypted = false;
     while (!decrypted && iter->Next(groupContext))
     {
-        CryptoContext context(groupContext.keyContext);
-        msgCopy = msg.CloneData();
-        if (msgCopy.IsNull())
+        if (!PrepareGroupMessageCopy(msg, msgCopy))
         {
             ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
             return;
@@ -1176,8 +1204,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         if (privacy && !decrypted)
         {
             // Try processing the P=1 message again without privacy as a work-around for invalid early-SVE2 nodes.
-            msgCopy = msg.CloneData();
-            if (msgCopy.IsNull())
+            if (!PrepareGroupMessageCopy(msg, msgCopy))
             {
                 ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
                 return;
@@ -1284,13 +1311,12 @@ Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId pe
     SecureSession * tcpSession = nullptr;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    mSecureSessions.ForEachSession([&peerNodeId, &type, &mrpSession,
+    mSecureSessions.ForEachSessionWithPeer(peerNodeId, [&type, &mrpSession,
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &tcpSession,
+                                                        &tcpSession,
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &transportPayloadCapability](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == peerNodeId &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+                                                        &transportPayloadCapability](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             if (transportPayloadCapability == TransportPayloadCapability::kMRPOrTCPCompatiblePayload ||
                 transportPayloadCapability == TransportPayloadCapability::kLargePayload)
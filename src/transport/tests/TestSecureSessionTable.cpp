@@ -43,6 +43,7 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidateSessionIndexAcrossEviction();
 
 private:
     struct SessionParameters
@@ -452,6 +453,67 @@ void TestSecureSessionTable::ValidateSessionSorting()
     }
 }
 
+void TestSecureSessionTable::ValidateSessionIndexAcrossEviction()
+{
+    std::vector<SessionParameters> sessionParamList = {
+        { { 2, kFabric1 }, System::Clock::Timestamp(9), SecureSession::State::kActive },
+        { { 3, kFabric1 }, System::Clock::Timestamp(3), SecureSession::State::kActive },
+        { { 4, kFabric1 }, System::Clock::Timestamp(1), SecureSession::State::kActive },
+        { { 5, kFabric1 }, System::Clock::Timestamp(7), SecureSession::State::kActive },
+    };
+
+    CreateSessionTable(sessionParamList);
+
+    uint16_t evictedLocalSessionId = 0;
+    mSessionTable->ForEachSessionWithPeer(ScopedNodeId(4, kFabric1), [&](auto * session) {
+        evictedLocalSessionId = session->GetLocalSessionId();
+        return Loop::Break;
+    });
+    EXPECT_TRUE(mSessionTable->FindSecureSessionByLocalKey(evictedLocalSessionId).HasValue());
+
+    // The table is full, so this evicts the oldest session (the one to node 4).
+    auto newSession = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId(2, kFabric1));
+    ASSERT_TRUE(newSession.HasValue());
+    EXPECT_TRUE(mSessionList[2]->mSessionReleased);
+
+    EXPECT_FALSE(mSessionTable->FindSecureSessionByLocalKey(evictedLocalSessionId).HasValue());
+    EXPECT_EQ(mSessionTable->ForEachSessionWithPeer(ScopedNodeId(4, kFabric1), [](auto *) { return Loop::Break; }),
+              Loop::Finish);
+
+    // The new session is found by its local session ID, and moves to its peer's bucket once activated.
+    auto found = mSessionTable->FindSecureSessionByLocalKey(newSession.Value()->AsSecureSession()->GetLocalSessionId());
+    ASSERT_TRUE(found.HasValue());
+    EXPECT_EQ(found.Value()->AsSecureSession(), newSession.Value()->AsSecureSession());
+
+    newSession.Value()->AsSecureSession()->Activate(
+        ScopedNodeId(1, kFabric2), ScopedNodeId(6, kFabric2), CATValues(), 100,
+        ReliableMessageProtocolConfig(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                      System::Clock::Milliseconds16(0)));
+
+    int matches = 0;
+    mSessionTable->ForEachSessionWithPeer(ScopedNodeId(6, kFabric2), [&](auto * session) {
+        EXPECT_EQ(session, newSession.Value()->AsSecureSession());
+        matches++;
+        return Loop::Continue;
+    });
+    EXPECT_EQ(matches, 1);
+
+    // Every remaining session is still reachable through both indexes.
+    mSessionTable->ForEachSession([&](auto * session) {
+        EXPECT_TRUE(mSessionTable->FindSecureSessionByLocalKey(session->GetLocalSessionId()).HasValue());
+
+        bool foundByPeer = false;
+        mSessionTable->ForEachSessionWithPeer(session->GetPeer(), [&](auto * other) {
+            foundByPeer = foundByPeer || (other == session);
+            return Loop::Continue;
+        });
+        EXPECT_TRUE(foundByPeer);
+        return Loop::Continue;
+    });
+
+    newSession.Value()->AsSecureSession()->MarkForEviction();
+}
+
 TEST_F(TestSecureSessionTable, ValidateSessionSorting)
 {
     // This calls TestSecureSessionTable::ValidateSessionSorting instead of just doing the
@@ -461,5 +523,62 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+TEST_F(TestSecureSessionTable, ValidateSessionIndexAcrossEviction)
+{
+    ValidateSessionIndexAcrossEviction();
+}
+
+TEST_F(TestSecureSessionTable, ValidatePeerIndexFollowsFabricAdoption)
+{
+    SecureSessionTable table;
+    table.Init();
+
+    auto session = table.CreateNewSecureSession(SecureSession::Type::kPASE, ScopedNodeId());
+    ASSERT_TRUE(session.HasValue());
+
+    const ScopedNodeId pasePeer(NodeIdFromPAKEKeyId(kDefaultCommissioningPasscodeId), kUndefinedFabricIndex);
+    session.Value()->AsSecureSession()->Activate(
+        ScopedNodeId(), pasePeer, CATValues(), 1,
+        ReliableMessageProtocolConfig(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                      System::Clock::Milliseconds16(0)));
+    EXPECT_EQ(table.ForEachSessionWithPeer(pasePeer, [](auto *) { return Loop::Break; }), Loop::Break);
+
+    EXPECT_EQ(session.Value()->AsSecureSession()->AdoptFabricIndex(1), CHIP_NO_ERROR);
+    EXPECT_EQ(table.ForEachSessionWithPeer(pasePeer, [](auto *) { return Loop::Break; }), Loop::Finish);
+    EXPECT_EQ(table.ForEachSessionWithPeer(ScopedNodeId(pasePeer.GetNodeId(), 1), [](auto *) { return Loop::Break; }),
+              Loop::Break);
+
+    session.Value()->AsSecureSession()->MarkForEviction();
+}
+
+TEST_F(TestSecureSessionTable, ValidateLookupByLocalKeyFullTable)
+{
+    SecureSessionTable table;
+    table.Init();
+
+    for (uint16_t i = 0; i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE; i++)
+    {
+        auto session = table.CreateNewSecureSessionForTest(
+            SecureSession::Type::kCASE, static_cast<uint16_t>(i + 1), 1, static_cast<NodeId>(i + 2), CATValues(), i, 1,
+            ReliableMessageProtocolConfig(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                          System::Clock::Milliseconds16(0)));
+        ASSERT_TRUE(session.HasValue());
+    }
+
+    // Every session is found by its own local session ID, and nothing is found for an unused one.
+    for (uint16_t i = 0; i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE; i++)
+    {
+        auto found = table.FindSecureSessionByLocalKey(static_cast<uint16_t>(i + 1));
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_EQ(found.Value()->AsSecureSession()->GetLocalSessionId(), i + 1);
+    }
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(static_cast<uint16_t>(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE + 1)).HasValue());
+
+    table.ForEachSession([](auto * session) {
+        session->MarkForEviction();
+        return Loop::Continue;
+    });
+}
+
 } // namespace Transport
 } // namespace chip